@@ -1,76 +1,420 @@
+#define _GNU_SOURCE  // rand_r, clock_gettime
 #include <stdbool.h>
-#include <assert.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
 #include "../misc/player.h"
-#include "../main.h"
-#include "arena_opponent.h"
+#include "../handle_turn.h"
 #include "../misc/util.h"
+#include "../board/dead_boards.h"
+#include "../misc/trace.h"
+#include "elo.h"
+#include "worker_pool.h"
+#include "engine.h"
+#include "mcts_engine.h"
+#include "process_engine.h"
+#include "tournament.h"
 
 
 #define ROUNDS 4000
 #define TIME 0.05
+// Ends games as soon as their result can't change anymore, see getForcedWinner
+#define ADJUDICATE_DECIDED_GAMES true
+// Measures TIME and the time banks in CPU time of the thread that searches instead of wall time, so a game that has
+// to share its core still gets its full budget. More ARENA_WORKERS than CPUs then only makes every game take longer.
+// Time spent pondering isn't counted.
+#define THREAD_CPU_TIME false
+// Gives both sides a fixed amount of simulations per move instead of TIME, with jitter from a seed per game, which
+// makes the results reproducible. Time banks, adaptive time and pondering only apply to timed games.
+#define SIMULATIONS_PER_MOVE 0
+// Stops before ROUNDS games once the results show that the Elo difference of the candidate to the baseline is at most
+// SPRT_ELO0 or at least SPRT_ELO1, with error rates SPRT_ALPHA and SPRT_BETA
+#define USE_SPRT true
+#define SPRT_ELO0 0.0
+#define SPRT_ELO1 10.0
+#define SPRT_ALPHA 0.05
+#define SPRT_BETA 0.05
+// Games played at once, 0 for one per free core (more for engines that ponder)
+#define ARENA_WORKERS 0
+// Writes a timeline of the games, searches and pondering of every thread to this file, see trace.h
+#define TRACE_FILENAME NULL
+#define TRACE_EVENTS_PER_THREAD 1000000
 
+// The engine under test, whose side the results are from, and the one it gets compared against. See engine.h for
+// what they can differ in, a weight file of either one is loaded once and shared by all workers. Another program,
+// like a release build started with "play", can take either side:
+// {.name = "release", .interface = &processEngine, .command = "./UTTT2_release play 0.05", .moveTimeout = 0.1}
+EngineConfig candidateConfig = {.name = "candidate", .interface = &mctsEngine, .networkFilename = NULL,
+                                .usePUCT = false, .fastNetworkFilename = NULL, .evalCacheLog2Entries = 0,
+                                .adaptiveTime = false, .timeBank = 0, .ponder = false};
+EngineConfig baselineConfig = {.name = "baseline", .interface = &mctsEngine, .networkFilename = NULL,
+                               .usePUCT = false, .fastNetworkFilename = NULL, .evalCacheLog2Entries = 0,
+                               .adaptiveTime = false, .timeBank = 0, .ponder = false};
 
-Winner simulateSingleGame(bool weArePlayer1) {
-    Board* board = createBoard();
-    int rootIndex = createMCTSRootNode(board);
-    StateOpponent* stateOpponent = initializeStateOpponent();
+// runTournament plays TOURNAMENT_PAIRS game pairs for every pairing of these configs, with the settings above. A
+// gauntlet only pairs the first one with every other one.
+EngineConfig* tournamentConfigs[] = {&candidateConfig, &baselineConfig};
+#define TOURNAMENT_TYPE ROUND_ROBIN
+#define TOURNAMENT_PAIRS 100
+// Results get appended to this file as they come in, running the same tournament again continues where it stopped.
+// NULL to not keep them.
+#define TOURNAMENT_CHECKPOINT_FILENAME NULL
+
+typedef struct ArenaTally ArenaTally;
+
+// Every worker keeps its engines for all its games, a fresh 512 MB node pool per game costs a page fault per 4 KB
+typedef struct ArenaContext {
+    Engine* candidate;
+    Engine* baseline;
+    Board* referee;
+    ArenaTally* tally;
+} ArenaContext;
+
+
+// The referee only uses the state of its board, so its node pool never gets touched
+Winner playArenaGame(Engine* player1, Engine* player2, Board* referee, unsigned int seed) {
+    Engine* players[2] = {player1, player2};
+    resetEngine(player1);
+    resetEngine(player2);
+    resetBoard(referee);
     Square previousMove = {9, 9};
-    bool weAreCurrentPlayer = weArePlayer1;
-    while (board->state.winner == NONE && stateOpponent != NULL) {
-        if (weAreCurrentPlayer) {
-            previousMove = playTurn(board, &rootIndex, ((rand() / (RAND_MAX * 2.0)) + 0.75) * TIME, previousMove);
-        } else {
-            previousMove = playTurnOpponent(&stateOpponent, ((rand() / (RAND_MAX * 2.0)) + 0.75) * TIME, previousMove);
+    Winner winner = NONE;
+    while (winner == NONE) {
+        Engine* engine = players[referee->state.currentPlayer];
+        double jitter = (rand_r(&seed) / (RAND_MAX * 2.0)) + 0.75;
+        SearchLimits limits = {SIMULATIONS_PER_MOVE > 0? 0 : jitter * TIME,
+                               SIMULATIONS_PER_MOVE > 0? (int) (jitter * SIMULATIONS_PER_MOVE) : 0, 0,
+                               THREAD_CPU_TIME};
+        uint64_t turnTraceStart = startTraceSpan();
+        previousMove = playEngineTurn(engine, limits, previousMove);
+        endTraceSpan(getEngineName(engine), turnTraceStart, "ply", referee->state.ply);
+        if (!isLegalMove(referee, previousMove)) {
+            fprintf(stderr, "%s played an illegal move and forfeits the game\n", getEngineName(engine));
+            engine->statistics.forfeits++;
+            winner = referee->state.currentPlayer == PLAYER1? WIN_P2 : WIN_P1;
+            break;
+        }
+        makePermanentMove(referee, previousMove);
+        winner = referee->state.winner;
+        if (ADJUDICATE_DECIDED_GAMES && winner == NONE) {
+            winner = getForcedWinner(&referee->state);
         }
-        weAreCurrentPlayer = !weAreCurrentPlayer;
-    }
-    if (board->state.winner == NONE) {
-        makePermanentMove(board, previousMove);
     }
-    Winner winner = board->state.winner;
-    assert(winner != NONE && "simulateSingleGame: oops");
-    freeStateOpponent(stateOpponent);
-    freeBoard(board);
+    // A worker keeps its engines between games, so nothing they started, like pondering or a program, may keep running
+    // into games they don't play in
+    resetEngine(player1);
+    resetEngine(player2);
+    return winner;
+}
+
+
+Winner simulateSingleGame(ArenaContext* context, bool candidateIsPlayer1, unsigned int seed) {
+    uint64_t gameTraceStart = startTraceSpan();
+    Winner winner = candidateIsPlayer1? playArenaGame(context->candidate, context->baseline, context->referee, seed)
+                                      : playArenaGame(context->baseline, context->candidate, context->referee, seed);
+    endTraceSpan(candidateIsPlayer1? "game going first" : "game going second", gameTraceStart, "seed", seed);
     return winner;
 }
 
 
+void addGameResult(GameResults* results, Winner winner, Winner ourWin) {
+    if (winner == ourWin) {
+        results->wins++;
+    } else if (winner == DRAW) {
+        results->draws++;
+    } else {
+        results->losses++;
+    }
+}
+
+
+GameResults combineGameResults(const GameResults* a, const GameResults* b) {
+    GameResults combined = {a->wins + b->wins, a->draws + b->draws, a->losses + b->losses};
+    return combined;
+}
+
+
+void printGameResults(const char* title, const GameResults* results) {
+    double games = getAmountOfGames(results) > 0? getAmountOfGames(results) : 1;
+    printf("%s:\n", title);
+    printf("\tWon %.2f%% of games\n", 100 * results->wins / games);
+    printf("\tDrew %.2f%% of games\n", 100 * results->draws / games);
+    printf("\tLost %.2f%% of games\n", 100 * results->losses / games);
+}
+
+
+// Shared by all workers, behind the mutex
+struct ArenaTally {
+    pthread_mutex_t mutex;
+    GameResults goingFirst;
+    GameResults goingSecond;
+    long plies;
+    EngineStatistics candidate;
+    EngineStatistics baseline;
+    SPRT sprt;
+    SPRTResult sprtResult;
+    int sprtGames;
+};
+
+
+void* createArenaContext(void* argument) {
+    ArenaContext* context = safeMalloc(sizeof(ArenaContext));
+    context->candidate = createEngine(&candidateConfig);
+    context->baseline = createEngine(&baselineConfig);
+    context->referee = createBoard();
+    context->tally = argument;
+    return context;
+}
+
+
+void addEngineStatistics(EngineStatistics* total, const EngineStatistics* statistics) {
+    total->moves += statistics->moves;
+    total->simulations += statistics->simulations;
+    total->time += statistics->time;
+    total->slowestMove = fmax(total->slowestMove, statistics->slowestMove);
+    total->earlyStops += statistics->earlyStops;
+    total->extensions += statistics->extensions;
+    total->forfeits += statistics->forfeits;
+}
+
+
+// The engines count their statistics over all games of the worker, so they get added once they're done
+void freeArenaContext(void* argument) {
+    ArenaContext* context = argument;
+    pthread_mutex_lock(&context->tally->mutex);
+    addEngineStatistics(&context->tally->candidate, &context->candidate->statistics);
+    addEngineStatistics(&context->tally->baseline, &context->baseline->statistics);
+    pthread_mutex_unlock(&context->tally->mutex);
+    freeEngine(context->candidate);
+    freeEngine(context->baseline);
+    freeBoard(context->referee);
+    safeFree(context);
+}
+
+
+// Every game gets its own seed, so the results don't depend on which worker plays it. Pairs that start after the
+// SPRT finished are skipped, the ones still running get counted.
+bool playGamePair(int pair, void* context, void* argument) {
+    ArenaContext* arenaContext = context;
+    ArenaTally* tally = argument;
+    Winner first = simulateSingleGame(arenaContext, true, 2*pair);
+    int plies = arenaContext->referee->state.ply;
+    Winner second = simulateSingleGame(arenaContext, false, 2*pair + 1);
+    plies += arenaContext->referee->state.ply;
+    pthread_mutex_lock(&tally->mutex);
+    addGameResult(&tally->goingFirst, first, WIN_P1);
+    addGameResult(&tally->goingSecond, second, WIN_P2);
+    tally->plies += plies;
+    if (USE_SPRT && tally->sprtResult == SPRT_CONTINUE) {
+        GameResults total = combineGameResults(&tally->goingFirst, &tally->goingSecond);
+        tally->sprtResult = testSPRT(&tally->sprt, &total);
+        tally->sprtGames = getAmountOfGames(&total);
+    }
+    bool keepGoing = tally->sprtResult == SPRT_CONTINUE;
+    pthread_mutex_unlock(&tally->mutex);
+    return keepGoing;
+}
+
+
+double getProcessTime() {
+    struct timespec time;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time);
+    return (double) time.tv_sec + (double) time.tv_nsec / 1e9;
+}
+
+
+// Other programs don't report their simulations and keep their own time
+void printEngineStatistics(const char* name, const EngineStatistics* statistics) {
+    double moves = statistics->moves > 0? statistics->moves : 1;
+    printf("%s: %.4fs per move, slowest %.4fs", name, statistics->time / moves, statistics->slowestMove);
+    if (statistics->simulations > 0) {
+        printf(", %.0f simulations per move", statistics->simulations / moves);
+    }
+    if (SIMULATIONS_PER_MOVE == 0 && statistics->simulations > 0) {
+        printf(" (%s, fixed budget %.4fs), stopped early %.1f%%, extended %.1f%% of moves",
+               THREAD_CPU_TIME? "CPU time" : "wall time", TIME, 100 * statistics->earlyStops / moves,
+               100 * statistics->extensions / moves);
+    }
+    if (statistics->forfeits > 0) {
+        printf(", forfeited %d games", statistics->forfeits);
+    }
+    printf("\n");
+}
+
+
 void runArena() {
-    srand(69);
-    int winsGoingFirst = 0;
-    int drawsGoingFirst = 0;
-    int lossesGoingFirst = 0;
-    int winsGoingSecond = 0;
-    int drawsGoingSecond = 0;
-    int lossesGoingSecond = 0;
-    #pragma omp parallel for default(none) shared(winsGoingFirst, winsGoingSecond, drawsGoingFirst, drawsGoingSecond, lossesGoingFirst, lossesGoingSecond)
-    for (int i = 0; i < ROUNDS/2; i++) {
-        Winner winner = simulateSingleGame(true);
-        if (winner == WIN_P1) {
-            winsGoingFirst++;
-        } else if (winner == WIN_P2) {
-            lossesGoingFirst++;
-        } else {
-            drawsGoingFirst++;
+    loadEngineConfig(&candidateConfig);
+    loadEngineConfig(&baselineConfig);
+    ArenaTally tally = {.goingFirst = {0, 0, 0}, .goingSecond = {0, 0, 0}, .plies = 0,
+                        .candidate = {0, 0, 0, 0, 0, 0, 0}, .baseline = {0, 0, 0, 0, 0, 0, 0}, .sprtResult = SPRT_CONTINUE, .sprtGames = 0};
+    pthread_mutex_init(&tally.mutex, NULL);
+    initializeSPRT(&tally.sprt, SPRT_ELO0, SPRT_ELO1, SPRT_ALPHA, SPRT_BETA);
+    int cpusPerWorker = 1;
+    if (SIMULATIONS_PER_MOVE == 0) {
+        cpusPerWorker += engineUsesExtraThread(&candidateConfig) + engineUsesExtraThread(&baselineConfig);
+    }
+    WorkerPool pool;
+    initializeWorkerPool(&pool, ARENA_WORKERS, cpusPerWorker, ROUNDS/2);
+    pool.createContext = createArenaContext;
+    pool.freeContext = freeArenaContext;
+    pool.runTask = playGamePair;
+    pool.argument = &tally;
+    if (TRACE_FILENAME != NULL) {
+        startTracing(TRACE_EVENTS_PER_THREAD);
+    }
+    double processTimeBefore = getProcessTime();
+    runWorkerPool(&pool);
+    double processTime = getProcessTime() - processTimeBefore;
+    if (TRACE_FILENAME != NULL) {
+        stopTracing(TRACE_FILENAME);
+    }
+    pthread_mutex_destroy(&tally.mutex);
+    GameResults total = combineGameResults(&tally.goingFirst, &tally.goingSecond);
+    int games = getAmountOfGames(&total);
+    printf("%s against %s\n", candidateConfig.name, baselineConfig.name);
+    printGameResults("Going first", &tally.goingFirst);
+    printGameResults("Going second", &tally.goingSecond);
+    printf("Total score: %f over %d games\n", getScore(&total), games);
+    EloEstimate elo = estimateElo(&total);
+    printf("Elo difference: %+.1f (95%% confidence interval %+.1f to %+.1f)\n", elo.elo, elo.lower, elo.upper);
+    if (USE_SPRT) {
+        printf("SPRT elo0 %.1f, elo1 %.1f: %s after %d games, log likelihood ratio %.2f (%.2f, %.2f)\n",
+               SPRT_ELO0, SPRT_ELO1, tally.sprtResult == SPRT_ACCEPT_H1? "H1 accepted"
+                                     : tally.sprtResult == SPRT_ACCEPT_H0? "H0 accepted" : "no decision",
+               tally.sprtResult == SPRT_CONTINUE? games : tally.sprtGames, getLogLikelihoodRatio(&tally.sprt, &total),
+               tally.sprt.lowerBound, tally.sprt.upperBound);
+    }
+    printf("Average game length: %.1f plies\n", (double) tally.plies / games);
+    printEngineStatistics(candidateConfig.name, &tally.candidate);
+    printEngineStatistics(baselineConfig.name, &tally.baseline);
+    printf("%d workers: %.0f games per hour, %.1f%% of worker time in games, %.1f%% of %d CPUs used\n",
+           pool.amountOfWorkers, 3600 * games / pool.wallTime, 100 * getWorkerUtilization(&pool),
+           100 * processTime / (pool.wallTime * getAmountOfAvailableCpus()), getAmountOfAvailableCpus());
+    unloadEngineConfig(&candidateConfig);
+    unloadEngineConfig(&baselineConfig);
+}
+
+
+// Shared by all workers, the tournament is behind the mutex
+typedef struct TournamentRun {
+    pthread_mutex_t mutex;
+    Tournament tournament;
+    int amountOfConfigs;
+} TournamentRun;
+
+// A worker only makes engines for the configs of the pairings it plays
+typedef struct TournamentContext {
+    Engine** engines;
+    int amountOfEngines;
+    Board* referee;
+} TournamentContext;
+
+
+void* createTournamentContext(void* argument) {
+    TournamentRun* run = argument;
+    TournamentContext* context = safeMalloc(sizeof(TournamentContext));
+    context->amountOfEngines = run->amountOfConfigs;
+    context->engines = safeMalloc(run->amountOfConfigs * sizeof(Engine*));
+    for (int i = 0; i < run->amountOfConfigs; i++) {
+        context->engines[i] = NULL;
+    }
+    context->referee = createBoard();
+    return context;
+}
+
+
+void freeTournamentContext(void* argument) {
+    TournamentContext* context = argument;
+    for (int i = 0; i < context->amountOfEngines; i++) {
+        if (context->engines[i] != NULL) {
+            freeEngine(context->engines[i]);
         }
-        winner = simulateSingleGame(false);
-        if (winner == WIN_P2) {
-            winsGoingSecond++;
-        } else if (winner == WIN_P1) {
-            lossesGoingSecond++;
-        } else {
-            drawsGoingSecond++;
+    }
+    safeFree(context->engines);
+    freeBoard(context->referee);
+    safeFree(context);
+}
+
+
+Engine* getTournamentEngine(TournamentContext* context, int engine) {
+    if (context->engines[engine] == NULL) {
+        context->engines[engine] = createEngine(tournamentConfigs[engine]);
+    }
+    return context->engines[engine];
+}
+
+
+// Tasks that already ran before the tournament was interrupted get skipped
+bool playTournamentPair(int task, void* context, void* argument) {
+    TournamentContext* tournamentContext = context;
+    TournamentRun* run = argument;
+    pthread_mutex_lock(&run->mutex);
+    bool done = run->tournament.taskIsDone[task];
+    Pairing pairing = *getTaskPairing(&run->tournament, task);
+    pthread_mutex_unlock(&run->mutex);
+    if (done) {
+        return true;
+    }
+    Engine* first = getTournamentEngine(tournamentContext, pairing.first);
+    Engine* second = getTournamentEngine(tournamentContext, pairing.second);
+    uint64_t traceStart = startTraceSpan();
+    GameResults results = {0, 0, 0};
+    addGameResult(&results, playArenaGame(first, second, tournamentContext->referee, 2*task), WIN_P1);
+    addGameResult(&results, playArenaGame(second, first, tournamentContext->referee, 2*task + 1), WIN_P2);
+    endTraceSpan("game pair", traceStart, "task", task);
+    pthread_mutex_lock(&run->mutex);
+    recordTaskResults(&run->tournament, task, &results);
+    pthread_mutex_unlock(&run->mutex);
+    return true;
+}
+
+
+void runTournament() {
+    TournamentRun run;
+    run.amountOfConfigs = sizeof(tournamentConfigs) / sizeof(EngineConfig*);
+    const char** names = safeMalloc(run.amountOfConfigs * sizeof(const char*));
+    int cpusPerWorker = 1;
+    for (int i = 0; i < run.amountOfConfigs; i++) {
+        loadEngineConfig(tournamentConfigs[i]);
+        names[i] = tournamentConfigs[i]->name;
+        if (SIMULATIONS_PER_MOVE == 0 && engineUsesExtraThread(tournamentConfigs[i]) && cpusPerWorker < 3) {
+            cpusPerWorker++;
         }
     }
-    double denominator = ROUNDS / 2.0;
-    printf("Going first:\n");
-    printf("\tWon %.2f%% of games\n", 100*winsGoingFirst / denominator);
-    printf("\tDrew %.2f%% of games\n", 100*drawsGoingFirst / denominator);
-    printf("\tLost %.2f%% of games\n", 100*lossesGoingFirst / denominator);
-    printf("Going second:\n");
-    printf("\tWon %.2f%% of games\n", 100*winsGoingSecond / denominator);
-    printf("\tDrew %.2f%% of games\n", 100*drawsGoingSecond / denominator);
-    printf("\tLost %.2f%% of games\n", 100*lossesGoingSecond / denominator);
-    printf("Total score: %f\n", (winsGoingFirst+winsGoingSecond + drawsGoingFirst/2.+drawsGoingSecond/2.) / (double)ROUNDS);
-}
\ No newline at end of file
+    pthread_mutex_init(&run.mutex, NULL);
+    initializeTournament(&run.tournament, run.amountOfConfigs, names, TOURNAMENT_TYPE, TOURNAMENT_PAIRS);
+    if (TOURNAMENT_CHECKPOINT_FILENAME != NULL && !openCheckpoint(&run.tournament, TOURNAMENT_CHECKPOINT_FILENAME)) {
+        exit(1);
+    }
+    int tasksBefore = 0;
+    for (int task = 0; task < getAmountOfTasks(&run.tournament); task++) {
+        tasksBefore += run.tournament.taskIsDone[task];
+    }
+    if (tasksBefore > 0) {
+        printf("Continuing after %d of %d game pairs\n", tasksBefore, getAmountOfTasks(&run.tournament));
+    }
+    WorkerPool pool;
+    initializeWorkerPool(&pool, ARENA_WORKERS, cpusPerWorker, getAmountOfTasks(&run.tournament));
+    pool.createContext = createTournamentContext;
+    pool.freeContext = freeTournamentContext;
+    pool.runTask = playTournamentPair;
+    pool.argument = &run;
+    if (TRACE_FILENAME != NULL) {
+        startTracing(TRACE_EVENTS_PER_THREAD);
+    }
+    runWorkerPool(&pool);
+    if (TRACE_FILENAME != NULL) {
+        stopTracing(TRACE_FILENAME);
+    }
+    pthread_mutex_destroy(&run.mutex);
+    printTournament(stdout, &run.tournament);
+    int games = 2 * (getAmountOfTasks(&run.tournament) - tasksBefore);
+    printf("%d workers: %.0f games per hour\n", pool.amountOfWorkers, 3600 * games / pool.wallTime);
+    freeTournament(&run.tournament);
+    for (int i = 0; i < run.amountOfConfigs; i++) {
+        unloadEngineConfig(tournamentConfigs[i]);
+    }
+    safeFree(names);
+}
@@ -3,4 +3,6 @@
 
 void runArena();
 
+void runTournament();
+
 #endif //UTTT2_ARENA_H
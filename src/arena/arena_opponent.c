@@ -1,1239 +0,0 @@
-#include <stdlib.h>
-#include <stdio.h>
-#include <stdint.h>
-#include <stdbool.h>
-#include <stdalign.h>
-#include <string.h>
-#include <sys/time.h>
-#include <immintrin.h>
-
-
-// START PARAMETERS
-alignas(32) int16_t hiddenWeights2[190][256] = {{16,2,-2,15,-136,-9,-9,3,-10,7,8,-1,8,12,-5,0,12,10,-6,-14,9,20,6,3,59,-33,17,9,-15,18,20,-47,-3,29,-78,-167,14,-29,-8,17,12,16,1,-57,5,19,6,-9,6,-35,9,28,87,-135,-7,-1,-4,9,9,6,-11,1,3,0,-134,1,-1,11,-28,-41,2,-137,-7,11,-86,8,9,-18,-73,2,-6,-20,-1,0,-6,-1,-4,5,-28,-52,-7,22,-1,-7,-157,-138,-11,7,-3,10,-169,-2,2,7,-5,3,9,4,-5,10,1,-51,5,41,-46,-2,-13,1,2,-8,25,2,10,10,-49,45,7,3,128,-4,1,15,2,0,8,-16,5,-75,-80,-2,4,-44,-50,5,43,0,-6,5,37,23,-4,-2,-93,16,25,8,-1,24,-18,-2,-79,-3,8,53,-4,-9,-43,7,-94,1,-21,1,2,10,5,-23,5,-153,-168,11,11,2,-5,23,-82,-73,-11,-164,9,-11,-18,6,6,5,7,24,11,-8,-4,10,32,-6,-5,-11,17,11,-10,6,8,7,4,24,-7,-11,26,2,-1,-5,-17,15,41,5,5,-167,78,-4,-32,-16,8,3,21,2,18,5,4,-5,-42,-40,7,-16,-2,-15,-18,-50,12,2,-18,139,-26,8,-106,3,0,2,-6,-35},
-                                                {7,4,6,9,-1,-20,-140,-2,1,24,-1,-159,3,16,6,14,-16,4,-6,-16,5,7,17,-160,-46,-9,-111,3,-3,-90,-110,-44,7,-25,14,-5,10,-20,6,15,1,31,8,24,13,29,17,-11,-3,-15,-1,11,15,10,-6,-9,6,-99,-6,4,5,9,1,6,8,6,-2,-86,-13,-29,14,38,-147,5,-4,10,10,13,-18,19,-1,0,-10,1,-114,7,-6,3,7,-39,-10,10,-2,21,14,-156,2,-10,3,11,-4,9,-5,0,7,5,11,0,-8,-10,10,12,2,-32,-39,7,3,9,9,8,-25,10,13,8,-38,-6,13,-10,-22,1,-133,-93,1,9,-1,-3,-10,8,6,-154,10,-13,-33,214,43,-5,-2,-2,40,28,4,-135,-5,2,27,2,-24,-9,20,15,9,1,-8,44,6,2,-20,5,-21,2,-8,12,-4,-84,-1,16,9,2,4,11,12,-27,-6,-31,15,10,63,4,3,3,8,1,4,-50,5,5,2,1,9,4,24,-15,53,7,12,8,-4,7,-15,-4,-10,27,-11,8,29,-7,-2,4,28,14,-7,14,13,7,2,-81,6,12,7,10,-32,-19,-1,13,7,-91,65,-28,13,-2,-1,-6,167,54,-3,7,-5,-3,-18,7,11,7,-2,-1,1,-10},
-                                                {-127,5,11,54,-3,-16,-5,-9,-8,0,9,-4,8,6,10,-2,3,5,-4,-80,-9,17,3,4,-51,-17,10,-13,-50,14,19,15,-89,-19,14,7,27,-40,4,-90,3,13,0,10,5,16,7,0,-11,-15,-19,11,6,1,-11,-1,15,11,5,8,14,-3,1,-87,7,-141,-8,11,30,-38,-3,30,3,1,7,12,-76,4,-11,4,-5,-25,-5,2,0,-148,-7,0,-1,14,-1,19,-2,13,18,-135,-6,10,-6,-2,0,1,-9,-1,-1,5,-95,-3,55,-11,-8,18,-1,-67,53,-7,5,3,13,3,-52,1,-7,-73,-62,-8,5,-7,18,-5,7,12,7,-3,-4,14,10,2,-7,-6,-2,40,46,10,-128,-3,-6,8,33,-161,-141,6,37,2,-5,1,-5,21,-17,6,7,-35,-5,56,1,-6,-18,1,-6,-8,7,1,242,4,8,4,12,3,3,-85,-31,-3,11,-74,10,8,-16,-4,5,-1,-20,36,15,0,-15,20,3,5,5,-1,7,11,-5,-16,16,2,-154,0,6,-5,15,1,-12,12,23,-85,-2,-3,12,-7,-17,-10,4,6,-11,-4,11,6,12,8,-43,-9,11,5,-91,9,-41,-38,-130,-1,-17,-18,-4,-62,25,-138,1,12,-14,-141,12,-7,1,4,-4,21},
-                                                {2,-75,6,9,-2,-5,7,9,-142,23,-9,13,0,28,-9,16,14,10,13,0,8,13,8,9,70,-21,-5,4,-121,19,4,-33,-11,-45,8,5,15,-21,-18,10,-137,15,-2,36,12,30,-8,-8,-3,-70,-104,30,7,-164,-16,-7,8,-88,253,-8,18,3,9,-2,-137,11,3,10,-13,-23,-128,32,-13,10,14,-49,4,-28,9,-141,44,-15,0,-108,6,5,-6,-1,13,-46,10,10,6,23,18,7,1,1,1,9,4,-4,-2,0,7,-11,3,0,-6,-16,4,17,-11,50,-43,0,2,4,-8,0,-19,-135,-12,1,62,-17,38,1,-3,-3,5,3,-120,-144,9,5,9,9,13,11,1,-8,-29,10,45,-68,2,-8,-27,27,4,6,-3,-133,3,17,-4,1,32,-32,10,11,-1,-7,-107,0,-12,12,63,4,13,13,3,-1,8,14,6,-7,10,-13,24,14,6,-1,-3,-15,1,3,-17,-13,0,-2,4,21,10,20,-33,7,-2,-98,22,-12,-2,5,17,5,11,16,4,-9,-5,7,2,6,-18,-2,8,3,111,-75,0,0,5,5,-2,7,-36,0,9,-8,-43,-32,19,-8,6,-2,-26,82,12,1,-87,-12,4,-35,-4,12,10,6,-2,-2,9,-151,8,0,12,-11},
-                                                {40,-131,28,-21,-5,156,-12,-176,-11,-7,2,-18,3,20,5,-10,4,-6,-10,4,-51,-65,7,-5,-41,9,-8,4,25,-90,-11,25,6,42,3,-8,8,-53,-169,12,-61,-54,-12,-37,-3,-228,10,-10,8,-24,5,-78,28,18,-12,4,-53,25,16,2,9,-4,-197,6,45,0,-56,-18,36,-30,-3,-166,10,1,-5,17,-13,-139,4,-8,-11,130,17,14,13,-12,1,3,-13,36,1,-107,-10,-70,-175,22,-7,-2,-7,3,-2,-5,-9,-66,-5,-95,6,8,4,-54,1,-2,-5,-57,-41,-12,-11,-1,-64,-4,-41,-82,-18,3,34,43,-76,6,-6,-12,-159,3,17,-7,1,6,-220,1,6,-9,-10,-23,-71,-14,-161,14,3,1,-39,-192,-1,-17,40,-10,14,1,1,11,43,19,-13,-10,-8,-31,-9,-11,-39,19,14,-38,38,-9,18,11,5,-43,4,-8,0,-1,13,-7,-7,30,1,0,-7,-2,-11,3,5,29,-11,7,-13,24,-12,11,-9,12,16,-16,-2,-9,34,-72,1,10,-67,-9,60,-26,-176,-55,-45,-2,-14,93,-13,-122,29,7,-188,-1,0,-11,6,11,9,-7,27,-154,-1,-179,3,7,50,46,-144,-13,8,1,65,42,1,1,10,53,-67,10,7,-1,-16,-5,4,10},
-                                                {-152,-122,8,8,11,-16,8,-8,1,28,11,9,8,53,18,-97,2,11,10,7,6,-108,6,11,-40,-72,-3,-17,-7,14,3,-37,11,-25,3,11,-48,-25,14,25,-6,13,-149,23,7,30,-1,-7,-10,-7,4,23,4,0,11,2,10,1,-12,-14,14,-2,8,3,-2,0,2,4,-35,-20,0,32,-143,6,3,-41,7,10,0,3,5,-3,-9,16,4,-2,-5,3,8,-16,5,13,4,30,18,9,-3,13,1,-2,11,10,0,-5,2,-15,6,-4,-5,-11,-5,11,-6,-26,58,4,9,11,10,9,49,-135,2,-16,53,11,-97,4,-7,-166,5,0,13,-4,2,-71,11,-1,-10,9,0,-11,42,5,37,-39,15,-6,-25,29,1,15,14,6,-3,-8,-5,19,48,4,3,2,0,12,-4,9,-30,20,-123,10,-56,6,-8,-4,-74,16,6,2,15,-6,1,9,-87,-22,-9,2,-4,5,-115,3,5,3,-80,15,1,18,3,2,-134,14,19,-15,-4,6,14,-11,6,-77,5,4,0,-11,5,8,-19,9,9,6,3,-96,1,-1,2,15,0,-6,4,2,227,-1,-30,-19,-7,0,7,1,-31,78,15,-2,13,-8,-2,-34,6,9,-72,9,-4,-180,10,7,1,12,9,-10},
-                                                {18,1,8,-55,-1,6,-3,8,-1,-15,-7,5,-18,31,-12,7,-80,-1,-4,5,-6,19,-3,7,56,3,-6,6,29,8,-3,21,0,-22,-12,-6,20,30,-5,23,13,9,5,25,-3,10,12,-4,214,-20,11,-138,11,-132,-14,3,14,15,19,-74,29,12,-3,7,-124,5,-6,6,27,35,2,37,-66,2,8,18,-15,2,9,-4,-16,-4,3,-5,2,3,-6,-8,-1,27,-66,10,-2,5,15,5,7,4,92,-1,3,-182,5,11,-6,2,-1,-4,-1,-5,-150,20,-55,40,-52,-11,5,-171,10,-5,10,12,0,8,-52,-49,6,8,-2,9,12,-19,-10,-7,-59,-15,14,-5,8,-3,-1,-6,-64,8,-139,6,-122,8,-42,-163,-5,-1,13,16,-1,-71,-11,29,11,15,5,-5,-5,-22,-7,-4,-13,-141,-14,3,-19,4,18,4,-14,3,-133,2,-1,3,24,7,-2,-20,3,-16,1,2,-6,-87,9,3,4,27,-64,17,1,-76,-4,-2,25,56,-8,-4,-119,8,4,12,3,11,10,-1,5,10,-32,3,-6,-21,-32,38,-146,9,-4,0,0,-5,-93,-2,7,-156,-10,6,-85,0,26,-30,-39,-40,-140,1,8,-44,9,-44,13,-8,7,4,-5,9,12,-7,-6,-160,-3,18},
-                                                {13,4,-96,2,10,0,3,1,9,5,8,4,-16,-118,15,15,-7,-6,-143,1,9,8,-129,10,-38,-36,9,8,-115,21,-1,-37,2,-27,-6,0,17,41,5,25,5,-101,9,25,-1,30,7,33,5,-11,-3,25,6,12,-10,-6,-5,5,6,14,34,-142,-2,1,7,12,2,15,-30,45,13,30,-13,249,-10,4,3,7,0,5,-2,-29,-2,5,17,11,-7,7,10,-12,13,-14,-149,42,15,7,-62,-5,5,-4,14,6,2,-122,3,6,-13,11,-3,-3,3,14,-16,-28,-46,1,10,-9,8,11,-34,1,8,0,-37,-3,11,12,-10,11,-137,10,-1,11,-18,1,11,0,1,5,5,-9,-32,-2,45,3,2,12,-28,35,8,0,18,6,28,8,115,-38,-51,46,0,11,-1,-9,4,9,-25,-162,-10,1,-2,10,4,16,-4,3,-7,11,2,0,15,4,-4,-16,1,0,-16,10,1,5,-109,3,5,42,12,11,8,9,19,2,-67,-22,-10,11,-139,8,12,7,-15,-5,-6,16,9,7,-14,-13,-148,5,21,14,-11,-92,-13,12,-5,5,21,-113,17,5,-41,-17,12,11,8,11,70,-35,9,-14,2,-5,13,58,11,1,2,5,-4,11,2,6,-148,-12,3,-10},
-                                                {-116,-3,2,6,6,0,1,-3,5,-2,-53,-7,-51,25,-105,4,5,-148,0,11,5,11,-1,9,-47,9,2,-49,16,2,4,-50,12,26,4,9,22,32,11,-18,3,14,-3,26,-166,11,-8,-8,7,-11,-18,28,-49,3,-9,-2,-144,-79,3,12,-6,12,7,-3,8,1,1,9,-55,36,-1,-137,-6,7,3,12,7,2,8,3,-1,-11,4,2,3,4,83,-72,5,2,10,13,3,28,-151,9,6,-73,-1,-148,9,3,5,16,-39,6,-4,248,-11,3,-4,-45,6,-62,52,-1,-67,-3,9,-169,-21,2,26,-13,-59,27,7,-59,-26,7,8,-12,5,-2,-18,16,8,7,2,-3,-154,-19,39,11,46,-9,6,-71,-43,29,4,8,2,3,20,-3,-7,28,13,16,-17,0,-1,1,5,2,-26,-130,-3,-5,0,-110,-12,-26,1,-13,-8,6,-3,6,24,6,13,25,4,6,1,-3,3,4,12,4,16,29,2,-103,-6,-4,1,-17,17,-20,-7,-6,-147,4,5,-6,5,1,11,-20,5,-13,-22,9,-4,-8,26,25,26,-1,-8,6,-10,1,23,10,13,1,23,1,13,9,1,5,-41,-40,10,43,-1,-8,4,-65,-109,1,8,-36,-11,-90,23,0,-5,9,-162,-26},
-                                                {15,12,-5,-1,-74,10,-2,1,-1,-4,3,6,0,-12,5,3,-2,4,-2,1,-1,2,-4,5,33,7,2,-1,4,0,5,-15,2,19,-42,20,-10,-4,-5,6,7,11,5,-13,1,14,7,-4,8,11,4,-2,21,-9,-5,-12,0,-7,14,0,0,-2,3,3,-7,6,-3,3,-6,-4,-4,-5,3,7,-44,-2,2,13,105,3,-2,-6,-5,10,6,1,-8,4,17,6,0,-3,-3,-11,-13,-1,0,-1,2,5,-77,0,-17,-4,2,-2,-3,10,-3,-7,7,53,6,31,-4,4,6,5,3,-5,0,8,-10,-4,-5,-9,12,2,65,1,12,4,1,6,2,1,0,-46,-42,2,8,-3,-8,17,24,-2,1,3,19,21,0,-4,16,4,-35,2,3,0,-25,5,107,5,-4,18,1,-63,-11,5,-9,1,-1,3,4,0,-3,3,1,24,17,2,7,15,-2,17,-50,114,3,21,3,5,-3,6,-1,14,0,-3,5,7,-1,2,-4,-8,-3,4,16,1,0,-2,-3,4,4,-18,-2,3,16,0,1,-4,3,5,17,-4,3,-74,30,-1,6,6,9,6,32,0,-2,4,1,5,-2,-8,9,-2,4,-6,7,-6,24,5,4,-1,5,10,64,4,0,4,-3,-6},
-                                                {10,11,3,-1,7,7,-1,3,-2,7,1,-1,-4,15,-2,-1,-2,1,2,1,0,4,-7,-2,14,6,-11,-4,12,3,-10,-4,-2,5,-16,-109,-11,-6,0,1,7,7,3,5,2,6,7,-2,6,4,0,7,10,-9,-5,2,1,16,11,-3,-2,-4,2,0,-12,2,1,11,-7,-5,0,-13,7,2,72,-1,0,3,65,-1,-6,-8,15,6,-9,2,-4,-2,28,-5,1,-5,2,-3,-13,-13,2,-2,-2,0,-150,3,2,-2,3,-3,-5,4,-5,-2,0,0,-3,17,-9,6,0,3,2,-1,4,-2,-7,-5,-12,12,11,2,15,4,3,-6,-1,3,-4,0,0,-30,-20,1,2,-1,-5,4,12,1,-1,-2,8,14,2,-7,-9,0,-9,-1,-2,3,-9,7,-25,1,-1,4,1,28,-2,10,-14,-7,-2,3,3,-14,-3,3,-3,23,18,-2,10,13,-1,8,-28,-16,-3,29,-1,0,-5,7,-3,-9,-1,7,7,5,3,-4,1,3,-3,6,13,-5,1,-5,-1,4,0,8,3,0,9,-5,5,-1,2,9,0,-9,6,36,29,-5,5,0,4,5,12,0,-6,3,1,-17,-7,-9,11,-2,2,0,14,-12,17,3,1,-8,4,12,11,-1,0,0,-5,-5},
-                                                {4,14,8,-10,20,7,2,0,-1,-3,2,3,-4,-5,0,-1,-1,5,-1,-12,6,-1,-3,4,15,-7,1,-1,-4,-4,4,-10,-10,10,-23,35,-10,-6,-3,13,1,1,2,-12,3,13,4,-5,8,8,1,0,19,-18,-6,-4,-2,15,7,-3,-5,-1,2,-6,-17,-1,-7,2,-4,-6,-4,-17,6,10,-28,3,-8,8,62,3,-4,-10,17,5,6,3,-3,-2,-107,-5,1,-6,0,0,-19,-16,1,-4,-6,-5,-144,0,-11,-2,8,-2,-9,6,-2,-4,-2,3,4,19,-11,1,0,1,4,1,10,7,-15,-13,-10,6,2,3,32,3,13,-1,-2,0,0,-1,1,60,60,2,4,-10,-13,7,10,2,-4,-3,14,13,-1,-2,7,1,-19,0,-7,3,-20,-13,-26,0,-3,4,1,32,-14,13,-12,-1,6,7,9,-5,-4,3,-1,38,34,-8,12,8,-1,5,-27,-20,-1,-128,4,1,-1,6,-3,-3,5,3,7,7,7,1,2,-1,-5,3,12,-1,-4,-4,-3,7,-3,5,-1,1,12,-14,0,-7,11,15,3,-3,7,40,34,-2,0,1,7,0,13,7,3,3,-2,3,-7,-6,9,-3,6,-10,4,-3,22,4,0,-8,1,4,26,-4,-6,-2,-2,-2},
-                                                {5,6,7,0,-119,2,-1,2,-13,2,4,2,-4,3,0,-2,-5,5,-1,0,-4,2,-6,1,11,-12,2,-5,0,-4,0,-4,1,7,-22,22,-3,-6,-1,0,4,4,3,11,4,9,6,-4,4,0,-12,10,9,-12,0,-4,1,16,10,-2,-4,-2,4,0,-17,0,3,2,-8,-7,-6,-13,6,6,-30,11,-3,8,-17,-6,-3,-11,-8,-6,6,-1,-1,-2,24,-6,-2,-7,-2,-4,-18,-14,-3,-2,-1,0,23,1,-1,-2,4,-4,-4,5,-7,-2,3,-6,2,22,-7,5,-1,6,4,0,6,2,-13,-4,-11,5,3,0,11,3,6,1,1,3,-3,-2,-2,-23,-18,3,-2,-1,-5,8,8,-1,7,-2,8,17,-1,-3,-4,-17,-5,-3,-10,2,-5,-4,-21,4,-5,1,-2,30,-1,6,-6,-10,0,9,2,0,-4,9,-2,-126,20,1,-1,2,-5,7,73,64,-3,21,4,1,-4,1,-2,-2,-4,2,8,2,1,-16,-4,3,-3,-1,7,-4,-1,-7,-6,8,-4,5,2,-1,7,-1,-1,-1,3,-8,2,-3,4,-135,32,-4,4,3,1,5,10,6,3,2,0,4,-9,-4,10,0,-14,-1,1,-12,17,1,-5,-13,-2,8,16,-1,1,4,-2,-4},
-                                                {4,7,6,3,27,-3,3,9,1,6,9,2,1,-1,1,0,1,5,1,-1,-3,-6,-2,2,20,-1,1,0,0,2,7,-19,3,10,-62,-117,-9,-7,1,-5,2,2,10,-65,2,15,-4,-2,14,-4,0,9,31,-24,-5,-9,-5,14,5,2,-8,-2,11,5,-22,4,-3,4,-1,-17,1,-26,0,7,77,1,4,-10,-41,8,-2,-9,3,8,7,-3,-11,3,-89,-17,4,-2,6,-3,-27,-26,-2,-1,-2,2,32,-3,1,-2,1,-8,-3,8,-7,-3,-1,-5,10,18,-16,3,4,5,-2,2,15,-8,-13,-2,-22,-3,4,3,47,2,2,1,0,4,3,5,1,74,-48,4,5,-11,-12,5,8,4,1,-1,10,13,-2,-2,20,6,-16,3,-2,4,-15,-10,70,0,1,7,5,-124,-15,14,-15,-15,4,5,2,-1,-3,2,2,-115,39,1,5,-10,-1,18,78,-48,2,37,0,3,-3,3,-1,7,5,-7,5,8,5,-3,1,-4,3,-2,7,-5,-1,-2,-8,2,-1,-5,5,-7,10,0,-1,-15,7,0,29,-5,9,37,35,-3,0,1,7,2,24,4,-1,9,1,7,-12,-19,2,-7,4,-10,6,-19,24,2,1,-11,-11,15,11,0,1,0,-2,-12},
-                                                {3,-2,-1,-4,16,5,2,5,-7,8,2,-1,-2,-4,1,-12,-1,4,3,-1,1,5,-5,2,13,-6,2,-2,2,11,2,-5,-2,7,-25,28,-17,-7,2,2,5,5,1,-1,4,6,4,-3,5,4,1,5,10,-9,-3,-6,3,18,5,1,-1,-1,5,1,-14,2,2,2,-8,-5,3,-18,7,4,-29,8,0,6,-18,7,-2,-5,2,4,2,0,-2,-2,31,-5,-2,-6,0,-14,-14,-10,3,-2,-6,-3,20,2,-1,2,1,0,-6,6,-4,1,0,2,4,16,-9,2,-1,5,2,0,4,5,-2,0,-5,2,12,2,21,-2,10,1,-2,4,1,-10,-5,-22,59,2,2,-8,-4,7,12,0,-1,3,10,11,6,-3,2,1,-9,2,-6,7,-14,9,-20,3,6,5,-1,27,2,10,-12,-5,-25,2,1,-1,-13,5,-3,-133,21,-1,3,9,-15,6,65,-11,-1,-135,13,1,-5,2,-13,4,0,1,3,2,-3,-6,-5,9,-2,7,6,1,0,-14,-3,1,-8,0,3,0,7,-2,0,0,-3,3,4,-7,7,23,29,0,2,-4,9,2,8,2,-7,2,3,4,-7,-6,12,-7,-4,-6,5,-7,21,2,-14,-9,-4,8,8,0,-4,4,0,-4},
-                                                {10,12,5,3,-110,8,5,-1,0,-2,6,4,-3,3,2,-3,-12,3,0,0,6,5,-5,5,21,-5,4,-5,14,1,6,-7,2,8,63,35,-9,-10,-2,3,6,4,4,-3,1,15,-7,-2,10,5,0,2,18,-17,-5,-4,-3,19,3,-13,-11,-5,2,3,-21,1,-5,4,-1,-10,-1,-24,-4,4,-23,6,3,7,-25,4,-2,-16,-6,6,3,-1,-3,0,-125,-9,-12,-2,-5,2,-22,-15,-5,-2,-7,-3,32,0,-4,-4,4,-4,-4,4,-7,3,2,0,10,22,-11,2,1,4,4,-2,-1,11,-11,-5,-8,6,4,3,37,4,10,1,4,2,-6,2,0,57,-26,2,5,-11,-10,6,10,-2,1,-2,9,7,0,-2,4,2,-18,-8,-3,12,-13,5,-26,-1,1,4,7,33,-12,2,-23,-4,-10,7,2,-4,-1,0,-10,37,-127,1,4,8,-2,7,-33,66,-5,32,9,-8,-3,2,-1,7,-12,3,8,-9,-2,-4,3,8,-4,-1,-1,-1,0,-3,-4,0,3,4,-2,1,11,-3,-3,-2,-5,7,1,-4,4,-126,31,0,-21,3,8,5,12,3,-5,4,9,7,-9,-13,10,-4,3,-14,5,-14,21,3,1,-10,-1,13,16,3,3,3,-3,-15},
-                                                {11,9,11,-1,14,8,2,5,-5,7,3,5,-2,-17,0,-3,0,6,-9,0,-1,4,-17,3,13,-12,0,-5,2,-2,4,-3,-2,10,62,-116,-11,-5,3,-1,7,19,6,0,2,6,4,1,5,6,1,3,14,-9,-4,2,3,14,7,-2,-4,-11,5,2,-3,1,3,1,-3,-6,0,-12,6,7,63,3,1,0,-16,2,-4,-9,-2,2,2,3,-6,1,24,-13,0,-4,-2,-5,-17,-10,-1,-3,-3,1,17,1,-10,-1,4,-5,0,4,-5,-1,4,0,10,17,-5,5,-2,4,0,1,9,5,-13,-2,-9,1,8,1,14,6,1,-1,1,2,2,2,-2,-28,-26,-4,6,1,-6,6,11,0,4,-2,9,13,1,-1,9,0,-7,-1,-3,-15,-14,3,-26,0,5,3,2,24,1,0,-9,-8,-2,4,3,-3,-1,7,3,27,-119,0,2,7,-3,1,-33,-23,2,22,8,2,-23,3,-1,8,-1,0,7,5,1,1,-5,-2,-1,1,1,-5,1,-6,-2,4,-4,2,1,-1,7,-1,-6,-1,9,7,4,-12,4,26,30,-4,-1,-13,6,5,9,2,3,5,-5,-1,-4,-9,8,-5,1,-6,3,-4,17,2,-2,-10,2,17,3,7,-6,5,-3,-5},
-                                                {3,13,9,4,28,6,3,-4,-5,-11,2,0,-9,9,-13,2,-3,1,-1,0,-2,-1,-3,4,16,-6,5,-10,1,5,2,-11,0,7,62,34,-9,-2,-1,4,7,3,6,2,-1,9,8,-4,9,0,2,9,27,-15,-4,-4,10,10,7,-3,-3,-7,6,2,-9,0,0,3,-8,-12,2,-19,-1,4,-31,4,4,4,-27,2,-1,-22,3,5,6,3,-7,-10,27,-9,1,-1,-3,2,-16,-14,-3,-13,0,0,28,2,-6,-9,1,-3,-2,10,-8,-7,6,85,12,19,-13,8,-11,1,5,-3,13,9,-5,0,-10,3,5,-10,31,2,6,3,-2,-1,-1,1,1,-33,59,-1,4,-9,-11,7,11,0,3,-9,10,17,1,-3,-7,1,-4,0,-6,19,-11,1,60,2,-1,-6,0,-139,-13,2,-15,-3,6,-3,6,2,-4,2,6,39,-118,-2,-2,7,-4,19,-37,-31,-4,-124,4,2,-5,4,-1,5,0,9,8,6,0,1,2,4,-3,3,0,-1,-1,-6,-3,8,-1,-1,0,4,9,-2,3,-4,12,5,25,-7,4,31,34,-3,-1,-2,5,5,28,4,-4,5,1,3,-6,-10,7,-6,4,-5,4,-9,16,2,0,-14,4,3,12,3,-1,1,-9,-6},
-                                                {10,12,2,3,2,13,-116,0,0,6,-2,37,-5,0,-4,5,1,0,4,2,-1,5,3,28,-8,8,-25,-5,5,-1,-29,-8,-1,-2,-7,-3,-5,-4,-2,-2,-1,3,6,18,3,6,15,-4,2,10,-3,2,6,0,-7,-2,-1,-21,12,-3,3,6,-6,-2,5,7,2,-4,0,-4,5,4,-9,6,-7,0,1,5,-11,2,-9,3,6,-1,65,4,-6,0,5,-8,5,-5,1,16,3,-14,4,1,1,5,-1,2,-4,5,3,-3,-1,4,-6,-1,10,9,3,-7,-11,1,-2,6,-2,3,-2,9,0,0,-3,-4,6,2,-8,1,-15,-22,-1,5,-3,-1,2,-5,-13,42,3,0,-3,-28,8,3,3,-3,14,9,3,-93,-1,0,8,-3,-5,11,3,5,-12,8,1,-3,0,1,3,11,0,1,-2,-1,3,-30,-7,2,-6,7,8,-2,0,4,2,-5,-7,-8,37,4,3,-1,11,7,-3,-18,-4,4,-1,-3,7,-3,8,-1,32,0,9,0,2,-2,0,2,5,-2,0,-1,15,3,3,-2,1,1,-4,0,4,2,-5,14,-1,7,9,6,-4,5,1,-1,-1,65,19,-9,12,-1,2,-2,-11,19,4,4,8,-7,6,13,2,3,7,-1,0,-6},
-                                                {3,24,-8,2,3,9,-90,2,1,1,-4,-3,-5,2,-4,-4,-1,-4,0,3,-2,5,3,-7,-5,-11,-51,-4,-12,5,98,-11,-2,-14,-1,0,-4,3,5,2,5,26,2,0,6,-1,-21,2,2,8,-3,-10,-6,3,-3,-3,-3,-12,10,-7,-6,4,-7,-1,0,4,1,2,2,12,-1,2,-5,0,1,-9,3,0,6,4,-7,2,32,-4,98,6,4,-7,8,-15,4,-5,12,23,7,-1,8,-1,2,2,-1,5,-6,2,7,-4,-1,3,3,3,5,-2,-9,-2,5,1,-5,3,-4,5,-23,-3,5,0,-11,7,7,3,-5,-4,0,-37,-5,11,-6,-2,-2,-1,0,8,2,5,-3,-35,10,1,-3,-7,17,7,4,1,-1,-3,6,-5,-4,-20,1,-7,2,5,1,-13,3,3,16,4,-11,4,-5,1,13,-46,-9,1,-3,4,0,-1,0,13,-2,-9,-1,0,3,3,0,-3,-1,9,-5,-28,-3,10,9,-6,6,-3,10,-13,45,2,0,-2,5,-4,4,11,1,-10,-3,-6,11,1,14,3,-2,-5,-7,-1,6,6,-3,9,-6,4,8,8,-5,-9,-3,0,0,-48,26,2,3,1,-2,2,-11,21,-1,3,2,8,6,4,-3,0,13,-3,-2,-9},
-                                                {6,20,-3,-3,9,10,-132,-2,1,2,-5,-119,-6,9,-5,2,2,6,0,-8,4,2,3,28,-9,5,-24,-1,4,-5,-28,-5,-9,-7,-1,2,-5,-3,3,5,1,0,3,4,8,8,3,-8,6,8,-7,2,5,11,-8,5,-2,-11,10,-4,5,3,-8,-10,14,4,-4,-6,1,-3,1,6,-7,8,1,1,-5,3,4,6,-8,1,16,-1,67,8,-1,-4,7,-5,4,-5,3,19,11,-16,7,1,0,2,4,3,5,4,11,-3,-7,1,-3,0,2,4,-8,-5,-9,-1,-5,5,-1,13,-4,6,0,-8,-1,11,0,5,-5,5,-12,-25,0,8,-4,-2,2,2,0,43,6,-6,-4,-33,5,2,-4,-5,15,4,5,36,-3,-2,5,-4,-8,-7,-6,0,1,5,-2,5,2,4,1,15,-3,6,2,5,0,55,-10,1,-6,5,4,-10,15,4,0,-4,0,-1,35,3,6,-4,13,15,-4,-29,3,2,2,-4,10,-1,8,-10,29,0,13,1,-2,-3,2,8,1,-12,-1,-3,13,-9,6,-4,10,0,-9,6,7,4,-3,7,-3,3,7,2,-5,2,6,0,-3,-27,19,-8,6,2,4,-5,-6,21,0,7,1,-3,8,3,2,-1,2,-4,3,-3},
-                                                {9,9,3,2,6,5,18,4,-10,6,-2,23,-4,7,-2,-3,-3,4,2,0,-3,6,1,-116,-1,4,58,-5,-1,0,-21,-7,1,-2,-1,4,2,-4,2,8,0,7,3,-2,7,3,4,-5,2,3,-17,2,-3,2,-4,4,-1,-10,5,-5,4,5,-7,-4,0,4,5,-3,-8,-4,-2,3,-6,6,-1,5,-1,-1,1,-2,1,-1,0,-11,-20,1,0,-4,3,-1,0,-7,3,11,6,-14,1,0,0,4,3,5,-12,5,6,-3,-2,4,-5,4,5,0,2,-2,-5,4,-6,7,-4,5,-8,1,-1,1,0,6,-1,0,-3,-1,-10,-21,0,6,-6,-3,2,1,-1,26,1,4,1,-19,10,1,5,-6,5,10,-1,-97,1,-17,5,-6,-13,-2,2,-3,-2,10,4,0,4,8,8,7,2,-1,-5,7,4,-16,-10,6,-6,4,3,-1,-5,-2,-4,-7,-1,1,17,4,3,-3,5,6,-6,-24,-4,5,4,-6,3,-17,10,-1,27,2,8,-2,4,-6,0,12,2,-5,3,-5,6,-2,3,3,1,-8,-6,2,6,2,-3,7,0,5,5,3,-6,1,7,-2,-5,69,11,-3,8,1,-15,4,-11,6,-2,1,-4,-1,3,9,1,1,7,-2,2,-5},
-                                                {11,11,8,5,4,7,46,6,4,0,-2,44,-3,15,-5,3,2,2,0,3,-2,-2,0,-120,-11,3,68,-2,14,-89,77,-11,3,-8,3,-1,-3,-2,5,-2,10,2,10,10,5,18,15,-6,7,8,-4,10,-1,6,-10,-1,-6,-23,11,-3,11,2,0,1,13,7,0,-6,-7,-11,2,4,-22,6,8,5,5,-13,4,6,-8,-2,1,-1,-36,2,-5,-2,7,-15,7,-1,8,18,3,-26,-1,5,-2,2,1,3,3,-16,3,-7,2,6,-11,-1,3,3,-4,-10,-18,-2,0,7,-4,10,-5,2,3,1,-13,10,-3,4,-3,6,-22,-48,1,9,-3,1,4,8,0,34,5,0,-9,-51,9,2,2,-4,13,6,1,46,4,2,9,-4,-14,-9,5,10,4,2,2,2,7,1,3,18,-6,-12,1,2,4,-39,-9,3,0,5,0,1,1,-14,6,-5,1,1,53,3,3,-4,14,11,-4,-35,2,5,1,-5,11,-4,5,3,35,-5,12,-9,1,-2,-5,4,-6,-6,-1,-7,18,6,1,-13,8,1,-6,2,10,4,-7,-38,-4,4,9,10,-20,-8,4,5,18,-43,27,-15,4,-2,5,-5,-20,34,-8,0,6,-1,1,11,2,1,4,-6,-1,-9},
-                                                {-2,2,8,1,8,7,19,5,-6,10,-2,-114,-4,7,-4,-3,0,1,5,1,-1,7,1,-116,-5,4,55,-4,2,7,-20,-6,-1,-8,0,4,-12,-2,8,-5,2,11,4,2,6,-1,2,-3,0,5,-4,6,-1,6,0,-7,-2,-1,8,-2,4,5,-5,0,8,3,6,-4,-6,-1,3,5,-3,6,3,3,1,0,2,3,-8,-1,9,-3,-21,2,-2,-9,10,-3,2,-6,5,11,9,-8,5,-2,-4,0,4,5,-6,9,7,-1,-3,4,-4,7,4,2,2,-2,-7,2,-5,7,-3,4,-1,4,2,3,-1,4,3,1,0,0,-8,-21,-2,6,-4,-13,-3,2,1,28,1,0,0,-18,15,3,-1,-2,9,5,6,24,-3,-5,5,-4,-9,-5,9,10,0,4,3,1,0,8,10,11,1,-3,-8,3,3,57,-19,4,-5,6,4,-1,5,4,-10,-1,0,1,16,4,9,-3,8,9,-15,-18,-2,2,0,-6,2,-8,-4,8,26,5,11,2,3,-15,0,0,-3,-4,3,-4,6,-1,5,5,0,-2,-6,-1,9,3,-6,11,-4,2,6,3,-7,0,-5,-1,2,-19,9,-6,11,-4,-5,-2,-9,6,7,4,-9,1,0,8,0,-2,6,-2,4,-5},
-                                                {5,15,6,6,8,8,31,-2,4,-5,-4,36,-4,8,-4,-3,-12,3,1,0,3,9,3,39,-8,4,-35,-4,4,-1,-34,-4,0,-4,-2,3,-1,-2,1,5,5,0,5,5,3,7,-8,-5,2,4,-3,2,3,3,-5,-4,-4,-15,4,-15,5,3,-7,0,2,5,-3,-2,-3,-6,6,4,-10,5,2,1,2,1,1,5,-7,0,0,-3,-27,3,0,-5,2,-2,-9,-1,0,8,9,-11,1,0,-2,4,2,6,1,1,7,-2,-2,0,-5,8,5,2,-2,-7,-6,1,-5,8,-2,6,-10,5,0,-1,-7,11,-1,2,-3,4,-15,55,3,7,-8,-1,6,1,-1,-108,5,-4,-2,-34,2,2,-2,-6,9,1,1,-118,2,0,2,-12,-8,-11,7,10,3,4,-2,-5,4,6,4,8,-9,0,-4,3,5,-38,-9,-2,-14,3,2,-2,1,1,0,-13,-3,2,31,3,7,-9,10,2,-3,-26,-14,5,4,-19,1,-3,5,6,26,-1,2,-1,6,-6,0,2,-1,-8,-1,-2,8,2,0,-4,9,0,-8,1,3,2,-5,23,-23,6,8,8,-7,5,-1,1,9,61,15,-10,7,-2,1,-6,-10,14,-5,0,3,2,0,14,1,5,7,-8,3,-9},
-                                                {15,14,13,2,6,7,23,5,-2,7,-1,23,-4,-3,-1,1,4,5,-2,1,-2,6,-9,16,-7,2,-21,-4,0,1,69,-4,-2,-7,3,-2,-5,-2,6,-4,4,23,7,5,6,-1,-3,6,0,4,-6,1,5,9,-5,-2,1,-11,8,-6,8,-6,-4,-2,12,3,5,-3,-3,-2,1,6,-3,-2,3,0,2,-3,2,0,-9,-6,3,-3,-20,3,-3,-3,8,-7,2,-3,8,14,5,-9,10,2,-1,3,1,4,-5,5,7,-5,2,2,-6,4,7,1,0,-1,-6,0,-5,5,-5,7,-6,7,-3,0,-5,-1,4,1,1,2,-16,66,0,6,-1,-2,1,1,-2,-115,8,4,-2,-22,12,2,4,-5,11,7,2,19,0,-2,12,-6,-8,-6,-3,18,3,3,2,3,4,4,7,1,-6,-3,0,6,2,-19,-6,6,-2,6,1,-1,2,3,-2,-6,-2,-2,20,2,9,-3,-10,9,-3,-18,-4,1,8,-4,6,-3,5,-4,29,1,1,-3,3,-6,3,5,2,-6,2,-5,9,2,5,5,4,-1,-4,-5,5,1,-5,-63,-5,-8,7,6,-6,-5,4,3,-6,-18,16,-7,5,-3,1,-1,-8,14,2,1,0,0,5,14,0,5,6,0,2,-7},
-                                                {2,20,1,4,8,9,29,-3,1,10,-10,-129,-12,8,-14,3,0,-4,3,2,-1,6,5,39,-6,1,-41,-13,5,1,-36,-10,0,-1,0,-1,1,-2,3,8,6,-1,4,2,3,6,16,-4,4,10,-6,2,-6,11,-8,-10,10,-14,12,-8,0,2,-6,-1,14,2,1,-4,-6,-11,7,3,-7,4,0,0,5,2,-1,2,-8,-6,3,-2,-28,7,-6,-15,6,-5,5,-2,1,9,5,-10,1,-11,2,3,4,6,3,2,3,-2,1,11,-7,-1,8,5,5,-3,-12,3,-15,2,-3,5,-7,6,6,3,-4,4,1,-13,-6,1,-14,55,-4,6,-6,-1,2,1,-2,-99,4,-3,-7,-37,9,-2,0,-14,8,9,4,37,2,-1,10,-8,-8,-7,2,0,1,5,3,0,3,2,2,8,4,0,-2,-4,6,52,-7,-3,0,6,2,-2,0,4,1,-7,-3,-2,32,0,3,-4,9,5,-2,-20,-2,10,6,-7,7,-3,4,2,28,-3,3,-2,4,-4,1,6,1,-1,-1,1,11,3,9,-4,4,-1,-1,2,5,2,-5,18,-5,3,6,7,-3,1,1,0,1,-41,18,-10,9,-6,2,-1,-15,16,-7,3,1,-9,9,8,-5,5,4,-1,-5,-4},
-                                                {-10,4,5,35,-2,7,3,-2,2,3,-1,4,-3,-7,4,-1,-1,-5,1,57,2,5,-2,3,-17,-2,-1,-2,-17,-4,3,11,60,-1,-9,0,-1,-9,1,24,0,9,2,6,4,10,4,-5,1,4,0,0,6,-1,-7,6,2,17,5,1,12,-1,6,54,0,30,-2,-1,3,-10,2,10,16,5,-12,5,-30,-2,-13,5,-5,-11,12,-2,6,35,-10,4,-7,11,5,-5,-1,0,7,-15,-2,-3,-3,6,-1,1,-2,3,-5,-1,-24,6,39,-3,0,6,8,-25,15,-3,3,6,1,-2,-14,13,2,-37,-18,7,1,2,-10,-2,11,3,0,3,1,3,1,-4,-13,2,1,-10,18,3,-22,-3,0,-2,12,-20,-109,3,3,-2,-10,5,1,15,3,-17,-13,34,-3,-5,0,-4,-5,8,-1,0,4,-4,-10,4,-1,3,-4,2,3,-24,-10,11,3,-12,-7,-11,-4,-2,0,0,0,9,4,1,-1,-3,-5,2,-1,-2,5,9,-2,-113,9,3,-147,8,-1,-3,3,-8,-2,5,16,-31,1,-2,6,15,-7,3,3,2,-6,1,6,-3,4,4,-12,-2,28,5,-25,3,-10,-14,-31,-5,0,-3,7,-11,4,32,7,0,8,-18,25,2,0,4,0,-2},
-                                                {-11,0,2,19,0,3,-3,0,0,12,-4,-6,-6,6,1,-2,0,-5,1,58,3,4,-3,-2,-9,-5,-14,-1,-6,1,-8,12,-20,-7,-3,5,0,-7,4,-23,1,12,-4,0,4,0,-26,-3,3,1,-3,-1,5,9,-7,-5,-1,5,7,-2,11,-1,3,-23,10,21,-2,10,7,-9,-2,10,13,-1,-4,-1,-22,-6,4,2,-6,-7,28,-2,-8,23,-4,-2,-2,0,5,-4,5,-7,13,-12,3,-2,-4,1,1,4,-6,2,-1,-2,-19,3,40,4,-2,2,-3,-14,8,-2,0,4,-2,0,-11,5,-1,-13,-16,5,3,2,-7,-4,2,-7,-2,5,-1,1,1,3,-1,-1,-2,-3,13,7,-19,-2,-1,-4,8,-17,27,1,3,-4,4,2,0,-15,-7,-6,-2,28,0,-5,2,1,3,10,-6,-4,-3,1,-5,-11,-1,-4,-5,0,2,-23,10,13,1,-5,-2,-4,-10,5,-3,-4,-2,7,2,-8,1,6,0,1,-1,-5,3,11,-1,33,15,1,-154,4,1,2,-2,3,2,0,8,63,7,2,6,13,-9,-2,4,7,-3,-8,0,-7,5,3,-6,-6,23,4,-19,-13,-8,-8,-26,-1,-1,2,3,-18,-5,24,3,5,6,-16,4,-3,-1,4,-3,-5},
-                                                {1,11,-2,40,5,7,0,-3,-1,-14,-1,3,-6,7,2,3,0,2,-4,90,9,4,-3,6,-2,-8,1,4,-14,0,4,31,-49,-11,-1,2,0,-3,4,5,3,6,-3,-8,5,2,-9,-9,4,5,1,2,9,8,-4,-15,2,8,11,3,9,0,1,-38,18,-76,-8,-1,9,-4,-2,22,16,8,-4,-1,91,-1,4,7,-8,-8,23,-2,7,24,-2,2,-2,10,4,-3,1,7,12,-7,0,-4,-4,2,3,5,-3,6,2,2,-33,7,24,-3,-4,1,-2,-14,28,-6,1,6,4,7,-9,12,4,93,-11,2,-7,2,-2,1,8,2,1,4,3,3,0,6,-1,5,5,-4,25,1,-23,1,0,-2,21,-18,20,6,-3,-5,3,4,4,-3,-6,-38,0,-57,-6,-1,-1,2,-6,12,5,5,6,3,-40,3,0,-5,-2,2,2,-38,-21,11,2,5,1,-4,0,0,3,-2,5,19,3,9,9,1,0,2,4,1,4,4,4,29,20,8,-72,8,2,5,0,-14,-3,3,18,-36,3,-2,-2,15,-5,8,7,3,0,-4,2,-4,6,4,-8,-4,45,6,-7,4,-5,-11,-21,1,4,-5,12,-7,1,26,3,3,12,-14,7,-4,-3,3,1,28},
-                                                {-13,1,3,23,5,4,2,0,-8,-12,2,2,-5,1,2,-2,-2,3,-2,-19,-1,3,-3,1,-16,-7,1,-3,-22,-1,0,11,58,-1,0,6,7,-7,0,-15,2,9,-3,-5,7,6,5,-7,0,7,-17,-2,3,4,-3,-1,1,0,9,0,13,-2,4,-19,1,13,-1,2,7,-11,-6,12,14,7,-3,9,-21,-2,0,-1,-3,-8,0,-11,4,-131,-3,1,-7,3,-1,-4,-2,-2,11,-11,-4,-1,-4,5,1,3,3,6,1,-2,-25,4,39,3,1,0,1,-15,11,-1,-1,7,0,1,-4,4,-1,-17,-15,2,-4,-1,-1,1,5,2,3,-2,-2,0,0,3,-1,4,-3,1,18,4,-23,-3,4,-1,7,-19,-95,0,5,-20,6,0,-4,8,1,-18,-2,23,1,-5,0,3,3,5,12,-5,-1,6,-6,3,0,3,-4,-1,2,55,11,7,-1,-18,-1,0,-5,2,5,-3,-4,4,3,-2,-1,1,2,-2,-1,-16,-3,11,-2,30,12,1,16,3,-1,4,0,22,2,0,11,-28,0,2,10,-6,-7,3,4,0,0,-7,5,-3,6,3,-7,1,27,2,-25,3,-11,-10,-23,-2,-18,3,5,-14,-5,18,-2,3,2,-12,6,0,-1,7,3,1},
-                                                {-22,-1,6,63,5,-2,4,3,2,-3,3,2,-3,-2,3,0,-1,-1,2,-46,-5,-4,0,-1,-19,-8,4,1,-12,-7,8,29,-59,3,2,0,6,-8,6,-2,0,4,4,9,5,13,2,-4,4,-6,0,-6,6,6,-2,4,3,16,7,0,3,-1,13,67,7,35,-3,0,11,-17,4,10,13,4,2,5,68,-12,1,9,-4,-12,-2,0,6,-119,-4,8,-5,12,5,2,7,-6,4,-20,-3,0,-6,2,2,3,6,7,-5,-8,-76,6,32,-1,-3,3,16,-25,17,-2,7,7,-2,2,-20,-3,-3,-56,-25,8,-9,1,-3,-2,0,3,-1,5,3,3,1,8,2,7,-1,-29,20,-2,-23,-3,2,-1,10,-33,33,5,-5,-1,-1,5,2,8,2,-11,4,-123,10,2,4,-2,-2,10,-3,-14,8,-2,-32,7,-1,13,1,-1,0,64,1,-10,4,-32,3,0,-3,0,0,-1,2,30,7,7,3,2,-4,-1,7,-2,2,13,4,-113,9,-4,33,8,-7,-5,-5,-12,2,-8,11,66,3,-8,6,7,-9,5,8,5,-4,-5,2,-4,2,4,-20,4,39,12,-22,4,-15,-17,-30,-4,0,-4,6,-26,-1,29,4,8,-2,-23,8,-2,-2,3,-2,27},
-                                                {-11,-4,-1,18,4,3,1,5,-2,2,1,0,-4,3,1,-5,-3,-1,0,-15,3,8,-3,0,-10,-5,0,2,-16,7,2,11,-18,-12,-1,6,-9,-6,3,3,1,10,-7,-3,5,2,21,-5,-3,1,0,0,-1,6,-5,-8,2,16,-2,2,3,1,3,-23,11,-144,0,1,0,-8,-1,8,14,4,-1,12,-22,-6,0,11,-1,-7,9,-6,4,-109,-6,1,-1,9,2,-8,1,-7,13,-9,1,-3,-9,0,3,4,4,7,-3,1,-23,5,37,4,-4,2,4,-17,13,-4,-1,7,-3,0,-3,8,6,58,-12,3,0,2,-3,-6,7,0,-1,6,-1,-11,-3,2,1,1,-1,-6,18,3,-17,-1,0,0,8,-20,20,0,-1,-6,2,4,1,17,-1,-1,-1,28,-4,-4,-1,3,4,8,1,-4,-13,2,-6,6,-13,5,-6,0,1,63,-14,6,-10,-5,0,-3,-5,2,7,-4,0,6,-10,6,0,3,-7,-1,-1,-12,-4,18,-2,27,9,6,20,-9,-2,-3,-6,-2,0,0,9,-24,2,4,7,1,-6,2,6,1,-3,-3,-2,-8,6,1,-11,-3,19,3,-24,2,-8,-9,-24,-5,-7,-1,1,-15,3,26,-11,7,-2,-8,-4,0,-1,3,3,-2},
-                                                {-11,4,12,60,5,5,1,-1,4,14,-1,2,-2,1,5,-3,-13,1,-1,-24,6,6,0,2,-16,-7,2,-1,-3,0,5,34,58,-5,1,4,-2,-8,2,-8,4,4,-1,-2,4,9,-3,-4,1,-3,0,-7,5,0,-4,-10,-1,8,-1,-11,9,-3,5,-29,3,27,-6,3,13,-12,0,11,7,2,-1,4,57,-6,0,10,-1,-16,-1,-2,5,34,-2,3,-4,12,-9,0,-3,1,13,-15,-5,-2,-8,3,3,4,2,-3,1,-3,62,5,34,7,-6,3,0,-24,14,-3,1,6,0,2,-9,8,-11,-41,-18,2,-5,3,-1,-2,7,1,5,1,-3,0,4,2,2,1,4,-25,18,3,-24,-3,2,0,8,-27,-122,1,2,0,4,-5,0,7,0,-8,1,-145,-6,-6,4,2,-1,1,-4,-3,-1,-2,-13,3,1,1,-14,-4,1,-34,-1,4,2,-17,1,-1,-8,2,4,-8,2,20,5,6,-11,7,1,-14,-7,-4,-1,23,1,25,1,4,29,6,-2,-1,-1,0,-2,1,10,-33,-1,0,5,15,-9,5,1,4,-2,-4,-15,-3,6,4,-13,1,31,6,-19,8,-10,-16,-17,-3,1,-5,6,-18,-7,-121,3,12,-1,-17,7,3,1,0,-2,19},
-                                                {-9,7,13,23,6,5,1,0,2,-5,2,5,-3,-12,4,2,2,5,-9,-20,1,8,-16,3,-11,-7,0,-2,-23,-1,5,12,-29,-5,1,1,-3,-5,4,15,4,19,0,2,6,3,7,-6,-1,6,-4,1,8,11,-6,-1,3,15,6,0,9,-10,5,-30,10,15,1,0,5,-9,-1,11,15,9,-1,1,-27,-9,1,2,-6,-5,0,-3,2,18,-6,2,0,6,0,-4,1,-10,12,-10,1,-1,-5,1,3,4,-10,5,0,-4,62,5,43,4,2,-1,4,-14,11,-2,1,4,-3,2,-7,10,-2,-18,-16,5,0,0,-5,2,0,1,1,3,3,3,0,1,-4,-4,4,2,17,2,-14,-3,2,-1,9,-22,19,1,4,-4,2,-1,-3,10,0,-12,-1,22,-5,-2,1,2,4,-2,4,-4,0,4,-7,0,1,3,-2,2,2,-32,4,8,2,-18,-1,-4,-2,1,5,-4,-18,4,3,2,-1,1,-2,1,1,-2,-5,11,1,31,0,-2,22,2,0,0,-3,12,-1,-1,11,60,-1,2,9,7,-6,-9,4,2,-2,-6,1,-15,4,4,-8,-5,28,5,-27,3,-8,-9,-28,-4,-3,1,1,-8,3,-136,1,7,3,-10,-2,3,-7,6,0,-1},
-                                                {-13,12,2,39,7,5,4,-4,2,-1,-3,0,-13,3,-10,2,-2,-3,1,-24,0,5,0,7,-14,-4,3,-13,-18,8,1,10,-35,-2,-2,-2,2,-9,2,-45,2,5,1,-2,0,10,-13,-6,1,5,-1,-2,-5,10,-7,5,10,3,11,-2,11,-3,4,58,16,-154,-2,3,9,-12,2,8,11,4,-5,4,-20,-5,-2,3,-6,-19,12,-2,4,33,-4,-8,-7,2,4,-1,-2,1,12,-13,-4,-11,-3,-1,1,5,-1,0,-4,-1,68,10,41,-3,0,3,16,-18,15,1,-11,1,-2,2,-9,13,3,58,-14,6,-3,-12,-4,-2,7,3,-1,3,-3,0,0,2,-2,0,3,-18,20,4,-25,-4,-2,-9,10,-20,30,3,1,-1,7,4,1,-14,-1,-13,2,29,-2,-4,1,-1,-7,5,5,-4,1,-8,-15,7,-2,1,0,-1,1,-35,9,8,0,-20,-1,-3,-4,-4,5,-6,0,9,3,6,0,0,1,-1,0,-2,10,18,1,-111,2,4,29,4,-1,2,3,-6,-2,4,14,-20,8,1,4,14,-6,3,4,-4,-5,-5,1,-7,7,4,-6,0,32,5,-25,1,-12,-15,-34,-16,0,-1,6,-17,-8,-112,4,0,4,-17,3,4,0,3,-3,0},
-                                                {8,-12,4,-6,-6,9,3,3,-106,-3,2,10,-5,5,5,11,0,5,5,-1,-2,1,-1,6,19,2,-1,-6,-19,1,-5,-8,2,-1,-13,3,10,-9,-4,-1,-2,8,7,8,2,-2,-10,-4,4,6,-29,10,6,-12,-6,4,0,-18,-48,6,8,3,4,-2,-17,9,5,1,-6,0,-2,9,0,7,-6,8,-4,8,-10,37,42,-1,0,75,-1,5,-7,-1,4,-7,0,-6,2,6,2,6,3,-5,-2,10,3,0,0,3,5,1,-2,1,1,1,4,10,-5,19,-3,3,-2,6,4,-3,-5,-11,-15,-3,24,5,4,-4,-1,0,7,-1,13,39,3,7,0,-7,-8,7,1,1,-4,7,7,3,2,1,-2,11,4,0,3,-39,-1,4,1,-4,8,-5,-10,8,-8,4,-128,-1,-11,7,27,3,1,3,2,-4,3,-4,-4,-2,5,2,-8,-2,4,-4,-7,-8,2,7,1,4,-5,0,3,7,0,2,-1,0,-2,-29,9,-2,0,6,9,0,7,5,-4,1,7,3,4,-1,-3,-2,-1,-2,-17,-13,-2,-3,1,-4,-6,8,12,4,7,1,-2,2,2,0,-5,0,-6,16,10,0,64,-4,8,1,1,9,9,-10,7,4,6,36,10,6,4,-3},
-                                                {7,-1,3,-6,-3,5,5,7,-107,4,0,5,-5,1,1,5,1,2,2,-1,-1,1,-4,-6,12,-2,-13,-3,-2,5,-14,-6,-4,-8,-2,4,4,-6,1,2,6,14,5,2,7,-4,-9,-4,3,3,-22,5,1,-8,-4,-12,-1,-8,-35,1,12,-1,4,-4,-10,5,5,8,-6,-4,4,13,7,5,2,3,-3,-1,4,27,34,-1,3,-33,-15,5,-3,-4,4,-6,3,-4,6,9,9,2,4,-3,-4,8,2,4,1,3,7,-1,-4,2,-2,10,3,4,-10,13,-1,3,-5,3,1,-2,-6,-14,-6,-4,11,7,7,0,-1,3,1,-8,7,29,0,3,-4,-3,0,1,-1,3,-5,8,9,4,-1,1,-3,11,5,-2,1,-27,3,1,-2,13,10,-1,1,2,-2,2,22,1,2,8,22,-1,3,6,1,-16,4,-4,-5,2,1,0,0,2,2,1,1,2,17,5,-1,1,-6,4,1,-10,0,6,55,-2,0,-24,4,-1,-3,8,9,-1,5,1,-1,-156,-1,-2,5,-4,-3,-5,1,2,-6,-6,-5,-7,5,5,-7,1,4,1,6,1,-3,-1,-1,1,3,-18,-3,14,6,1,59,5,14,-3,-6,5,1,-2,4,3,2,23,7,3,3,-2},
-                                                {4,5,6,-14,0,8,3,2,-127,-10,1,7,-6,9,1,12,1,7,3,-10,3,-2,-2,3,10,-8,0,-3,-10,2,-7,-3,-11,-7,-3,2,6,-6,1,2,-1,3,1,-5,7,1,-9,-4,2,2,62,-1,6,-13,-5,0,0,-1,-44,3,6,2,0,-11,-3,6,-1,-1,-3,1,3,9,-2,8,1,6,-12,2,3,44,39,-5,-3,-32,-1,2,0,-6,4,-3,-2,-5,4,12,10,2,2,-7,-5,3,5,3,-5,7,11,1,-10,-2,2,6,-2,4,-3,11,-1,0,-5,3,5,3,-4,-19,-11,-12,22,6,-5,-2,3,2,9,-5,7,-129,1,4,-2,1,2,7,2,-2,-5,0,9,5,-2,-1,-3,0,0,1,-2,-38,2,-1,-3,1,3,-3,2,3,1,6,42,3,2,16,26,3,-1,7,0,-5,2,-6,-5,3,6,-10,2,-2,1,-1,4,1,-3,2,-3,0,-1,8,2,0,4,-1,-6,1,4,-23,10,-6,5,8,12,-1,5,3,-3,-11,-5,8,2,-3,-3,-13,1,-1,-5,-18,-4,2,5,3,-4,4,2,2,5,-2,-5,2,5,0,-6,-2,-4,17,5,1,61,0,7,3,-5,4,0,-2,11,-2,3,25,5,3,9,3},
-                                                {-6,7,-9,-5,-3,5,3,8,-8,-8,-2,10,-5,2,10,11,0,7,4,-3,-6,0,-2,-3,10,-19,0,-4,-15,1,-5,1,1,2,-2,7,4,-2,-3,8,10,13,6,1,8,1,-26,-8,9,4,-50,-17,-13,-13,0,2,-6,-16,-38,1,-3,2,6,-3,-21,6,4,-4,-18,-1,24,6,1,7,1,12,-5,-6,0,1,38,1,-33,82,-1,1,7,-1,5,-12,-1,-2,2,3,7,6,-2,-5,4,7,3,1,4,-7,8,1,-2,0,5,5,5,-2,-5,19,-5,6,-6,4,1,-6,0,-7,-18,-3,30,1,7,-5,-9,3,13,0,16,9,-3,0,-1,1,-1,6,-4,9,1,9,-9,0,6,1,-4,13,-1,-4,-6,87,18,0,4,-10,4,-18,-2,8,0,-18,-88,5,10,2,0,-3,6,10,8,-3,6,7,-3,3,3,4,-14,-5,0,-15,-3,3,-5,5,-3,3,-2,0,-1,1,-2,-5,24,-3,-10,-50,10,-3,6,7,1,0,7,2,-3,-3,2,-14,8,-7,-4,-3,-7,1,-25,2,-5,1,3,-1,3,-4,1,-1,5,-1,-4,1,2,0,-3,-2,-2,28,0,-3,-44,5,4,-8,-8,5,1,-2,6,2,-3,-103,12,7,6,-4},
-                                                {7,-39,3,-2,-4,5,5,10,56,0,6,11,-2,7,5,11,3,8,7,-2,-4,-4,2,1,17,-7,3,-4,-11,4,-2,-12,6,-5,2,0,9,-9,-1,3,-9,7,9,-4,5,13,17,-3,5,-6,-38,8,3,-30,-4,-8,-3,-12,-69,10,18,5,8,0,-25,11,1,-2,-6,-7,-23,8,-11,8,5,0,1,-21,3,37,60,-12,-5,-21,0,0,-5,1,2,-17,-2,0,9,8,2,7,2,-3,-1,9,3,0,3,4,2,-2,-2,3,-4,0,2,1,2,24,-4,4,1,3,-4,-3,-11,-16,-18,-2,32,5,1,-3,0,-2,3,-3,6,56,2,10,-2,4,3,8,0,-2,-5,1,5,4,6,3,-9,7,3,5,10,85,7,4,-3,12,24,3,6,4,-8,14,33,-1,7,12,33,-19,11,7,0,-1,3,1,-1,-2,4,6,-3,-15,-1,-9,7,4,-2,1,-3,1,0,0,1,1,4,-1,-89,4,0,-25,7,-6,3,8,5,-9,8,1,-7,-100,15,-14,7,-7,-4,0,-3,-6,-24,-12,-5,-1,5,-1,-7,-2,2,8,1,-3,-15,-19,6,0,0,4,-16,29,-3,-3,-29,0,11,-14,-9,5,0,0,9,8,4,-99,13,2,5,-7},
-                                                {5,-19,3,-4,0,1,5,7,18,-8,-2,3,-4,-8,3,4,0,5,6,-3,-4,2,-4,1,15,0,2,-2,-13,12,-6,-6,-4,-8,-2,6,-2,-6,2,-3,4,10,3,7,5,-8,3,-1,1,0,72,11,-2,-7,3,0,2,3,-27,3,13,2,9,-1,-9,4,6,0,-1,0,9,7,-2,4,3,93,-5,2,2,25,25,2,-4,-21,-3,4,-2,-6,6,-11,-3,-7,5,-2,11,10,4,-4,-8,4,4,4,-11,8,6,2,-6,1,0,9,1,5,-2,17,-1,4,-4,4,1,-2,-9,-8,-12,-1,19,6,10,-5,1,2,9,-4,6,-103,0,-8,-6,-1,4,5,-2,2,0,7,10,7,4,2,-5,4,8,-3,-4,67,4,5,-3,-2,9,3,2,4,-3,5,27,4,7,8,20,-1,-11,4,2,-2,-7,3,-5,1,4,0,-3,-3,-8,-2,1,2,3,4,-1,0,-3,1,-11,2,-1,2,-11,-4,-6,-22,2,11,-2,9,8,1,7,-10,-5,-13,-9,-4,7,-5,-3,-5,0,2,-9,-1,-4,-3,5,0,-6,3,3,-2,1,-3,-6,-1,-1,-1,-1,-3,-7,22,9,-3,-15,0,6,-3,-3,4,-8,-1,2,1,0,-132,9,5,8,-3},
-                                                {4,-14,2,-1,0,8,7,3,40,1,3,10,-3,6,7,4,-8,5,4,-2,2,3,2,5,21,-3,3,-5,-9,5,-4,0,1,-5,-4,3,5,-10,-2,2,4,4,6,-4,4,1,14,-3,0,2,-31,9,3,-11,-4,2,-2,-10,-53,-8,18,0,5,-2,-23,6,0,3,-1,-2,7,9,-1,7,2,3,-2,3,0,-99,43,-5,-8,76,-3,3,2,-4,4,-7,-12,-1,0,7,10,11,-3,-5,-6,7,7,1,-8,4,9,-1,-3,0,1,15,5,3,-15,21,-4,1,-3,5,4,1,-12,-22,-10,-6,21,1,1,-2,-2,5,6,-2,19,40,-4,8,-2,-3,1,7,3,-6,-5,1,7,0,5,0,-9,6,2,-1,-2,-33,1,-5,-2,14,13,2,2,3,0,-2,-102,4,-10,4,26,-4,0,8,5,-7,5,-7,-13,0,0,2,-3,-3,1,-6,4,4,-2,4,8,-5,-2,-3,3,1,-8,2,-11,-13,-5,68,15,5,2,6,1,-1,7,1,-4,-6,2,15,4,-6,-3,-4,-2,-1,-7,-16,-6,-2,-1,4,-4,3,-19,5,6,-4,-6,7,0,1,4,2,-8,18,5,-2,-17,-6,10,-7,-10,2,5,-4,1,3,1,37,11,6,8,-7},
-                                                {12,-8,15,-6,2,4,4,8,26,3,3,7,-4,5,1,8,3,5,-3,-2,-1,0,-14,3,9,-2,-3,-5,-14,5,-5,-2,-2,-3,0,0,6,-5,3,3,4,17,6,3,4,-6,6,6,1,0,-21,2,6,-5,-3,-9,2,-1,-42,3,11,-7,6,-3,-5,6,8,2,-7,-2,-30,16,3,4,2,7,-3,0,3,-104,36,-3,-12,-27,-5,6,-4,-5,8,-6,-1,-7,5,8,8,8,7,-5,-6,8,5,2,-2,6,8,-1,0,3,0,9,5,4,-2,13,1,1,-5,4,2,2,1,-13,-8,-4,12,3,3,-4,2,3,0,-5,13,27,5,5,-5,2,1,-5,3,2,-2,7,9,4,6,-2,-6,10,2,0,4,-26,3,0,-2,-5,3,-3,3,4,-1,4,24,3,2,-2,14,1,1,6,2,-6,5,4,-1,3,5,2,-7,-1,0,-8,0,1,0,5,2,1,-18,4,3,3,-1,2,-152,-2,-3,65,0,-1,1,5,0,-3,8,0,-2,15,-3,16,6,-5,-4,-2,-8,3,-12,-2,-2,-7,5,-1,-7,1,3,-10,5,1,-7,-2,7,-1,-4,-4,-2,9,2,-3,-24,4,0,-1,1,2,0,3,7,7,0,27,4,6,4,-3},
-                                                {2,-9,4,-3,2,5,7,0,32,0,-5,4,-13,3,-15,13,0,5,3,-3,-1,-2,0,4,10,-10,4,-14,-7,8,-6,-10,1,-6,-4,2,11,-4,1,-6,0,8,2,-4,4,0,-11,-3,2,4,64,6,-4,-11,-2,3,8,-17,-38,1,4,-1,4,-5,-1,5,4,2,-5,-4,18,8,-4,4,0,8,-3,4,-2,-116,34,-12,-5,-30,-3,5,-4,-14,7,-10,-1,-3,0,4,5,11,1,-15,-3,6,5,5,-11,4,6,1,-2,5,0,3,5,3,-2,13,-3,4,-15,1,3,-5,-4,-15,-9,-1,18,5,-1,-16,-2,1,6,-2,11,-127,-2,3,-1,-1,0,4,-1,-1,-6,2,3,2,2,-8,-5,12,7,1,3,-35,3,0,-3,-14,14,-3,3,7,-11,8,43,-1,2,4,29,0,2,4,-1,-1,3,-3,0,0,4,0,-6,-2,1,1,1,0,0,-1,-2,0,-2,2,4,0,0,9,-15,-3,-1,58,8,-5,-1,7,-3,-2,7,1,-3,-28,2,-20,3,1,-4,-3,3,-2,-10,0,-3,-4,3,-1,-6,0,3,-2,3,1,-3,5,4,0,-2,-5,-6,14,4,-2,-22,2,9,-4,-12,5,-1,-10,7,-1,-1,29,8,5,5,-4},
-                                                {12,-21,8,-8,-7,-36,-4,37,0,-1,2,6,-1,3,-4,-5,0,-6,-3,-3,-16,-7,-1,-4,-10,3,0,0,8,-11,3,7,0,11,-14,-5,-2,-4,-141,3,22,8,-2,-17,-3,-2,-6,-5,8,3,-4,-8,2,1,-3,-4,-20,28,5,2,4,4,35,1,10,3,29,9,5,-5,-2,-27,2,4,-10,2,-1,93,-10,0,-6,45,7,-1,1,-3,-17,5,-5,8,-3,-35,-2,-11,-17,7,1,2,-5,3,-4,-3,3,-18,-8,-29,-4,8,-4,-102,0,5,-2,-12,-8,-8,4,-2,62,-2,-8,3,-20,-3,23,0,15,-1,-7,-3,-13,-1,-2,2,2,1,57,-6,-13,3,-5,-9,-7,6,-33,0,-1,2,-3,-16,0,5,16,3,-5,-1,-1,4,9,2,-14,-3,10,0,0,-8,-13,13,3,-38,12,-5,1,0,-1,-128,-3,-5,-5,1,3,94,5,12,-11,-9,-4,-2,-2,2,1,-10,2,-4,-1,-4,-7,4,-1,1,-13,5,-8,-7,15,-36,0,5,-18,2,-32,-14,-121,58,-6,0,-8,53,-3,-23,30,-4,37,-3,-8,2,5,4,0,-1,23,60,-11,31,-8,1,17,17,-10,-6,-4,-9,-4,27,1,4,4,11,-9,14,23,-1,-1,-5,-1,3},
-                                                {7,-19,-1,-2,-6,-31,-2,22,1,4,-3,1,-6,1,-3,-9,0,-6,-4,-3,-17,-5,-6,-19,-1,4,-13,-3,8,-123,-11,5,-5,0,-7,-3,-3,-3,24,0,-12,-7,-6,8,0,2,1,-2,6,-2,-7,-3,-8,9,-2,4,-24,-1,6,-1,9,2,-160,-2,5,0,30,-80,4,-3,-9,-14,3,5,1,-7,-2,-53,-2,-5,-5,18,9,-2,-13,0,1,-1,-4,2,-2,-15,-1,-17,-16,2,4,3,-3,-6,-6,-3,5,-22,-5,-27,-6,4,-2,28,-1,-2,-8,0,-2,-3,-1,-5,-20,3,-5,-5,-15,-5,13,-5,17,-1,1,-3,-10,-13,-5,-5,-2,-1,68,-1,-6,-2,-5,-5,-1,8,-12,-1,-4,0,-2,-13,1,5,-7,5,0,-2,-5,-2,5,16,-4,-1,-9,12,-5,-5,7,11,-7,-37,-4,3,-1,-15,-3,33,-6,-9,-6,0,0,90,7,12,-1,-3,-17,2,-9,-4,-9,-8,4,-15,-2,8,4,0,-2,-3,-9,-1,-9,-5,11,-22,0,-2,83,12,-54,10,-142,-17,-5,-1,-7,44,2,-11,10,-9,23,4,-3,-9,-3,-5,2,3,7,-50,-10,49,-4,-18,15,11,-11,-5,-6,-9,-29,20,-5,0,0,12,-37,2,-6,-8,-3,-4,-2,1},
-                                                {2,-11,-2,-24,0,-48,-2,-117,2,1,-3,3,-4,5,-4,-4,1,-4,-2,-12,58,24,-2,1,-4,3,4,1,-8,-7,4,25,-9,12,-5,-3,-9,-3,32,3,-21,2,-2,4,-1,-1,3,-4,11,9,-2,3,-7,12,-1,-6,-8,12,-3,2,-8,3,39,-7,19,0,-169,12,10,-2,-8,-31,11,3,0,-10,-10,-46,-1,1,0,38,11,0,1,-2,-3,1,-3,15,-1,-37,2,-9,-17,4,3,1,-5,-3,-3,0,3,-18,-1,-23,-11,4,2,23,-3,-1,-13,-3,-12,-8,0,-2,-38,4,-5,-4,-7,-11,20,6,-10,-2,-4,1,-11,-5,4,0,1,-4,60,2,-3,4,-5,-18,-11,-2,-46,-1,-4,0,-3,-22,0,5,3,3,10,-1,-3,11,-1,-1,-3,-1,11,4,-1,-8,-17,18,6,-48,18,1,3,0,-3,24,-2,-3,-1,-9,1,97,3,-8,0,-2,-3,1,1,1,1,2,0,-3,8,7,0,1,4,6,-12,2,-1,-1,15,68,-1,0,-19,6,-62,5,-119,-16,-3,-11,-7,42,3,-43,11,-2,37,-2,0,1,-3,-1,1,-4,11,48,-7,31,-13,-3,16,13,-11,-2,1,-10,2,27,-6,3,-1,11,-41,-2,3,-9,-6,-3,2,27},
-                                                {11,-20,7,-9,-4,-29,-4,29,-10,8,-2,0,-4,5,-2,-5,-2,-1,-8,-4,-19,24,-1,-11,-2,1,4,-3,-4,3,4,13,0,13,-7,1,-8,-4,-155,4,-124,6,-7,13,1,11,19,-8,4,-6,-19,-1,-7,1,3,-4,-26,-4,1,1,13,4,51,0,1,-2,32,-2,3,-3,-10,-14,-1,5,-2,-2,-3,97,-5,-11,-1,51,1,-7,2,-6,-1,2,-7,14,-7,-10,-3,-14,-18,7,3,3,-4,-7,-3,-2,1,-35,-4,105,-2,5,-3,38,0,-3,6,-1,-4,-1,0,1,63,2,-15,0,-23,-5,21,0,-24,-5,-5,-2,-13,-1,15,-4,-3,-3,-19,1,-6,1,-6,-2,-2,6,-16,2,1,0,-4,-12,-4,0,2,-18,6,-5,-9,6,10,3,-8,-2,0,8,-4,-3,4,7,10,-38,-4,10,-1,1,-3,34,-3,-7,-5,1,-7,-57,3,-12,-1,-2,-9,3,-1,-3,-5,-12,0,-14,-2,7,-4,-1,-3,-17,-8,0,-7,-5,7,-32,-2,-5,-21,11,-33,-6,29,-18,-4,0,-11,39,5,-9,14,-1,28,-1,0,-10,1,0,0,-4,8,-32,-6,-132,-7,1,15,18,-16,-3,-24,-2,-16,24,-6,-1,-4,12,-26,9,-1,-13,-4,-3,1,5},
-                                                {-68,-76,-77,-53,-42,-99,-43,1,-35,-17,-21,-35,-62,-45,-77,-54,-37,-48,-47,-51,59,-52,-59,-54,-92,-44,-29,-60,-34,-66,-51,-31,-37,-38,-42,-49,-2,-42,-9,-37,-32,-61,-46,-43,-71,-34,-38,-41,-46,-57,-47,-130,-66,-18,-43,-14,-120,-23,-45,-29,-36,-44,-135,-38,-50,-63,-151,-39,-50,-63,-29,-78,-7,-38,-38,-104,-51,-149,-49,-42,-51,-11,-66,-58,-63,-47,-93,-40,-54,-36,-34,-115,-37,-66,-38,-39,-1,-37,-72,-63,-61,-77,-10,-70,-74,44,-42,-42,-46,-130,-42,-98,-42,-49,-83,-57,-50,-63,-99,-33,-44,-37,-53,-52,-20,-55,-51,-40,-58,-33,-56,-30,-85,-40,-62,-33,-137,-31,-31,-33,-43,-3,-47,-36,-107,-7,-39,-37,-62,-72,-37,-41,-47,-54,-50,-39,-66,-19,-36,-38,-65,-91,-16,-53,-56,-72,-12,-24,-44,-113,-21,-51,-53,-33,-29,-151,-22,-46,-41,-32,-74,-136,-32,-39,-42,-51,-53,-35,-30,-59,-47,-69,-58,-38,-48,-75,-28,-44,-36,-27,-48,-45,-60,-49,-60,-104,-64,-60,58,3,75,-14,4,54,-37,-39,-30,-22,-29,-83,22,-33,-16,-74,-52,-11,-57,-36,-50,-47,-21,-113,-15,-144,8,-39,-42,-47,-29,-38,-34,0,-55,-12,-16,-44,-38,20,-54,-27,-68,-54,-25,-50,-35,-11},
-                                                {2,-34,-3,-4,-4,-40,-4,-127,-7,-3,-4,-4,-3,-2,-6,-13,-1,-5,-3,-6,-18,-115,-3,-8,-9,-1,7,-1,5,22,8,6,-1,-2,-2,-1,-8,-3,23,4,10,15,-6,7,-1,6,-17,-7,1,2,-8,2,-4,10,-6,4,12,13,4,3,8,5,59,1,15,0,32,2,6,0,-4,-12,1,5,2,3,-4,-35,-4,-2,-2,36,0,-7,0,-3,-3,-2,-1,-3,-5,-13,-1,-19,-12,7,5,1,-8,-3,-1,-1,-11,-33,-3,109,-7,3,-3,30,0,-2,4,-4,-2,-4,-2,-3,-32,-2,-4,7,-7,-1,21,-11,-141,-4,-2,-1,-11,-3,-4,-3,2,-14,-6,2,-3,0,-7,-8,0,8,-3,4,-2,3,-5,-8,1,-1,-4,-1,5,1,-7,-6,9,9,-2,-1,-7,10,-9,-6,16,8,10,-66,-20,-1,0,2,-17,40,-8,-5,-3,-2,-2,-54,-12,16,-1,-2,-6,5,-2,-4,-5,-13,-13,-6,0,4,-3,0,-4,-9,-14,-3,-9,-2,7,74,-2,-9,-23,3,-53,2,30,-17,2,-2,-11,34,0,10,15,-3,28,-3,-6,-6,-7,-4,4,-2,6,-46,-14,-173,-6,-2,13,13,-6,-6,-13,-12,-17,20,0,-3,-14,17,-50,0,-6,-4,-3,2,0,5},
-                                                {6,-24,1,-20,-4,-46,-2,37,8,-18,-3,3,-2,5,-3,-10,-11,-5,1,0,58,-11,-1,-6,-6,9,6,-4,17,13,6,21,2,6,-6,-5,-4,-8,-116,3,27,-9,-2,10,-1,-3,-1,-4,5,3,-6,104,-9,4,-1,0,17,16,-1,-11,3,-1,34,3,5,4,-132,-2,9,-3,-3,-30,-1,7,1,-7,2,99,-2,3,-1,42,-6,0,2,-3,-1,3,-3,14,-13,57,-6,-14,-19,11,-3,0,-1,-1,-3,0,2,42,-5,-22,-1,3,0,31,0,-4,4,-5,-8,-3,2,0,57,0,-7,-2,-5,-3,15,1,12,-2,-10,2,-15,2,15,1,-11,4,-40,2,-2,-1,-5,-20,-9,6,-38,-3,3,1,-6,-21,-3,1,11,6,4,-9,-1,-4,16,13,0,-6,5,2,2,-7,-15,4,6,93,8,1,3,0,0,21,-8,-10,-6,2,0,-41,4,5,1,1,-4,3,8,-6,-4,-21,4,-7,-9,4,-3,-13,-6,0,-8,-21,-6,-5,-3,-32,3,2,-18,3,-8,5,35,-20,-9,0,-10,45,1,-15,6,-2,-127,-1,-2,-4,-29,3,-2,-4,7,42,-12,32,-4,6,12,11,-9,-6,-3,-12,-9,20,-6,0,3,16,-31,11,-4,0,4,-7,5,15},
-                                                {13,-22,24,-9,-2,-34,-4,25,-2,0,-1,3,-4,0,-4,-8,2,-4,-6,-4,-18,-15,-11,-2,-7,-13,5,-4,-1,-21,6,12,0,9,-3,-3,-3,-3,30,0,-15,-117,-5,2,1,5,-12,-12,2,3,-4,0,-3,11,-4,4,28,18,-1,-2,12,-14,-145,0,13,2,37,8,11,2,-14,-13,-1,8,1,-1,-2,-45,-2,-5,-2,62,5,-1,-5,0,-6,2,0,1,-5,71,2,-12,-14,11,9,1,-7,1,-3,1,-9,-64,-2,-24,1,0,-1,36,0,0,10,-4,0,-3,-4,-3,-27,3,-17,2,-17,-4,22,-4,1,-5,-5,-1,-15,-4,6,-5,3,1,-37,3,-3,-3,-2,-6,-3,-1,-17,-2,3,-2,-4,-12,1,1,-4,3,6,-2,-1,2,1,7,0,-7,2,3,-4,-6,-2,4,1,95,-1,3,-1,-4,0,42,1,-5,-3,1,1,-49,4,-9,1,-3,8,1,-6,-3,-22,-8,5,-6,-1,-6,5,-1,-4,3,-15,4,-4,-1,5,-28,1,0,82,10,-53,-19,30,-20,-7,0,-11,27,3,-6,13,-14,-166,-4,-3,-6,-4,-16,2,-2,9,-63,-7,51,-8,-4,20,16,-17,-3,-5,-4,6,29,-4,2,-1,12,-48,8,-2,-3,-4,-5,0,5},
-                                                {4,-21,10,-7,-1,-46,-1,-119,1,3,-9,-1,-10,8,-15,-4,-2,-10,0,-3,-16,20,-3,-3,-10,11,7,-10,-2,18,4,8,-1,7,-5,-3,-2,-6,35,8,-16,-8,-3,2,-5,0,4,-4,9,4,-1,-4,-15,10,-2,-3,-115,1,1,-1,3,-1,44,2,15,0,31,0,11,-7,-2,-29,-1,5,-1,-5,0,-44,-3,-1,2,45,3,2,1,-4,0,-10,-4,6,-3,72,0,-15,-16,11,-2,-10,-4,2,-3,0,4,67,-4,-23,-2,10,-2,-97,0,1,11,-3,-5,-4,-10,-6,-46,-3,-3,-2,-6,0,23,6,-7,-13,-10,-1,-16,3,0,-4,1,-3,-43,3,-3,0,-5,-18,-11,8,-33,-2,-2,-9,-2,-18,2,5,4,2,9,-3,-4,7,-6,4,2,-6,4,9,-1,-10,-17,7,10,90,17,-8,-1,4,-4,-117,2,-4,-3,1,5,-49,0,19,-3,-1,1,-3,-3,-3,-5,-6,2,-11,0,5,5,1,-1,2,-2,16,-3,-3,2,66,0,0,-26,11,-59,7,39,58,-7,1,-1,45,3,-24,35,-4,-142,-3,-5,-3,-5,-2,1,-3,24,52,-9,37,-5,-1,16,17,-14,-14,-2,-8,-14,26,-5,2,0,5,-55,1,-5,0,1,-6,-2,7},
-                                                {-11,-14,3,2,1,7,1,0,2,0,2,4,-2,-3,-1,28,-7,1,4,1,-1,-4,-5,2,-6,3,0,1,-2,4,-5,-8,-1,-4,-14,7,-12,-7,1,-4,1,5,32,15,3,5,-8,-3,-2,11,8,6,9,4,39,-3,0,11,11,1,-2,0,1,-1,-1,3,7,1,-6,-6,3,5,-4,6,-15,5,0,2,-15,3,-4,2,1,3,-4,0,-8,3,4,1,-4,-6,3,9,5,6,0,-1,-1,5,6,5,-3,4,1,2,0,4,-9,-3,4,8,-3,-6,13,5,3,8,-1,1,17,0,10,2,26,3,2,0,-8,-123,9,-3,0,1,0,51,-3,-13,-12,5,0,2,13,6,7,5,6,4,-2,10,4,4,2,3,0,2,-4,4,11,5,-17,7,-1,5,1,3,-2,10,2,1,-4,2,3,-1,-33,1,-9,1,5,5,0,3,-40,-12,-10,-12,1,-5,15,-2,-2,6,-37,10,-4,3,3,-4,-116,8,5,1,-6,-2,8,3,6,-28,-1,4,12,7,0,1,-5,2,6,-3,-5,-6,-1,3,1,9,-3,8,2,0,-34,1,-2,2,-5,-3,4,-2,-8,20,18,-5,5,1,8,-2,8,6,58,-5,8,-5,-6,7,0,9,3,-1},
-                                                {-8,-10,7,2,2,5,5,1,4,7,-2,-3,-2,-9,-1,16,-3,2,4,2,0,-3,-3,-7,0,0,-14,2,11,8,-15,-5,-1,-8,-6,8,-14,-3,8,-2,6,11,19,0,6,0,-18,-3,1,5,4,8,3,11,26,-9,-1,4,11,-1,1,-3,-1,-1,5,0,7,11,-2,-6,4,9,-1,3,-6,4,0,0,-1,5,-3,1,18,1,-15,2,-6,-4,5,-3,-1,-1,8,17,11,4,4,0,-2,2,4,7,-4,4,6,1,-3,9,-8,4,-3,5,-1,-4,11,2,1,5,-3,5,23,-4,4,2,11,6,10,1,-4,-124,2,-12,1,1,-3,-21,0,-5,0,2,0,2,8,6,4,-7,1,2,0,10,8,4,3,1,4,-1,-3,3,-3,8,-3,4,-7,5,2,6,7,9,-8,-2,6,5,5,-15,-14,1,-6,3,5,2,8,3,62,-2,-2,-4,2,2,17,-3,-3,5,-23,-7,-4,8,6,-6,21,3,-2,7,2,4,10,1,4,-20,0,4,1,-4,1,-3,-3,1,7,0,2,3,-7,-3,4,13,-3,-1,-3,-2,-20,1,-6,2,-7,-3,13,-16,-4,12,10,-4,4,3,4,-5,-4,5,61,2,6,-4,-2,2,3,5,1,-6},
-                                                {-18,-12,4,-2,7,6,6,-2,3,2,-2,3,-4,4,4,23,-5,3,3,-8,3,-4,-4,4,-2,-6,1,6,9,5,-3,-2,-9,-8,-5,8,-15,-6,4,0,2,5,-116,-2,7,8,16,-4,0,6,10,4,7,11,38,5,0,9,0,1,6,0,-1,-11,7,-5,1,1,-3,-5,-2,7,-5,6,-7,4,-9,-1,-2,7,-1,-3,8,4,-2,-4,-2,-3,5,6,-3,-4,5,18,13,3,3,-2,-3,-1,9,6,-10,3,9,1,-10,4,-4,1,-4,4,-3,-7,20,1,2,6,0,9,25,-4,5,-10,25,3,-1,3,-4,-116,9,-7,2,2,-1,-28,0,-4,3,8,2,-11,21,1,8,1,0,4,-2,5,7,7,-1,1,3,1,-5,5,5,3,-2,3,-5,4,0,8,-6,16,-6,3,4,7,6,-1,-23,-1,-9,8,8,-6,22,7,-21,3,2,-5,-1,2,39,-5,2,10,-36,9,2,6,5,-3,36,7,6,-3,-5,2,8,4,2,64,-1,8,5,7,-3,-2,-5,-10,6,0,14,-6,-7,7,4,13,0,7,-3,-4,-35,-1,-6,7,-1,-2,2,-5,-4,19,10,-7,9,-1,7,0,0,4,59,-1,5,-6,3,1,-3,5,8,0},
-                                                {-12,-24,10,6,4,1,5,3,-5,-6,0,1,-2,-4,4,-64,-6,6,2,0,-5,-3,-5,-4,-4,-5,0,2,8,5,-6,-6,1,-5,-7,10,-17,-4,4,-6,1,7,21,1,5,1,2,-4,0,-1,-8,10,2,7,23,-4,0,3,-4,0,10,-1,6,-3,-2,-2,7,1,-10,-7,-5,9,-2,7,-8,92,-1,-4,-5,-3,7,-2,-6,-7,-3,-5,-2,-3,2,1,-6,-4,4,13,5,6,-2,0,-1,2,4,7,5,2,8,2,-2,7,-7,4,0,0,4,-3,16,5,1,8,-2,1,27,-2,2,2,18,5,-1,-2,-8,17,7,-4,6,-3,-4,65,1,-3,-2,6,-2,3,15,8,6,-21,5,3,-4,7,2,1,4,-15,1,-3,-12,-2,7,3,-5,6,-5,9,1,10,4,5,0,-2,9,7,5,-1,-13,4,-7,3,3,4,-3,-4,-19,-13,-1,-3,-3,1,-137,-5,-1,2,74,3,-5,2,4,-8,-83,-10,3,5,-2,0,4,0,3,-21,-3,8,3,3,4,-5,-5,-1,2,2,3,-2,-9,2,4,6,1,-2,-1,0,-24,-2,-8,5,-2,-1,8,-1,-9,19,11,-5,-11,5,2,-8,1,3,-21,1,2,-1,1,-2,2,9,4,-5},
-                                                {-23,-34,3,7,7,0,5,0,0,-4,1,5,0,-1,4,-118,-4,3,9,1,-3,-9,0,0,-10,-6,3,4,10,3,0,-13,4,-8,-2,6,-15,-15,9,0,6,3,46,8,5,16,-36,-4,-1,2,10,11,1,11,57,-5,0,2,5,4,3,0,6,4,13,2,4,-2,-14,-10,1,6,-13,4,-5,9,3,-15,-3,0,-5,-7,-3,2,-2,-4,0,7,5,1,-1,2,10,18,2,8,2,1,-2,-3,6,7,0,-6,2,-6,0,10,-13,-2,-2,0,10,-9,23,4,6,9,-6,3,28,-15,10,3,35,-1,-44,0,-10,34,4,-5,0,1,0,-41,1,-2,4,11,-3,4,24,1,8,38,8,9,-10,4,5,7,5,4,5,4,-5,8,20,14,0,-3,-8,8,5,3,2,8,-14,-12,-3,7,5,4,-30,5,-5,2,6,8,8,-14,74,-13,5,-4,-1,-1,-61,-7,-1,12,72,9,2,4,-2,-5,45,5,3,0,-4,1,7,-4,2,-26,-5,-1,6,-14,4,-7,-7,4,5,-10,3,-15,-6,6,5,7,-3,4,0,-3,-49,0,-17,-12,-1,1,15,-2,-12,32,9,-11,4,5,13,-12,3,5,-47,-1,5,-13,-3,4,3,8,5,-7},
-                                                {-5,3,-6,-1,6,7,3,2,-1,-6,-3,-4,0,-1,-3,-100,-6,6,9,0,-2,-7,-1,-4,1,-9,-3,6,-10,16,-5,-7,-3,4,-2,11,-17,1,7,-12,6,5,-93,-8,5,2,4,-3,-4,7,3,-5,-4,3,36,0,-3,1,7,1,4,-1,1,-1,12,0,6,1,-6,-6,-2,5,-2,6,-5,20,-2,-2,-5,10,2,2,-5,2,-4,1,2,-3,6,-2,-1,-7,4,1,10,10,1,-2,-2,0,7,8,-13,4,3,4,-1,8,-1,3,1,1,-6,-3,16,4,2,8,-2,2,16,1,10,6,34,-4,1,3,-9,9,12,-5,2,-6,-1,-43,-4,-4,4,3,-5,1,14,7,23,5,7,3,3,-2,8,8,-5,0,10,3,2,-4,6,1,-2,4,-3,-12,2,7,10,8,2,10,15,-1,10,2,-50,1,-7,-2,6,2,14,0,-35,-14,-1,-3,-5,-1,-72,-3,4,-13,96,12,-2,4,-2,-7,4,2,1,-5,-1,8,4,0,5,90,-3,-2,-3,-12,5,-4,-4,-2,6,3,1,7,-6,-4,5,7,1,-6,-8,-2,-28,-3,-6,0,-10,-5,6,-1,-8,29,12,-9,1,3,-5,-6,6,7,-51,5,0,-2,-14,0,-10,7,7,-5},
-                                                {-7,-35,-1,6,3,7,7,-1,7,-11,-3,3,0,-5,1,30,-14,3,2,-1,3,0,-1,2,-5,0,4,2,11,6,-3,-4,1,-10,-5,8,-12,-4,3,4,9,4,34,1,4,5,-9,-7,-5,2,5,1,3,6,41,5,-1,11,0,-12,5,-3,-1,-1,5,0,2,2,-8,-6,0,7,-6,7,-6,4,1,-3,-4,8,0,-3,-7,2,-4,-4,-4,0,-3,1,-13,0,1,13,9,14,-5,-2,-7,7,6,9,0,1,5,0,-3,7,-8,8,-5,0,9,-6,13,1,4,9,-2,2,26,-18,2,1,21,3,-2,-1,-6,43,8,-5,2,-2,-5,52,-3,-5,4,7,0,-2,14,6,9,7,7,4,-7,2,2,4,2,4,5,-9,-1,9,3,9,-1,-1,0,-7,6,6,-5,7,1,-1,-6,2,7,-3,60,-1,-16,0,3,4,6,2,-51,-6,1,-1,-4,1,25,-10,1,0,-27,6,-14,6,8,-19,-137,7,10,8,-7,0,2,3,3,-31,-1,4,5,21,-1,-2,-6,-1,2,-4,9,2,-8,4,0,9,-3,1,-18,0,-36,-2,-8,3,-7,-2,12,2,-8,19,11,-9,5,-4,8,-7,-2,3,-22,3,0,-9,-1,7,3,5,1,-5},
-                                                {-9,-15,17,1,5,1,4,4,2,6,-1,3,0,7,6,18,-2,5,-2,1,-2,-3,-16,-1,-2,0,-3,2,-2,6,-5,-3,-1,-8,-3,4,-18,-6,10,-7,6,16,21,4,5,0,19,6,-2,6,5,-2,6,12,30,1,2,11,5,-1,-1,-10,1,0,11,1,10,0,-6,-3,0,10,0,4,-5,7,1,-8,-3,3,-2,1,-6,2,-7,2,-6,1,5,1,-4,-3,6,13,7,11,5,0,-3,3,6,9,1,3,7,0,2,4,-5,4,2,1,6,-4,11,3,0,7,-5,6,25,-4,7,2,15,1,3,1,-9,26,-1,-6,4,-2,2,-22,-1,-6,0,-4,5,3,11,7,5,-7,9,1,-3,6,6,4,7,2,8,-1,-8,-2,0,15,-1,5,-5,4,4,5,7,1,-5,-2,15,4,6,-4,64,6,-5,4,4,5,3,-1,62,-10,-2,-5,2,-2,17,-4,-16,5,-18,9,-5,5,3,-5,19,6,-2,2,-3,1,-1,-3,7,-25,-1,3,3,14,3,-4,-5,2,0,2,5,-2,-3,-5,4,9,-1,-1,-4,-12,-27,0,-7,3,-2,-3,-2,-4,-4,15,8,-6,3,4,2,-1,5,4,-17,2,5,-1,-6,6,-4,8,5,-6},
-                                                {-15,-14,2,4,7,7,5,-3,0,-5,-2,-1,-10,-3,-14,24,-5,5,3,-1,-2,-3,-1,2,-6,-13,3,-9,10,13,-5,-7,0,-1,-5,4,-11,-5,4,5,5,6,-126,1,2,7,15,-5,0,6,8,6,-3,11,41,-1,11,3,7,0,1,-4,2,-1,8,-2,5,2,-8,-8,5,10,-4,6,-8,4,2,-2,-7,4,-1,-8,-3,3,-3,-1,-4,-10,1,-4,-2,0,2,11,5,12,-3,-9,-1,3,5,9,-5,-3,4,1,2,12,-8,-1,2,4,12,-4,18,5,-8,4,-3,5,34,-4,12,5,26,4,2,-14,-9,33,6,-2,0,-1,-3,-32,-2,-4,1,4,-2,-8,17,6,10,-1,5,-4,-5,10,6,8,1,1,2,2,-4,-6,11,9,-1,3,-2,7,1,5,-8,6,1,-1,2,-10,7,3,61,1,-3,3,3,4,3,1,-33,-8,-3,-7,-4,-4,37,-6,-1,3,-27,6,-3,11,7,-7,31,7,4,3,-5,4,-1,1,4,63,-2,7,10,0,-1,0,-4,1,9,-3,0,-2,-3,3,2,5,-4,-1,-2,-4,-36,1,-3,7,-5,-3,6,-2,-7,19,13,-11,5,2,1,-5,-4,4,-24,-9,5,-7,-6,7,2,7,5,-4},
-                                                {11,11,-1,-3,-6,7,-1,1,5,-2,3,4,0,6,8,9,-17,1,-5,-1,1,2,3,8,16,14,-6,-3,19,2,-4,11,3,-10,-11,2,2,10,-3,6,3,-3,4,15,-2,8,7,-2,-10,5,2,-13,10,-21,-9,0,-1,14,13,-31,-19,2,1,0,-24,1,0,2,8,12,4,9,-11,8,-10,4,-2,8,-12,-7,-7,1,6,5,-4,6,-17,6,-6,7,60,3,-1,1,9,5,6,-3,47,7,3,-154,-4,2,-1,-2,2,8,-4,-8,42,8,25,22,-11,32,6,32,2,-5,2,16,5,-3,-6,5,11,-3,-6,-3,11,1,-4,-4,-31,2,0,-2,-10,1,1,10,-15,5,-13,-3,-123,2,-8,-16,-2,-5,9,5,-7,-30,-7,5,-8,13,-8,7,-4,-3,-1,-5,-6,-23,-9,3,-3,-5,8,-5,0,1,-23,3,-9,-2,5,-3,1,-1,-10,-10,-4,4,-2,69,0,-8,-5,8,-38,-1,-1,73,-4,8,8,-6,-5,1,-21,-4,2,-2,-2,-2,2,13,0,3,-11,-1,-3,-13,-16,12,-14,-2,-1,-8,-9,3,62,2,7,31,-11,3,-16,0,19,-2,-11,-11,-20,-5,-1,-26,4,-10,0,1,0,-2,9,13,30,3,4,39,-2,4},
-                                                {15,14,-2,-7,-4,2,0,1,6,-21,-3,-4,-1,-4,4,7,61,5,1,0,1,2,5,1,17,17,-18,-1,18,14,-13,10,-3,-9,-1,5,2,9,2,8,7,8,-1,4,4,0,9,1,-6,2,1,-11,3,-7,-4,2,-3,7,6,-29,-5,0,-1,-3,-16,1,0,12,7,7,4,4,-4,2,1,-2,-3,3,0,-5,-8,-2,10,0,-15,4,-6,1,0,6,58,2,8,-11,14,4,10,-2,35,6,3,23,-1,5,2,-1,-3,3,-1,0,21,2,-16,16,-8,31,2,22,0,0,4,5,11,-3,-8,5,13,0,1,-2,3,-10,-3,-1,-20,-3,1,2,-1,-2,3,5,-13,8,-16,-2,-123,-1,-7,-12,4,-11,1,3,-3,-23,-4,-3,8,4,2,4,-2,3,-1,-4,2,-13,0,1,-3,1,5,-15,-2,0,-15,2,-6,-3,10,0,-1,-3,-2,0,-4,0,-6,-17,-2,-3,-7,-4,-22,4,6,-23,2,4,6,-1,-5,1,-7,-2,1,-4,1,1,1,-13,5,-2,-9,-2,1,-2,10,3,-16,-4,2,5,-5,5,-20,-3,6,26,-3,1,-14,1,23,-23,-4,-6,-12,1,-2,-7,12,-4,-6,2,-5,1,11,9,3,0,4,-119,-1,4},
-                                                {1,13,2,-21,3,10,-1,-2,4,41,4,1,0,12,4,9,-26,7,-6,-10,7,-1,3,10,16,7,-4,1,14,0,-3,29,-7,-12,1,2,2,11,2,-2,3,-6,-1,0,3,9,18,-4,-14,-2,2,-5,6,-15,-4,1,-2,4,2,-26,-12,-2,-2,-13,-11,-1,-5,1,10,10,-2,11,-4,6,-2,1,-13,4,0,-4,-6,-11,8,6,-4,6,-5,1,-3,7,61,2,1,10,18,4,8,-4,33,5,4,29,4,4,3,-4,-6,5,2,-5,-119,5,43,15,-16,-123,0,31,4,1,4,8,0,-10,-7,-5,4,0,-1,0,10,0,-1,-3,-38,0,1,6,-1,2,1,1,-20,-2,-28,0,-119,-2,-5,-23,2,-3,4,3,1,62,-5,-8,-1,-1,2,1,4,1,1,-3,-9,-6,-4,11,6,0,8,-7,0,-2,-30,5,-3,-12,4,-4,-1,3,-4,0,-2,2,0,-30,2,3,-6,3,51,3,2,-19,1,9,7,3,-2,-1,-17,-3,-3,-6,-2,2,-3,1,0,-2,-10,-12,-3,-5,1,13,-10,2,4,-3,-2,6,-42,-1,0,28,-7,4,-7,1,13,-1,-6,-9,-5,-2,4,-10,1,-4,-4,-1,-7,8,16,-2,10,0,-4,30,1,27},
-                                                {4,6,0,-6,-2,6,0,3,-4,10,2,1,1,2,7,4,-23,6,-5,-3,0,1,5,3,17,14,-2,-3,20,3,-4,17,2,-4,-2,5,5,9,1,1,1,-1,0,-2,3,8,16,-6,-13,-7,-10,-19,3,-15,-1,3,-2,3,0,74,-7,2,1,-3,-17,-1,0,4,9,10,-1,5,-1,5,-3,3,-4,5,-4,-16,-2,-2,6,-11,-3,-1,-4,4,-5,5,-24,0,1,-5,14,7,4,-1,27,3,3,-156,0,1,1,-3,2,3,-1,-4,24,3,11,22,-5,32,-1,25,1,-2,-1,1,6,-3,-12,3,2,-5,-4,-1,6,1,142,-2,-20,-2,-3,5,-5,1,-1,13,-15,3,-8,-4,28,0,-6,-9,-3,-6,4,-12,-6,-18,-6,6,4,2,-2,3,0,6,-6,1,7,-17,-1,2,0,0,6,-4,-2,5,-10,4,-3,0,-2,-9,-6,-12,-4,1,-1,2,-1,61,-2,-7,-7,0,-25,0,0,-27,-5,-10,8,-7,-4,0,-14,-6,1,-10,-4,7,-4,10,5,-5,-12,-3,-7,-6,14,-3,-15,0,1,-3,-1,-3,75,-1,1,-122,-8,1,-7,-1,17,-1,-11,-8,-15,-2,-19,-8,6,-10,-5,-3,-11,0,8,5,6,-1,4,27,1,7},
-                                                {7,6,-3,-17,2,3,5,4,9,-29,6,4,2,-3,6,6,67,3,3,0,-3,-3,7,7,20,10,-1,1,22,0,1,22,8,-10,5,1,5,5,3,-2,5,-2,5,7,-1,16,1,-2,-14,-5,2,140,6,-21,-7,1,2,10,4,70,-16,1,6,-1,-19,9,-1,6,7,12,2,7,-17,5,4,-2,0,-5,-1,-1,-6,-15,8,6,-3,2,-9,10,-4,10,-52,5,10,-7,5,8,6,1,46,9,4,33,-1,4,-3,-10,4,7,-4,-6,34,3,40,16,-15,-138,8,36,-2,-3,5,-6,11,2,-18,18,10,-3,-1,3,2,2,5,3,-68,1,2,12,1,6,-1,0,-20,6,-21,-1,39,1,-9,-30,4,-2,10,6,0,-51,-4,1,4,11,8,2,1,11,4,-6,-8,-21,-1,-10,5,-3,4,-2,-1,2,-18,3,-7,1,0,-17,0,-5,-1,3,-2,-1,-3,-27,4,-25,-3,6,56,-1,1,76,0,7,11,9,-1,2,-17,-6,2,-2,-6,-3,0,4,4,-6,-11,1,-4,-7,10,-4,-11,-4,3,-7,-7,-1,-57,2,5,-102,-17,-1,-12,4,24,-2,-11,-9,-15,-8,-2,-17,-1,-18,-4,0,-6,9,8,7,8,-1,5,-110,-1,27},
-                                                {3,-5,-7,-10,1,2,1,3,1,-17,2,-4,2,-2,5,2,-29,5,0,-3,3,6,2,6,12,12,-2,1,16,12,-4,10,0,-6,0,5,-6,10,3,6,5,2,0,7,3,2,-6,-1,-11,-1,1,-8,-1,-10,-5,-3,1,10,5,61,-3,-2,2,-1,-14,1,3,4,1,8,5,8,-4,5,1,4,-5,4,-2,0,-2,-5,5,3,-4,1,-9,-1,-1,11,-24,-1,4,-5,13,14,11,-3,33,1,4,21,1,8,1,0,-2,3,2,-1,-127,2,-17,16,-3,29,2,21,-1,-1,4,4,2,1,-4,13,12,-3,-3,1,12,-3,14,1,-31,-15,-3,1,1,3,-2,2,-10,2,-15,-2,21,1,-9,-15,5,-5,8,0,2,61,-7,1,-6,22,1,3,0,1,-1,1,4,-12,-3,-1,-28,1,4,-4,-15,3,-8,4,-3,-1,8,-1,-14,-4,-2,0,-3,3,10,-16,1,-7,-14,5,-23,2,-5,-29,-5,-3,2,-2,-6,2,-15,0,3,-13,-1,-4,-4,13,6,-1,-5,-4,-3,-1,-7,0,-15,-3,1,-3,-5,-2,-23,-5,10,-137,-7,4,-19,-2,21,-5,-8,-12,-10,-4,-8,-11,3,-6,4,1,-13,3,3,5,-1,1,3,28,3,3},
-                                                {21,10,2,0,0,9,3,1,12,3,-4,6,1,7,14,1,-49,4,4,-1,7,7,8,11,42,8,-1,-1,21,14,-2,36,4,-2,0,4,8,21,-1,-9,8,-3,4,5,2,10,-22,0,-16,2,5,4,2,-9,-3,-10,-4,2,5,-56,-58,-2,1,1,-7,4,-5,8,18,25,0,17,-15,10,1,-2,0,7,-3,0,3,-4,-17,6,-4,3,1,1,-2,-5,-53,5,-2,-8,9,13,3,-3,37,5,5,-74,-16,-3,3,-1,-1,7,2,2,22,-1,-98,33,-7,-73,5,-69,0,-5,-13,7,16,-2,-8,8,8,0,2,0,10,1,33,5,116,1,0,4,-1,1,2,-5,-14,1,-3,-5,20,-1,-1,-13,0,-6,7,6,3,-44,3,-18,16,19,5,1,1,7,5,2,-12,-7,7,10,-2,4,8,-7,-2,-5,44,2,-7,0,7,0,-4,-7,-2,4,-2,3,7,125,4,-1,-2,6,88,17,0,-59,-8,3,16,-8,1,-1,-10,0,5,-4,1,-3,9,-23,2,-1,-6,-1,-8,-6,-7,7,-13,1,-1,3,-1,4,63,0,5,17,-10,-1,-10,1,20,3,-4,-8,-4,2,-2,-11,3,-5,1,-2,-5,4,8,11,4,6,6,21,3,20},
-                                                {14,5,31,-6,0,4,1,3,5,21,5,7,2,10,5,2,71,4,-6,-4,3,3,-13,8,14,18,-7,-2,17,3,-4,14,1,-6,0,-2,4,10,4,3,7,8,3,6,3,2,-7,-6,-7,1,0,-17,9,-7,-3,-5,2,19,5,-22,-10,-10,1,-3,-9,2,2,1,3,11,0,15,2,7,1,1,-3,-2,-3,-7,-7,0,-4,3,-8,5,-10,3,-5,8,-22,2,0,-6,16,10,15,1,29,6,2,24,-2,3,-1,-5,4,3,1,-2,22,5,12,20,-8,30,-1,-150,-3,1,8,5,9,-3,-9,0,10,-4,-2,1,2,-2,4,-2,67,0,0,3,-2,-4,2,9,-10,2,-10,-2,29,-3,-6,-11,2,-4,8,3,4,-23,-7,-6,-10,16,1,2,1,-1,0,-1,4,-16,0,0,2,1,6,-9,0,6,36,1,-5,-2,3,-5,-4,-7,-5,-1,2,0,5,-25,-16,-5,-5,5,-26,-2,0,-25,-3,5,5,-5,-2,-2,-13,-6,1,-8,-1,1,-3,1,4,-4,-10,-1,-10,-7,-7,5,-10,-11,1,-4,-4,-3,-23,-17,1,23,-9,-4,-9,0,13,-4,-11,-12,-16,-5,-4,3,-1,-9,-3,1,-6,2,11,15,-2,6,2,-113,2,6},
-                                                {6,11,1,-2,1,6,2,-5,4,-26,-3,-2,-11,2,-15,8,-33,1,-1,-3,0,3,5,8,17,22,-1,-9,17,10,-3,9,1,-8,1,1,11,15,2,10,6,0,0,5,-5,11,8,0,-12,2,2,-10,-2,-16,-5,8,9,-1,2,-21,-18,-5,1,0,-14,-2,1,4,9,12,5,4,-11,2,0,-3,-1,1,-5,-5,-4,-10,-1,4,-3,4,-5,-6,-8,6,-35,4,-2,1,13,13,8,-12,45,7,3,35,-6,1,-1,-3,2,12,-2,-9,-113,3,26,22,-14,40,-8,-148,-2,-4,15,9,17,0,-10,2,7,-13,-4,-1,12,3,-2,-4,61,-3,2,5,-3,1,1,-1,-21,3,-25,-4,38,-9,-7,-22,1,-2,5,5,4,61,-6,1,0,9,5,3,5,9,0,-4,-14,-18,3,5,3,-9,5,-1,-4,1,30,3,-4,-4,8,-5,-4,-3,-4,-1,-3,-5,-3,-34,-1,-7,-4,8,-29,5,6,62,-2,6,12,3,-4,-2,-21,-3,0,-7,-2,3,3,5,1,3,-9,-2,3,-8,16,7,-11,-3,-2,-4,-5,-2,-29,-4,3,35,-10,2,-11,2,24,-4,-8,-13,-21,-16,0,-2,7,-7,-9,-1,-7,0,11,2,0,2,6,38,2,5},
-                                                {8,9,16,-2,-1,9,-1,4,6,1,2,5,1,3,2,9,0,2,-123,-1,-2,3,-33,5,-5,-5,-2,-2,-17,4,4,-9,1,-5,-12,-1,5,9,-2,-8,-1,-6,10,13,0,8,-8,35,0,11,0,11,10,4,-3,-10,8,-1,8,1,4,-42,-1,-3,-2,12,4,0,-8,12,4,-1,0,-40,-12,4,-6,7,-15,3,-6,3,7,-2,6,5,-8,2,6,-7,2,0,24,8,0,4,-24,2,-4,7,7,-1,-2,-3,1,-2,2,5,-1,0,9,10,-2,-4,-4,3,1,1,-4,-2,-9,9,-4,-4,-3,4,14,2,-3,3,-8,7,1,3,6,-4,-6,-14,-15,3,2,6,-4,4,2,2,5,0,-4,14,4,3,8,-2,2,-1,42,1,-31,-1,-15,9,-8,3,-2,3,3,-16,0,1,2,0,-1,3,1,2,-2,8,0,-3,-1,-5,3,-5,-14,-14,0,5,-3,1,66,7,-4,17,0,4,1,1,4,3,-12,-1,-3,8,-10,-2,5,-1,-1,-2,0,8,1,-2,-4,1,-14,-3,-3,7,-3,-23,-2,5,-4,11,4,66,2,4,-3,13,0,-1,-7,5,19,-4,7,-6,3,-5,3,27,11,7,6,-10,7,10,-9,7,44,0,4,-2},
-                                                {2,15,17,-7,-1,4,4,5,6,-7,-3,0,0,-2,-2,9,2,1,-95,-2,-1,4,-32,0,-3,-8,-14,0,-3,8,-13,-5,-4,-10,-2,5,2,17,3,-1,5,-3,7,-4,2,1,1,25,2,5,-4,11,4,9,-3,-7,2,2,9,-2,14,-17,-3,-5,4,7,4,9,-8,9,2,5,4,-26,-1,0,-4,0,-1,2,-6,7,14,-1,-8,5,-7,-5,7,-1,5,6,31,11,7,-1,-163,2,-7,4,6,3,3,-4,4,-3,-1,7,-1,4,3,5,-8,-3,-6,4,-2,-3,-3,3,-8,4,1,-5,-9,2,18,3,1,4,-8,-5,2,2,2,-4,-3,-6,-4,1,2,7,-5,9,5,1,1,-2,-1,9,3,5,1,-2,2,-2,44,22,-15,3,-4,6,-8,-2,2,6,9,-10,-3,-1,-3,1,2,-10,-2,4,-2,6,1,-4,7,-4,2,-3,-6,-6,18,8,-5,-1,76,1,-4,5,1,4,6,-1,7,-1,-17,3,-4,7,-3,-2,3,-4,4,4,3,7,5,-4,-6,-2,27,-4,9,2,-8,-13,1,12,-4,5,-3,-15,6,6,-6,4,-1,2,-1,-16,18,-1,6,-5,-1,-2,2,21,7,2,-1,-3,5,3,-1,2,16,-3,1,-5},
-                                                {-2,9,17,-6,3,7,1,0,9,15,-3,2,-1,-7,2,10,2,6,-129,-11,3,1,-29,4,-8,-13,-1,2,-15,5,2,-5,-9,-9,-2,4,6,8,1,5,2,-10,4,-2,4,7,3,35,5,15,-5,6,5,12,-5,0,5,6,4,0,4,-33,-3,-13,9,6,-4,-1,-12,8,3,3,2,-40,-3,3,-12,6,-4,4,-3,-2,5,-1,6,5,-8,-3,3,5,0,-1,27,8,11,1,-15,1,-5,0,7,3,-6,1,7,-1,-7,5,0,3,0,2,-4,-5,-12,-1,-1,-2,-1,7,-11,8,4,-13,-5,12,5,2,4,5,-10,2,0,1,4,-4,-3,-6,-5,5,3,1,-6,0,2,1,1,-1,-1,4,3,2,2,-4,-5,-3,40,1,-10,4,-3,4,-7,3,2,5,0,-12,1,3,3,4,0,1,0,2,-5,10,2,-13,10,-7,-1,0,-6,-7,-2,6,-2,-3,69,14,-4,16,4,3,2,1,7,4,-20,-6,-3,5,-6,-2,3,-3,0,4,-8,-10,2,-2,-4,-11,42,-1,7,14,-9,65,1,12,-2,10,0,-33,2,2,-8,14,3,0,-10,3,20,-3,3,-4,2,-6,3,28,12,-3,0,-3,7,0,-1,3,-62,-3,5,4},
-                                                {0,2,11,-6,1,2,2,7,-1,-9,-2,2,0,-18,0,7,0,4,25,-3,-4,5,-23,3,-3,-9,0,-1,-5,5,-1,-4,0,-4,-5,6,9,10,1,-4,1,-3,5,0,2,4,10,19,1,5,-15,6,7,3,-3,-3,4,1,2,1,9,77,-2,-6,-4,6,6,1,-14,8,-2,5,6,-23,-4,7,-6,5,-5,-5,5,8,2,-11,6,-1,-4,-4,2,3,0,2,13,10,4,2,-16,2,-4,5,5,1,-9,-3,5,-2,-1,7,-1,5,7,1,-2,-5,-4,3,-1,0,-4,3,-11,3,-3,-5,-6,0,12,0,-2,2,-5,4,4,1,2,-5,-2,-4,-4,2,-1,11,-2,10,0,-3,7,-2,-3,11,-3,-1,1,-16,0,-2,44,-1,-5,7,-7,7,-6,-3,3,9,9,-14,2,-4,-2,8,1,3,-3,2,-2,6,1,-3,-2,-5,-4,-4,-6,-5,5,7,-8,-2,-26,5,-5,13,-3,4,7,-2,-1,-15,-14,-2,-5,6,-7,-4,3,-6,0,7,3,8,7,-5,-6,-1,-135,-3,0,5,-7,-13,-2,6,0,5,5,65,3,3,-8,10,7,-1,-6,4,13,-2,5,-4,-12,1,4,15,3,-2,-5,-6,2,5,-1,4,24,-1,8,-2},
-                                                {4,0,3,4,5,3,1,6,12,16,3,-3,3,6,-1,11,6,-1,53,-2,-3,-4,-34,-1,-12,7,-3,2,-6,9,7,-15,2,-7,1,1,17,10,2,-6,6,-36,12,7,1,18,0,68,8,7,-3,13,2,4,-5,4,3,6,5,1,10,88,4,-3,7,14,0,2,-20,15,1,2,-1,-66,4,7,-2,-10,-5,7,-6,-9,0,0,2,3,-8,1,6,-9,5,-5,42,11,-2,7,-54,9,-6,5,7,0,-10,-25,-4,-7,7,10,-6,4,3,-2,4,-9,-13,0,5,-1,-7,6,-8,-2,11,-4,-17,4,14,5,-9,7,-15,9,0,5,7,-1,-7,-5,-3,-4,2,-1,-7,-6,6,-1,4,1,-5,5,4,-1,7,2,2,-1,35,-6,-10,11,0,4,7,19,5,5,4,-36,-6,-12,3,3,-2,2,4,3,1,7,1,-3,12,-22,5,-6,-6,-4,-6,9,-3,0,-47,12,0,11,6,3,2,0,6,4,-21,-2,2,8,-30,-6,6,-1,-3,-1,-10,7,6,-7,-10,3,13,-2,-2,9,-13,-58,-2,6,-4,17,2,-52,3,1,-20,-4,4,6,-5,3,26,-14,1,-13,1,-6,9,40,24,0,-1,-2,3,11,-5,5,17,-5,4,-8},
-                                                {-2,-6,8,-4,3,4,3,8,0,-2,-1,0,1,-8,1,4,1,4,26,-4,-1,5,-22,3,-5,-8,-1,2,-10,14,0,-7,-2,-9,-1,6,-9,12,6,-5,3,-3,6,9,3,0,-3,20,2,11,-3,13,0,8,3,1,6,8,2,1,14,76,0,-3,6,6,7,1,-6,6,2,7,9,-24,0,8,-7,4,-3,6,-3,11,6,-6,5,1,-6,-6,8,-5,1,-2,17,7,7,5,-5,0,-7,1,9,4,3,-2,5,-1,-2,7,-1,6,2,2,3,-5,-3,3,-2,0,-5,2,2,4,3,-2,-3,5,10,1,-3,3,-3,3,-2,0,4,-16,-7,-4,-2,4,-2,4,4,7,14,2,4,1,-3,12,4,0,3,-7,4,0,44,-3,-18,4,-4,6,-5,2,-2,10,11,-8,4,0,-8,3,2,3,-12,9,-4,6,1,-4,6,2,-11,3,-3,-6,2,7,2,-1,-19,1,-14,19,-1,5,-4,-2,0,-7,-18,6,-4,6,-9,1,3,-15,0,-1,-4,-5,8,-4,-5,-4,16,-2,1,2,-4,66,1,4,-3,8,0,-22,0,0,-8,3,-5,-1,-1,2,13,1,10,-7,-7,-3,2,17,11,0,-11,-3,1,3,-2,-1,-137,-1,8,-3},
-                                                {4,8,22,3,2,8,5,2,10,20,-2,5,1,-9,2,7,-9,6,39,-3,2,6,71,5,-8,-21,3,-1,-6,7,3,-2,0,-10,1,3,8,15,0,1,8,-2,10,4,3,6,-5,38,-1,7,-3,7,4,5,-2,6,5,7,2,-9,20,-29,-3,-4,-1,9,-2,3,-13,14,3,5,1,-41,0,4,-3,1,-5,8,-3,3,2,-2,4,4,-6,-2,3,4,-9,1,-114,18,6,8,-13,1,-6,8,7,3,2,-2,6,-4,1,2,-1,10,4,2,-7,-5,-6,-1,-1,0,-3,3,-6,3,12,-5,-8,10,12,1,1,7,-12,7,4,3,-1,-3,-4,-6,-1,1,2,-1,-5,0,2,-1,9,-2,-3,3,-1,1,6,1,2,-10,42,16,-11,12,-2,4,-6,7,7,6,-1,-15,-1,3,-5,5,1,3,4,-2,-14,5,0,-3,7,-5,0,-4,-4,-4,-4,8,6,-7,-24,-1,-1,17,-10,1,1,-12,2,2,-14,8,-3,6,-16,0,5,-1,-1,-1,0,-6,3,-5,-7,0,-20,-4,-3,6,-10,-24,-4,11,-2,9,-21,66,2,5,-8,16,-2,-1,1,5,18,-8,5,-2,0,-8,8,25,9,2,1,-1,0,12,-1,10,42,-7,6,-8},
-                                                {4,12,2,-2,4,7,5,9,8,-15,2,11,1,24,5,5,0,4,4,-3,-3,4,94,7,-9,4,-2,-1,-28,-1,3,-2,1,-12,0,-2,1,38,5,-5,7,5,8,-11,1,2,-17,23,6,18,-1,-11,-6,7,0,-11,-1,-15,1,-1,1,-39,2,-2,8,11,5,-4,-9,9,3,5,4,-45,-1,-5,-4,-7,-3,-4,-5,1,-22,-3,5,6,-6,2,7,-13,1,-1,-107,-11,3,1,14,-2,0,4,9,0,4,-14,5,-3,4,6,3,4,4,-2,-1,-6,5,0,-2,-5,-5,2,-15,0,6,-4,-12,-1,9,2,-5,9,5,-5,-1,5,4,0,1,-3,-3,-19,4,4,-5,10,-22,-3,5,-1,3,16,1,3,-2,-2,8,-2,44,-8,-16,-14,-3,4,8,-4,1,9,10,-13,-14,7,2,9,6,5,-3,9,2,6,2,-2,0,-3,-6,-9,-4,-8,-4,7,-1,-4,-54,-7,-2,27,0,2,6,1,7,-7,-26,-9,3,6,-14,-3,7,-5,3,1,7,-12,7,-5,-4,1,-14,5,5,-6,-7,-47,-1,10,2,2,-7,-56,4,0,-5,-1,1,2,-4,4,31,-10,-4,-3,3,-3,-3,30,3,-4,-2,0,5,3,-10,6,-14,1,4,-5},
-                                                {0,9,25,-1,6,7,4,-1,7,5,-7,1,-9,-14,-15,9,2,-4,37,-3,-2,2,69,7,-9,-21,2,-9,-12,10,1,-10,0,-7,-2,3,12,15,1,0,6,-3,7,-5,-4,6,7,33,3,15,-4,10,-3,11,-5,3,16,6,7,-4,5,-25,0,-3,10,6,2,2,-12,12,6,7,4,-38,-3,0,-3,6,-8,4,-3,-6,7,-1,5,6,-6,-13,4,-4,3,2,-107,3,4,5,-11,-9,-3,5,7,3,-9,-5,2,-3,4,8,0,1,7,5,6,-5,-9,3,-10,-5,-4,4,-7,7,12,-2,-6,1,10,-9,-3,3,-10,7,-3,1,3,-5,-4,-5,-3,1,4,0,-10,1,6,-2,1,-8,-3,13,3,4,3,0,5,-3,46,-2,-20,7,-3,5,-7,8,2,6,-4,-12,6,3,2,-2,0,7,1,4,1,7,1,-3,8,-4,-3,-2,-8,-7,-1,1,2,-2,-22,7,-1,17,1,10,6,-1,5,2,-13,1,-2,4,-20,-1,5,-3,-1,5,2,-12,1,0,-6,0,36,-3,5,7,-6,66,-3,7,-4,8,-2,-31,5,2,-4,11,2,1,-7,1,18,-9,6,-6,2,-7,4,26,6,3,-1,-14,9,3,-5,9,-24,-1,7,-1},
-                                                {-1,12,-1,5,-1,8,2,-2,2,-7,59,2,-26,-6,86,-1,-5,34,1,-1,-4,6,2,6,-15,16,-4,-26,1,2,-3,-15,-1,10,-7,4,11,13,0,12,-1,-2,1,13,29,13,7,-5,7,9,4,12,-13,0,-8,-2,1,-14,8,-1,2,1,3,3,8,3,3,-2,-9,11,0,-19,1,6,-14,3,-1,0,-10,-5,-7,-4,5,-2,-2,6,44,-29,1,-6,1,1,0,2,-18,3,5,-31,-1,40,2,1,-8,4,-132,-4,0,-36,-8,-7,3,83,1,-12,14,1,57,-1,-3,-126,5,12,16,0,-10,-2,-1,63,-9,0,9,3,-4,-1,2,-1,1,-12,-10,2,39,3,14,3,13,3,3,-26,-7,17,-2,1,0,-3,7,3,-4,-9,-2,-2,-13,3,-5,-3,3,-1,-9,-18,4,9,-1,20,7,0,0,0,2,4,-2,-3,-5,-4,4,16,-13,-10,-1,-2,4,4,1,0,5,6,-1,-2,-3,4,2,1,15,6,-2,-4,-15,3,0,6,-3,-4,2,-17,1,3,-5,-1,0,-8,-4,6,28,3,-2,0,-6,6,1,4,6,4,29,1,-6,4,-4,-3,-8,-13,13,33,-4,-5,5,-10,-12,6,6,-17,8,-14,-4,2,-6,1,-128,-7},
-                                                {-9,15,0,-3,0,4,2,-2,2,7,-23,-6,-13,1,-33,-4,-3,-136,5,1,-1,8,1,2,-6,14,-17,-19,12,15,-13,-10,-5,7,0,4,12,11,5,21,3,2,2,-5,23,5,5,-2,11,3,0,7,-15,10,-5,-6,-1,-15,6,-2,-6,1,1,1,15,2,3,10,-10,7,-2,-8,6,5,-4,1,0,-3,-1,-4,-4,-3,18,-3,-14,7,46,-26,2,-2,2,0,7,-10,-14,2,6,59,0,23,2,5,-1,6,25,-3,-1,-32,-7,0,-2,0,-7,-9,12,2,-25,-1,-4,22,6,4,18,0,-12,7,3,61,-3,4,-2,-7,-3,4,-1,-2,-3,-3,-2,-5,27,2,13,3,7,3,1,-25,-5,13,1,1,10,-5,3,0,-8,-11,15,-9,-2,0,-2,13,6,4,0,-10,-1,5,0,14,2,-19,0,-2,2,0,-1,-2,5,4,3,10,-4,-5,2,3,3,-1,2,2,3,-3,0,-2,5,1,5,-3,3,-2,3,4,0,1,2,1,0,2,-2,12,3,1,-6,-2,5,-3,7,-2,5,-3,1,8,-4,1,-3,1,5,4,13,-1,-6,3,4,-19,-5,-12,9,30,-5,-3,12,-14,-13,2,0,-14,5,-10,4,1,-4,0,-133,-6},
-                                                {-18,20,-2,-8,4,10,2,-4,2,3,-17,2,-21,3,-58,2,-2,37,0,-10,4,5,1,7,-9,15,0,63,2,5,-3,-8,-9,16,1,4,16,13,3,-20,1,-8,-1,3,38,18,1,-7,8,4,4,5,-15,8,-5,7,1,-10,6,-2,-4,1,1,-5,20,-3,-5,2,-7,14,-5,-21,8,10,-7,2,-11,-2,-1,-3,-4,-3,10,-3,-2,7,49,60,4,-1,-2,-3,2,5,-22,6,7,-25,-4,-138,5,2,7,6,38,-4,-9,-50,-5,-3,-4,2,-5,-13,13,-1,-29,-3,-2,39,7,15,18,-11,-8,12,-6,66,-1,5,7,-2,-5,1,-2,-2,0,0,2,0,44,-11,17,3,8,3,-1,-27,-6,9,0,5,5,-3,11,2,-7,-3,9,-6,0,-2,-4,0,4,5,-14,-14,2,13,3,-71,5,-2,0,-1,2,6,0,-14,14,0,0,2,-3,-5,1,0,5,-1,4,7,5,8,6,-2,3,4,9,4,9,-8,1,-1,-16,4,-1,7,-3,1,-2,-23,-1,1,-5,-11,5,-8,5,18,4,8,1,4,-3,3,-6,-1,7,-2,17,2,1,4,-5,-4,-9,-11,8,48,0,-8,2,-13,-11,0,0,-12,8,-19,3,-2,-8,-3,-125,-5},
-                                                {-7,6,-2,-2,3,7,3,1,-5,-1,48,2,-20,0,88,-4,-4,23,-1,-1,-4,3,-1,3,-8,12,-1,-17,0,6,-5,-9,0,7,-2,6,12,11,3,2,1,0,-1,-4,21,10,6,-7,7,4,-15,10,-16,3,-3,3,0,-14,6,-1,1,2,4,2,8,0,4,3,-14,8,-4,-7,8,9,-6,8,-4,-2,-5,-13,1,-6,0,-12,-1,2,49,-28,-2,-1,-4,-4,0,-7,-16,6,1,-30,-1,25,4,2,-10,6,26,-4,-1,-29,-6,0,-1,-4,4,-7,12,5,-24,1,-4,-124,11,1,14,-1,-13,4,-6,-27,-4,3,2,1,0,-6,-1,-1,1,-2,-1,4,-120,5,14,10,7,1,3,62,-6,14,-5,-1,7,-20,12,-1,-10,-7,7,-9,-5,3,-8,0,4,6,1,-14,3,7,0,18,4,-2,-1,5,2,3,0,0,0,-9,-1,11,-3,-3,0,2,7,-1,-1,2,4,-7,0,0,1,1,4,-16,-2,4,-1,0,-14,1,0,2,-4,5,1,-20,5,-1,-7,-2,-1,-3,7,-8,5,5,0,0,-1,-2,-1,2,4,2,12,3,5,3,-4,-3,-9,-10,8,27,-18,-3,0,-14,-14,0,-4,-14,2,-7,4,1,-4,2,23,-7},
-                                                {-13,6,-6,2,3,4,3,3,7,3,-124,2,-45,1,-28,-4,0,-125,8,-2,-6,-1,6,3,-17,15,-1,-45,9,-5,1,-25,2,11,5,5,21,8,8,6,1,-6,6,8,35,22,0,-2,13,0,2,13,-43,8,-3,0,-20,-4,3,0,-12,1,12,6,17,4,1,2,-11,16,-1,-22,-3,8,-2,-1,4,-16,-1,-3,-1,-4,-6,-2,-2,1,50,80,5,-4,1,-3,9,-2,-27,8,5,70,-4,49,4,2,-10,3,-116,-11,1,-45,-10,0,-6,-2,5,-15,16,0,63,-1,-6,38,2,-3,20,2,-26,6,-3,-59,-15,7,0,2,-3,3,1,3,2,4,4,5,-107,-7,18,5,6,2,1,71,-10,7,-2,6,7,-1,10,5,-7,-15,13,2,2,-1,-4,8,7,0,-12,-25,-2,-3,9,13,1,1,-1,0,6,3,0,-1,6,-18,4,19,-2,-1,2,0,3,0,4,5,8,4,7,-4,0,4,11,0,9,-4,2,2,-25,-5,1,7,-8,-4,-1,2,7,-8,-8,-1,2,-14,6,-1,32,2,0,2,-6,-1,0,-1,3,3,29,-6,-1,10,1,-1,-13,-21,4,43,-1,-10,3,-23,-13,-2,-2,-14,0,-18,3,-2,-6,-4,43,-15},
-                                                {-8,1,-2,-1,4,7,2,5,-2,-7,-7,-2,-15,0,-39,-7,-3,20,4,-2,-3,10,2,3,-8,23,-2,64,6,15,-5,-6,-3,10,1,7,3,11,6,5,-2,-1,-5,1,27,8,8,-6,4,-2,4,6,-12,6,-4,-3,6,0,-1,-1,3,2,4,5,17,1,6,3,-5,7,-2,-10,6,7,-4,9,-3,-3,-4,0,2,2,8,-7,-4,4,44,-27,4,-5,-4,-5,1,-7,-16,12,6,-22,-4,-148,5,2,-9,10,32,-3,-1,-32,-6,2,-2,-3,-1,-10,13,1,-23,0,-4,21,10,7,21,4,-11,4,-1,-14,-3,3,5,0,-3,3,0,-12,-7,-1,2,1,-93,-1,17,3,16,4,2,69,-7,12,1,0,7,-6,6,2,-8,-7,8,0,1,-2,-3,5,2,4,0,-8,0,4,-10,-124,2,1,-13,3,2,1,-1,-4,4,-2,-9,6,-3,-5,-3,2,6,-2,1,3,-9,4,-2,-10,-6,0,4,-9,4,4,0,3,-13,6,1,-10,-4,-5,-6,11,6,-1,-2,-4,2,0,1,-7,6,3,3,0,-3,0,-4,-2,6,0,12,-1,-9,1,-1,-3,-8,-8,12,24,-10,-4,0,-13,-9,1,-11,-11,2,-6,0,-1,-5,0,31,-5},
-                                                {-16,12,1,5,2,9,7,-3,5,-15,57,5,61,0,92,-10,-16,40,3,-3,4,6,4,4,-13,27,0,-24,12,10,0,-9,-2,8,2,3,19,13,4,19,1,-5,2,-5,-147,20,3,-2,13,-4,2,2,-16,4,-3,-9,-1,-13,0,-11,-10,-2,2,2,13,2,-2,3,-11,15,0,-18,-2,6,-6,2,1,-4,-4,-1,0,-7,-2,-3,-2,1,49,65,-1,2,-10,5,-1,-2,-24,13,1,-31,-4,12,1,3,0,5,36,-6,0,-47,-7,5,-5,1,-1,-16,13,-1,-27,-2,-4,-131,7,11,23,-1,-15,3,-3,-28,-3,6,8,4,1,1,-7,-1,-3,-1,1,1,37,-7,16,0,7,0,5,-23,-8,6,-5,3,7,-1,13,-7,-9,-6,10,0,0,-3,3,13,6,5,-13,-18,3,6,-3,55,3,-2,1,-3,-9,0,-4,-4,5,-5,0,9,-4,-2,-3,0,12,-7,1,0,7,9,-10,-5,0,-12,1,-2,8,-22,2,-3,-21,4,0,4,-4,-4,-1,19,2,0,-6,-2,0,-7,11,-1,3,5,-3,3,-2,0,-24,2,5,6,14,6,-4,4,7,-1,-8,-14,9,45,-4,-13,8,-13,-16,-3,1,-11,1,-19,-1,2,0,-2,42,-16},
-                                                {-7,7,22,3,4,6,2,1,2,-4,-15,2,58,-7,-19,-4,-3,-102,-3,-3,-4,6,-11,4,-11,10,-5,-18,-1,5,-1,-8,-2,7,2,0,10,13,6,-1,2,13,2,0,-144,7,18,-3,3,0,0,1,-9,13,-6,5,6,-8,5,-5,2,-8,3,1,18,1,6,1,-8,8,-3,-9,9,7,-4,2,-1,-8,-3,-4,-3,-1,-2,-7,-6,6,43,-27,4,-7,-3,1,-1,-2,-15,10,9,68,-3,14,2,3,6,8,30,-6,2,-35,-6,1,2,-3,3,-6,13,-1,-26,-2,-7,27,9,4,18,0,-14,7,-4,-14,-2,7,-1,1,1,1,4,-2,-3,-2,-1,-6,24,2,18,2,12,1,2,-22,-6,15,-2,2,6,-6,9,1,-10,9,4,5,0,-2,-5,0,6,0,3,-13,-4,5,-3,31,5,-4,1,2,5,1,-1,-3,1,-4,1,7,-6,-6,0,-3,6,0,-16,-3,3,9,0,-4,2,2,4,0,7,2,-1,-2,-15,-2,1,3,-2,0,0,-10,3,-1,-5,-1,-3,-4,-1,4,6,-5,0,2,-4,-1,-7,-13,2,1,14,-7,1,4,-8,-7,-7,-11,5,29,-5,-3,0,-10,-14,-1,-1,-14,4,-1,-3,3,-10,4,26,-7},
-                                                {6,22,2,6,7,8,4,-6,2,-1,-42,-1,119,-5,-60,1,-3,15,7,-2,-3,7,5,7,-5,12,-1,111,8,11,-5,-17,0,20,1,5,28,28,4,9,5,1,1,-6,-59,11,-17,-3,4,4,4,9,-10,10,0,-16,2,-8,11,-3,4,0,5,4,26,0,1,4,0,26,2,-5,1,10,-5,1,3,0,-2,-4,-3,-9,0,-3,-2,7,84,-50,5,-15,1,4,-2,-4,-13,10,3,-48,0,-71,6,5,-10,5,-51,-3,2,-43,-6,-3,1,39,8,-6,32,4,100,-3,-5,18,11,9,27,3,-13,1,-2,-42,-1,6,5,3,-8,-1,1,1,1,1,1,-3,24,-6,25,3,16,4,0,-44,0,11,1,3,3,-5,7,-1,-2,-33,32,-14,2,1,-3,11,4,5,-14,-3,2,10,-4,-63,8,1,-2,-2,6,5,-2,-1,7,2,4,9,-2,-3,1,-3,8,-1,4,0,9,1,1,2,1,1,7,0,23,13,0,1,-5,4,2,8,-2,2,5,-13,2,2,-2,-1,6,-4,-6,14,20,2,0,4,0,-1,-4,-1,7,5,37,-2,0,5,-1,-5,-5,-15,6,22,-3,-2,-1,-7,-7,0,4,-6,8,-6,-9,2,-3,4,19,-8},
-                                                {-36,-29,3,4,-48,-4,-1,12,1,14,-7,4,0,4,-9,-6,4,-2,-7,-5,-5,10,4,10,-144,12,3,2,15,21,-3,22,-5,-128,-156,-72,-11,12,2,3,13,-3,8,-54,3,4,8,8,-8,12,-1,36,-3,34,9,-7,28,-111,-4,8,-5,9,4,-4,55,11,10,5,25,2,2,40,3,-5,-171,4,3,-12,-151,9,7,-6,11,1,-1,7,-3,0,-64,3,-12,2,10,8,29,37,1,4,-1,2,-69,-9,-4,12,-14,5,0,-12,-2,9,15,-113,4,-163,12,6,1,8,-11,1,4,-21,20,6,8,12,-11,-10,64,-5,-29,6,12,11,10,-2,-4,-34,-166,16,-1,-11,13,-8,-34,-5,-2,4,-157,-43,5,-1,-29,0,61,1,8,-10,43,-13,-23,1,6,20,3,-81,10,-29,17,8,-8,1,-17,6,14,-21,-1,-73,-69,3,-3,-2,11,-127,-158,-150,10,-67,16,-3,-3,-3,8,-27,-2,-9,-1,-13,-10,8,-26,14,3,8,-31,9,-11,4,4,-1,6,10,9,-7,-125,7,-6,-2,-14,-39,-168,6,12,-85,235,5,-15,-4,-14,7,-184,37,3,6,-2,-6,7,10,-18,13,-5,-7,-21,5,-120,12,-6,4,-2,-38,-151,19,4,13,0,21},
-                                                {-19,-31,3,8,1,0,-78,12,4,10,6,-87,13,-4,13,5,-5,-6,5,-5,-2,11,-3,-124,9,-3,-153,12,-2,-137,-164,23,8,27,4,1,-19,11,14,10,9,-5,4,20,4,11,-24,11,-4,34,8,28,-9,-18,6,-7,10,24,-11,12,-10,6,-17,9,-14,10,4,-81,32,-4,7,-20,5,-18,-3,5,5,4,-4,5,7,16,-1,6,-144,10,0,14,7,11,-4,17,16,-79,-21,44,19,-1,1,1,-18,4,-6,17,-1,7,4,-4,-7,2,5,9,19,16,8,0,9,3,5,0,47,-17,10,6,11,-14,12,-2,18,2,46,-162,8,1,13,9,-11,14,6,-92,4,14,11,24,-10,-1,-7,11,-165,-23,2,-93,-19,8,-17,12,7,6,-66,-42,7,4,-1,24,7,5,19,-14,37,1,14,4,-10,-152,10,15,6,12,10,1,0,-20,7,12,5,6,236,2,6,11,-6,-7,7,18,9,-7,11,11,2,9,-83,14,189,5,-26,4,-17,5,-6,7,-18,-22,-7,4,-141,-3,8,-19,2,-11,6,-6,13,11,-2,-96,14,-4,-7,5,17,-5,1,3,-110,-152,-168,8,-13,6,2,7,53,-156,0,10,0,-3,-7,-17,16,7,8,-13,-10,15},
-                                                {59,-14,3,115,2,-6,-3,3,-5,12,7,0,6,3,1,13,6,13,-10,-129,-6,2,6,9,6,7,-1,-3,76,11,0,-189,-157,46,7,5,-4,8,10,-95,13,2,-2,-12,12,-8,-8,5,-5,15,-4,36,-10,-30,10,-4,-1,15,1,8,-17,6,3,-30,-29,-84,-17,2,-143,-2,2,-27,-74,-5,8,3,-41,2,-4,0,-1,5,-6,6,-1,-87,6,-4,4,-116,-7,7,6,-14,-35,39,0,7,1,-11,-7,4,0,11,5,6,-159,-3,253,10,6,5,-1,2,-148,-18,4,6,8,10,6,-38,-12,-163,8,-8,11,-7,-15,3,-34,1,5,-11,8,1,-6,-4,-6,13,8,-4,-168,0,50,0,5,7,-151,36,-77,3,8,2,0,-6,-1,2,3,28,2,-102,12,14,4,10,17,-49,29,10,8,2,76,-3,1,2,-6,11,14,-164,35,-7,0,-34,5,7,1,5,15,5,-2,3,1,-36,-4,6,-5,2,9,6,2,10,2,-91,-36,-3,-77,-5,7,-6,8,-6,1,4,-152,-144,1,-6,2,-42,10,-10,12,17,-2,11,3,4,-5,7,15,12,-89,4,-2,1,6,6,23,1,-9,26,-8,5,-1,-84,-7,-41,10,41,1,1,-8,5,-1,-101},
-                                                {-18,72,7,-9,-18,3,9,8,-106,-5,0,4,12,7,2,28,5,4,2,12,2,23,6,2,-164,6,5,14,19,22,8,21,1,14,10,11,-92,15,-15,1,-127,16,16,20,4,6,-11,15,-6,26,-167,26,-4,43,2,4,13,33,19,-11,-10,6,-2,10,72,7,7,9,36,15,-66,-10,-5,-8,2,-65,9,-21,6,-120,247,1,27,-167,7,-4,-10,12,1,6,6,8,7,-23,-24,-14,9,12,13,1,7,-16,-1,8,-1,-2,12,-4,-7,0,16,5,-10,-182,12,7,8,5,-11,-6,2,32,19,12,-195,-23,13,9,23,15,-20,11,-136,-92,5,-5,3,8,3,6,-5,1,11,6,-14,-68,0,2,8,-26,1,1,-14,-143,-30,5,-2,-29,-71,14,5,2,-1,2,-110,7,56,-15,-49,-4,-48,5,-12,8,-4,8,3,-1,4,2,23,8,9,40,-6,-2,21,12,-18,-2,10,-3,3,-6,3,6,-135,8,10,-131,-81,-5,-4,0,-33,11,6,-4,4,-93,2,-5,10,0,13,14,5,3,-1,46,5,7,10,-10,-5,8,-13,2,-16,-4,15,-11,-134,-28,-4,4,12,-148,-9,9,-145,-8,-6,11,0,4,-3,-6,16,-4,6,-116,2,16,2,15},
-                                                {-18,50,25,-6,2,1,13,-51,9,-17,1,16,1,0,5,-19,-4,4,4,2,-75,-90,-10,-2,19,24,-11,2,-5,-44,-10,-197,6,-152,4,8,0,-65,-48,-1,-124,-51,9,-47,6,-18,-10,-3,-15,-4,-1,-137,55,-22,6,4,-94,53,-5,-1,-30,-5,-64,-9,-18,2,-57,-26,-154,56,-4,43,59,3,-8,19,-12,-169,0,10,4,-11,22,-11,-13,8,1,-8,3,-123,6,-169,10,-3,21,-17,-5,-5,4,6,3,5,-1,-120,-10,-160,5,-7,14,-103,8,12,-6,14,16,-12,-6,7,-190,10,21,30,26,-1,-195,-8,-100,6,-5,13,35,-5,10,6,3,-4,-153,-10,6,2,7,43,11,-8,63,2,6,-7,11,37,2,14,5,-5,-5,8,11,-9,-29,-2,-8,-15,-13,-15,18,-11,49,-28,14,-185,-7,3,0,-9,-13,-50,-5,3,5,-4,-3,-186,-15,-131,-5,3,-9,4,8,0,-1,66,-13,4,-5,8,-5,-6,2,-9,7,-22,5,12,-31,-144,3,-12,-125,0,-30,3,-46,-53,8,-6,4,252,-5,28,-122,-8,-51,5,6,0,6,-8,-7,14,-202,-153,2,-67,-16,-5,-173,-135,20,14,-5,18,-17,-215,4,8,-7,-56,-230,-36,-4,2,5,16,6,-135},
-                                                {68,58,8,9,7,0,8,-10,12,-3,4,8,6,11,-2,-57,14,13,5,5,2,-110,7,5,-2,5,6,-1,4,16,8,22,4,24,14,0,8,8,6,9,14,11,-76,14,12,15,18,13,0,30,-7,28,-18,-13,235,1,-2,-13,-12,-7,-7,6,2,8,-24,-17,2,10,18,11,7,-13,4,-6,12,-40,5,10,11,11,4,4,18,-8,5,1,-6,8,4,30,13,5,8,-126,-17,-21,7,0,4,-18,6,4,-3,6,11,0,8,-13,-9,4,-8,7,34,5,-157,2,5,3,14,14,-30,32,-61,-4,-194,-8,-138,7,9,-75,-24,13,5,7,17,-159,4,13,-2,4,2,9,-169,-3,-10,-23,1,-5,45,-12,8,8,-5,5,-3,-4,-5,5,-47,-10,10,5,-7,14,10,3,6,-14,45,5,-62,-10,-8,0,-160,7,3,-7,0,-5,-11,5,-165,13,0,14,15,-9,-72,15,10,0,-160,-14,6,2,10,10,-86,-1,-7,4,-1,3,-26,-9,6,-158,8,5,-13,13,8,6,-75,1,0,-3,0,50,5,-1,9,5,-3,-2,10,6,3,-11,17,-3,-6,-17,-139,11,6,-153,-10,16,-2,7,-2,5,-154,3,-165,-9,11,34,23,7,2,5,4,14},
-                                                {-38,-43,0,-24,3,-8,7,9,7,-32,-8,2,-5,-3,-5,-1,-164,7,11,4,-3,10,-2,0,-156,-17,6,4,-55,-16,6,-198,-8,16,-11,13,-16,-144,12,-14,8,6,11,9,-12,1,-4,12,49,22,0,-182,-11,40,5,-5,-6,12,0,-145,53,-3,4,2,53,1,-8,6,-143,-152,12,-28,28,-8,2,16,-7,-7,4,-1,-4,-2,11,-3,8,0,-3,-13,5,-117,-153,-4,-7,11,-17,-36,0,6,247,12,11,-110,-2,9,8,2,-8,-13,8,7,-101,-1,-69,-195,14,-97,1,-100,-4,3,-5,-36,-91,5,13,-31,-17,3,3,6,-27,-7,-10,12,-147,-2,6,-6,1,-12,8,21,6,4,60,2,-104,0,4,30,5,-12,12,-4,-2,-154,4,21,-5,-28,0,-14,-7,-8,-14,11,15,50,22,-9,0,4,-16,9,-8,16,-124,9,4,7,-2,17,10,35,4,-3,-3,13,4,-172,1,56,5,-17,-28,11,2,-39,-9,-3,-101,97,-2,6,63,6,3,6,3,-2,5,-1,11,-2,4,6,3,8,-6,-6,19,6,12,-16,0,1,-126,-5,-5,-110,19,9,-6,4,-100,-9,9,11,25,10,6,5,-3,12,-8,9,11,-36,0,-44,13,14,8,-101,15,-136},
-                                                {-19,-37,-80,-1,-1,6,19,10,4,-2,9,15,-3,-80,7,6,-12,0,-111,12,-1,8,-166,6,7,54,7,3,22,10,1,20,12,20,-1,-1,-51,-136,10,2,8,-139,7,14,-21,11,0,249,-8,40,11,25,0,-19,3,-9,-4,-14,-12,2,-14,-146,-11,8,-14,9,8,17,12,-153,5,-11,0,28,-1,8,9,4,11,8,10,-31,18,4,-7,7,-9,7,4,37,0,-19,-120,-89,-19,-14,-117,-9,3,3,8,8,1,-119,8,4,-3,-7,-8,5,7,4,-1,14,3,10,3,-21,5,8,47,-13,6,11,10,-17,19,0,17,6,49,-2,5,4,-4,8,11,11,9,11,11,5,9,-14,-9,-3,12,2,7,-25,4,11,-2,5,-14,7,31,-42,3,-26,8,3,2,8,9,4,24,57,29,-6,18,6,-6,-6,0,12,-7,6,-6,11,14,13,5,33,9,13,8,5,3,4,-159,9,8,-85,4,0,16,10,7,1,7,-1,-3,7,74,8,9,6,-6,6,1,15,9,0,6,-1,-88,17,-3,1,2,-140,-10,4,-4,10,6,-146,-7,11,15,9,-125,2,-14,-6,-168,6,-6,6,9,4,-7,-161,-128,-4,6,-7,7,-15,16,7,-77,-8,12,13},
-                                                {59,-38,2,-1,8,-3,10,6,6,-5,-176,-16,-155,-4,-157,13,11,-85,12,8,-3,2,4,5,8,-75,10,-158,24,-1,8,24,4,-133,-6,0,-105,-120,10,-22,13,8,-5,10,-72,2,-17,12,-14,5,-4,27,41,-41,-3,0,-99,33,2,4,7,-4,5,-7,-26,-7,9,8,15,-144,-1,50,18,-11,8,2,4,11,2,-7,1,-16,9,3,2,8,104,-34,5,43,3,-7,2,-1,36,-24,7,-157,-1,-65,5,14,3,15,-89,3,-8,47,-4,-3,4,-101,-7,9,-154,13,-23,-8,10,-76,32,-33,-44,-5,7,1,15,-175,22,10,-30,1,10,-15,-2,2,6,4,-9,-10,-77,12,-159,2,-24,-8,12,-169,3,-27,8,3,-25,3,-8,-8,8,34,-23,1,-4,8,-1,14,5,-16,26,49,5,-13,10,-69,-9,-9,-5,-23,-13,-2,1,7,22,8,2,-128,8,3,7,0,17,6,-1,-2,0,-16,3,-48,8,-13,13,-3,-65,-11,-2,3,65,-5,11,-9,5,7,11,-5,16,-8,6,0,11,8,-1,-24,-151,-7,3,-1,5,4,11,4,-1,14,-177,19,-3,9,-8,10,4,11,-13,251,10,11,-2,4,-6,3,3,-3,5,41,16,8,4,13,-72,15},
-                                                {-6,-4,-16,0,104,-5,6,0,8,-3,-6,0,4,-3,2,2,4,-2,3,3,2,3,5,0,-1,14,4,6,3,5,1,11,2,-9,20,-43,9,10,7,7,3,5,-4,-30,2,6,-2,3,-7,4,1,-13,-30,27,6,-4,3,-28,-10,2,19,5,-4,0,24,0,1,5,8,13,0,15,-2,-5,23,-9,3,-2,-104,3,9,13,-16,-4,-1,-1,15,-2,-44,29,-1,6,4,-8,20,23,4,5,4,1,125,4,-11,6,4,4,6,-3,11,7,-2,45,-8,1,18,-2,1,-3,-3,3,-9,-6,14,4,13,9,0,0,-14,3,-6,1,5,3,0,-2,4,20,26,0,0,4,13,5,10,0,1,2,-2,-15,-1,4,-19,1,15,1,10,-21,11,24,-104,-2,-7,28,7,127,11,-5,23,6,2,-1,-1,5,2,1,4,-51,-44,4,17,2,1,-9,19,-112,5,-41,-5,-2,6,3,3,-1,5,19,1,-5,1,4,-4,-11,4,2,3,4,4,2,5,1,-5,6,3,-3,-4,4,3,8,6,-8,-14,8,-3,85,-18,-4,-6,-3,-3,-2,-14,-9,4,-2,4,-1,11,15,-9,5,-1,8,-16,8,-11,-5,-2,10,-1,-12,44,0,4,-1,8,10},
-                                                {-6,-15,-1,-7,-17,-9,-10,-1,4,1,-1,-15,2,6,1,1,2,0,-5,0,3,1,1,-8,-14,2,3,4,2,5,0,16,1,-17,20,68,8,4,2,5,3,-1,-6,-14,-3,4,7,1,-5,-3,0,-5,-18,15,6,-3,6,4,-10,1,6,0,3,0,8,-4,1,11,10,9,1,5,-2,-2,-146,1,-1,-3,-164,2,7,5,4,-1,1,-5,7,-2,-26,9,-3,5,-5,0,10,13,1,2,2,-6,54,4,0,-2,-2,3,2,-1,6,-1,-3,2,-1,-16,10,3,3,-2,3,1,5,-10,8,1,4,20,-1,0,-30,2,-6,4,4,-3,0,1,2,24,24,-13,-5,-3,10,-6,-7,0,5,3,-11,-9,2,-10,-12,-1,12,1,7,-13,16,-3,29,-6,-3,17,2,-31,-5,-9,7,0,6,3,-5,2,6,-2,5,-26,-13,2,15,3,1,-14,23,21,-1,-21,-5,-1,-1,1,5,0,3,18,-1,2,0,-1,4,-2,4,3,-8,2,1,2,0,-5,-5,10,4,2,-7,0,-5,3,1,6,-13,6,-5,-25,-11,-8,-3,-3,-7,-2,-20,3,3,-1,11,-4,-2,6,-7,1,-2,-6,2,7,-13,-7,-2,9,-4,-9,14,0,-9,4,2,9},
-                                                {-17,-9,0,-2,-10,-8,5,-2,4,4,-3,-5,5,13,1,-7,-2,0,5,0,-3,-2,5,0,-20,7,5,3,6,8,-1,10,-1,-14,33,-35,-1,6,4,16,1,-7,-2,-13,-2,7,2,4,-7,5,-1,-6,-30,19,6,-9,4,-13,-10,-3,3,3,-2,-1,16,-5,5,4,9,12,4,11,-9,-3,36,-5,-3,0,-164,-1,7,12,2,2,-1,-6,11,0,57,9,-4,5,2,1,8,12,6,5,3,-6,54,3,-7,-1,3,1,3,-4,5,1,-2,3,-11,-14,6,9,2,-2,-2,1,12,-15,14,2,12,17,2,3,-41,5,-5,-1,4,0,-5,2,-2,-140,-152,-1,-5,1,6,-1,-3,2,1,4,-14,-13,-1,2,-23,-1,28,-3,-1,-5,25,8,35,-10,6,18,3,-29,3,-6,6,2,-1,6,-4,1,4,-4,3,-21,-26,1,-1,-6,3,-34,33,31,3,57,-1,0,3,1,3,-10,-2,18,4,-4,2,1,3,-9,-1,-5,-6,-1,-8,-2,1,0,-3,13,4,-2,-11,1,0,3,2,5,-20,1,-4,-40,-18,1,-8,-1,-4,-2,-27,0,4,-3,10,-5,9,12,-3,0,0,2,-17,19,-21,-8,-2,8,-6,-15,14,3,2,-1,3,13},
-                                                {-10,-5,-1,2,44,-6,0,-5,-13,5,-2,-6,3,7,-4,-10,-1,-1,0,1,3,2,3,-1,-15,2,1,2,4,4,2,15,0,-20,26,-25,4,7,6,2,9,-7,-7,-8,0,8,-6,4,-10,-2,1,-2,-20,23,4,4,4,7,-3,1,2,1,-5,1,9,-5,-1,4,7,5,7,5,-3,-7,19,4,1,1,22,-15,1,5,3,3,0,-2,15,-1,-26,14,2,7,-1,1,8,6,-1,5,2,-9,-23,5,-2,-1,-3,0,1,-1,3,-1,-6,1,-5,-7,6,2,2,0,0,4,-2,-10,13,3,-2,16,-1,0,-32,-1,-8,-1,0,-10,1,1,0,24,21,2,-1,-7,6,-5,-10,1,4,1,-8,-10,-1,2,-16,2,25,-1,2,-5,17,9,27,-3,0,12,-10,-37,-1,-4,7,1,-3,0,-3,3,3,1,3,65,-24,0,17,2,2,-4,-134,-171,-5,-11,5,-3,2,6,1,-2,2,17,-3,-1,3,-2,-1,-2,2,-3,-6,2,-3,0,3,-6,-8,-1,-1,2,-11,2,3,2,2,-10,-13,3,-5,62,-9,0,-3,-4,-6,-1,-21,3,2,-1,4,1,7,-3,-7,1,-10,-1,-16,4,-8,-2,-2,11,-7,-10,15,-8,-6,-4,-1,7},
-                                                {-22,-8,-7,3,-81,-7,5,-6,3,2,-2,-2,4,-5,-2,-2,2,1,4,3,-2,0,7,1,-23,8,1,5,-8,4,-3,11,-4,-29,37,70,2,12,-1,1,1,4,-1,-45,3,3,-23,6,-8,5,6,2,-13,15,9,-5,4,-17,-4,2,8,5,-10,-4,16,-4,-5,0,8,3,5,9,-2,-5,-136,-3,1,-19,34,0,5,5,-9,5,2,0,6,-2,72,5,-2,5,0,2,28,11,3,3,5,2,-42,4,4,4,3,2,1,-8,13,-9,-5,-4,-4,-31,10,6,0,2,0,8,-3,-22,8,5,-1,11,-8,1,-28,1,-14,1,2,4,-4,3,2,-124,35,1,-3,2,11,-2,-2,0,4,2,-16,-20,4,-2,-25,-3,31,-1,0,-22,19,4,-113,0,3,21,4,77,6,-8,7,1,-1,0,-1,5,9,-9,6,72,-50,1,14,-8,2,-21,-137,30,-1,-56,-1,-2,5,0,2,-9,0,10,0,-5,4,2,-3,5,3,6,-14,1,-1,4,0,-4,-32,4,-2,-3,-20,3,6,0,-7,-22,-13,11,-8,2,-26,1,-5,0,-4,0,-32,-4,6,-10,3,0,-2,0,-19,6,1,5,-13,-4,-15,-2,-1,0,-23,-8,4,3,-1,1,5,8},
-                                                {-4,-4,-5,0,0,-7,-2,-1,0,4,1,-4,2,9,4,-14,3,-3,-3,2,2,12,4,2,-19,2,3,0,2,3,2,14,1,-19,23,-29,13,3,2,7,1,-3,-12,-22,-1,8,-12,3,-4,-3,-2,-6,-24,10,7,-4,5,-5,-9,2,6,3,0,0,11,2,-2,5,8,7,1,5,-1,-4,26,5,3,-3,23,-2,4,5,2,0,3,2,13,0,-22,4,-3,5,-2,4,7,4,2,2,0,-6,-20,0,-11,0,-5,1,2,-5,7,-1,1,-1,3,-11,1,1,0,-4,-1,-1,-12,-11,14,1,-2,13,0,0,-27,-12,-7,2,1,0,0,0,1,28,-175,1,-4,-3,10,-4,-9,3,2,1,-7,-10,-3,-1,-18,-3,22,0,3,-2,3,3,25,-4,-3,13,1,-22,4,-7,5,3,1,1,-2,2,2,2,7,53,-30,0,8,-1,1,-12,-128,19,3,52,-7,2,0,0,1,-6,4,11,2,0,-11,-2,1,4,6,-1,-4,1,-1,2,3,-1,-7,4,2,1,-8,2,-2,4,-1,-8,-12,-1,-3,-30,-13,0,-3,-3,2,0,-19,-4,6,4,6,-5,8,-2,-12,1,-1,-7,-9,8,-11,-4,-5,11,-2,-11,16,4,0,-3,-3,8},
-                                                {-9,-6,4,4,48,-8,2,0,1,8,-2,-1,0,4,-1,-5,3,-3,1,1,-2,-1,-1,-4,-26,-2,3,2,2,4,0,11,-1,-18,-155,-26,3,3,4,4,2,-1,-4,-14,-1,8,13,4,1,2,-1,1,-27,25,8,-4,7,-10,-9,1,3,7,0,-1,12,-1,6,1,10,2,-2,7,1,-4,34,2,1,-2,32,3,7,9,-5,-1,3,-1,13,-1,56,6,-2,4,2,2,8,10,0,6,5,-7,-27,-7,1,2,0,3,0,-3,6,6,-11,1,-8,-14,14,-14,2,-11,0,5,2,-8,9,1,11,9,-7,4,-39,5,-11,0,1,2,-1,2,-2,-153,36,2,-3,-3,17,-3,-6,2,-5,3,-16,-17,2,8,-25,-4,32,3,3,0,16,4,31,-1,0,29,4,-39,6,-12,1,-4,3,4,-7,2,3,-2,5,-38,64,0,9,0,2,-27,37,-154,1,-24,-3,0,4,1,6,-8,-1,13,4,-5,5,-2,-2,3,4,3,-17,1,0,3,2,4,-8,4,3,1,-11,-2,4,6,-11,-11,-20,3,-2,63,-17,2,-18,3,-4,-9,-29,-1,11,2,-3,-1,8,14,-17,-1,1,-13,-13,7,-19,-4,0,10,-11,-7,16,-1,-3,-8,1,6},
-                                                {-8,-8,13,1,-3,-5,0,-4,-1,-7,0,-6,0,-6,1,-11,2,-2,-16,3,4,2,7,-4,-13,3,5,3,15,5,-1,13,-4,-15,-169,56,7,-1,4,-1,1,10,-8,-23,0,6,23,5,-5,-4,0,-4,-20,13,5,-3,2,-3,-9,1,4,4,1,-2,15,-7,0,3,7,1,2,10,-4,-2,-152,-2,4,-5,22,-1,7,0,-4,-3,-1,1,16,0,-24,6,-1,5,-9,0,9,7,-2,3,2,-9,-20,3,3,13,-2,3,-1,-5,4,-2,-5,-4,3,-9,11,0,2,2,2,0,14,-9,16,5,8,11,-9,-1,-34,-1,-6,-1,3,4,-1,2,0,29,24,1,-5,-10,7,-4,-6,1,2,3,-12,-16,3,0,-24,-1,22,2,-8,-14,30,5,27,-6,-7,16,1,-26,-3,-3,5,0,1,2,-2,2,3,-1,2,-32,55,1,11,1,3,-14,24,22,-4,-27,5,0,0,4,4,-7,2,10,2,-2,-1,0,4,1,3,0,0,3,-2,0,2,0,-2,3,-1,2,-7,1,-9,2,1,-2,-12,2,0,-41,-11,-4,-1,0,-1,-3,-19,-9,4,0,3,-1,-4,9,-5,0,-5,5,-13,0,-14,-2,-4,14,-3,-7,16,-2,-6,-1,-4,5},
-                                                {-20,-9,1,-3,-81,-9,1,0,4,5,1,-1,3,17,-5,-4,3,-8,-2,2,4,-2,3,1,-13,-2,2,1,-4,4,-1,19,-1,-26,-150,-34,5,3,5,-1,2,-2,-2,-18,-3,-2,11,4,-8,2,-4,-5,-3,15,7,-1,10,3,-10,4,9,4,-1,-2,10,-1,0,2,8,3,7,3,-6,-6,36,0,3,-3,30,7,6,4,-8,0,1,-3,0,2,-48,16,1,5,3,2,25,9,4,3,2,-9,-28,4,-2,-4,-7,6,5,-5,8,5,0,89,2,-18,5,1,-3,5,1,-3,-3,-9,3,2,12,10,0,1,-30,0,-7,-4,6,4,2,2,0,31,-138,4,-12,2,9,-2,-11,-1,6,2,-10,-18,4,4,-22,0,25,3,6,-9,20,13,-150,-1,-3,12,-1,59,12,-9,6,-3,0,-7,-1,2,5,1,-2,-41,61,3,6,1,2,-20,35,28,2,57,-4,-1,1,4,1,-3,4,9,2,-1,-3,0,-3,4,2,3,-13,-1,3,-1,4,-1,-6,14,3,-2,-12,3,-1,4,0,-3,-7,2,-1,11,-19,3,-3,-3,-3,-2,-23,-5,0,-1,2,-4,7,14,-11,11,-2,6,-12,10,-13,-3,-4,5,-6,-11,11,4,2,1,-8,11},
-                                                {-7,-12,0,6,-5,-1,48,0,1,2,2,-23,5,5,4,7,4,1,8,2,1,2,5,-34,-5,5,28,5,-4,-1,28,12,5,3,5,-5,3,2,1,0,-2,-4,-3,12,-6,7,8,2,-5,7,4,-5,-7,-6,1,4,-1,17,-10,5,-4,2,3,2,-3,0,0,-10,11,8,3,0,-1,-4,-1,4,1,-1,-3,-1,4,13,10,-1,-157,-2,5,4,-7,8,1,3,1,4,-10,18,-5,1,2,-2,-7,-3,-7,4,-2,4,6,-7,3,5,-1,5,2,2,6,-7,-1,-2,0,-4,2,0,2,6,11,8,-4,-2,-3,-3,11,23,4,-8,6,4,5,3,4,-30,-5,-1,10,25,-6,-1,5,2,-12,-9,-3,67,-6,4,2,4,1,5,0,-4,-3,-1,-4,7,-2,-5,-6,-9,21,4,-2,-4,-5,34,5,4,1,-6,0,0,3,-5,2,4,5,1,-23,-7,-4,2,5,-3,3,25,4,11,-6,0,-3,8,-20,-4,-23,-6,-9,0,2,7,1,-3,5,-4,2,0,-8,3,1,1,-3,3,5,6,-2,-12,6,-22,-1,0,-6,-7,4,-4,5,1,-11,-116,-16,10,-4,2,2,7,21,-18,11,-3,1,-10,-4,-5,-7,-4,7,2,4,11},
-                                                {-8,-7,-13,-2,-3,-2,81,-2,0,-16,8,-43,6,-1,5,0,1,-3,-6,-1,0,-1,4,-42,3,-25,8,5,-20,10,-103,6,6,-1,2,-3,3,7,-4,-4,7,9,-5,-4,-4,13,-3,5,-4,1,9,-16,4,-9,9,-10,3,10,-14,5,-13,1,8,7,-14,-1,-3,-1,10,27,-2,-6,1,-3,0,-2,0,2,-1,4,8,2,19,0,-126,-5,9,7,-1,-3,-4,3,-4,6,-8,26,-6,0,1,0,3,-4,-2,-12,-5,4,6,-6,11,-4,-2,-6,2,2,20,-4,6,-4,4,-5,-13,-4,-5,2,7,10,-3,0,2,-5,25,5,2,-2,6,5,-4,1,4,-40,-4,0,6,8,-5,-2,7,6,-1,-4,-3,-47,8,1,-9,5,13,-9,1,-25,3,-3,-5,-3,-3,-3,-9,-16,1,9,4,-2,4,5,10,1,7,-1,-2,5,0,7,-5,-2,4,3,-36,-3,1,4,-10,0,4,37,3,8,-3,4,-4,6,11,-13,1,-1,-24,4,3,6,-2,-4,-1,-9,-2,4,0,3,-1,3,-7,-4,8,7,-6,-3,9,-140,1,0,-10,-7,7,1,4,0,-2,9,-1,21,-10,1,-2,-2,11,10,5,-4,0,1,-4,-11,-1,-1,2,6,4,8},
-                                                {-8,-9,0,4,2,0,48,0,3,2,7,63,9,12,8,0,1,3,9,-1,-4,-3,4,-31,5,0,31,5,8,-3,30,6,7,8,4,2,-5,3,-1,-1,1,-7,4,4,-6,13,15,4,-2,6,6,0,2,-3,4,-1,1,4,-6,2,-11,1,4,3,-6,-3,3,-7,5,11,3,-5,-6,-3,3,3,-3,3,0,-4,5,12,13,3,-157,-5,5,4,-1,11,-4,1,-1,2,-10,17,-3,5,6,0,3,-3,1,-3,0,1,6,-5,0,-1,-1,-1,7,16,3,3,4,-3,-1,-3,18,-4,-1,2,16,6,0,2,7,4,14,23,3,-5,4,5,1,1,7,-31,-1,-2,5,29,-6,0,3,5,-13,-4,-5,-27,1,4,-9,1,-1,1,-7,-3,4,-6,-3,14,-2,1,-6,-7,9,6,-1,-1,-7,-127,5,-1,5,2,1,3,0,-6,2,11,3,6,-22,-3,-2,5,0,1,5,24,-2,3,0,2,-2,7,-18,-8,-27,-13,-8,-1,-9,1,-3,-4,5,-7,4,1,-9,-3,-1,0,-3,1,8,1,-4,-5,2,-24,-1,4,-6,-8,9,1,7,-2,-7,36,-14,13,3,3,5,1,17,-10,3,-4,2,-8,-6,-3,0,2,5,1,6,16},
-                                                {-5,-10,-2,6,6,-1,-18,-5,-15,-4,2,-13,7,6,2,-6,0,2,1,0,3,4,3,73,-3,-1,-130,5,4,6,22,10,5,9,4,0,0,3,-1,5,10,-7,-4,1,-4,15,8,4,-3,-3,5,-2,2,-2,3,-4,3,17,2,3,-6,1,-1,3,-2,-2,-4,-8,6,8,11,-8,0,-5,-2,5,2,2,-2,-14,-2,4,15,9,20,-4,5,5,-4,13,0,6,-3,-6,-6,9,-7,2,4,-5,1,-4,-7,1,-9,2,4,-1,2,-5,-2,-4,10,2,6,-3,5,-2,1,-1,-5,5,-2,4,5,12,-2,0,2,-1,10,15,1,-16,5,1,2,2,2,-22,-2,-6,8,13,-7,-2,5,3,-7,-5,-5,72,5,6,-4,2,2,1,-7,-6,0,0,2,8,-12,2,-10,-8,2,4,-1,-4,-3,25,2,6,4,2,3,0,10,2,-1,6,1,0,-24,-2,3,3,2,1,0,24,4,4,-8,4,0,4,-4,-1,-13,-7,-8,3,-4,4,0,-10,-1,4,-1,6,-5,1,1,3,3,-1,7,5,-4,-2,7,-10,-3,-1,-8,-6,7,10,4,1,-9,-129,-7,-1,-4,-2,-6,-1,8,-10,7,-3,2,-1,-7,-1,1,-7,-2,-2,1,9},
-                                                {-15,-8,-4,13,8,-8,-37,-5,3,-9,8,-42,8,-4,7,3,1,8,11,2,-2,-3,5,77,5,-6,-115,6,-4,-93,-129,7,4,6,4,5,-8,10,-3,-8,1,-7,5,12,-6,2,-27,10,-7,15,9,7,-3,-9,9,-7,1,14,-17,7,-8,-5,-4,0,-16,-1,-2,-9,4,7,4,-4,2,-12,-3,7,-1,-7,1,2,10,14,5,8,36,2,2,5,3,12,0,2,-7,-7,-9,20,-5,0,4,1,4,-1,3,3,1,5,3,-4,3,-6,-1,-2,12,3,4,1,1,1,0,-3,11,-13,-2,4,5,1,-6,1,9,5,21,43,5,-2,6,7,-3,0,5,-25,-1,2,8,50,-13,-3,6,5,-20,-6,1,-39,-3,2,-8,7,3,1,-6,-21,2,7,4,13,-2,9,1,-13,10,0,-4,-5,-8,30,11,1,5,5,9,3,8,-10,0,8,5,5,-42,0,4,7,-1,-3,6,32,1,7,1,2,-1,9,-17,9,-41,-1,-12,-1,1,8,-3,-6,-33,-3,0,1,-22,-2,6,-4,-4,-14,2,4,-7,-4,5,44,5,0,-12,-5,7,-5,0,-6,-16,38,-33,5,-6,7,9,7,48,-25,0,3,7,-5,-17,-6,2,2,2,9,6,10},
-                                                {0,-4,4,1,1,-1,-19,-1,-4,11,7,67,4,11,5,-6,4,-4,3,0,3,7,3,72,0,0,-123,1,-8,1,22,10,6,8,4,-2,6,2,-3,1,-1,-4,-9,-1,-4,12,14,2,1,-2,1,-7,4,-9,1,4,3,10,-9,5,-3,4,4,5,-5,3,-4,-6,5,10,-2,-7,2,-2,1,5,2,4,1,-5,2,-1,11,3,22,-1,4,6,-2,7,0,4,-4,-1,-7,6,-6,3,2,-2,1,-5,5,0,-7,0,5,-4,6,-2,-1,-1,7,3,-4,-2,2,-4,3,-6,1,-3,1,1,3,10,-3,0,6,-9,5,18,2,-4,5,6,0,4,1,-27,-4,-4,5,16,-5,3,1,3,-8,-2,-6,-12,5,-1,-11,3,3,3,3,-14,1,-1,-3,7,-6,0,-13,-10,4,7,8,-3,-5,-142,3,3,8,0,1,0,4,2,-1,5,2,4,-14,2,-6,6,-1,-2,1,20,3,1,-5,4,-11,1,-13,-4,-9,-2,-8,4,-1,5,0,-6,-4,3,1,5,-3,1,-2,4,1,-3,6,2,-5,-7,4,-11,0,2,3,-3,9,3,7,5,-7,27,-6,-2,-9,2,-1,-4,13,-8,8,-3,0,-5,-3,-6,6,-4,3,-4,0,10},
-                                                {-8,-9,2,6,7,-5,-18,0,-3,-13,5,-26,3,6,3,-4,-1,-2,4,1,-3,1,-3,-48,-3,-6,34,3,-6,-3,29,2,4,10,4,-1,-5,4,-2,-1,-1,-6,-2,0,-3,9,-4,3,6,4,2,3,4,-3,5,7,6,13,-10,6,-5,3,5,2,-6,-1,2,-12,-1,3,-1,-3,5,-4,-1,0,0,1,2,0,5,7,7,0,32,-2,7,2,2,14,-2,2,-4,1,-8,11,-8,4,5,-2,2,-11,-1,0,-3,3,1,-3,1,2,-10,0,6,2,10,-18,2,-10,3,-2,4,3,-2,3,13,3,-3,3,7,3,10,-147,-2,-3,5,5,-1,-1,5,47,-1,-6,10,30,-7,1,-7,5,-12,-5,-4,67,1,2,-4,7,2,2,-6,-22,-2,1,-6,5,-5,4,-7,-9,12,2,3,-3,-5,38,4,1,4,1,1,2,3,-2,0,6,4,2,-26,-3,0,7,1,-5,4,26,1,3,0,4,-2,3,-18,6,-23,1,-12,3,-1,5,-1,2,0,10,2,4,-10,-1,2,2,1,3,8,3,-4,-2,4,-11,-8,4,-6,-14,10,2,6,3,-16,-138,-17,11,-4,0,4,-11,23,-17,1,-3,2,-2,-13,-5,-3,-3,-2,-10,4,8},
-                                                {-3,-11,19,8,4,-3,-29,-4,-4,-5,4,-27,3,2,3,-6,4,-1,-8,1,2,0,9,-19,3,2,25,2,2,11,-169,12,1,7,3,2,-1,-3,1,5,3,6,-4,1,-4,5,6,2,-5,-5,4,-1,2,-10,5,-2,0,12,-12,5,-2,2,5,3,-1,-3,-2,-7,8,3,1,-5,-2,0,1,3,4,2,2,-6,6,-6,0,2,20,-2,9,6,-3,10,-1,6,-11,-6,-8,12,-2,3,4,-5,1,-4,-8,12,-5,6,1,-6,2,-4,-2,-3,11,6,6,-3,4,2,5,-5,12,-1,1,4,13,5,-13,-1,3,0,11,-135,5,-2,4,6,0,5,2,56,0,-5,5,26,1,-1,2,5,-6,-12,0,-31,2,2,-5,4,-3,3,1,-3,2,-3,-10,15,-1,0,-5,-5,3,1,2,-3,-8,10,3,2,2,2,3,2,0,3,1,6,4,6,-26,-2,8,6,1,-1,2,19,3,2,-6,2,-3,4,-9,0,-15,-2,-11,3,0,4,-2,-3,-3,-13,-1,5,-3,0,-5,4,0,-8,6,2,-1,-7,6,38,1,6,-8,-7,10,3,6,3,-9,16,-16,7,-1,2,-3,6,16,-15,4,1,-2,-1,-2,-4,3,-3,0,3,-2,8},
-                                                {-9,-13,1,1,-1,-6,-19,-1,-2,-4,5,59,5,12,5,1,5,-6,1,2,4,0,2,-45,9,-14,33,2,-9,0,27,10,5,5,-1,1,6,0,-2,5,1,-4,1,5,-11,5,-34,7,-7,9,1,-8,3,-8,6,3,7,15,-12,8,-8,2,2,0,-12,0,-2,-10,4,3,4,-3,2,-6,0,2,1,2,1,2,6,6,0,7,31,-2,-4,7,-2,12,3,4,0,-5,-6,10,-4,-2,1,-11,1,-3,-3,-4,-11,5,4,-2,4,2,0,4,10,8,1,-2,0,1,3,-11,3,0,-9,2,17,-4,2,-2,5,-1,13,-137,5,-4,6,8,-1,-1,1,43,-11,-5,6,29,-11,-3,4,5,-9,-5,-1,-27,0,4,-10,5,1,3,-5,1,0,5,1,11,-7,2,-8,-12,10,-1,7,-11,-9,-164,7,6,-1,1,2,5,4,2,0,-1,2,4,-24,-2,-5,5,2,1,3,29,3,5,-1,4,-5,5,-11,5,-26,-5,-11,0,2,0,0,-2,0,-4,2,1,-7,1,-1,4,1,4,5,3,-1,-5,3,-15,3,0,-9,-7,4,4,1,0,-10,42,-13,9,-5,6,6,6,20,-13,4,-2,0,-3,-6,-2,0,1,6,2,-11,12},
-                                                {14,-20,-1,-26,-6,-5,6,5,4,-5,-5,4,3,0,0,4,4,-1,6,-169,-2,2,5,1,4,7,1,0,14,9,-1,-25,-147,5,1,-9,9,5,0,1,2,4,0,11,0,6,-5,6,-10,5,3,2,-9,-12,4,-5,-4,-2,-9,2,5,3,-1,-155,-19,-24,3,3,-23,11,3,-6,-11,-7,3,1,29,-3,-3,-3,6,12,1,-2,-1,-27,5,0,-3,-26,4,5,1,-6,-15,15,0,-1,1,2,-11,-1,-10,0,0,2,31,-6,-16,9,4,-1,-6,9,-15,0,-3,-3,-2,-1,-2,-4,1,35,10,5,6,-3,-8,2,-7,3,0,-4,1,-1,3,-4,-1,1,0,3,-21,-6,19,0,8,-1,-16,10,57,-1,20,5,-1,1,4,-2,8,38,-4,-36,2,23,-1,-7,3,-16,14,-1,-1,-3,35,2,1,6,1,-10,-5,29,-20,-6,0,8,1,2,4,-6,-1,1,3,-30,-2,-11,1,16,-2,-2,-2,0,2,-7,-1,61,-11,-1,59,4,4,-2,1,0,4,-2,-10,38,-2,5,5,-10,4,0,-5,-11,5,4,-3,2,-6,-2,6,-7,-21,-3,14,2,8,12,8,3,0,9,-3,11,8,-27,2,-17,-6,17,9,-1,7,0,7,-38},
-                                                {6,-23,7,-21,-4,-9,-9,6,2,-10,1,-11,3,-5,2,7,1,-1,-1,-166,-2,0,1,-8,7,1,0,1,18,9,-1,-19,24,6,0,-1,6,3,-3,12,0,3,4,-2,-2,7,8,4,-6,1,4,0,0,-7,8,5,-2,-4,-9,1,-4,-2,5,30,-18,-24,6,11,-10,4,-2,-7,-4,-7,3,0,28,0,-1,-1,7,4,20,2,1,-25,5,2,1,-26,-3,5,-4,1,-5,13,2,-1,1,5,1,-2,-3,-8,-4,2,20,-4,-14,0,4,-1,8,8,-12,4,2,-4,3,-4,-2,-5,-1,21,3,7,10,-1,-1,5,-4,6,3,-2,1,-1,3,-1,3,-14,0,-51,-13,1,5,-4,9,3,-13,12,-22,-11,24,3,-1,2,9,8,6,28,-2,-36,-2,23,-1,0,26,-18,7,1,3,2,42,1,6,4,4,-4,-2,23,-16,0,-2,15,0,3,1,6,-3,3,-5,-23,0,-2,-3,12,-1,1,-2,0,0,10,2,-26,-11,0,51,4,-1,-2,-1,-7,6,3,-9,-152,-7,5,0,-1,10,1,-7,-1,5,-6,-3,2,-12,-1,12,3,-22,-1,18,1,-3,10,3,-1,-2,0,-7,6,0,-19,2,-8,-5,18,-4,3,1,4,2,-28},
-                                                {23,-9,-8,-26,-5,-3,6,5,2,-13,1,2,7,13,4,3,2,1,6,-109,-6,3,3,1,28,10,4,1,25,8,1,-13,26,5,3,0,0,10,1,-9,6,4,9,6,-3,8,-19,4,-3,0,4,9,-1,-5,9,-5,2,-15,-2,2,-2,3,-2,17,-6,113,8,3,-13,15,4,1,-17,-4,5,-5,-103,5,1,-6,6,16,2,1,-2,-44,6,2,5,-19,1,6,1,7,-14,22,3,5,9,6,3,0,0,-2,0,3,21,1,-35,0,8,-5,-8,25,0,8,2,-1,1,-1,0,-6,3,-113,17,-7,8,-1,3,4,-5,7,2,2,2,4,0,0,3,1,2,22,-5,4,4,3,8,4,-3,19,-31,3,23,3,4,-1,5,-6,4,18,3,155,0,27,0,2,6,-10,-1,2,-3,4,7,1,6,1,6,-2,-3,22,-75,-6,2,28,1,6,16,3,0,5,0,-21,1,-1,-2,8,5,-1,0,1,1,-12,5,-32,-2,-1,120,0,2,1,3,-10,5,-1,-6,25,-2,3,-9,-9,9,-3,-4,0,3,2,-1,7,-4,1,12,-6,-3,-3,36,2,14,16,28,2,-1,3,3,17,3,-28,3,-11,-2,25,-4,3,10,1,4,-11},
-                                                {7,-8,-5,-16,2,-4,-2,0,-17,4,0,-5,6,-1,-3,-3,2,0,1,19,-2,4,3,0,2,10,1,1,14,5,5,-21,-157,7,3,0,4,5,1,-15,9,1,-2,1,-1,18,-8,8,-8,2,1,3,-5,-5,4,-3,3,7,0,0,-2,0,-2,25,-9,-16,0,4,-8,5,6,-9,-11,-9,2,7,23,0,-1,-17,1,9,5,8,1,54,3,0,-2,-44,3,8,-3,-3,-7,11,-3,3,2,-3,-1,-2,-1,-3,-5,-1,17,-1,-12,-2,2,-4,9,9,-20,1,1,-2,0,1,-3,-1,7,23,-3,-7,10,0,0,-2,-6,4,4,-14,3,1,2,-2,-1,2,-1,1,-15,-2,9,-1,4,2,-10,8,50,0,23,5,6,-2,1,16,0,19,1,-27,5,15,-10,1,-1,-13,0,-4,-5,-7,33,3,3,4,5,0,-1,-157,-2,-2,1,7,-1,2,1,0,7,1,0,-24,-2,-5,-1,10,-2,1,-1,-2,3,7,0,-20,-10,-2,-21,0,2,-6,-1,13,0,3,-10,25,2,2,5,-21,9,-1,-4,2,5,4,-1,-1,-6,0,9,4,-18,-1,12,2,8,-2,6,0,-11,0,-7,6,6,-24,2,0,-9,20,-5,-8,-3,0,-1,-28},
-                                                {16,-16,-2,-10,1,-7,5,0,2,3,2,0,6,-5,-1,4,3,2,4,33,-5,0,6,2,11,8,-2,0,27,9,-9,-33,29,6,1,0,-5,12,-3,-16,6,7,6,18,0,4,-20,8,-16,7,7,6,-8,-10,9,-3,-2,-3,-11,0,-7,3,-14,-138,-23,-50,-5,-1,-27,8,2,-9,-11,-8,1,2,-130,-4,0,-2,9,8,-10,5,4,68,6,-2,12,-26,3,5,-2,-1,-18,14,1,-2,6,5,2,5,2,2,4,3,33,-9,-36,-5,8,-3,8,12,-24,5,-1,3,1,-1,-2,-19,-3,31,-1,-10,1,-3,-1,2,-12,3,-1,2,1,4,-2,-5,-2,4,2,-40,-27,-5,9,-4,7,1,-18,16,-62,-4,17,0,-1,2,8,6,2,38,-1,81,2,29,3,11,35,-15,4,-5,-8,-3,44,1,8,-1,2,2,4,-142,-32,-7,-2,14,2,4,6,4,4,5,2,-11,-1,-14,-4,10,4,-3,1,2,5,2,5,72,-18,-3,-38,6,1,-2,-25,5,-1,-2,-19,-147,6,2,4,-24,-3,4,-8,1,7,6,2,8,-6,0,10,-4,-17,-14,5,6,1,2,25,5,3,9,4,-3,0,-59,3,-8,-21,26,-1,4,8,6,4,-29},
-                                                {11,-13,-1,-16,-4,-5,1,4,0,1,3,1,3,5,1,-9,3,-2,2,21,-3,12,5,4,9,1,2,-2,4,3,2,-16,23,0,3,-4,14,1,-5,-19,-1,0,-10,2,-1,8,-4,6,-4,0,1,-3,-1,-11,3,-10,0,-5,-5,2,-5,2,1,22,-9,64,-1,6,-13,9,0,-11,-12,-5,4,10,25,1,2,-5,3,5,11,2,2,69,3,3,3,-29,-2,7,-4,-4,-8,5,2,1,1,5,-1,-4,-8,-2,-7,0,23,-5,-8,2,6,-3,0,12,-17,0,-2,-6,0,-7,-6,-13,9,-176,-2,2,5,-1,0,-11,-8,4,0,0,-1,4,1,-3,-1,2,-3,-4,-8,2,5,1,3,1,-13,11,-6,-1,17,3,-3,0,4,6,11,25,0,-29,-3,16,-4,-2,-2,-15,-5,-4,5,-1,29,2,2,3,6,-3,0,-134,-30,-3,2,18,1,2,7,4,-6,4,-2,-16,-1,-3,-1,8,0,2,-11,-1,-5,-1,-1,-18,-8,1,-18,-1,1,-2,-4,5,3,2,-8,21,-3,4,-1,-17,8,-4,-6,-4,3,4,-3,2,1,0,10,-3,-15,2,10,0,7,-4,1,5,-3,-3,-4,3,3,-19,2,-2,-4,18,1,3,6,-5,2,-30},
-                                                {14,-10,2,-9,4,-6,4,5,-1,14,3,4,3,-3,-2,-3,4,-1,6,28,-8,0,-1,-4,4,-4,1,-1,21,5,0,-30,-156,7,5,1,-4,6,-2,-26,3,0,2,9,0,8,-5,6,-2,5,2,8,-5,-7,9,-3,3,-10,-4,2,-1,4,4,30,-17,-28,6,2,-21,2,-2,-12,-11,-6,5,-2,-161,-3,2,0,8,7,4,-1,3,-39,7,2,9,-20,0,3,-1,-2,-15,11,-3,2,5,-1,-1,-10,6,-2,0,2,-159,-1,-26,7,-4,-8,-11,8,-17,-16,0,-9,1,0,5,-6,-4,31,9,-11,4,0,0,4,-8,3,-2,1,3,0,0,-2,2,2,0,1,-14,0,2,0,-2,4,-15,11,55,5,17,2,4,1,4,9,7,30,0,69,6,30,0,5,9,-18,-1,-6,-3,3,30,3,3,1,3,-2,3,32,-24,1,-2,18,3,3,5,6,6,5,-1,-2,0,-7,-4,11,5,-1,2,-4,-5,9,5,-30,-17,2,-22,3,2,5,-1,-13,4,0,-12,31,-2,5,-3,-12,9,-1,-4,3,6,5,-6,6,-5,-8,12,-6,-18,1,0,3,10,14,26,2,1,-7,-6,6,1,64,4,-2,-12,19,-2,0,5,-9,3,-18},
-                                                {14,-13,18,-13,1,-4,2,1,-6,1,3,-2,3,-4,-1,-4,2,-5,-13,21,-2,2,8,0,13,11,1,-2,11,5,-3,-22,20,9,2,0,2,-2,0,-59,4,12,-3,4,1,6,5,5,-8,-1,2,1,-6,-10,6,-11,-3,-5,-7,1,-7,4,1,31,-9,-25,4,2,-27,1,0,-5,-7,-4,4,-1,28,-3,1,-4,7,1,0,0,-2,-34,4,2,3,-15,0,6,-11,0,-5,12,-4,3,5,4,-3,-1,-4,7,-3,2,-159,-5,-18,0,2,-4,12,13,-11,2,2,3,2,-3,10,-5,3,21,8,-8,2,-3,-4,-2,-2,1,3,-2,-1,2,1,2,1,1,-2,-54,-15,-3,9,-3,1,2,-13,7,-24,0,20,1,0,2,-6,5,16,23,-1,-29,-4,27,2,-1,25,-13,2,-5,-2,-3,36,1,2,1,0,-3,1,26,-11,2,0,8,2,7,3,1,3,4,-3,-21,0,-6,-3,6,2,-1,-1,-4,4,4,0,-29,-11,0,-18,2,0,1,0,-7,1,3,-9,-154,-9,6,-7,-7,12,-6,-1,-4,4,-3,3,8,-4,1,12,-5,-15,0,9,4,-4,5,6,4,-5,10,-5,-1,2,53,-1,-1,-5,19,10,0,-2,2,-2,-31},
-                                                {10,-19,-2,-22,-2,-6,1,6,1,-2,1,4,4,6,3,6,5,-7,-1,29,0,1,1,2,17,2,2,-3,20,4,0,-24,35,6,0,-1,7,0,-2,-56,5,8,4,3,-8,7,-13,9,-10,5,0,-2,-6,-10,4,-5,5,-4,-8,4,-5,6,-2,-146,-17,64,-1,4,-25,4,4,-5,-10,-8,3,-1,27,-1,0,3,9,14,-2,2,1,-41,2,-1,4,-15,1,7,2,4,-12,11,2,2,-1,-8,-3,-1,-3,-7,-10,5,-145,-7,-13,5,6,2,9,16,-16,2,-3,0,1,-8,-3,-3,-3,-159,15,-3,12,-3,-5,0,-6,1,5,2,0,2,0,-4,0,3,-10,-4,-9,1,11,-2,6,3,-14,10,-19,1,24,4,6,1,1,3,3,47,-3,-30,4,23,-2,3,8,-22,0,-9,-1,-15,34,2,8,4,-1,1,3,36,-13,-4,-1,8,0,3,4,4,-4,2,1,-26,-3,-4,0,3,0,0,-6,0,-1,12,-2,63,-19,-1,-19,-1,2,0,0,3,2,-2,-13,32,-2,3,-1,0,4,-1,-3,-2,6,5,4,4,-5,0,8,-4,-19,-4,15,0,5,16,6,4,0,7,-3,7,4,66,1,-10,-9,28,-9,7,10,1,-9,-33},
-                                                {-4,8,-4,2,-6,-1,0,-4,77,4,-1,-3,4,7,-2,5,5,-5,2,4,4,-1,7,-1,-16,7,2,6,8,1,4,8,4,6,4,-7,-3,7,6,2,3,1,2,-6,-4,5,11,3,-1,11,38,-2,-7,24,4,-12,-5,10,30,0,-4,4,-2,4,15,-3,0,-1,4,5,-9,-3,-4,-4,6,8,4,-1,1,-19,-32,7,4,-149,-1,3,4,2,-5,11,7,4,2,-4,-5,-2,3,3,3,-4,-4,2,-4,5,-2,3,9,-8,3,6,-4,7,-5,-13,7,-5,1,-5,-1,4,-6,17,18,7,-13,6,-1,4,2,4,-5,2,8,-31,5,-1,3,3,6,-5,3,-4,5,-11,-3,1,-3,0,2,-8,3,4,-8,38,-2,4,5,-2,-10,15,2,-6,-8,-9,69,-8,-9,-5,-3,6,-7,-9,0,5,-1,-6,2,-9,-7,2,5,-4,3,-2,0,-1,-5,-4,-5,2,9,-2,4,3,5,8,11,3,6,36,-6,-4,6,-5,-8,2,2,3,5,3,1,4,-4,2,5,6,5,4,34,17,3,7,-1,-9,0,2,0,0,-4,4,7,-9,-6,3,2,0,7,-12,-3,4,-113,-1,-4,9,10,-4,4,-8,-3,-11,-5,-41,0,-5,-1,11},
-                                                {0,1,-1,-2,-4,-4,-11,-3,72,-5,4,-16,5,-4,-2,3,3,-6,-5,2,7,-1,2,-8,-6,2,-2,5,10,9,3,13,1,6,3,-4,1,6,1,1,6,-3,2,-3,-6,10,-2,3,-4,5,28,-3,6,8,5,-7,3,9,18,1,-2,-3,5,5,7,-1,-1,7,6,4,-147,-5,4,-5,3,8,1,3,1,-16,-19,2,9,19,4,-2,0,5,-2,8,3,6,-4,-3,-4,1,0,2,-1,-2,0,-1,-9,-1,-6,3,4,-3,3,-1,-3,2,1,-13,6,0,6,-4,2,-2,4,10,12,3,-10,6,3,4,2,3,0,4,10,-23,6,-1,1,1,2,-17,2,-8,1,2,-4,1,-5,4,-2,-2,4,-10,4,29,-8,6,10,-1,-6,12,4,-9,-7,-3,-17,-5,-18,-5,-12,4,-5,-5,-4,3,7,0,4,-3,-3,1,13,6,5,12,2,2,10,0,-2,3,-1,0,4,12,4,10,-9,6,3,26,-1,3,-2,1,-8,5,-4,4,1,-8,-1,13,-2,6,4,4,-4,5,25,16,7,2,-2,-1,2,-2,-3,-3,-8,0,10,2,-6,4,8,-6,0,-5,-4,2,-129,-8,11,10,2,-2,2,-2,-3,-9,1,-18,-7,1,-5,9},
-                                                {-7,13,-2,0,0,-2,-1,-4,71,10,3,-4,8,4,4,-3,2,-5,1,2,0,-5,6,1,-4,10,5,5,15,2,5,2,-1,6,5,-1,-10,6,3,10,6,0,5,-1,-5,12,-7,7,-1,9,-137,-5,4,11,3,-5,3,6,29,-3,-18,0,-1,5,10,-4,1,1,4,6,-16,-5,-10,-5,6,3,0,5,2,-31,-29,8,3,36,-2,-4,3,5,7,6,3,4,0,2,-6,-2,6,8,4,-2,2,0,-5,-4,-4,0,4,-1,0,-2,0,3,-4,-10,1,6,5,-4,0,1,7,10,18,2,-10,3,4,8,6,4,-1,4,7,59,2,0,2,2,6,-5,3,-6,3,-4,3,1,-6,3,2,-3,-3,2,-4,36,-5,-2,0,-22,-12,12,6,-12,-2,-4,-31,-2,-7,0,-15,6,1,-7,-2,2,1,-7,5,1,-3,-4,-4,-1,4,10,0,5,-2,-3,2,6,4,2,4,5,-1,2,20,2,3,34,-11,-3,5,-16,-6,1,-9,-1,2,10,3,16,-5,2,4,5,4,1,28,18,7,-1,-3,3,0,6,-9,3,-4,2,10,-5,-5,1,7,-1,10,-9,4,-1,-140,-4,-4,16,2,-8,4,0,-3,-4,1,-33,0,-4,-8,12},
-                                                {-10,29,-18,6,2,3,-6,-5,-44,2,-1,-3,5,-2,2,-8,2,-5,2,2,5,3,4,0,-11,-12,-3,5,6,5,9,13,1,8,7,-1,-10,12,2,9,19,0,1,-4,-5,17,-27,3,4,8,5,-24,-12,6,3,-4,-3,7,25,-5,-21,-2,-5,7,4,-1,-5,-4,-7,4,24,-14,-3,-6,3,8,5,-3,0,-45,-23,5,-14,-124,1,-1,8,7,3,5,6,10,-1,-11,-2,-3,1,4,12,-6,-3,-1,-10,-11,-9,2,6,-2,6,-9,-2,-2,3,-1,-3,-3,5,-5,-2,-4,-4,21,12,4,3,-1,12,5,-6,3,3,5,-1,-47,2,-5,5,3,1,-5,0,-6,2,-9,-19,-3,-2,3,7,1,-2,3,-1,-104,12,4,17,-16,-17,6,3,-6,2,-25,82,-3,-1,-5,-43,3,0,-9,6,4,2,4,6,-1,-2,2,12,6,6,2,-3,-1,-13,-4,10,3,8,-1,-3,6,6,-1,34,6,-4,-3,-2,-5,8,-7,-10,5,-4,5,6,-1,2,-18,-6,6,6,5,-1,-3,10,17,5,4,-2,5,8,0,-14,-5,-4,2,9,-2,-10,6,3,-3,14,-6,-6,-5,-2,-7,-8,3,9,-1,10,5,1,-3,-6,76,-3,-5,-7,5},
-                                                {-10,26,-7,6,3,-8,2,-9,-18,10,3,-3,7,3,0,-3,3,-4,2,5,1,0,9,4,-41,3,0,7,22,0,1,9,-2,5,5,2,-10,8,-4,-3,6,2,6,0,-2,9,-16,8,-9,21,45,6,-5,20,6,3,-4,8,68,-4,-10,0,-7,3,12,-3,-5,-4,1,2,-13,-15,0,-9,4,9,4,-17,3,-37,-65,3,-1,31,2,8,1,2,5,7,6,3,2,9,-9,-5,5,6,5,1,2,4,-4,2,0,-2,6,-6,5,-7,0,3,-1,-45,1,2,1,2,0,4,9,20,21,6,-25,0,2,7,12,-1,-9,3,5,-42,3,-4,0,1,2,-3,7,0,6,-16,2,2,-2,2,4,-7,7,1,-12,-120,-4,2,6,-3,-17,20,4,0,2,-18,-16,5,-3,-4,-19,-3,6,-10,-2,6,-1,-4,3,10,6,-2,6,4,0,3,0,1,-6,0,8,3,8,-1,1,0,3,5,-22,4,11,42,-18,1,14,0,-10,1,-3,4,1,-37,-24,-10,-6,3,7,6,11,4,37,7,-1,8,-4,2,2,0,-2,2,-7,5,9,-8,-8,-7,-6,4,1,-34,-10,7,50,-1,3,3,-1,-1,-1,0,-16,-7,3,76,-4,0,-4,5},
-                                                {4,13,-3,0,-2,-2,-5,-5,-6,0,3,-4,4,8,-1,-9,4,-9,-1,2,5,6,4,3,-11,8,0,2,-2,-1,6,9,2,3,4,-5,1,3,2,-2,5,-3,-6,-6,-8,9,-2,3,2,0,-128,0,3,8,-2,-10,1,7,13,-1,-8,2,-1,7,14,0,-6,0,11,5,-10,-11,-2,-2,6,91,5,4,3,-16,-16,-4,10,27,2,1,0,3,4,-1,3,5,-5,0,-4,-6,1,4,2,-4,-2,-3,-1,0,-9,0,4,-2,5,-1,0,2,-10,-11,0,-3,3,-6,0,-5,-3,11,15,1,-14,4,8,4,5,-6,-5,3,0,67,4,3,1,2,0,-7,-2,-7,3,-5,-8,6,-5,1,3,-5,-2,0,2,-162,-3,3,6,-9,-9,10,4,-8,-4,-1,-14,-5,-13,-9,-17,8,5,-9,-6,3,0,-3,7,0,-1,-1,4,7,4,11,0,2,0,0,-14,6,3,3,-1,-2,5,2,15,4,-5,19,-13,0,3,-2,-5,3,-3,5,6,14,0,10,-4,6,8,4,2,2,24,8,7,0,-2,-1,1,2,-2,1,3,3,10,-7,-3,7,2,-1,8,-17,-7,2,24,-10,-3,10,5,-4,6,-1,-1,-7,-1,64,-3,-6,-8,8},
-                                                {-4,11,-2,8,3,-1,-2,-3,-24,12,3,-3,3,6,1,-3,5,-8,3,5,0,-3,2,-2,-19,2,2,5,10,2,6,4,-1,7,7,-4,-12,4,4,-1,5,3,4,-4,-4,11,1,4,3,13,38,4,-1,22,5,-6,2,6,31,-3,5,5,1,4,14,-3,2,-1,5,-1,-10,-7,4,-5,3,5,5,-2,5,66,-29,2,-1,-150,4,4,5,2,1,8,6,1,0,2,-8,-5,0,4,6,-5,-1,-7,-7,-2,-3,1,3,-2,2,6,-6,1,-20,-14,7,-18,3,-10,3,3,2,15,19,4,-16,-7,-3,9,4,7,-5,4,9,-25,2,1,-3,1,4,-5,3,-8,9,-5,-2,1,-12,3,5,-5,1,6,-3,37,-3,6,8,-4,-13,14,4,-4,1,-9,69,0,-9,-5,-19,1,-12,-7,-2,5,2,-4,6,4,1,0,4,6,4,10,2,2,-3,-3,3,5,5,-3,6,1,1,4,9,5,10,-114,-8,5,8,3,-13,2,-3,4,3,13,-1,-20,-4,5,11,4,6,5,36,17,10,4,-1,5,0,0,-17,6,-5,-8,12,-8,-3,6,-3,1,6,-19,-6,1,35,-16,-7,6,2,-2,7,-2,-10,-6,-1,-40,-5,-10,-4,11},
-                                                {4,12,19,5,1,1,-4,-6,-26,5,1,-5,2,11,-2,-5,4,-9,-11,3,6,-1,8,-1,-8,12,2,3,15,4,0,10,-3,6,4,-5,-10,1,6,6,4,7,0,-2,-5,5,7,6,-5,6,21,-1,0,11,5,-8,-2,12,43,-2,-9,1,2,5,11,-3,-1,3,7,-3,40,-1,-3,0,4,4,5,1,4,60,-43,-1,3,16,-5,1,6,2,2,6,2,5,-9,-12,-4,-3,2,2,3,-5,-1,3,3,11,-7,3,1,-6,1,-3,0,3,8,-10,8,0,4,2,2,-2,8,11,19,5,-6,0,-3,2,3,1,-1,-2,4,-23,0,0,1,4,4,-3,0,-6,1,-8,1,1,-2,3,2,-3,3,1,2,29,-5,3,-2,-7,-5,1,4,-6,-10,-6,-23,-4,-7,-2,-17,2,4,-9,1,0,-1,-5,2,0,-1,2,5,9,4,8,3,4,-5,-3,8,3,3,-2,5,0,3,2,-10,1,2,-130,-5,8,6,-4,-3,5,0,2,2,-40,-2,-11,-4,6,5,2,-4,1,31,2,6,-1,1,-1,3,-1,-2,4,-5,3,10,1,-4,5,0,0,-2,-15,1,2,21,-1,-12,0,3,0,2,1,1,-5,7,-25,-6,0,-8,5},
-                                                {-9,6,-3,0,-2,-4,-4,-3,-22,6,1,-3,4,7,-6,2,6,-12,-3,5,8,-4,4,2,-5,-4,3,3,6,2,4,9,4,1,2,-4,-3,0,4,-8,7,-1,4,-4,-13,5,-10,4,-4,13,-145,-9,1,10,2,4,6,9,28,1,-15,3,-1,3,5,-1,-2,0,0,-2,-16,-3,-2,-6,4,6,6,3,4,59,-29,3,0,38,1,0,-9,5,-1,11,7,4,2,-6,-4,-5,4,3,0,-14,-3,0,5,-3,-13,5,6,-2,6,1,-1,7,0,-16,-1,-1,0,0,2,-7,1,13,12,3,-11,-1,4,7,1,1,-1,0,13,61,3,2,1,1,1,-5,-7,-10,4,-8,-7,-2,-3,-1,5,-9,6,0,0,33,-4,4,7,11,-18,17,0,-5,-2,-7,-28,-4,-10,-5,-16,-4,0,-13,-4,3,3,-2,-1,0,-1,3,4,5,3,1,0,3,0,-1,-1,2,5,3,3,1,5,0,13,5,0,-137,-6,0,4,-1,-7,1,-1,0,5,17,2,18,-5,2,7,6,2,6,27,17,5,1,-1,-1,2,1,1,0,-4,1,3,-7,-5,2,5,0,8,-12,-5,6,34,0,0,11,5,-3,4,1,-4,-6,-2,-32,0,0,-13,10},
-                                                {-2,11,0,5,-4,50,4,-33,3,-4,-4,1,1,10,4,3,1,0,4,2,27,15,2,3,2,0,-2,0,-19,26,-7,-29,2,-30,-1,-10,4,11,55,5,-5,-13,-3,-20,1,-9,14,-1,-11,-3,6,4,4,-9,-4,2,33,-6,-3,-4,7,-4,-44,-1,-3,-5,-17,2,-7,11,4,9,-9,-1,-1,1,-2,-154,-2,1,0,-43,3,-6,-2,3,5,-7,-8,-97,1,31,-1,13,23,-3,-3,-1,-1,5,-6,0,1,13,7,25,5,-3,6,46,1,3,-7,6,11,-6,-6,-5,-152,0,-6,24,22,1,-17,15,-15,0,1,2,11,2,1,-6,-1,-1,-131,-5,2,-3,1,8,11,-5,10,-3,-3,-2,4,11,-3,-1,16,0,0,0,1,-6,0,-1,-4,-2,4,-17,0,-13,1,-9,-1,45,-19,-3,8,1,0,61,-3,-13,-7,-4,7,-132,-6,-30,-2,-2,11,-7,0,1,4,12,-3,9,-3,16,1,-2,-2,2,7,11,0,-1,-6,36,3,-1,22,-4,-5,-6,51,-114,6,-1,6,-10,-5,18,-8,5,-29,-13,6,3,-4,0,5,-1,-20,1,-4,-36,-6,2,-28,-36,7,-1,1,8,22,-20,5,-5,2,-15,43,-10,9,-2,4,1,4,-20},
-                                                {0,2,-7,-8,-5,40,-7,-17,2,-3,0,-14,1,-6,2,7,-1,2,-9,-1,27,13,-6,-10,11,-1,-4,0,-19,-100,-5,-19,-2,-16,-3,-2,4,11,-32,3,14,30,-2,-7,-4,-4,-9,6,-8,-6,0,11,10,-4,-1,-5,13,-13,0,0,3,-3,92,-1,-7,-9,-17,-91,-1,9,5,8,-3,-7,-5,-3,-1,39,-3,1,3,-51,0,-2,1,0,5,-3,-3,-43,-3,15,-10,0,13,-4,-2,-3,1,0,-3,-1,-2,7,-3,26,-1,-3,5,-19,-1,-1,2,9,8,-2,-1,-5,23,-3,11,21,9,-2,-22,15,-8,1,5,1,18,4,2,-7,0,-2,-158,-8,-1,-19,3,3,7,4,4,-6,-2,4,1,7,-3,-16,11,-3,-2,1,-2,12,-8,-2,-3,-4,-2,-11,2,-5,-3,-14,-9,34,3,-1,0,-2,3,-28,-5,-2,-5,0,0,-153,-4,-12,-2,-2,-1,-4,4,-1,-7,6,-2,13,-4,12,-6,2,-6,0,12,18,-3,3,-11,27,-3,-2,-166,-12,0,13,53,29,6,-2,-1,-27,-11,17,-11,0,-28,-5,4,2,0,-3,-1,-4,-14,33,-4,-31,6,-3,-19,-27,8,-1,-3,-3,-8,-7,5,-8,-3,-1,56,-10,-4,8,-3,6,0,-16},
-                                                {-6,11,1,0,-5,49,2,46,-1,5,-2,-2,2,9,5,0,-1,1,2,0,-115,9,0,0,18,1,0,0,0,23,-3,-28,-1,-1,0,0,-5,9,-32,5,0,-15,-3,-8,-3,-2,27,3,-4,-4,2,6,8,-3,0,4,6,-16,5,-5,1,-6,-33,-1,-6,-6,51,1,-43,10,0,7,-13,-5,-4,-4,-5,41,-2,-4,-1,-44,7,-2,-2,-7,9,-4,5,-15,-3,23,-3,16,8,-2,-1,0,7,-2,-3,-1,-2,6,1,16,1,-2,4,-6,3,-1,-15,23,7,7,-3,-3,31,-4,-1,18,23,-1,-13,21,21,1,11,-3,13,3,6,-4,-2,0,-155,-3,3,-5,1,4,6,-4,3,-2,-5,0,7,15,-5,-1,5,-1,7,-5,-1,9,1,15,0,-7,0,-16,-2,0,-10,-8,-10,41,-12,1,-3,0,2,-38,0,0,-4,-2,-12,-129,-3,-114,-3,0,9,-3,-5,3,-1,4,-1,10,-5,10,-2,-3,-5,1,9,7,0,-14,-5,-140,-5,-2,15,-7,-7,3,45,23,5,-1,5,-15,-12,15,-17,-3,-35,-4,3,3,-4,3,3,-4,-18,-2,-1,-36,3,-1,-26,-37,24,1,0,7,16,-11,0,-5,2,-4,32,-9,1,3,3,1,-2,-5},
-                                                {-2,17,-3,8,2,46,2,-29,-19,-9,-2,-1,0,5,2,-9,-4,6,-2,1,26,12,-2,6,5,2,-3,-1,-14,-18,-2,-17,-1,-24,0,0,-3,11,52,5,-163,-17,-5,-9,-2,1,17,4,-12,-5,5,1,11,-4,1,1,13,-13,-6,-4,2,-7,-38,1,-3,-8,-19,2,6,5,9,3,0,-6,-5,2,-1,-153,-3,-19,4,-37,4,5,-3,2,6,-5,-3,-42,-2,26,-3,2,13,-3,-2,0,3,-5,-5,-1,-1,13,-3,-160,1,2,4,-25,0,-2,-1,13,13,-3,-2,-4,-168,1,-7,26,19,0,-14,11,40,1,5,-1,13,0,6,-18,-2,-3,20,-8,0,0,4,3,13,-8,1,-3,-3,-2,8,11,-4,0,12,-2,2,-5,2,0,-13,-5,-4,-3,1,-9,-7,-3,4,-8,-14,35,-6,-4,7,-1,-1,-21,0,-1,-4,-3,12,57,-3,-2,-5,-2,-1,-6,10,-2,-2,11,1,10,-3,7,-16,-2,-3,-3,10,10,-1,-1,-2,23,-3,-4,21,-9,4,1,-22,27,8,-1,8,-26,1,-2,-14,-1,-23,-1,3,5,-2,-4,0,0,-15,30,-4,77,2,-3,-15,-24,11,-2,-9,2,10,-13,7,-3,2,-3,43,-8,0,-14,-1,-2,-2,-18},
-                                                {-78,-39,-67,-35,-34,9,-36,-70,-35,-21,-19,-34,-64,-46,-63,-39,-38,-33,-44,-49,-152,-63,-57,-33,-77,-33,-35,-62,-47,-31,-64,-66,-40,-68,-38,-33,-6,-32,-71,-35,-60,-31,-43,-43,-60,-86,-36,-42,-68,-18,-37,-123,-51,-31,-46,-2,18,-39,-34,-34,-33,-49,5,-46,-73,-59,58,-45,-78,-45,-20,-55,-5,-37,-45,-93,-56,-27,-51,-35,-52,-130,-55,-61,-63,-29,-75,-51,-33,-59,-32,16,-39,-28,-6,-45,0,-45,-62,-56,-49,-65,-7,-30,-56,-168,-38,-49,-39,50,-34,-97,-34,-34,-65,-39,-57,-55,12,-30,-16,-11,-18,-52,-61,-46,-33,-37,-45,-35,-28,-28,-85,-39,-62,-30,35,-44,-28,-26,-27,36,-27,-46,-71,-10,-34,-41,-46,-38,-35,-39,-45,-62,-50,-35,-60,-34,-60,-34,-69,-77,-2,-65,-51,-52,33,-39,-35,-58,1,-38,-52,-34,-26,19,-29,-30,-35,-37,-69,-55,-41,-63,-44,-53,-38,-31,-29,-59,-41,-49,-65,-15,-53,-68,-25,-48,-35,-26,-16,-32,-52,-31,-80,-8,-57,-61,-146,2,-65,-21,-76,-152,-18,-44,-13,-94,-38,-44,-18,-25,-70,-60,-44,1,-54,-33,-43,-34,-50,55,-13,13,-1,-38,-81,-99,0,-30,-32,20,-26,-53,-16,-38,-35,-13,28,-32,-62,-41,-19,-33,-33,-37},
-                                                {-2,19,-6,-3,-3,44,1,55,-4,-1,-2,-2,-1,-4,-1,-6,2,-1,-2,-1,29,-167,-2,10,12,3,-2,-3,-24,-13,-2,-17,-4,-10,-2,-3,8,5,-19,9,-23,-6,-8,6,-4,-5,-4,7,-8,1,-5,7,13,-6,-4,3,-15,-15,-2,-4,-3,-5,-37,-2,-2,-4,-21,10,-22,10,3,7,-1,-7,1,8,1,33,0,-4,3,-48,7,-6,0,3,1,-7,4,-7,-1,15,-7,9,16,-7,-3,-2,0,2,-2,-5,-5,7,-5,-169,-1,-4,8,-20,2,-2,-1,13,1,-2,-4,-5,38,-8,3,20,17,-3,-14,7,-77,2,11,-8,10,2,-6,-7,-2,0,10,0,-1,1,0,5,8,-2,3,-4,-4,-3,4,7,-8,-3,1,-4,9,0,-2,-4,-7,-7,-2,-5,-5,-9,-4,-1,-7,-10,-2,47,0,-6,2,-3,-3,-27,-5,-1,-1,-4,1,47,-7,-20,-2,-2,8,1,-15,0,-6,9,-3,5,-4,11,-1,3,-16,-3,3,11,0,0,1,-156,-3,0,24,-2,16,5,-16,31,11,-2,3,-31,-4,6,-14,-6,-32,-5,4,6,-4,-5,3,0,-14,31,1,84,-5,-5,-18,-28,5,2,-2,-5,6,-17,2,-6,-1,-4,52,-13,3,3,3,0,-4,-15},
-                                                {-5,12,6,-1,3,46,3,-27,-2,-3,1,0,-1,12,-3,-3,-2,0,-2,4,-112,12,-6,0,7,-3,-3,-1,-22,-16,-3,-35,-3,-34,1,-1,-6,3,50,6,-3,18,-4,-9,0,-9,-4,1,-3,3,3,110,11,-6,0,-14,-15,-14,2,-1,7,0,-40,3,-10,-1,45,-1,-36,4,1,11,-2,-2,-5,-4,1,-114,1,4,2,-56,2,-6,0,3,10,-6,4,-16,0,-134,-4,16,6,-6,-7,-2,5,0,-2,-9,-10,-42,1,19,3,-1,6,-12,-9,-5,-14,9,10,-20,-4,-10,-141,-2,-1,15,25,1,-21,16,-20,4,9,4,11,-1,3,-3,-4,-1,28,-8,2,1,1,6,19,-5,1,-2,-12,0,9,11,-1,6,15,-4,12,0,-3,-3,-11,-1,-3,5,1,-19,-2,1,11,-16,-7,-136,-24,-3,3,3,0,-35,2,-1,0,0,1,48,-5,-21,0,0,8,-2,1,2,2,7,0,8,-1,8,4,0,1,-2,4,-7,0,6,-16,31,3,0,17,0,-9,-2,-31,24,15,1,5,-11,-1,16,-16,6,49,1,6,1,-10,7,2,-10,-21,-19,2,-24,-10,1,-27,-40,18,-3,4,-15,24,-22,-1,2,3,-1,24,-5,5,1,0,-5,-4,-11},
-                                                {5,8,22,6,-1,43,-2,-27,-7,-14,-2,-6,-1,-3,3,0,-2,0,-12,0,25,14,6,6,13,-3,0,-1,-11,43,-1,-16,-4,-20,0,2,5,5,-21,8,9,-69,-4,4,-2,-9,-11,-1,-13,-6,0,-1,6,-9,0,5,-89,-11,-2,-3,2,-8,87,0,-1,-8,-20,4,-24,2,7,5,-5,-6,-4,-2,0,37,-1,0,4,-25,2,-6,-6,4,2,-7,-2,1,-2,-157,-14,14,16,-6,-4,-3,3,-3,-4,0,-1,-122,-5,21,0,-4,3,-26,-2,-1,0,13,10,-2,-1,1,24,-7,-4,22,17,1,-11,20,-20,0,5,-2,17,-4,3,-2,-5,0,33,-1,0,-6,0,-4,7,-8,1,-3,-7,0,9,9,0,-4,4,-4,11,0,-2,7,1,3,-1,-3,-1,-18,1,1,-12,-5,-9,-145,-4,-7,3,-4,-1,-16,-1,2,-1,0,1,33,-4,1,0,2,8,-4,5,2,1,12,-2,9,-3,6,-6,-5,-3,-2,13,15,2,4,2,32,-1,-4,-162,-7,5,-1,-32,26,12,-2,-6,-28,-6,12,-15,-4,58,-2,6,-1,-4,2,3,-3,-12,46,-2,-28,0,-2,-18,-27,11,3,-7,7,21,-11,1,-1,-5,3,63,-9,5,0,-7,4,-9,-18},
-                                                {-8,12,-2,6,-2,49,2,49,-1,1,-4,2,-1,11,1,2,1,-10,-5,2,30,10,-1,10,18,-4,-4,-2,-31,-19,-3,-30,-1,-26,-3,1,3,2,-29,0,5,23,-2,-4,-8,-11,9,6,-11,-4,1,4,13,-7,1,-2,-149,-7,5,-2,8,-2,-39,-4,-9,-3,-24,4,-81,2,4,8,-8,-7,-1,-6,-1,39,0,3,-2,-41,-6,-1,1,1,5,-7,-1,13,0,-149,-2,16,24,-5,2,-4,1,-5,-2,0,3,-44,-8,23,4,-8,8,53,3,4,4,18,8,-2,-5,1,41,-9,8,20,12,-1,-15,14,27,2,3,2,15,-2,10,1,-4,3,28,-4,1,3,-9,7,7,-4,10,-4,-1,-2,12,11,-1,4,14,-1,2,0,1,-3,-19,2,-4,-1,3,-13,-3,3,6,-17,-6,-145,-5,-14,6,2,4,60,-5,1,0,0,2,46,-5,-36,0,3,1,2,-4,1,3,19,-4,9,-3,3,-5,-1,-8,1,12,29,-2,1,-9,-138,0,-3,20,-4,-3,19,-37,-112,11,-1,2,-11,-7,11,-6,4,52,-2,2,6,3,1,1,-3,-18,-17,-5,-40,-4,0,-27,-35,6,7,1,8,15,-18,4,-4,1,-8,43,-5,0,2,4,4,-9,-16},
-                                                {12,16,-3,4,-6,-3,0,1,10,0,-2,3,2,13,-4,-43,7,1,-3,2,3,1,7,1,1,7,2,2,-9,-1,4,10,2,5,3,-12,19,7,-3,16,-1,0,-25,13,-1,5,-11,1,-3,8,-1,-1,-6,-3,-34,-2,-6,-9,-6,2,-5,3,-3,2,-6,1,-3,2,9,9,5,0,-1,-5,4,5,1,-2,1,2,4,11,7,-3,1,3,6,1,-15,7,8,8,-1,4,-8,-8,-2,3,5,3,-12,-4,6,-2,1,0,7,-10,3,3,2,3,-3,4,-15,-6,-2,-4,2,2,-6,11,-13,1,-21,2,0,-1,-3,48,-7,6,1,-2,4,-138,8,4,1,-2,6,3,-20,-14,-12,-3,-1,-4,2,-8,-4,-3,4,5,1,3,3,-8,9,-5,-2,0,4,0,4,-13,-3,-6,18,5,-14,0,-8,3,31,-2,3,-9,-10,1,6,-3,28,2,1,2,4,-11,-11,4,7,0,32,-4,4,11,-1,5,58,8,8,-7,1,-5,-8,-1,2,36,5,-1,8,-10,-5,1,3,6,-2,1,1,5,4,6,-4,-12,3,0,1,5,33,1,6,-2,7,0,-12,4,9,-14,-8,8,5,6,2,12,-1,-2,-160,-9,2,3,-2,-1,3,-2,-1,9},
-                                                {11,6,3,-5,-7,-2,-11,-2,8,0,2,-8,4,7,3,-11,4,-1,-9,2,3,0,1,-7,9,1,-1,2,-1,-2,2,11,3,5,4,-8,15,5,-5,10,3,-2,-30,-1,-1,11,-15,2,0,0,0,-5,2,-5,-28,1,2,1,-9,2,-6,-2,5,1,-2,2,-2,11,8,6,0,-6,3,-5,2,5,2,4,2,3,8,4,14,3,7,-1,2,4,-10,0,1,7,-6,2,-5,-3,-4,2,2,6,-4,-4,-8,-7,-2,1,5,-8,5,-4,0,0,7,4,-7,-1,4,-5,8,1,-1,8,-11,-1,-11,6,6,0,3,52,-2,7,5,-1,5,15,6,1,1,-17,6,-2,-14,1,-12,-3,-1,0,-2,0,-2,-13,11,4,-5,2,14,4,-13,-6,3,-2,-5,3,4,-6,-17,-8,6,5,-9,1,-6,0,30,0,6,-5,-4,3,12,2,-135,7,4,3,4,-1,-20,4,-4,-4,24,4,2,11,4,7,-32,9,13,2,1,-2,-6,-1,0,19,1,1,3,2,-4,6,3,4,-4,0,0,20,8,3,-6,-2,3,-1,4,4,26,0,10,7,8,4,6,3,-1,-8,-7,7,6,0,8,8,-16,-1,-146,-7,3,5,6,2,-3,1,-2,9},
-                                                {7,25,-1,3,-5,2,2,1,9,-1,3,2,6,11,3,-16,3,4,-3,2,-5,-3,5,-1,13,9,5,2,7,-2,4,9,5,11,4,-7,12,9,-4,24,1,-4,54,10,-2,12,-8,2,-1,3,-2,0,0,-4,-32,4,-2,-11,-4,-1,-6,1,-2,1,-6,-4,2,3,8,9,3,-8,-8,-3,5,9,-1,6,3,0,3,10,14,3,1,-4,6,4,-6,8,2,5,-2,9,-10,-7,1,7,9,3,-3,-4,1,-2,4,-4,5,-9,0,-2,5,1,-1,13,-24,4,1,-5,1,3,2,7,-6,-4,-15,2,2,3,7,56,-6,5,4,3,2,34,4,3,5,-4,8,3,-18,-2,-9,-2,-5,0,4,-3,-4,-3,8,8,2,-1,4,6,-15,2,5,-9,0,5,5,-5,-7,-3,8,2,-22,5,-6,0,33,-2,6,1,-4,-3,7,-6,30,15,4,6,9,0,-25,5,3,-2,35,-7,-2,5,3,3,-16,7,10,-12,0,-16,-7,-4,-8,-157,1,0,9,2,-3,-1,2,5,-2,1,-6,1,5,1,-4,-3,1,6,5,10,33,2,13,1,10,1,-7,2,8,-16,-1,7,7,3,-1,13,-10,-5,-131,-8,-2,18,6,3,5,-7,-2,15},
-                                                {12,14,1,10,-1,-1,-5,-5,-6,4,0,-2,2,0,-3,90,2,-1,-5,1,3,4,3,-1,0,12,0,2,3,-10,6,10,2,6,4,-8,9,6,-3,10,6,-7,-19,3,-2,12,-17,1,0,-7,1,-2,2,-1,-23,-2,2,-4,7,0,-2,-2,-5,1,-6,-2,-5,2,14,4,7,-10,0,-3,1,93,4,5,2,-15,-7,0,12,9,4,0,6,2,-11,4,4,7,-5,3,-10,-8,-4,4,7,1,-6,-6,1,2,-3,-2,4,-3,2,-5,0,-4,6,4,-12,-4,3,-6,3,4,-2,17,-4,0,-19,8,4,1,-1,-9,-6,5,1,-13,3,-138,8,3,-1,-3,6,-1,-11,-6,-14,-17,-5,-3,7,-8,-5,-3,13,7,2,-1,6,1,-14,1,4,-2,9,3,-7,-4,-8,-7,4,3,-19,-2,-4,3,20,0,4,-3,-6,0,11,3,19,12,4,1,1,-5,20,2,3,-3,-159,-3,3,6,-4,4,69,6,8,-3,0,-10,-10,-2,-3,23,5,-4,4,-2,-6,5,4,4,1,-1,0,8,2,3,-3,-1,6,1,0,4,13,2,9,4,7,4,-4,4,7,-18,-8,5,0,0,-1,8,-2,-1,20,-1,2,11,6,-11,-3,-8,-4,7},
-                                                {15,30,-3,7,2,-11,2,-4,8,-1,3,4,4,14,2,25,7,2,-1,5,-1,3,8,5,13,7,2,2,-11,1,2,7,1,9,8,-7,11,13,-8,14,8,2,-27,14,1,1,-3,7,-5,12,-3,6,-6,-6,-54,3,-3,-3,-9,1,-7,1,-8,1,-7,2,-5,-3,7,2,5,-8,2,-11,4,0,2,-3,7,4,5,7,2,5,6,6,6,4,-7,5,9,8,-2,-8,-13,-9,0,3,10,5,-4,-2,-10,-2,4,-4,5,-11,3,-7,5,-1,0,8,-27,0,-1,1,5,4,-2,16,-19,0,-30,1,-98,4,5,-32,-11,9,0,8,2,34,6,4,2,-5,10,0,-38,-13,2,4,-2,-2,4,-9,1,-4,9,4,-1,-1,7,1,-22,-11,1,5,12,-7,8,0,-10,-7,15,-3,-15,2,-13,6,37,-2,8,6,1,-2,11,-3,-118,1,4,6,7,4,53,6,5,-5,-132,-11,1,9,1,7,-49,5,5,5,6,-2,-10,-7,-1,31,2,-3,-14,-11,-8,0,3,3,5,0,-13,10,0,9,-7,-5,2,-1,9,9,60,6,11,-5,10,-4,-17,9,5,-40,-13,10,8,8,9,5,-16,3,41,-5,-11,22,2,8,3,-1,-2,9},
-                                                {20,42,-12,-3,-3,5,-5,-5,7,-5,2,2,3,17,-1,48,5,-1,0,3,2,5,5,2,11,-7,-3,-2,-23,-4,5,8,3,15,6,-9,25,9,-8,2,1,-9,78,-14,-2,11,-25,1,1,2,-8,-17,-1,-11,-21,1,-5,-26,0,0,-5,1,-4,2,1,6,-10,4,8,6,-4,-10,-1,-2,6,15,4,0,4,0,4,1,7,6,5,4,11,7,-5,-5,7,7,-5,2,-6,-12,-3,3,5,5,-7,-6,-3,-5,-5,-1,7,-6,10,-5,6,-2,-9,5,-11,-3,1,-6,5,-3,-24,3,-1,-3,-1,-2,0,5,3,-31,-4,8,-1,-6,2,9,6,3,-1,-4,-1,5,-8,-1,-1,3,-4,-4,8,-10,-7,1,1,2,6,2,13,-6,-2,-9,2,-3,5,-22,6,-8,-3,-10,4,15,3,0,-1,2,-4,-5,9,-6,-3,-1,15,-1,12,-1,1,4,4,-2,36,7,4,-18,-110,-6,5,7,5,6,-34,8,3,-20,3,1,-8,-5,-2,-121,4,2,4,-21,-3,5,6,4,0,0,1,15,5,-5,-5,-7,5,-2,-3,7,24,3,12,-7,11,4,-10,4,9,-12,-14,8,8,-2,-8,6,-4,2,-1,-1,3,4,-3,2,-9,-7,-5,6},
-                                                {9,19,5,8,0,-4,-1,1,4,-2,1,1,0,11,-3,-53,5,-2,-1,3,-3,1,-2,-3,1,-2,3,1,-1,-5,5,3,0,11,6,-8,9,5,-5,13,-1,3,-20,4,-2,8,2,3,2,6,-5,2,-2,-2,-39,-10,0,-9,-5,-3,-2,2,2,-1,0,2,2,-1,2,0,3,-7,3,-7,5,2,3,0,7,3,4,7,9,-1,7,4,8,1,-5,5,6,4,-2,2,-7,-8,-6,4,7,1,-6,-10,1,-5,1,-1,3,-5,0,2,-7,-1,-2,6,-11,-19,-1,-12,5,1,-10,9,-13,-1,-20,-3,-3,3,7,-28,-6,6,-4,2,2,-134,3,2,4,-4,5,0,-22,-5,-8,0,-10,-1,6,-10,-4,1,6,5,9,-1,12,4,-27,-16,1,0,6,-6,1,-4,-2,-4,7,-1,-18,3,-9,2,-144,0,4,-1,-1,-1,3,3,34,1,5,3,4,-1,-17,7,2,-1,30,-4,0,11,6,6,60,3,2,6,3,3,-11,0,-1,36,2,4,2,1,-4,3,8,4,2,2,-8,7,7,5,-4,-2,3,0,-5,11,41,-7,11,1,11,5,-15,8,9,-13,-7,3,7,-7,0,7,-13,-2,31,-1,-7,8,1,1,0,-12,-4,9},
-                                                {9,15,21,2,-2,-1,-5,-6,3,5,1,0,-1,18,-1,-35,4,-3,-17,4,3,-1,8,-1,8,9,2,0,5,-7,-1,11,1,6,3,-7,14,0,-3,17,-1,4,-29,1,-1,4,-5,3,-3,-3,-1,-7,3,-7,-33,-2,-4,-3,-5,0,-7,-1,1,2,0,0,-3,1,11,1,0,-3,-7,1,3,2,5,1,6,-3,6,-3,4,2,-2,3,8,3,-7,6,3,9,-15,-8,-4,-5,-4,3,6,3,-7,-2,-2,8,-1,0,2,-9,4,-4,-1,-2,2,7,-11,-2,2,0,7,2,-8,10,-10,1,-8,1,-1,0,2,-22,-4,-1,2,3,1,20,8,3,0,-5,4,-7,-14,-5,-13,1,-4,-2,3,-4,0,-6,9,6,-2,2,-6,0,8,-6,3,0,-15,-4,4,-8,-16,-2,3,0,-3,0,-8,0,-142,-1,2,1,-3,1,2,5,-130,6,4,6,5,-3,-17,5,1,-2,20,-6,3,3,6,4,-29,6,10,-2,4,-7,-1,-1,1,19,3,4,6,-7,-7,5,4,3,-8,3,-3,9,5,-1,-1,-6,4,-6,2,10,36,3,12,1,7,5,-14,2,-3,-12,-5,9,3,7,-7,0,-3,-1,18,3,1,12,6,1,-1,-4,-4,6},
-                                                {9,18,3,2,-6,-1,-2,1,9,3,2,6,2,15,-1,-24,7,-5,-5,4,3,-3,1,1,10,-4,2,-3,-5,-5,5,12,4,6,1,-8,16,3,-3,15,2,3,47,9,-8,4,10,6,-2,9,-5,-7,0,-4,-39,-3,5,-4,-7,3,-3,2,-3,-2,-11,4,-4,2,9,-1,6,0,-2,-9,4,9,4,3,4,6,3,6,4,2,3,3,-1,4,-8,4,8,7,0,4,-4,-6,-1,3,5,-1,-7,-3,-5,-6,-8,0,6,-5,5,0,7,4,3,8,-17,1,-2,0,4,-3,-8,15,-14,0,-13,-1,7,4,6,-33,-4,4,5,6,3,36,2,1,-1,-2,-2,-1,-13,-3,-12,-5,-2,-5,5,-4,-2,-2,7,8,-5,3,9,5,-16,-2,0,1,-3,-2,2,-5,-5,-10,11,-7,-14,-20,-9,2,-118,-1,0,0,-3,2,2,2,28,0,1,5,6,1,-36,4,3,-2,28,-5,3,4,3,6,-25,6,12,2,1,-3,-9,-3,2,-153,4,2,6,6,-4,0,6,4,-3,3,-4,18,4,3,-3,-5,1,5,9,5,42,2,8,-2,9,1,-6,5,6,-12,-9,9,8,8,0,9,-16,-2,26,-9,1,20,1,5,6,-2,-9,12},
-                                                {-3,-8,-1,3,-8,-7,-4,1,-2,-15,-1,-5,1,11,-4,7,34,-1,1,1,-2,-2,1,-5,-24,-4,1,3,-26,-1,0,-30,1,8,-4,-6,0,-13,4,4,-6,3,-4,7,1,0,17,5,46,8,1,6,-6,21,6,2,-5,-4,-4,33,42,6,-3,0,14,-2,3,0,-24,-16,5,-3,28,-7,0,-4,1,-5,2,2,7,12,3,-3,-2,-3,3,-3,-3,-14,-141,-4,5,5,-11,-9,1,2,-15,0,-7,68,4,-1,2,3,3,-5,3,3,-31,6,20,-19,10,-35,-4,-42,-3,6,-3,-2,-4,4,17,-21,-2,0,-8,-4,-10,2,-17,0,42,1,4,-1,2,-5,1,11,14,-1,12,1,46,0,3,14,2,4,5,-2,-8,33,4,6,8,-3,-4,0,-3,-11,0,-9,7,20,-2,8,9,2,-6,6,1,6,3,-12,-2,4,11,-1,4,9,3,-4,4,-5,-9,-161,3,24,0,0,33,9,-2,-162,6,-1,-9,-12,2,-6,20,3,1,5,4,1,4,-3,0,-2,4,3,8,8,-9,-8,8,3,2,-17,6,-1,-134,-5,-9,-41,12,-5,5,-3,-15,-1,8,15,6,4,4,-60,-8,13,7,-1,3,-15,1,-7,14,-1,2,-28,4,-11},
-                                                {-2,-10,-3,0,-5,-4,-13,1,-4,21,4,-18,3,0,-5,6,-172,-2,-6,0,-1,-1,0,-12,-22,0,2,5,-15,7,0,-18,1,4,1,-2,4,-13,1,-2,-1,4,-5,-2,0,8,21,6,32,-1,4,5,0,14,6,-5,-1,8,-4,27,23,1,4,2,8,-4,1,10,-9,-15,-1,-3,24,-5,0,-7,1,-4,1,-3,7,2,7,1,6,-3,-1,1,2,-29,-148,0,1,-1,-4,-5,0,3,-9,-2,1,-29,8,-10,-3,4,2,-1,1,-7,-26,-2,30,-15,10,-27,4,-25,3,2,6,-4,-6,2,11,-24,4,2,-2,-7,-4,1,0,0,21,2,5,1,-1,-18,1,2,12,3,7,0,62,4,2,15,0,-15,5,-1,-1,23,7,21,6,-5,0,-5,-3,1,-2,-3,-10,13,3,6,9,4,-9,6,6,1,20,-2,2,3,13,2,2,14,5,-1,11,-1,-12,16,-4,19,4,15,23,9,-5,35,0,-1,1,-9,4,-1,12,3,-3,5,1,-4,2,7,-1,5,4,3,2,2,-18,2,9,2,0,3,6,-2,37,-4,-6,-21,11,1,5,0,-3,-5,0,16,1,1,-1,17,2,10,5,-1,-2,-10,0,-9,-2,0,-8,66,0,-6},
-                                                {-13,-4,0,-2,-2,-4,-5,1,-4,-50,3,-8,4,13,-1,1,27,0,1,0,-6,-4,0,-5,-21,-4,2,3,-4,-3,0,-25,1,6,1,1,-10,-12,2,5,-3,1,-1,10,0,9,7,6,48,4,1,8,2,11,7,-1,1,-11,-2,26,29,1,0,0,14,-3,9,2,-19,-12,2,-5,14,-7,3,-7,-3,4,2,-4,6,5,1,2,-2,-8,4,0,5,-21,-139,0,5,8,-9,-11,5,7,-8,-1,1,-48,-1,-5,3,0,2,-2,1,-5,58,-2,-34,-14,5,56,0,-50,-2,4,-5,-8,-15,0,17,-27,0,4,2,-4,-5,0,1,-3,20,1,4,-1,4,-6,1,7,8,3,-9,2,58,2,4,13,-1,0,7,-3,2,-156,1,1,5,-1,2,-6,-1,6,0,2,5,13,0,4,0,5,-7,3,1,3,35,-1,5,1,0,-8,4,16,3,1,11,0,-9,32,1,12,2,-1,-140,7,2,31,1,-1,-2,-11,-1,-12,13,-2,-6,-1,0,3,-6,2,-1,-1,2,3,5,3,-2,-4,6,-2,1,4,3,1,34,-2,-6,-32,13,-5,2,1,-9,-4,10,16,28,1,3,-71,-8,19,-1,-4,3,-9,-3,-6,5,2,0,-38,1,1},
-                                                {-8,-4,-5,6,3,-7,-8,-4,-21,-25,1,-8,3,5,-6,-7,21,-2,-1,0,-1,-3,-2,-5,-17,0,-1,4,-7,-1,3,-19,0,12,1,-1,-5,-8,2,6,0,1,-8,-2,1,7,11,4,24,-1,4,3,0,20,2,8,1,3,-4,-152,24,2,-4,3,13,-5,-1,1,-8,-10,11,-9,17,-7,-2,-3,2,3,0,-16,3,7,13,-1,3,-3,6,0,3,-10,26,0,2,0,-8,-10,0,4,-14,-6,-1,76,-2,-2,-3,2,0,-1,2,-12,-14,-4,-1,-13,7,-29,3,-23,-1,7,2,-7,-10,2,5,-6,3,1,-4,-6,-7,1,125,-12,22,0,4,0,-2,0,1,4,9,1,3,0,-21,1,8,13,1,3,12,2,3,20,3,-2,9,-6,-2,-1,-1,-4,-18,1,7,16,-3,4,0,-1,-3,7,0,8,24,1,5,0,16,6,4,8,3,-2,5,-1,0,-173,0,23,0,-2,31,6,-9,27,3,-3,0,-8,2,-2,11,1,-6,2,3,-5,-4,1,-3,3,6,3,8,0,2,-11,7,0,0,3,5,-1,-142,-6,-3,75,14,1,7,-1,-6,1,9,3,4,-1,-4,-70,-12,9,10,-1,4,-3,-3,-7,-5,-11,-7,-33,-1,-8},
-                                                {-15,-13,-7,1,0,-5,-2,-5,-6,-12,0,-4,1,-2,-6,4,-135,2,1,4,-7,-2,2,5,-26,-11,3,4,-18,2,-4,-37,-2,7,0,1,-9,-15,-3,2,-1,8,0,10,3,-1,2,5,67,9,7,152,-5,14,10,-6,-1,-2,-1,-117,46,2,-10,-4,17,0,-6,2,-27,-14,4,-4,22,-7,0,-7,0,-12,3,3,3,3,9,6,6,1,5,-2,11,-24,43,-4,1,1,-16,-10,2,0,-15,-3,0,-57,0,1,4,2,1,-5,4,-14,-56,0,-32,-29,10,51,-3,-36,-2,5,-5,-18,-24,6,2,-22,-2,1,-4,-1,-9,4,-6,3,26,2,3,-3,0,1,5,14,11,-2,-9,1,-38,0,8,27,6,-2,1,-5,-4,37,6,11,5,-10,-3,5,-1,1,1,8,10,18,2,-1,0,1,-7,9,6,1,50,5,10,2,12,1,4,6,3,-2,9,-2,-4,36,4,15,0,-5,-130,5,2,-124,6,0,-4,-4,6,1,19,-1,0,5,0,-1,-31,-1,-4,-1,5,3,12,7,-5,-16,-6,7,-4,1,9,-1,48,-3,-7,72,11,-9,4,-12,-23,2,1,5,18,5,8,-56,-5,0,1,4,6,-13,-19,-6,6,3,-5,58,3,-11},
-                                                {3,0,0,5,-2,-3,-7,1,-5,18,3,-8,2,7,-1,-9,29,-2,-2,1,-1,9,1,-1,-25,4,-1,1,-22,0,3,-24,3,8,2,-3,7,-8,-1,3,-4,4,-11,5,1,9,-12,5,31,1,-1,4,2,8,5,1,-1,-9,-2,-166,19,4,-1,2,15,-1,-2,2,-24,-11,2,-5,19,-6,4,0,2,-2,4,-3,3,6,8,2,3,0,2,1,2,-13,20,1,0,5,-6,-10,2,4,-10,-2,-3,-27,-8,-6,-2,0,3,-4,3,-7,57,-3,35,-16,2,-23,0,-29,-1,3,-9,-9,-4,1,3,-25,5,0,1,-10,-7,4,-9,0,13,1,4,0,-2,-3,-1,3,8,-2,7,4,-31,0,5,13,-2,-1,5,-1,4,-152,3,15,5,-8,-1,-1,1,-2,-2,-2,-6,14,-6,4,1,1,-5,4,0,3,25,0,3,1,12,3,3,11,2,0,8,0,-11,16,-3,18,-1,-3,23,5,-1,34,-6,-1,-5,-15,0,3,17,2,-3,4,3,0,0,-5,0,4,11,3,3,2,-5,-16,12,-2,1,-5,5,0,32,-2,-2,65,14,-9,10,2,-10,0,9,-1,-2,5,2,15,-5,12,9,-3,3,-8,2,-17,9,3,-2,-39,-3,-7},
-                                                {4,-2,0,12,2,0,-3,3,-3,21,-2,-1,-1,20,-5,-3,16,-3,6,4,-6,0,-5,-7,3,-21,3,5,-23,-1,1,-18,1,12,1,0,0,-1,0,-8,-2,7,-1,0,4,10,0,6,36,10,2,16,-4,22,8,0,2,-17,1,12,-16,8,1,5,26,-1,5,3,-12,-4,0,10,17,-1,2,-11,5,3,7,5,12,10,-17,-2,4,-1,10,-3,11,-22,16,-1,7,-4,-14,-9,-2,5,-7,-6,-1,133,0,-5,2,4,1,0,0,-3,-35,-8,47,-2,16,90,2,115,0,5,-22,-6,-4,5,15,-39,-2,5,2,0,-5,0,5,8,-101,0,2,-2,1,-1,1,-7,19,2,-1,4,-43,3,15,26,1,6,4,-1,4,13,9,-29,20,-1,1,5,-1,7,2,5,-5,25,10,5,5,7,-11,5,-2,7,-89,0,11,6,7,5,3,11,4,-1,11,0,-7,-92,5,29,5,-7,-114,24,-2,16,7,-4,-12,-16,6,2,21,5,0,4,4,0,1,-22,0,4,13,5,6,8,-8,-9,19,6,4,8,8,1,-92,3,-5,-48,10,-9,17,2,-26,3,14,14,17,6,6,55,-7,13,11,1,3,-3,-6,-7,-1,-2,-5,-44,2,1},
-                                                {-2,-6,40,4,-1,-3,-8,-5,-8,-66,2,-10,1,18,-3,-5,-149,-3,-12,2,-1,-2,1,-7,-16,4,3,2,-4,-4,0,-19,-2,12,0,0,-1,-11,0,14,-5,8,-9,5,4,-3,2,7,34,2,0,4,0,12,5,-6,-1,-4,-5,19,23,4,1,3,15,-5,0,-1,-16,-11,3,0,13,-9,2,-5,4,-5,4,-1,4,1,1,0,-2,-1,2,1,2,-9,25,-2,-8,-2,-3,-7,4,4,-10,-2,-3,-33,1,12,-1,5,-2,-5,1,-8,-24,-3,8,-15,10,-29,0,57,2,4,0,-6,-11,3,14,-20,-7,-1,-6,-4,-6,0,-6,1,-169,1,5,2,-1,-2,-1,-1,14,1,8,1,-23,3,6,14,2,-2,8,-3,5,24,-4,-19,9,2,1,0,-9,0,1,-3,-3,24,-1,3,7,2,-6,5,2,6,-147,0,5,3,8,2,4,6,4,2,4,0,-1,27,1,20,0,-4,30,-3,-5,26,3,0,4,-8,-1,-1,19,3,-2,3,3,0,-4,-3,-3,6,7,4,-3,1,2,-3,9,0,3,-3,6,-3,40,-1,-4,-27,15,-6,9,0,-4,-3,-2,7,5,6,-2,-73,-6,6,7,1,0,-1,0,-5,9,-2,-5,59,-4,-12},
-                                                {-13,-15,4,4,-4,-9,-6,1,-4,-18,3,-4,-1,4,-14,1,36,-10,-1,2,1,-5,0,-1,-20,-5,2,2,-31,-1,3,-29,0,6,-3,-1,1,-14,0,8,-5,8,-2,4,-10,-2,-19,8,51,11,-4,3,5,16,6,1,5,1,-2,31,35,5,-3,-2,12,-2,-1,0,-35,-16,5,-4,24,-11,2,-10,4,-1,1,5,4,7,-3,3,3,-3,0,-3,6,-6,36,-2,6,7,-9,-6,1,3,-13,-12,-4,-45,0,-7,-10,6,1,-8,5,-2,48,4,17,-22,6,-39,-4,50,1,-5,1,-8,-13,1,16,-19,3,2,0,-5,-5,0,-3,3,-154,5,3,-3,-3,2,-7,5,10,-1,7,-2,-42,1,11,9,5,3,5,0,0,-153,2,3,-3,-4,-4,0,-5,-3,-4,-1,12,25,-2,-1,6,-4,-8,6,4,9,-147,2,9,3,3,0,5,8,0,-1,11,1,-10,34,1,28,0,-2,34,-3,0,-159,-1,-2,-6,-2,1,-1,16,2,-1,0,5,3,-1,12,-1,-1,6,4,7,6,-12,4,6,0,4,1,5,0,59,-2,-8,-36,10,-1,6,-3,-13,0,12,14,4,7,3,-67,-11,16,6,0,2,-10,-2,-11,-7,4,1,-30,-7,-15},
-                                                {-7,-3,13,5,-8,-5,4,-3,1,5,-4,-1,1,-25,-3,1,0,-1,65,3,3,-2,36,2,0,3,2,4,12,1,3,8,4,6,-1,-7,-1,-6,-2,7,-1,-5,-6,7,0,8,-15,-39,-4,4,4,-1,-7,-6,2,2,-4,-7,-8,4,-8,31,-1,3,-9,-3,-3,1,10,-7,1,-6,-3,35,0,-3,3,1,1,1,4,6,8,-1,-1,-5,10,-2,-13,1,3,2,-9,2,-5,-4,3,-1,3,-1,-10,-1,-5,7,1,3,4,-6,1,2,-2,1,3,-1,9,0,-1,0,3,-3,2,2,-1,6,10,10,-1,-2,-3,-5,11,1,2,-4,-1,1,5,3,6,8,-3,1,7,-7,-9,1,-3,0,1,-11,-5,5,-2,4,-4,3,-31,-19,16,-19,-2,-3,2,-5,-4,-10,-5,16,14,8,2,-1,2,4,1,-7,-1,-11,-8,3,0,-2,3,-1,6,3,-4,-10,-7,-1,-140,1,1,-18,2,11,-2,1,-5,2,16,-2,4,-7,10,4,-2,8,3,1,-2,7,-5,1,6,3,23,5,3,-8,6,26,0,-14,2,4,1,-139,-1,-1,7,-1,-4,-1,8,2,-13,10,0,5,4,2,-3,-18,1,1,6,-5,-3,-10,-7,-8,-35,-1,5,10},
-                                                {-8,-8,10,-4,-7,-7,-8,-2,-3,-1,3,-12,4,-48,-2,-1,-2,1,64,1,3,-4,26,-6,7,34,5,4,7,5,-2,11,4,6,1,1,-2,-4,-5,6,2,4,-5,2,-1,12,8,-39,-1,-8,7,2,-1,-7,5,-7,0,-1,-6,4,-5,14,5,5,-8,-6,-4,12,8,-9,-6,-7,3,34,3,3,0,6,0,1,7,-3,10,6,7,-5,5,2,-5,6,-3,1,-30,-4,-2,-2,-16,0,3,2,-2,-1,-11,0,-2,7,1,-5,2,-1,-4,-2,-10,3,5,3,5,-1,8,-1,7,-2,-7,2,7,10,0,0,6,-6,13,0,3,-5,2,3,4,2,4,-5,1,1,4,6,-6,0,-2,5,2,-3,-2,-5,7,4,-9,5,-16,-3,19,-20,1,-3,2,-3,-3,-6,-9,21,2,3,6,-2,2,2,6,-6,1,-6,-3,5,6,5,2,9,6,4,11,-4,-3,3,-119,-2,4,-7,2,9,-4,1,-1,1,16,2,-3,0,15,5,-5,6,-1,-2,-7,-8,-3,6,3,3,-29,0,2,-1,5,9,-2,-1,3,-6,2,9,-4,-2,9,7,-8,2,12,-1,-14,5,0,1,4,-3,8,-13,-7,-1,4,-3,0,-10,6,-5,-29,4,3,8},
-                                                {-5,1,14,3,-5,-4,2,-4,-1,2,2,-2,5,-32,1,0,-3,1,65,2,-2,-3,35,0,10,4,4,3,18,0,2,2,5,9,3,1,-6,-10,-3,18,0,-8,-3,5,-1,16,4,-37,-1,3,3,2,-3,-5,3,5,-2,-7,-2,2,-15,27,0,2,-8,-6,2,2,4,-8,1,-9,-10,34,5,-2,-2,7,1,-3,3,5,4,6,-1,-11,6,1,-6,4,-2,1,-10,-2,-7,-6,2,2,6,-1,-3,0,0,-1,3,1,-3,-4,0,-2,0,1,-2,12,1,6,3,-2,4,-4,11,-2,0,2,14,11,3,1,9,-3,13,1,2,-5,-4,2,3,2,9,5,0,-4,2,-1,-9,1,-6,4,4,-5,-5,4,1,4,-10,-1,-32,-13,17,-2,5,-9,0,0,-2,-5,-5,14,5,5,0,3,-1,1,1,-4,2,-4,-1,3,-4,-4,5,10,7,8,2,-6,-7,5,-137,0,2,-20,-3,9,-1,0,-1,1,15,-4,2,-13,10,1,-9,1,-1,1,-3,0,-3,2,4,-3,-36,2,-1,-11,6,-155,1,-1,-1,6,-1,34,0,-2,9,7,-1,0,10,0,-10,11,10,5,4,-1,-2,-14,-6,-8,4,-1,-6,-10,5,-3,33,1,2,13},
-                                                {-8,0,11,6,0,-1,0,-7,-13,3,-1,-1,3,-24,-1,-9,-3,-1,-17,3,5,3,18,1,0,18,3,5,19,3,5,6,4,6,2,-2,-1,-2,-3,4,5,-6,-6,4,0,17,-11,-27,1,-4,5,1,-4,-1,2,3,1,1,10,1,-11,-124,-4,3,-5,-5,-6,1,8,-7,5,-10,0,22,1,4,2,8,1,-15,-6,6,13,11,5,-8,7,2,-6,7,2,2,-11,-9,-4,-7,4,0,7,-4,-3,-1,-3,2,-6,3,-1,-2,-2,-6,-2,0,-2,1,4,0,4,0,5,2,0,2,1,5,1,7,2,3,5,-2,7,2,-4,-13,-1,-1,8,0,3,9,-3,-4,5,-7,-6,-1,-5,2,8,-2,-5,7,3,6,-5,2,-16,-18,12,-14,1,-3,-6,-5,-14,-5,-8,13,2,6,-3,-4,0,5,-2,-3,0,-6,-2,1,9,5,3,10,5,2,-1,-5,-3,1,24,2,-2,-12,2,11,-9,2,-1,-5,16,-1,0,-10,11,4,-6,4,2,-7,-2,-6,-6,7,4,2,55,-4,0,3,6,20,0,0,3,4,-1,-139,-4,-1,8,5,-3,1,6,1,-7,-7,2,2,-2,-5,2,-12,-2,0,4,2,-4,-5,3,-15,-2,-4,-1,8},
-                                                {-13,-4,5,10,3,-10,4,-7,-1,1,3,-4,4,-68,1,0,-4,9,-47,6,-3,-5,38,-1,9,9,0,3,13,8,-3,8,3,9,4,8,-15,-38,-5,5,-1,-40,0,8,3,4,-1,-76,-5,18,9,10,-14,-8,8,-8,-3,-10,-8,1,-19,-116,-4,3,-17,-6,-6,4,6,-18,1,-6,0,72,3,3,1,-2,6,7,7,-2,-2,9,7,-5,11,-2,-4,2,3,1,-47,-14,-10,-12,-34,-3,9,3,-2,4,-8,-5,5,3,2,-8,5,-4,0,-1,5,4,9,7,-2,6,4,1,10,-13,-3,6,-1,6,-6,1,8,-5,21,-3,0,-2,-3,5,1,1,6,12,0,4,9,-14,-2,-1,5,0,9,-2,0,2,-4,3,-14,3,-76,2,12,-20,0,3,20,-7,2,3,1,21,1,-6,-5,0,1,-1,8,-1,4,-3,9,5,4,4,2,1,8,6,-6,-5,-1,2,49,4,2,-28,-3,6,-2,-1,0,5,17,8,9,-5,12,-1,-4,8,-3,-5,-35,-4,-6,1,4,2,11,8,-4,-24,-4,46,-6,-4,3,0,2,44,0,3,10,6,-5,-5,4,4,-27,3,-8,9,12,5,14,-27,-9,6,8,-6,-15,-4,4,-1,0,6,7,6},
-                                                {-5,0,4,-1,-3,-3,1,-6,-2,3,2,0,3,-22,1,-8,0,-4,-18,3,4,5,20,3,6,12,3,0,-1,3,4,6,5,5,2,0,2,-4,-6,8,-1,-6,-15,3,-1,13,-7,-28,4,-1,1,1,-2,-9,-2,-5,-3,-8,-6,3,-7,-130,0,4,-8,-1,-8,5,11,-8,-1,-4,0,23,5,2,3,7,4,-3,2,5,12,4,6,-4,7,2,-5,0,2,0,-12,-4,-2,-9,5,0,3,-1,-4,-3,-3,3,-2,2,1,-3,5,-2,-3,-3,-6,4,-5,0,1,-2,5,-3,0,-7,2,2,1,13,-2,1,8,-12,7,3,-1,-3,-2,4,4,5,2,10,-4,0,6,-4,-7,4,-5,1,2,-2,-5,5,5,0,-6,4,-19,-23,15,-24,1,-3,-8,-1,-4,-6,-10,15,1,9,5,-2,-1,2,0,-4,5,-5,-1,1,2,7,1,10,5,7,1,-2,-12,6,21,1,0,-18,4,6,-3,5,-9,-3,11,0,4,-5,12,5,-5,7,0,-1,-6,-23,-3,6,8,2,13,-2,3,-6,7,-136,0,-6,2,6,3,28,7,0,11,-1,-4,4,9,3,-5,-5,-3,6,1,-8,-4,-13,0,0,7,-1,-1,-9,6,-7,45,-5,2,9},
-                                                {-11,-5,23,8,0,-4,2,-2,-6,15,1,3,3,-27,-3,-4,-2,-2,-10,4,-2,-1,-151,-2,0,13,4,5,13,1,2,4,2,10,6,2,-3,-8,-5,4,-3,-4,-3,2,0,13,4,-36,8,3,3,10,-6,-7,4,-2,3,-8,-3,6,-2,25,2,4,-9,-3,0,3,6,-16,0,-10,2,32,4,-3,3,4,4,6,6,0,3,3,3,-6,9,1,-7,5,6,-2,53,4,-8,-8,15,2,8,-1,-4,-6,-4,6,1,5,1,-3,0,4,-9,-5,-18,1,8,-15,2,-8,4,-1,4,-3,0,5,8,2,-2,3,5,-3,12,-1,-3,-3,-6,4,1,2,7,11,-1,-6,15,-2,-5,2,-9,4,7,-3,-3,8,2,3,-3,5,-37,-2,15,-12,2,-2,-5,-2,-3,0,-6,26,4,-1,-7,-1,-3,4,1,-8,3,-3,4,3,4,4,2,5,8,6,-2,-2,-2,5,41,3,5,-29,0,6,2,3,-2,-2,14,8,4,-1,13,4,-5,9,-1,3,1,-11,-2,4,8,1,31,6,-1,-8,8,24,1,0,2,1,-7,-120,-1,-5,12,-1,-6,0,4,6,-17,9,-1,2,8,-16,-1,-25,-8,3,10,0,-11,-7,4,-6,-41,-11,1,9},
-                                                {-6,2,3,3,-3,4,0,-6,-2,-10,2,0,0,-2,5,-8,-4,-7,-47,2,2,-2,-122,0,6,-1,7,1,5,1,-2,8,3,-1,2,-4,-4,18,-4,6,2,12,-8,-7,1,6,-15,-47,2,6,6,-19,-14,-12,8,-15,-12,-33,-12,3,-22,6,3,6,-5,-3,-5,0,13,-11,2,-8,-11,24,2,-9,4,-1,3,-5,8,-5,-20,2,2,-3,15,6,-6,-10,1,-2,66,-20,-5,-8,-64,-4,10,-5,-3,-2,-9,5,-1,6,-2,-9,4,-5,-4,-8,-4,5,16,3,4,2,7,-5,-7,-7,5,6,6,2,-9,-1,-1,-1,27,-12,-4,2,-9,6,8,8,4,-5,-3,-6,0,-4,-30,1,-7,4,9,-2,0,4,-4,2,0,4,-28,-4,22,-29,2,-3,-3,-5,-2,-5,-5,19,-13,9,0,2,3,5,-5,-5,1,-7,0,4,1,4,-3,5,7,7,-7,-4,2,3,17,-11,2,4,4,4,-3,1,2,-11,8,-6,15,-2,8,8,-2,5,0,0,2,-15,-3,6,9,0,-59,5,4,-14,3,-21,2,-1,7,-3,-4,-11,-2,-4,13,-7,-5,1,9,4,-1,-1,-5,12,1,1,0,-6,-10,0,3,3,-3,-14,1,-9,-59,1,-4,2},
-                                                {-12,-9,22,2,-6,-4,1,-4,-6,9,2,1,1,-19,-2,-3,2,-8,-13,5,5,-5,-141,1,9,20,4,1,8,2,4,12,7,7,0,2,8,-7,-5,2,0,-1,-2,0,-7,7,-6,-34,-4,7,2,-1,-5,-9,3,-6,4,1,-4,4,-7,22,-2,3,-12,-3,-6,6,11,-13,2,-4,-2,30,4,-2,5,7,4,7,4,1,6,7,3,-7,4,4,-8,6,4,1,56,-3,-3,-8,18,-2,2,-11,-7,-1,0,1,-9,7,4,0,3,0,-1,6,5,6,3,2,-1,4,5,-10,4,-4,-6,4,11,2,5,5,3,-7,14,-3,3,-3,1,5,2,2,4,11,-9,-6,5,-6,-4,-4,-5,4,7,-8,0,3,4,7,-10,3,-29,-8,10,-6,1,-1,-12,1,-6,-3,-9,25,1,-4,2,-11,-1,1,4,-3,-6,-3,1,7,1,5,3,-1,6,7,-2,-4,-6,5,36,5,2,-29,3,3,-2,3,-6,3,21,7,1,-2,14,2,-2,3,2,0,4,0,-5,1,5,3,-33,3,4,-2,3,-133,3,-4,1,2,4,29,-1,-1,6,-3,-9,-3,10,3,-12,8,-1,2,8,1,2,-17,-8,-1,5,0,-7,-9,3,-3,40,3,-6,12},
-                                                {14,-13,-1,2,-4,-5,-2,8,1,2,-130,4,28,8,-117,4,3,-38,3,3,4,0,3,-6,4,-1,1,29,-4,-7,3,19,3,-29,2,-7,-11,-16,0,-2,-1,4,-1,23,-25,0,13,3,-7,8,2,0,21,-11,5,-9,-8,16,-12,3,17,3,-1,-1,-17,4,1,0,14,-10,-3,-4,-7,-4,8,0,-1,0,3,1,5,12,-2,-2,0,-1,-27,33,-3,6,3,0,7,12,17,-6,-1,32,0,-50,-5,-1,-5,4,58,4,2,34,6,7,-2,81,-16,4,-12,-5,-160,1,2,60,-9,-3,-10,2,16,7,2,-149,3,2,-5,-1,7,0,2,0,3,3,3,0,-40,12,-15,-3,-3,1,3,30,3,-13,-3,-4,-7,4,-6,2,6,11,-5,13,-1,2,0,-8,-3,-9,11,15,4,3,3,-9,1,1,-2,5,-2,-10,-4,2,0,-1,1,-19,6,2,3,-2,0,1,6,1,-4,-2,1,-21,-1,-2,0,1,-5,9,1,-2,17,1,3,3,5,-2,-4,-2,1,-3,3,3,0,6,6,-2,-7,1,2,-7,2,3,0,2,-2,-3,-26,-5,1,0,1,4,8,16,-2,-33,3,5,-2,13,10,0,5,-6,-1,10,-13,-8,8,-3,67,13},
-                                                {13,-14,-3,-5,-6,-6,-13,6,-2,-2,15,-14,21,-5,32,6,3,63,-6,2,4,0,-1,-14,10,-5,2,20,4,6,2,13,2,-21,2,-1,-9,-12,-5,-7,1,2,-2,8,-15,11,8,4,-2,-1,4,-2,24,-7,7,-7,-2,15,-8,4,6,1,2,1,-10,2,0,10,9,-9,-6,8,3,-4,4,2,-1,1,1,-2,7,7,8,3,3,-5,-23,33,0,3,-2,-2,-2,-2,7,-1,-3,-163,0,-17,0,-3,3,-5,-24,4,0,28,4,-2,-2,1,-6,6,-9,1,27,0,7,-26,-6,-6,-17,-1,12,16,5,-164,8,2,-1,0,8,-2,4,0,0,1,2,-16,-31,5,-13,4,-7,1,4,25,2,-1,0,-15,9,2,-9,2,7,17,-6,1,2,-3,-3,-2,-3,-3,-4,10,-3,3,5,-9,-4,-3,6,6,2,-6,-2,5,7,6,1,-12,7,3,6,4,-2,4,-4,-1,0,10,2,-32,-4,5,0,2,-8,6,4,3,12,1,0,4,1,-4,-1,-24,0,2,3,2,-6,5,1,1,-14,2,0,0,5,1,2,4,-6,-2,-18,1,0,-1,12,5,-1,11,-5,-33,0,-6,6,8,5,0,1,4,-5,10,5,-5,-5,0,61,10},
-                                                {7,-11,2,-1,-5,-4,-3,9,2,1,31,3,34,7,42,2,-1,-16,2,2,-4,-1,1,-6,14,-8,4,-158,7,-6,3,14,3,-7,2,-2,-24,-14,-3,-8,2,0,5,19,-30,6,4,7,-3,7,5,1,31,-9,5,-10,-5,12,-8,-2,6,3,-3,-4,-12,-2,3,1,9,-9,-3,9,-11,-7,6,2,-7,3,4,-4,6,17,3,3,-2,-9,-32,-135,-2,8,-4,-2,5,9,6,-10,1,36,5,53,1,-2,3,-2,-38,0,-5,44,3,0,4,7,-7,15,-19,4,33,1,3,-22,-9,-7,-17,-4,22,13,7,-147,14,2,-6,0,9,3,0,2,2,2,6,0,-36,12,-11,5,2,4,1,33,5,-7,-4,-4,4,5,-9,-3,4,20,-3,11,4,-8,2,-9,-2,-1,11,23,-4,4,2,50,-7,-2,1,0,1,-2,0,1,-9,-6,3,-45,5,6,8,5,-2,2,0,2,-2,-1,-5,-38,2,-2,2,1,-13,1,0,-6,22,-1,-6,0,1,-2,0,8,-1,-3,2,1,-3,6,1,5,-24,-2,0,3,2,5,-1,6,-4,-2,-25,1,3,-4,5,5,9,16,-2,-43,3,-2,-7,16,6,1,5,9,-5,28,5,-1,9,-3,60,12},
-                                                {8,-6,-2,-1,0,-3,-6,2,-14,1,-154,-3,20,4,-116,-3,1,-30,1,3,4,2,0,-5,2,1,1,21,7,-2,7,14,1,-25,4,-2,-17,-8,-3,6,9,-5,-3,10,-21,12,4,2,-5,4,0,4,20,-7,3,-2,-4,19,-2,3,3,2,-6,0,-8,-1,-2,0,7,-11,2,6,-1,-6,2,7,-1,3,2,-16,1,11,6,9,2,-3,-23,27,-2,8,-2,0,-1,-1,5,-8,-3,25,1,-33,-3,-3,3,-2,-30,1,-2,30,3,-4,-2,-2,-5,5,-17,-2,26,1,5,58,-11,-4,-17,1,2,6,3,24,8,-1,-4,1,0,-12,4,1,4,3,1,-2,56,2,-11,-6,-2,1,2,-151,10,-6,-4,-5,1,5,-4,-1,4,16,-7,3,0,-2,2,-3,-11,-3,3,16,-6,4,-2,-7,-1,2,-1,3,-1,-5,-1,1,6,4,2,-6,4,0,-2,1,5,1,0,5,-4,-1,2,-27,-8,2,2,-4,-6,13,2,-4,17,1,-4,3,4,-7,-2,-26,-4,2,4,3,-1,1,6,-14,-15,-1,-1,0,5,0,1,1,-4,-1,-21,7,2,-1,1,4,9,2,-4,-31,-6,-3,-4,10,11,0,5,9,-5,15,6,-14,-1,-4,-30,7},
-                                                {14,-22,-4,5,3,-4,0,2,-1,-1,25,3,32,0,60,0,2,73,3,4,-2,-3,4,-2,10,-12,2,33,1,-8,-1,14,-1,-30,5,-1,-20,-23,-7,-8,3,6,4,25,-51,1,-6,6,-3,10,7,8,24,-11,6,2,-18,25,-9,2,5,4,-8,-2,-19,1,-6,-3,12,-14,0,3,-4,-7,6,2,-3,-2,5,7,8,4,-5,7,5,0,-45,-133,4,4,1,-2,3,9,25,-10,-1,-136,5,-68,4,0,3,3,67,2,-3,57,8,-10,3,3,-4,7,-21,3,-139,5,5,-54,-11,-21,-32,1,2,10,1,38,6,-4,-9,1,3,6,-2,4,3,-1,0,1,64,13,-26,-4,-7,0,3,-136,10,-9,1,-5,-1,0,-12,0,7,22,-8,7,3,5,0,-4,0,5,11,19,2,-11,2,5,-4,1,4,-3,3,-1,6,0,6,2,0,-18,4,4,8,7,5,4,4,-2,-3,-3,-2,-37,1,-1,3,1,-17,12,5,8,21,-3,-1,3,1,-4,-25,3,-5,-3,3,2,4,7,-1,-1,-13,3,-6,2,5,1,2,7,-4,4,-34,-7,3,-9,1,11,2,4,-16,-46,8,-1,4,1,9,7,5,-6,-23,19,5,-2,5,2,-59,8},
-                                                {12,-6,-1,-5,-5,-5,-7,6,-3,4,27,1,24,9,25,-9,4,-19,-1,1,4,12,-1,-2,10,5,1,-172,-3,-8,4,17,3,-16,3,-4,-13,-15,-5,-7,-3,0,-13,9,-24,6,-2,3,-3,0,1,-9,28,-15,2,-8,-4,11,-3,4,2,4,-4,3,-6,7,-4,4,12,-8,-4,3,-3,-4,7,7,-2,1,5,-1,1,12,5,1,3,-1,-22,27,2,2,0,0,1,4,8,-9,-3,21,1,60,-3,-5,-8,1,-32,1,1,25,6,-1,2,8,-11,7,-17,-3,28,0,4,-11,-15,-14,-10,-2,2,6,5,26,14,-8,-6,2,1,3,0,7,2,4,1,0,69,6,-7,1,-8,5,1,-148,3,-5,-5,-6,12,2,-4,0,6,18,-5,0,1,0,0,-5,-4,-1,3,15,-6,2,10,45,-8,2,-2,2,5,-4,0,2,4,1,1,-14,4,3,5,7,-8,3,-1,-3,-4,-3,2,-27,0,4,-9,-1,-11,2,1,0,13,2,-1,-2,3,-3,-5,-12,1,2,9,-1,-2,5,-4,-15,-16,-2,0,-3,3,2,-1,3,1,1,-21,-1,6,0,1,2,7,-1,-10,-30,0,-9,-2,9,10,0,3,10,-2,14,1,-5,4,-5,-21,7},
-                                                {14,-22,4,10,-2,-3,-3,9,-3,4,-136,5,-163,7,-130,-2,3,-42,4,3,-3,-2,-3,-9,3,-9,2,31,5,-3,6,12,-3,-16,5,-3,-18,-14,-4,0,-2,5,1,9,60,6,-9,3,3,4,2,7,31,-12,7,7,-6,19,-11,5,-2,6,0,-2,-15,1,6,-1,10,-15,-7,11,1,-8,6,-2,-3,0,5,7,7,15,-2,-2,5,-1,-32,-144,0,6,1,-6,6,-1,7,-10,-5,36,7,-26,-3,-10,2,3,-34,3,-3,44,1,6,-8,2,-17,3,-20,-16,30,-6,5,56,-4,-6,-16,-1,10,-2,-1,40,11,2,-6,0,2,3,-3,1,1,1,2,3,-25,9,-12,-3,-5,2,-3,32,8,-9,-4,2,2,2,-5,0,1,16,-7,0,2,2,6,5,-3,2,13,25,3,2,-6,-30,-7,3,0,-2,4,-5,5,1,6,4,2,-28,6,3,6,6,0,4,1,3,-2,-2,-3,-50,3,-1,3,-2,-22,-11,3,4,16,1,-1,4,1,4,-7,-11,-1,0,9,-1,0,8,12,-2,-23,0,4,3,4,-2,-5,7,-5,-8,-30,0,8,0,-3,8,10,15,-12,-41,4,-17,-2,11,9,5,5,9,-9,20,2,-6,4,-11,-29,10},
-                                                {11,-12,25,2,-4,-4,-8,1,-6,-1,20,-1,-169,0,29,-3,3,76,-10,2,5,0,1,-9,14,2,2,23,2,-7,3,16,-2,-16,2,-4,-12,-13,-4,8,0,13,-4,10,63,1,21,5,-4,0,3,-2,26,-10,5,-9,-7,13,-8,2,3,3,-1,0,-6,-3,-1,1,11,-10,-3,9,-8,-6,5,2,1,0,6,-1,5,8,1,3,-1,-2,-18,30,-3,1,-2,0,-9,0,8,-7,-3,-143,1,-12,-5,-2,-3,18,-37,2,-2,25,3,-1,-2,3,-7,10,-15,-1,29,7,6,-24,-3,-10,-11,1,11,13,-4,22,9,-1,-6,-1,5,3,0,1,2,4,0,0,-25,-2,-11,-2,-2,1,-4,20,4,-6,-1,-7,6,2,-6,4,-4,28,-1,6,1,0,-6,4,-2,-3,-1,21,-5,-1,-3,-23,-3,-1,1,1,-1,-4,0,3,2,2,2,-11,6,6,-2,2,5,4,2,0,-3,-2,1,-38,-3,-1,-1,-1,-6,16,0,-2,16,3,-1,0,1,-4,-5,14,-3,2,4,1,-11,4,5,-5,-17,-4,5,-4,3,-1,0,9,-4,-4,-19,0,2,-2,4,6,-4,10,-4,-29,-2,0,-6,2,8,3,-1,15,-7,16,1,-8,-5,-2,-15,6},
-                                                {22,-6,-4,2,-4,-4,-4,7,0,-1,13,5,-109,2,34,5,6,-44,3,5,5,-1,-2,-7,21,-15,0,-96,2,-6,4,14,3,-6,1,-1,-4,-2,-3,-2,4,8,7,9,131,1,-22,10,-13,6,1,1,44,-8,11,1,-10,25,-5,7,20,7,-3,-3,-9,6,-1,4,20,5,0,8,-2,-4,8,0,2,5,8,7,4,16,-9,3,2,-3,-2,23,3,-4,4,0,7,2,21,-7,1,18,0,110,0,-3,5,1,115,6,0,34,9,5,3,42,-12,10,3,-1,-95,8,6,-42,-11,-8,-12,-1,16,7,9,22,17,5,-1,-3,8,6,4,7,3,4,2,0,-53,7,0,2,4,2,3,17,15,-12,3,-2,2,4,-13,0,17,-2,14,-2,2,5,-3,8,-3,3,12,25,-13,-1,1,69,-2,2,2,4,-6,0,2,7,7,6,4,-26,8,7,4,6,0,4,2,3,-1,-3,3,-42,-3,0,0,1,7,24,2,0,31,1,3,1,4,-2,-3,-6,1,-4,7,4,-4,10,-7,11,-17,-1,4,2,5,3,8,3,-3,-2,-12,-3,3,-3,0,5,13,14,-7,-50,3,4,-11,18,17,0,6,15,-5,22,-11,-4,9,2,-47,9},
-                                                {14,13,-54,-16,-25,3,-2,6,-10,-7,-5,0,-15,15,-27,-3,-11,1,-8,-15,-18,-44,-23,0,44,-30,-5,-18,-9,-4,-10,-29,-12,32,20,-23,-22,-38,-2,-8,-1,8,-4,66,-7,-8,-14,-11,6,-4,-8,-60,63,-31,-21,3,-60,13,-4,-17,-34,-18,8,-10,-80,-7,-4,-81,-39,-32,1,-45,0,-1,13,-51,-11,-34,24,0,-18,-35,-35,-12,-10,-11,-26,-14,-20,-65,-10,-15,-14,-51,-19,-57,-5,-17,-13,0,-47,-5,0,-22,-8,-19,-13,-5,-29,-9,-2,37,-4,30,-58,-4,-15,4,-10,-5,5,13,-13,-15,-33,-69,1,-14,82,-4,15,-9,-48,-4,-20,-15,-19,10,17,0,1,-1,-30,-9,13,-8,-13,-14,24,25,-8,-8,32,-12,-47,-11,-28,29,-50,-21,10,-12,0,-45,-7,-21,6,9,-20,-36,-12,-11,-9,-12,-12,0,-7,-16,-39,-9,-52,-21,-12,42,13,23,22,-42,-6,-12,-24,-7,-20,0,-11,-77,-5,-7,-3,-13,-13,-34,-31,-4,10,-17,-10,-18,-21,-1,-18,-1,-1,-13,23,-12,3,-28,10,29,20,-17,10,-78,89,-8,-12,-13,-1,3,28,-5,-7,6,2,-7,-46,-64,18,-18,-8,0,19,-34,34,-1,-18,-13,-25,17,54,-9,6,2,-8,-15},
-                                                {9,17,-38,-11,-2,4,-49,2,-5,6,-15,-47,-20,6,-37,-4,-17,-6,-4,-14,-16,-51,-10,-59,-24,-19,14,-21,-4,-34,13,-37,-12,-54,-4,-6,-12,-27,6,-8,-53,31,-5,-51,0,-4,10,-9,-3,0,-16,-67,5,18,-28,1,-53,-20,14,-21,-2,-5,1,-9,9,-5,-4,35,-54,-42,5,25,-15,-9,-9,-68,-11,-30,-16,0,-35,-51,72,-17,22,-8,-26,-18,3,-61,-14,-14,-7,20,18,-35,3,-18,-19,1,-7,-3,-5,-41,-5,-20,-8,5,-27,-1,3,-11,-6,-28,-49,-6,-17,6,-15,4,-44,11,11,-10,-34,-94,5,-16,-32,-4,-24,11,-55,-1,-28,-14,-21,-9,-13,-34,1,3,-25,-73,19,-9,-8,-18,30,18,-3,-54,2,-19,29,-20,-54,-16,-4,24,-14,-14,-5,-20,-6,-10,12,11,-14,-28,-14,-11,2,24,-18,3,-13,-1,4,-12,-31,-35,-10,-21,-10,-12,37,-3,-6,-19,-3,2,-20,-57,-15,-64,-6,-20,2,-15,7,-38,97,-2,12,-16,-7,-19,-21,-3,-23,3,1,-15,29,-6,6,-11,6,27,-6,-7,11,-3,-18,-5,-22,-2,9,4,-26,-9,-10,5,9,27,34,-49,13,-20,-10,4,-38,31,-18,-2,-13,0,-23,16,-22,-5,7,-6,-2,-14},
-                                                {-78,5,-44,68,-4,0,-2,-3,-6,-7,-6,-7,-17,-8,-17,-10,-14,-10,-9,20,-14,-62,-21,0,-59,-26,-8,-18,-37,-7,-11,38,14,-20,-5,-4,-8,-32,3,17,-11,6,-8,-65,-5,-1,14,-8,-8,-7,-16,-72,-6,7,-14,0,-9,10,-2,-16,2,-17,9,5,18,-45,-11,-69,40,-27,3,21,9,-6,-12,-15,12,-41,-16,0,-20,-39,45,-19,-10,-21,-32,-8,-15,37,-8,-13,-13,-13,16,-49,-6,-13,-27,2,-6,-4,5,-15,-11,-19,16,-14,83,-4,-8,-67,2,-47,38,-12,-10,4,-14,0,-12,17,-10,22,-37,29,-7,-12,-8,-5,12,-9,-31,-5,-20,-9,-17,-3,-12,-2,-2,5,41,-6,-59,-12,-8,-12,22,-68,-17,1,-90,-23,-24,-9,-22,-14,-9,-102,-15,-31,-8,-78,-7,-12,6,9,-13,-39,-6,-13,-61,-8,-12,14,-11,-4,0,10,106,-21,-7,-49,-9,-14,20,-12,-5,-14,-18,33,-10,7,-15,-3,-15,-13,-4,-16,-8,-1,-24,-8,13,-9,-43,-12,-20,-8,-13,9,-1,-12,26,17,8,-26,6,34,-7,-14,7,-3,-17,-11,-28,-16,-7,3,-20,-6,53,6,-34,-9,-42,-54,-20,4,-14,5,-4,-39,-7,-15,-13,15,-21,-35,23,-7,1,6,-7,12},
-                                                {8,-51,-45,-26,-6,0,2,7,-26,-3,-11,2,-20,-23,-23,1,-11,-4,-1,-17,-17,-56,-15,-2,51,-33,-9,-21,-45,1,-23,-54,-16,-40,-8,-5,-5,-20,0,2,3,13,-3,51,-3,0,-13,-22,-1,-11,12,-59,-7,-69,-8,0,-11,-45,-40,-12,4,-11,12,-17,-59,-2,-4,27,-60,-28,-32,24,-6,8,-6,59,-18,-57,-13,-42,65,-28,-64,15,-15,-9,-29,-16,2,-60,-15,-15,-7,-1,21,12,2,-20,-18,6,-7,-5,4,-39,-3,-17,-15,2,-16,-4,-1,-9,-33,31,-32,-10,-17,4,-13,-3,-20,-37,-24,-18,41,23,30,-19,-30,-9,19,-13,25,-43,-22,-3,-20,-10,-5,3,-6,0,-18,7,14,-11,-5,-13,-16,30,-3,-2,10,2,-1,-8,-33,-13,16,-23,-13,-11,-11,40,-41,-14,0,18,50,-30,4,-7,4,-16,-5,4,-8,-8,5,-13,-11,-37,-7,-42,-9,-13,-120,-3,-6,-13,-15,-12,-13,1,-10,-28,25,-15,-8,17,6,-44,28,5,11,-18,-2,-8,-20,25,-5,-9,7,-14,-13,-14,3,-19,-90,-47,2,-12,10,-5,-23,-5,-20,-7,-7,-7,-32,-17,1,-2,6,-10,-47,64,14,-19,26,2,23,-28,-13,4,-9,3,-23,-1,3,-56,11,4,3,-10},
-                                                {47,-74,20,-23,-10,-107,-7,-67,-6,2,-11,-7,-19,0,-32,-14,-14,-10,-5,-19,0,115,-17,-9,-69,12,-12,-20,25,-1,-17,33,-13,39,-16,-11,-7,-52,-94,-3,52,-50,-14,42,-8,-63,-23,4,-10,-6,-18,74,-29,22,-15,-1,57,29,-22,-17,0,-16,-143,-11,42,-7,-40,78,44,-56,-9,-106,22,-20,-16,-45,-25,64,-20,-4,-9,157,-86,-17,-15,-16,-36,-11,-15,44,-21,-12,-12,3,-64,27,2,-15,-31,-2,-9,-9,4,56,-11,16,-17,-14,-24,-6,-3,-77,6,-43,-73,-11,-19,-6,17,1,-17,-39,-61,-19,37,-82,-8,-18,-21,-8,-69,-16,12,-4,-23,-11,14,-4,-17,-1,-9,-15,-67,6,-89,-2,-7,-14,-42,-93,-4,0,-58,-17,-19,-16,-48,-1,2,20,-28,-15,33,10,-11,-19,-27,27,1,48,26,-10,-14,-14,-12,-123,-13,-13,-4,-15,-7,55,-11,42,-18,-16,22,-6,0,-17,-17,-21,-19,-26,-19,-13,-9,-12,-2,-9,-8,65,-33,-10,26,22,-10,-16,24,3,125,2,-79,11,-47,-13,-7,121,-2,-83,28,-16,-115,-2,-6,-4,-31,-9,-12,-9,23,6,-11,-137,-15,-13,30,54,-42,-6,-12,6,-109,34,-9,-4,-13,13,78,27,36,-5,0,-9,3,11},
-                                                {-60,-26,-51,-11,0,-4,2,2,-5,0,-10,-3,-14,-62,-12,-57,-19,-3,-2,-12,-17,22,-18,-5,-51,-40,-13,-16,-19,6,-22,-58,-10,-25,-13,4,-29,-21,10,-65,-15,10,-51,-52,-5,-6,6,-27,-10,-3,-3,-70,-14,11,64,-7,-14,-12,-2,-21,12,-12,5,-9,18,-11,-1,-50,-52,-22,4,19,-10,10,-18,61,-14,-40,-23,1,-19,-11,40,-11,-18,-14,-17,-8,-2,-24,-18,-13,-6,23,18,8,1,-11,-23,3,-1,2,-9,-24,-8,-19,-12,8,-21,-4,-5,-22,-5,-33,48,-4,-8,7,-16,1,51,-45,3,-13,41,28,-35,-14,-24,-27,15,-17,-54,-9,-24,16,-19,-19,-15,4,-8,19,37,9,17,37,-2,-7,-22,15,-2,5,-13,-15,-21,-18,-12,-17,11,-9,-19,-16,-2,27,-8,-7,15,27,-16,-24,-26,-15,6,-14,22,7,-15,-2,8,-8,-21,-30,12,-76,-16,-18,16,-8,-17,-18,-14,17,15,3,-16,-21,-7,-21,-31,-5,-10,-47,-62,1,10,-14,-5,22,-20,2,-17,0,5,-15,-15,-6,8,-18,13,-72,-6,-10,7,5,-29,-2,-54,-15,-84,-4,-24,-6,-20,-2,8,-17,-46,64,22,-32,-6,12,2,-30,-2,2,19,4,-24,-65,-83,-2,2,9,3,-11},
-                                                {22,8,35,-22,-9,-2,-2,3,2,10,-7,-2,-15,-66,-14,6,14,-3,-3,-16,-15,-30,-12,5,44,-2,-17,-14,36,-7,-23,40,-12,-50,-7,-7,-9,19,-1,-5,1,-5,-4,3,-5,-1,-12,0,-89,0,-10,92,-13,-33,-19,6,2,13,-21,18,-38,-10,5,-12,-79,-10,-9,-19,47,26,5,25,-9,-12,-11,-58,-21,-19,-17,-12,-11,-37,-64,-16,-20,-8,-42,-5,-14,34,12,-3,-7,-25,30,16,11,-14,101,0,-5,-108,2,0,-9,-18,-11,-9,-22,-9,-39,-72,20,32,-56,-18,-7,-87,-9,-9,-3,14,-1,-14,-33,69,-2,-13,-17,-2,15,-20,62,-6,23,-21,-20,-3,-11,-7,-4,10,-50,-12,-64,-13,-41,-8,-41,-65,-9,-10,8,-11,-22,15,-21,25,-19,13,-12,-15,-11,-2,-7,-19,3,-46,-11,-22,-16,-8,17,-20,-18,10,11,-1,-11,-16,-29,-34,-15,-14,-14,-14,15,-7,-10,3,-13,-93,-23,11,12,-42,-12,20,-8,-8,12,2,-27,-2,-65,-16,-9,-20,-19,-6,-12,-12,4,-14,-27,-13,-5,-39,25,44,-18,-13,-1,-6,-19,-3,70,-14,-4,-58,-25,-3,-28,2,29,-22,-42,-65,-17,-7,-15,-18,15,-32,-16,-10,-20,10,-14,13,28,-8,12,-50,-1,20},
-                                                {0,15,83,-26,-3,4,2,6,5,-23,-9,-6,-17,36,-18,7,-10,-9,-20,-20,-16,-37,9,-1,-49,19,-7,-16,-33,10,-14,-58,-15,-40,-12,-5,13,27,6,-4,-48,-39,1,-7,-6,-3,1,8,-7,-2,-17,-58,-5,15,-18,-6,-30,3,9,-15,13,11,5,-17,9,-1,-4,-4,-43,30,15,12,-2,-70,-16,-61,-19,-40,-24,-2,-28,-13,-38,-17,-5,-7,-41,-14,2,-37,-11,-13,-11,-3,16,3,13,-11,-20,3,0,-2,-7,-25,-9,-20,-13,1,-19,-2,3,-15,-29,-29,-43,-6,-12,-3,-18,5,-35,11,10,-19,-30,1,8,-8,-25,4,-34,-2,-38,-3,-19,-15,-22,-20,-19,-7,-3,13,-22,9,16,-10,-6,-11,-24,35,-2,-6,7,-19,8,-17,143,-13,-50,31,-23,-11,-6,3,-8,-8,12,-59,-18,-30,-9,-10,-1,-3,-10,6,-12,2,-2,-17,-10,-38,-10,-68,-20,-23,-119,1,-11,-13,12,-5,-18,-4,-9,-9,-5,-12,2,-11,-46,-42,22,-1,-82,-17,-5,-15,-19,-4,-16,1,10,-14,-17,-12,-57,-31,-2,18,-7,24,1,4,-26,16,-27,15,-2,0,-35,-6,-4,5,-6,-4,40,-38,14,-18,-9,0,-5,38,21,-4,-13,7,-22,11,-86,-3,-29,-6,4,-8},
-                                                {-53,11,-1,-11,-3,1,0,-3,-2,-14,10,-7,20,-6,26,-14,-17,-35,-3,-14,-20,-47,-16,0,-59,13,-15,22,9,2,-22,-28,-12,36,-7,-1,27,21,8,7,-34,4,-7,-85,-69,4,-11,-3,-4,-2,-14,-54,-99,9,-8,-10,-6,-38,-3,-15,-20,-11,8,-7,27,-9,-1,-40,-69,22,2,-49,1,-10,-20,-31,-13,-35,-19,-10,-17,-27,-8,-19,-17,-3,135,9,0,-35,-15,-10,-9,-21,-42,11,7,12,-27,-83,-6,-3,5,-17,-23,-20,-10,-59,-27,-9,-8,37,0,-39,37,-7,12,-3,-17,-30,2,14,22,-13,-35,-33,-5,17,-26,3,11,-15,-48,-7,-23,-9,-23,-13,-14,-4,-20,1,40,-8,22,-6,-4,15,-30,24,-6,-1,-11,-20,7,-11,-24,-23,1,-4,-22,-16,-5,-23,-3,-10,2,-38,-7,-23,-5,-9,-9,-19,-9,-5,-5,-1,-6,-15,-46,-41,-5,48,-19,-17,19,-12,0,-11,-12,-8,-7,8,-10,87,-13,-10,0,-17,5,54,-29,-8,-61,-10,-9,-13,-21,-9,-14,-10,7,-12,-17,-8,8,-21,1,31,22,-9,0,-6,-18,-4,-32,-10,-11,0,33,-7,-11,6,4,-16,-42,-60,16,48,-17,1,13,-36,-25,-7,-13,-18,-22,-35,-86,-6,-6,4,-50,-14},
-                                                {-45,-1,-32,-13,-16,-1,-10,-27,-7,-4,3,-10,3,23,8,-9,4,-16,-13,5,8,63,-6,-8,25,4,0,3,-3,-26,-4,23,5,32,9,-17,5,6,-24,7,14,-43,-16,11,-19,-36,0,-7,7,-29,-1,4,-8,-14,-8,-3,22,0,1,6,-14,0,-15,6,-50,-14,-24,29,47,14,-8,-43,7,-1,5,-37,0,22,5,-12,-16,-39,20,-9,1,-19,-40,8,-21,41,9,-8,-10,-27,-33,-28,6,5,-18,-11,-20,-18,-8,22,-18,12,7,-4,-27,-7,-15,-13,-11,19,22,-23,1,-12,7,-15,-6,-8,4,10,18,23,-32,7,-10,-13,-12,3,-15,-15,5,2,-1,4,7,-13,-11,0,23,-4,-58,0,-22,8,12,-54,-14,-11,3,-3,-11,10,-51,1,0,-16,-1,-20,0,-21,-19,-26,16,-26,-27,12,8,-19,-8,6,6,-26,11,-11,-16,4,-46,16,5,47,3,2,19,-21,-11,1,-3,-12,-4,-7,4,29,-8,8,-12,6,7,16,-27,-12,-49,6,-18,-3,13,-2,3,-6,-26,7,12,9,-7,-24,-18,-84,14,3,-19,-15,-18,-3,38,6,-11,-6,11,-21,15,-26,17,7,7,27,-22,-6,3,7,8,14,19,-17,2,16,48,-9,-4,-15,-3,-10,-14,0}};
-
-alignas(32) int16_t hiddenBiases2[256] = {-141,-105,-158,-76,-84,-79,-96,-73,-80,-25,-49,-75,-113,-87,-143,-92,-76,-81,-72,-96,-93,-116,-123,-89,-149,-66,-72,-109,-76,-102,-120,-86,-80,-118,-78,-72,-19,-82,-87,-67,-103,-105,-86,-72,-138,-121,-55,-78,-97,-84,-77,-249,-105,-49,-84,-11,-92,-63,-74,-76,-83,-99,-128,-67,-133,-117,-91,-83,-123,-114,-34,-144,3,-100,-88,-205,-101,-195,-115,-64,-110,-146,-109,-115,-116,-72,-160,-81,-65,-96,-69,-103,-74,-93,-46,-83,0,-66,-128,-114,-129,-138,-10,-114,-130,-121,-84,-104,-91,-68,-69,-210,-77,-84,-143,-97,-114,-109,-89,-67,-44,-49,-74,-97,-82,-119,-80,-78,-95,-69,-87,-69,-164,-80,-123,-72,-106,-82,-81,-53,-81,34,-81,-76,-166,-12,-74,-80,-92,-102,-56,-80,-98,-124,-96,-74,-137,-44,-95,-79,-112,-147,-4,-108,-110,-139,17,-63,-73,-167,-22,-87,-97,-70,-66,-134,-49,-70,-65,-79,-139,-183,-80,-97,-86,-125,-98,-66,-69,-126,-83,-114,-119,-64,-99,-144,-53,-75,-68,-66,-49,-79,-103,-78,-127,-104,-108,-110,-108,4,13,-40,-81,-98,-52,-79,-52,-133,-65,-121,-1,-61,-78,-127,-97,-18,-104,-61,-82,-75,-71,-61,-27,-121,-2,-76,-117,-138,-24,-75,-60,7,-91,-79,-19,-69,-68,11,-40,-54,-120,-104,-55,-73,-88,-31};
-
-alignas(32) int8_t outputWeights2[256] = {21,12,12,9,8,-9,9,13,9,-5,-9,10,-16,-5,-15,7,-18,11,11,-18,-17,-12,-12,10,-35,9,-11,-17,9,8,-13,-13,-17,-38,-16,11,-7,-15,16,-6,-13,9,9,-7,12,-6,-26,13,-11,6,-12,10,-9,10,12,-6,-17,8,-11,-17,-9,-11,11,-16,20,12,15,-14,-36,-28,-7,36,7,-14,-16,12,-19,-20,-17,9,14,9,8,-11,-13,10,10,-15,9,-28,-16,-10,9,12,12,20,6,-16,14,7,12,13,-4,-23,15,-14,-17,-15,13,9,11,14,7,-10,-36,14,-18,12,-12,10,7,8,-7,-18,-11,-7,8,-16,11,9,19,-12,10,11,-13,-12,-12,-15,-16,10,11,6,-10,-10,40,-10,11,-16,-29,13,11,9,-7,-12,-11,-16,8,-9,-7,-7,-18,14,-6,-8,9,14,5,8,7,-10,-5,8,-11,-14,-12,10,-9,11,10,-16,-12,-15,-11,-24,-15,-17,8,10,7,-11,-12,-11,-13,-7,-18,-9,6,-15,10,-12,-6,9,10,8,25,-20,11,-12,-16,5,-5,-33,14,-18,-16,-16,10,10,-5,14,-7,-11,15,10,14,-6,-15,-11,-13,11,-13,5,-7,11,-6,-12,-36,-34,9,12,-13,6,-7,-9,-6,9,-12,-6,6,9,9,10,10,12,11,-8};
-
-float outputBias2 = -0.0376901775598526f;
-// END PARAMETERS
-
-
-// START HEADERS
-typedef struct Square {
-    uint8_t board;
-    uint8_t position;
-} Square2;
-
-bool squaresAreEqual2(Square2 square1, Square2 square2);
-
-#define BIT_SET(a,b) ((a) |= (1ULL<<(b)))
-#define BIT_CHECK(a,b) ((a) & (1ULL<<(b)))
-
-Square2 toOurNotation2(Square2 rowAndColumn);
-
-Square2 toGameNotation2(Square2 square);
-
-#define Player bool
-#define PLAYER1 0
-#define PLAYER2 1
-#define OTHER_PLAYER(p) ((p)^1)
-
-#define Winner uint8_t
-#define NONE 0
-#define WIN_P1 1
-#define WIN_P2 2
-#define DRAW 3
-
-typedef struct PlayerBitBoard {
-    uint16_t smallBoards[9];
-    uint16_t bigBoard;
-} PlayerBitBoard2;
-
-void initializePlayerBitBoard2(PlayerBitBoard2* playerBitBoard);
-
-bool isWin2(uint16_t smallBoard);
-
-bool isDraw2(uint16_t smallBoard, uint16_t otherPlayerSmallBoard);
-
-bool setSquareOccupied2(PlayerBitBoard2* playerBitBoard, PlayerBitBoard2* otherPlayerBitBoard, Square2 square);
-
-#define TOTAL_SMALL_SQUARES 81
-#define ANY_BOARD 9
-
-typedef struct State {
-    PlayerBitBoard2 player1;
-    PlayerBitBoard2 player2;
-    Player currentPlayer;
-    uint8_t currentBoard;
-    Winner winner;
-    uint8_t ply;
-} State2;
-
-typedef struct MCTSNode2 MCTSNode2;
-
-typedef struct Board {
-    State2 state;
-    State2 stateCheckpoint;
-    MCTSNode2* nodes;
-    int currentNodeIndex;
-    Player me;
-} Board2;
-
-Board2* createBoard2();
-
-void freeBoard2(Board2* board);
-
-int allocateNodes2(Board2* board, uint8_t amount);
-
-Square2* generateMoves2(Board2* board, Square2 moves[TOTAL_SMALL_SQUARES], int8_t* amountOfMoves);
-
-uint8_t getNextBoard2(Board2* board, uint8_t previousPosition);
-
-bool nextBoardIsEmpty2(Board2* board);
-
-uint8_t getCurrentBoard2(Board2* board);
-
-Player getCurrentPlayer2(Board2* board);
-
-void revertToCheckpoint2(Board2* board);
-
-void updateCheckpoint2(Board2* board);
-
-void makeTemporaryMove2(Board2* board, Square2 square);
-
-void makePermanentMove2(Board2* board, Square2 square);
-
-Winner getWinnerAfterMove2(Board2* board, Square2 square);
-
-Winner getWinner2(Board2* board);
-
-void setMe2(Board2* board, Player player);
-
-bool currentPlayerIsMe2(Board2* board);
-
-uint8_t getPly2(Board2* board);
-
-typedef struct MCTSNode2 {
-    int parentIndex;
-    int childrenIndex;
-    float eval;
-    float sims;
-    Square2 square;
-    int8_t amountOfChildren;
-} MCTSNode2;
-
-int createMCTSRootNode2(Board2* board);
-
-void discoverChildNodes2(int nodeIndex, Board2* board);
-
-bool isLeafNode2(int nodeIndex, Board2* board);
-
-int selectNextChild2(Board2* board, int nodeIndex);
-
-MCTSNode2* expandLeaf2(int leafIndex, Board2* board);
-
-int updateRoot2(MCTSNode2* root, Board2* board, Square2 square);
-
-void backpropagate2(Board2* board, int nodeIndex, Winner winner, Player player);
-
-void backpropagateEval2(Board2* board, MCTSNode2* node);
-
-void visitNode2(int nodeIndex, Board2* board);
-
-Square2 getMostPromisingMove2(Board2* board, MCTSNode2* node);
-
-float getEval2(MCTSNode2* node);
-
-int findNextMove2(Board2* board, int rootIndex, double allocatedTime);
-
-typedef struct HandleTurnResult2 {
-    Square2 move;
-    int newRootIndex;
-    int amountOfSimulations;
-} HandleTurnResult2;
-
-HandleTurnResult2 handleTurn2(Board2* board, int rootIndex, double allocatedTime, Square2 enemyMove);
-
-inline __attribute__((always_inline)) void addFeature2(int feature, __m256i regs[16]) {
-    for (int i = 0; i < 16; i++) {
-        regs[i] = _mm256_add_epi16(regs[i], _mm256_load_si256((__m256i*) &hiddenWeights2[feature][i * 16]));
-    }
-}
-
-void setHidden2(Board2* board, int16_t* restrict input);
-
-float neuralNetworkEvalFromHidden2(int16_t* restrict input);
-
-float neuralNetworkEval2(Board2* board);
-// END HEADERS
-
-
-
-
-
-
-
-
-
-
-// START SQUARE
-bool squaresAreEqual2(Square2 square1, Square2 square2) {
-    return square1.board == square2.board && square1.position == square2.position;
-}
-// END SQUARE
-
-
-
-
-
-
-
-
-
-
-
-// START UTIL
-Square2 toOurNotation2(Square2 rowAndColumn) {
-    uint8_t row = rowAndColumn.board;
-    uint8_t column = rowAndColumn.position;
-    if (row == 255 && column == 255) {
-        Square2 result = {9, 9};
-        return result;
-    }
-    uint8_t board = 3 * (row / 3) + (column / 3);
-    uint8_t position = 3 * (row % 3) + (column % 3);
-    Square2 result = {board, position};
-    return result;
-}
-
-
-Square2 toGameNotation2(Square2 square) {
-    uint8_t row = (square.position / 3) + 3*(square.board / 3);
-    uint8_t col = (square.position % 3) + 3*(square.board % 3);
-    Square2 result = {row, col};
-    return result;
-}
-// END UTIL
-
-
-
-
-
-
-
-
-
-
-// START PLAYER_BITBOARD
-bool isWin2(uint16_t smallBoard) {
-    __m128i masks = _mm_setr_epi16(0x7, 0x38, 0x1c0, 0x49, 0x92, 0x124, 0x111, 0x54);
-    __m128i v1 = _mm_set1_epi16(1);
-    __m128i boards128 = _mm_set1_epi16((short) smallBoard);
-    __m128i andResult = _mm_and_si128(masks, boards128);
-    __m128i result = _mm_cmpeq_epi16(andResult, masks);
-    return !_mm_test_all_zeros(result, v1);
-}
-
-
-void initializePlayerBitBoard2(PlayerBitBoard2* playerBitBoard) {
-    memset(playerBitBoard, 0, sizeof(PlayerBitBoard2));
-}
-
-
-bool isDraw2(uint16_t smallBoard, uint16_t otherPlayerSmallBoard) {
-    return (smallBoard | otherPlayerSmallBoard) == 511;
-}
-
-
-bool setSquareOccupied2(PlayerBitBoard2* playerBitBoard, PlayerBitBoard2* otherPlayerBitBoard, Square2 square) {
-    BIT_SET(playerBitBoard->smallBoards[square.board], square.position);
-    uint16_t smallBoard = playerBitBoard->smallBoards[square.board];
-    uint16_t otherPlayerSmallBoard = otherPlayerBitBoard->smallBoards[square.board];
-    if (isWin2(smallBoard)) {
-        BIT_SET(playerBitBoard->bigBoard, square.board);
-        return true;
-    } if (isDraw2(smallBoard, otherPlayerSmallBoard)) {
-        BIT_SET(playerBitBoard->bigBoard, square.board);
-        BIT_SET(otherPlayerBitBoard->bigBoard, square.board);
-        return true;
-    }
-    return false;
-}
-// END PLAYER_BITBOARD
-
-
-
-
-
-
-
-
-
-
-
-// START BOARD
-Square2 openSquares2[512][9][9];
-int8_t amountOfOpenSquares2[512];
-Winner winnerByBigBoards2[512][512];
-
-
-int8_t setOpenSquares2(Square2 openSquares_[9], uint8_t boardIndex, uint16_t bitBoard) {
-    int8_t amountOfMoves = 0;
-    while (bitBoard) {
-        Square2 square = {boardIndex, __builtin_ffs(bitBoard) - 1};
-        openSquares_[amountOfMoves++] = square;
-        bitBoard &= bitBoard - 1;
-    }
-    return amountOfMoves;
-}
-
-
-Winner calculateWinner2(uint16_t player1BigBoard, uint16_t player2BigBoard) {
-    uint16_t decisiveBoards = player1BigBoard ^ player2BigBoard;
-    uint16_t boardsWonByPlayer1 = player1BigBoard & decisiveBoards;
-    if (isWin2(boardsWonByPlayer1)) {
-        return WIN_P1;
-    }
-    uint16_t boardsWonByPlayer2 = player2BigBoard & decisiveBoards;
-    if (isWin2(boardsWonByPlayer2)) {
-        return WIN_P2;
-    }
-    if ((player1BigBoard | player2BigBoard) == 511) {
-        int player1AmountBoardsWon = __builtin_popcount(player1BigBoard);
-        int player2AmountBoardsWon = __builtin_popcount(player2BigBoard);
-        return player1AmountBoardsWon > player2AmountBoardsWon
-               ? WIN_P1
-               : player1AmountBoardsWon < player2AmountBoardsWon
-                 ? WIN_P2
-                 : DRAW;
-    }
-    return NONE;
-}
-
-
-#define MEGABYTE (1024*1024ULL)
-#define NODES_SIZE (512*MEGABYTE)
-#define NUM_NODES (NODES_SIZE / sizeof(MCTSNode2))
-Board2* createBoard2() {
-    Board2* board = malloc(sizeof(Board2));
-    initializePlayerBitBoard2(&board->state.player1);
-    initializePlayerBitBoard2(&board->state.player2);
-    board->state.currentPlayer = PLAYER1;
-    board->state.currentBoard = ANY_BOARD;
-    board->state.winner = NONE;
-    board->state.ply = 0;
-    board->stateCheckpoint = board->state;
-    board->nodes = malloc(NUM_NODES * sizeof(MCTSNode2));
-    board->currentNodeIndex = 0;
-    board->me = PLAYER2;
-    for (int boardIndex = 0; boardIndex < 9; boardIndex++) {
-        for (int bitBoard = 0; bitBoard < 512; bitBoard++) {
-            amountOfOpenSquares2[bitBoard] =
-                    setOpenSquares2(openSquares2[bitBoard][boardIndex], boardIndex, bitBoard);
-        }
-    }
-    for (uint16_t player1BigBoard = 0; player1BigBoard < 512; player1BigBoard++) {
-        for (uint16_t player2BigBoard = 0; player2BigBoard < 512; player2BigBoard++) {
-            Winner winner = calculateWinner2(player1BigBoard, player2BigBoard);
-            winnerByBigBoards2[player1BigBoard][player2BigBoard] = winner;
-        }
-    }
-    return board;
-}
-
-
-void freeBoard2(Board2* board) {
-    free(board->nodes);
-    free(board);
-}
-
-
-int allocateNodes2(Board2* board, uint8_t amount) {
-    int result = (amount > NUM_NODES - board->currentNodeIndex)? 0 : board->currentNodeIndex;
-    board->currentNodeIndex = result + amount;
-    return result;
-}
-
-
-Square2* getMovesSingleBoard2(Board2* board, uint8_t boardIndex, int8_t* amountOfMoves) {
-    uint16_t bitBoard = ~(board->state.player1.smallBoards[boardIndex] | board->state.player2.smallBoards[boardIndex]) & 511;
-    *amountOfMoves = amountOfOpenSquares2[bitBoard];
-    return openSquares2[bitBoard][boardIndex];
-}
-
-
-int8_t copyMovesSingleBoard2(Board2* board, uint8_t boardIndex, Square2 moves[TOTAL_SMALL_SQUARES], int8_t amountOfMoves) {
-    uint16_t bitBoard = ~(board->state.player1.smallBoards[boardIndex] | board->state.player2.smallBoards[boardIndex]) & 511;
-    memcpy(&moves[amountOfMoves], openSquares2[bitBoard][boardIndex],
-           amountOfOpenSquares2[bitBoard] * sizeof(Square2));
-    return (int8_t)(amountOfMoves + amountOfOpenSquares2[bitBoard]);
-}
-
-
-int8_t generateMovesAnyBoard2(Board2* board, Square2 moves[TOTAL_SMALL_SQUARES]) {
-    int8_t amountOfMoves = 0;
-    uint16_t undecidedSmallBoards = ~(board->state.player1.bigBoard | board->state.player2.bigBoard) & 511;
-    while (undecidedSmallBoards) {
-        uint8_t boardIndex = __builtin_ffs(undecidedSmallBoards) - 1;
-        amountOfMoves = copyMovesSingleBoard2(board, boardIndex, moves, amountOfMoves);
-        undecidedSmallBoards &= undecidedSmallBoards - 1;
-    }
-    return amountOfMoves;
-}
-
-
-Square2* generateMoves2(Board2* board, Square2 moves[TOTAL_SMALL_SQUARES], int8_t* amountOfMoves) {
-    if (board->state.winner != NONE) {
-        *amountOfMoves = 0;
-        return moves;
-    }
-    uint8_t currentBoard = board->state.currentBoard;
-    if (currentBoard == ANY_BOARD) {
-        *amountOfMoves = generateMovesAnyBoard2(board, moves);
-        return moves;
-    }
-    return getMovesSingleBoard2(board, currentBoard, amountOfMoves);
-}
-
-
-uint8_t getNextBoard2(Board2* board, uint8_t previousPosition) {
-    bool smallBoardIsDecided = BIT_CHECK(board->state.player1.bigBoard | board->state.player2.bigBoard, previousPosition);
-    return smallBoardIsDecided ? ANY_BOARD : previousPosition;
-}
-
-
-bool nextBoardIsEmpty2(Board2* board) {
-    uint8_t currentBoard = board->state.currentBoard;
-    return currentBoard != ANY_BOARD
-           && (board->state.player1.smallBoards[currentBoard] | board->state.player2.smallBoards[currentBoard]) == 0;
-}
-
-
-uint8_t getCurrentBoard2(Board2* board) {
-    return board->state.currentBoard;
-}
-
-
-Player getCurrentPlayer2(Board2* board) {
-    return board->state.currentPlayer;
-}
-
-
-void revertToCheckpoint2(Board2* board) {
-    board->state = board->stateCheckpoint;
-}
-
-
-void updateCheckpoint2(Board2* board) {
-    board->stateCheckpoint = board->state;
-}
-
-
-void makeTemporaryMove2(Board2* board, Square2 square) {
-    PlayerBitBoard2* p1 = &board->state.player1;
-    if (setSquareOccupied2(p1 + board->state.currentPlayer, p1 + !board->state.currentPlayer, square)) {
-        board->state.winner = winnerByBigBoards2[board->state.player1.bigBoard][board->state.player2.bigBoard];
-    }
-    board->state.currentPlayer ^= 1;
-    board->state.currentBoard = getNextBoard2(board, square.position);
-    board->state.ply++;
-}
-
-
-void makePermanentMove2(Board2* board, Square2 square) {
-    makeTemporaryMove2(board, square);
-    updateCheckpoint2(board);
-}
-
-
-Winner getWinnerAfterMove2(Board2* board, Square2 square) {
-    State2 tempCheckpoint = board->state;
-    makeTemporaryMove2(board, square);
-    Winner winner = getWinner2(board);
-    board->state = tempCheckpoint;
-    return winner;
-}
-
-
-Winner getWinner2(Board2* board) {
-    return board->state.winner;
-}
-
-
-void setMe2(Board2* board, Player player) {
-    board->me = player;
-}
-
-
-bool currentPlayerIsMe2(Board2* board) {
-    return board->state.currentPlayer == board->me;
-}
-
-
-uint8_t getPly2(Board2* board) {
-    return board->state.ply;
-}
-// END BOARD
-
-
-
-
-
-
-
-
-
-
-
-
-
-// START FORWARD
-#define HIDDEN_NEURONS 256
-
-
-void addHiddenWeights2(int i, int16_t* restrict output) {
-    for (int j = 0; j < HIDDEN_NEURONS; j++) {
-        output[j] = (int16_t) (output[j] + hiddenWeights2[i][j]);
-    }
-}
-
-
-void boardToInput2(Board2* board, int16_t* restrict output) {
-    __m256i regs[16];
-    for (int i = 0; i < 16; i++) {
-        regs[i] = _mm256_load_si256((__m256i*) &hiddenBiases2[i * 16]);
-    }
-
-    PlayerBitBoard2* p1 = &board->state.player1;
-    PlayerBitBoard2* currentPlayer = p1 + board->state.currentPlayer;
-    PlayerBitBoard2* otherPlayer = p1 + !board->state.currentPlayer;
-    uint16_t bigBoard = currentPlayer->bigBoard;
-    while (bigBoard) {
-        addFeature2(__builtin_ffs(bigBoard) - 1, regs);
-        bigBoard &= bigBoard - 1;
-    }
-    for (int i = 0; i < 9; i++) {
-        uint16_t smallBoard = currentPlayer->smallBoards[i];
-        while (smallBoard) {
-            addFeature2(__builtin_ffs(smallBoard) + 8 + 9 * i, regs);
-            smallBoard &= smallBoard - 1;
-        }
-    }
-
-    bigBoard = otherPlayer->bigBoard;
-    while (bigBoard) {
-        addFeature2(__builtin_ffs(bigBoard) + 89, regs);
-        bigBoard &= bigBoard - 1;
-    }
-    for (int i = 0; i < 9; i++) {
-        uint16_t smallBoard = otherPlayer->smallBoards[i];
-        while (smallBoard) {
-            addFeature2(__builtin_ffs(smallBoard) + 98 + 9 * i, regs);
-            smallBoard &= smallBoard - 1;
-        }
-    }
-
-    for (int i = 0; i < 16; i++) {
-        _mm256_store_si256((__m256i*) &output[i * 16], regs[i]);
-    }
-}
-
-
-void applyClippedReLU2(const int16_t* restrict input, int8_t* restrict output) {
-    for (int i = 0; i < HIDDEN_NEURONS; i++) {
-        output[i] = (int8_t)(input[i] <= 0? 0 : input[i] >= 127? 127 : input[i]);
-    }
-}
-
-
-float multiplyOutputWeights2(const int8_t* restrict input) {
-    int32_t result = 0;
-    for (int i = 0; i < HIDDEN_NEURONS; i++) {
-        result += input[i] * outputWeights2[i];
-    }
-    return (float)result / (127*64);
-}
-
-
-void setHidden2(Board2* board, int16_t* restrict input) {
-    boardToInput2(board, input);
-}
-
-
-float neuralNetworkEvalFromHidden2(int16_t* restrict input) {
-    int8_t output[HIDDEN_NEURONS];
-    applyClippedReLU2(input, output);
-    float x = multiplyOutputWeights2(output) + outputBias2 + 0.5f;
-    return x < 0? 0 : x > 1? 1 : x;
-}
-
-
-float neuralNetworkEval2(Board2* board) {
-    alignas(32) int16_t input[HIDDEN_NEURONS];
-    boardToInput2(board, input);
-    addHiddenWeights2(board->state.currentBoard + 180, input);
-    return neuralNetworkEvalFromHidden2(input);
-}
-// END FORWARD
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-// START MCTS_NODE
-int createMCTSRootNode2(Board2* board) {
-    int rootIndex = allocateNodes2(board, 1);
-    MCTSNode2* root = &board->nodes[rootIndex];
-    root->parentIndex = -1;
-    root->childrenIndex = -1;
-    root->eval = 0.0f;
-    root->sims = 0.0f;
-    root->square.board = 9;
-    root->square.position = 9;
-    root->amountOfChildren = -1;
-    return rootIndex;
-}
-
-
-void initializeMCTSNode2(int parentIndex, Square2 square, float eval, MCTSNode2* node) {
-    node->parentIndex = parentIndex;
-    node->childrenIndex = -1;
-    node->eval = eval;
-    node->sims = 0.0f;
-    node->square = square;
-    node->amountOfChildren = -1;
-}
-
-
-float getEvalOfMove2(Board2* board, Square2 square) {
-    State2 temp = board->stateCheckpoint;
-    updateCheckpoint2(board);
-    makeTemporaryMove2(board, square);
-    float eval;
-    Player player = OTHER_PLAYER(board->state.currentPlayer);
-    Winner winner = board->state.winner;
-    if (winner != NONE) {
-        eval = winner == DRAW? 0.5f : player + 1 == winner? 1.0f : 0.0f;
-    } else {
-        eval = neuralNetworkEval2(board);
-    }
-    revertToCheckpoint2(board);
-    board->stateCheckpoint = temp;
-    return eval;
-}
-
-
-void singleChild2(int nodeIndex, Board2* board, Square2 square) {
-    MCTSNode2* node = &board->nodes[nodeIndex];
-    node->amountOfChildren = 1;
-    node->childrenIndex = allocateNodes2(board, 1);
-    float eval = getEvalOfMove2(board, square);
-    initializeMCTSNode2(nodeIndex, square, eval, &board->nodes[node->childrenIndex + 0]);
-}
-
-
-bool handleSpecialCases2(int nodeIndex, Board2* board) {
-    if (nextBoardIsEmpty2(board) && getPly2(board) <= 20) {
-        uint8_t currentBoard = getCurrentBoard2(board);
-        Square2 sameBoard = {currentBoard, currentBoard};
-        singleChild2(nodeIndex, board, sameBoard);
-        return true;
-    }
-    if (currentPlayerIsMe2(board) && getPly2(board) == 0) {
-        Square2 bestFirstMove = {4, 4};
-        singleChild2(nodeIndex, board, bestFirstMove);
-        return true;
-    }
-    return false;
-}
-
-
-bool isBadMove2(Board2* board, Square2 square, Winner winner, Player player) {
-    bool isProvenLoss = (winner == WIN_P1 && player == PLAYER2) || (winner == WIN_P2 && player == PLAYER1);
-    bool sendsToDecidedBoard = (board->state.player1.bigBoard | board->state.player2.bigBoard) & (1 << square.position);
-    return isProvenLoss || (sendsToDecidedBoard && getPly2(board) <= 30);
-}
-
-
-void initializeChildNodes2(int parentIndex, Board2* board, Square2* moves, Winner* winners) {
-    MCTSNode2* parent = &board->nodes[parentIndex];
-    alignas(32) int16_t NNInputs[256];
-    board->state.currentPlayer ^= 1;
-    setHidden2(board, NNInputs);
-    board->state.currentPlayer ^= 1;
-    int8_t amountOfMoves = parent->amountOfChildren;
-    PlayerBitBoard2* p1 = &board->state.player1;
-    PlayerBitBoard2* currentPlayerBitBoard = p1 + board->state.currentPlayer;
-    PlayerBitBoard2* otherPlayerBitBoard = p1 + !board->state.currentPlayer;
-    int childIndex = 0;
-    for (int i = 0; i < amountOfMoves; i++) {
-        Square2 move = moves[i];
-        if (isBadMove2(board, move, winners[i], board->state.currentPlayer) && parent->amountOfChildren > 1) {
-            parent->amountOfChildren--;
-            continue;
-        } else if (winners[i] == DRAW) {
-            MCTSNode2* child = &board->nodes[parent->childrenIndex + childIndex++];
-            initializeMCTSNode2(parentIndex, move, 0.5f, child);
-            continue;
-        }
-        MCTSNode2* child = &board->nodes[parent->childrenIndex + childIndex++];
-        uint16_t smallBoard = currentPlayerBitBoard->smallBoards[move.board];
-        BIT_SET(smallBoard, move.position);
-        bool smallBoardIsDecided;
-        __m256i regs[16];
-        for (int j = 0; j < 16; j++) {
-            regs[j] = _mm256_load_si256((__m256i*) &NNInputs[j * 16]);
-        }
-        if (isWin2(smallBoard)) {
-            smallBoardIsDecided = BIT_CHECK(board->state.player1.bigBoard | board->state.player2.bigBoard
-                                            | (1 << move.board), move.position);
-            addFeature2(move.board + 90, regs);
-        } else if (isDraw2(smallBoard, otherPlayerBitBoard->smallBoards[move.board])) {
-            smallBoardIsDecided = BIT_CHECK(board->state.player1.bigBoard | board->state.player2.bigBoard
-                                            | (1 << move.board), move.position);
-            addFeature2(move.board, regs);
-            addFeature2(move.board + 90, regs);
-        } else {
-            smallBoardIsDecided = BIT_CHECK(board->state.player1.bigBoard | board->state.player2.bigBoard, move.position);
-        }
-        addFeature2(move.position + 99 + 9 * move.board, regs);
-        addFeature2((smallBoardIsDecided ? ANY_BOARD : move.position) + 180, regs);
-        alignas(32) int16_t result[256];
-        for (int j = 0; j < 16; j++) {
-            _mm256_store_si256((__m256i*) &result[j * 16], regs[j]);
-        }
-        float eval = neuralNetworkEvalFromHidden2(result);
-        initializeMCTSNode2(parentIndex, move, eval, child);
-    }
-}
-
-
-void discoverChildNodes2(int nodeIndex, Board2* board) {
-    MCTSNode2* node = &board->nodes[nodeIndex];
-    if (node->amountOfChildren == -1 && !handleSpecialCases2(nodeIndex, board)) {
-        Square2 movesArray[TOTAL_SMALL_SQUARES];
-        int8_t amountOfMoves;
-        Square2* moves = generateMoves2(board, movesArray, &amountOfMoves);
-        Player player = getCurrentPlayer2(board);
-        Winner winners[amountOfMoves];
-        memset(winners, NONE, amountOfMoves * sizeof(Winner));
-        if (getPly2(board) > 30) {
-            for (int i = 0; i < amountOfMoves; i++) {
-                Winner winner = getWinnerAfterMove2(board, moves[i]);
-                if (winner == player + 1) {
-                    singleChild2(nodeIndex, board, moves[i]);
-                    return;
-                } else {
-                    winners[i] = winner;
-                }
-            }
-        }
-        node->amountOfChildren = amountOfMoves;
-        node->childrenIndex = allocateNodes2(board, amountOfMoves);
-        initializeChildNodes2(nodeIndex, board, moves, winners);
-    }
-}
-
-
-bool isLeafNode2(int nodeIndex, Board2* board) {
-    return (&board->nodes[nodeIndex])->sims == 0;
-}
-
-
-float fastSquareRoot2(float x) {
-    __m128 in = _mm_set_ss(x);
-    return _mm_cvtss_f32(_mm_mul_ss(in, _mm_rsqrt_ss(in)));
-}
-
-
-#define EXPLORATION_PARAMETER 0.41f
-#define FIRST_PLAY_URGENCY 0.40f
-float getUCTValue2(MCTSNode2* node, float parentLogSims) {
-    float exploitation = node->eval;
-    float exploration = node->sims == 0? FIRST_PLAY_URGENCY : fastSquareRoot2(parentLogSims / node->sims);
-    return exploitation + exploration;
-}
-
-
-// From: https://github.com/etheory/fastapprox/blob/master/fastapprox/src/fastlog.h
-float fastLog22(float x) {
-    union { float f; uint32_t i; } vx = { x };
-    float y = (float)vx.i;
-    y *= 1.1920928955078125e-7f;
-    return y - 126.94269504f;
-}
-
-
-int selectNextChild2(Board2* board, int nodeIndex) {
-    MCTSNode2* node = &board->nodes[nodeIndex];
-    float logSims = EXPLORATION_PARAMETER * EXPLORATION_PARAMETER * fastLog22(node->sims);
-    int highestUCTChildIndex = -1;
-    float highestUCT = -1.0f;
-    for (int i = 0; i < node->amountOfChildren; i++) {
-        int childIndex = node->childrenIndex + i;
-        float UCT = getUCTValue2(&board->nodes[childIndex], logSims);
-        if (UCT > highestUCT) {
-            highestUCTChildIndex = childIndex;
-            highestUCT = UCT;
-        }
-    }
-    return highestUCTChildIndex;
-}
-
-
-MCTSNode2* expandLeaf2(int leafIndex, Board2* board) {
-    discoverChildNodes2(leafIndex, board);
-    return &board->nodes[selectNextChild2(board, leafIndex)];
-}
-
-
-int updateRoot2(MCTSNode2* root, Board2* board, Square2 square) {
-    MCTSNode2* newRoot = NULL;
-    for (int i = 0; i < root->amountOfChildren; i++) {
-        MCTSNode2* child = &board->nodes[root->childrenIndex + i];
-        if (squaresAreEqual2(square, child->square)) {
-            newRoot = child;
-            int newRootIndex = root->childrenIndex + i;
-            newRoot->parentIndex = -1;
-            return newRootIndex;
-        }
-    }
-
-    Square2 movesArray[TOTAL_SMALL_SQUARES];
-    int8_t amountOfMoves;
-    Square2* moves = generateMoves2(board, movesArray, &amountOfMoves);
-    for (int i = 0; i < amountOfMoves; i++) {
-        if (squaresAreEqual2(moves[i], square)) {
-            int newRootIndex = allocateNodes2(board, 1);
-            newRoot = &board->nodes[newRootIndex];
-            initializeMCTSNode2(-1, square, 0.0f, newRoot);
-            return newRootIndex;
-        }
-    }
-    exit(123);
-}
-
-
-void backpropagate2(Board2* board, int nodeIndex, Winner winner, Player player) {
-    MCTSNode2* node = &board->nodes[nodeIndex];
-    node->eval = winner == DRAW ? 0.5f : player + 1 == winner ? 1.0f : 0.0f;
-    backpropagateEval2(board, node);
-}
-
-
-void backpropagateEval2(Board2* board, MCTSNode2* node) {
-    MCTSNode2* currentNode = node;
-    if (currentNode->amountOfChildren <= 0) {
-        currentNode = &board->nodes[currentNode->parentIndex];
-    }
-    while (currentNode != NULL) {
-        float maxChildEval = 0.0f;
-        for (int i = 0; i < currentNode->amountOfChildren; i++) {
-            float eval = (&board->nodes[currentNode->childrenIndex + i])->eval;
-            maxChildEval = maxChildEval >= eval? maxChildEval : eval;
-        }
-        currentNode->eval = 1 - maxChildEval;
-        currentNode->sims++;
-        currentNode = currentNode->parentIndex == -1? NULL : &board->nodes[currentNode->parentIndex];
-    }
-}
-
-
-void visitNode2(int nodeIndex, Board2* board) {
-    makeTemporaryMove2(board, (&board->nodes[nodeIndex])->square);
-}
-
-
-Square2 getMostPromisingMove2(Board2* board, MCTSNode2* node) {
-    MCTSNode2* highestScoreChild = &board->nodes[node->childrenIndex + 0];
-    float highestScore = getEval2(highestScoreChild) + fastLog22(highestScoreChild->sims);
-    for (int i = 1; i < node->amountOfChildren; i++) {
-        MCTSNode2* child = &board->nodes[node->childrenIndex + i];
-        float score = getEval2(child) + fastLog22(child->sims);
-        if (score > highestScore) {
-            highestScoreChild = child;
-            highestScore = score;
-        }
-    }
-    return highestScoreChild->square;
-}
-
-
-float getEval2(MCTSNode2* node) {
-    return node->eval;
-}
-// END MCTS_NODE
-
-
-
-
-
-
-
-
-
-
-
-// START FIND_NEXT_MOVE
-int selectLeaf2(Board2* board, int rootIndex) {
-    int currentNodeIndex = rootIndex;
-    while (!isLeafNode2(currentNodeIndex, board) && getWinner2(board) == NONE) {
-        currentNodeIndex = selectNextChild2(board, currentNodeIndex);
-        visitNode2(currentNodeIndex, board);
-    }
-    return currentNodeIndex;
-}
-
-
-bool hasTimeRemaining2(struct timeval start, double allocatedTime) {
-    struct timeval end;
-    gettimeofday(&end, NULL);
-    double timePassed = (double) (end.tv_usec - start.tv_usec) / 1000000 + (double) (end.tv_sec - start.tv_sec);
-    return timePassed < allocatedTime;
-}
-
-
-int findNextMove2(Board2* board, int rootIndex, double allocatedTime) {
-    int amountOfSimulations = 0;
-    struct timeval start;
-    gettimeofday(&start, NULL);
-    while (++amountOfSimulations % 128 != 0 || hasTimeRemaining2(start, allocatedTime)) {
-        int leafIndex = selectLeaf2(board, rootIndex);
-        Winner winner = getWinner2(board);
-        Player player = OTHER_PLAYER(getCurrentPlayer2(board));
-        if (winner == NONE) {
-            backpropagateEval2(board, expandLeaf2(leafIndex, board));
-        } else {
-            backpropagate2(board, leafIndex, winner, player);
-        }
-        revertToCheckpoint2(board);
-    }
-    return amountOfSimulations;
-}
-// END FIND_NEXT_MOVE
-
-
-
-
-
-
-
-
-
-
-
-
-
-// START HANDLE_TURN
-Square2 handleOpening2(Board2* board) {
-    uint8_t ply = getPly2(board);
-    Square2 invalid = {9, 9};
-    if (board->me != PLAYER2 || ply > 10) {
-        return invalid;
-    }
-    bool firstMove = BIT_CHECK(board->state.player1.smallBoards[4], 4);
-    bool secondMove = BIT_CHECK(board->state.player1.smallBoards[8], 8);
-    bool thirdMove = BIT_CHECK(board->state.player1.smallBoards[0], 0);
-    bool fourthMove = BIT_CHECK(board->state.player1.smallBoards[5], 5);
-    bool fifthMove = BIT_CHECK(board->state.player1.smallBoards[7], 7);
-    uint8_t currentBoard = getCurrentBoard2(board);
-    if (ply == 1 && firstMove) {
-        Square2 move = {4, 8};
-        return move;
-    } else if (ply == 3 && firstMove && secondMove && currentBoard == 8) {
-        Square2 move = {8, 0};
-        return move;
-    } else if (ply == 5 && firstMove && secondMove && thirdMove && currentBoard == 0) {
-        Square2 move = {0, 5};
-        return move;
-    } else if (ply == 7 && firstMove && secondMove && thirdMove && fourthMove && currentBoard == 5) {
-        Square2 move = {5, 7};
-        return move;
-    } else if (ply == 9 && firstMove && secondMove && thirdMove && fourthMove && fifthMove && currentBoard == 7) {
-        Square2 move = {7, 5};
-        return move;
-    }
-    return invalid;
-}
-
-
-int handleEnemyTurn2(Board2* board, int rootIndex, Square2 enemyMove) {
-    if (enemyMove.board == 9 && enemyMove.position == 9) {
-        setMe2(board, PLAYER1);
-        return rootIndex;
-    }
-    discoverChildNodes2(rootIndex, board);
-    int newRootIndex = updateRoot2(&board->nodes[rootIndex], board, enemyMove);
-    makePermanentMove2(board, enemyMove);
-    return newRootIndex;
-}
-
-
-HandleTurnResult2 handleTurn2(Board2* board, int rootIndex, double allocatedTime, Square2 enemyMove) {
-    rootIndex = handleEnemyTurn2(board, rootIndex, enemyMove);
-    MCTSNode2* root = &board->nodes[rootIndex];
-    Square2 openingMove = handleOpening2(board);
-    if (openingMove.board != 9) {
-        int newRootIndex = updateRoot2(root, board, openingMove);
-        makePermanentMove2(board, openingMove);
-        HandleTurnResult2 result = {openingMove, newRootIndex, 0};
-        return result;
-    }
-    int amountOfSimulations = findNextMove2(board, rootIndex, allocatedTime);
-    Square2 move = getMostPromisingMove2(board, root);
-    int newRootIndex = updateRoot2(root, board, move);
-    makePermanentMove2(board, move);
-    HandleTurnResult2 result = {move, newRootIndex, amountOfSimulations};
-    return result;
-}
-// END HANDLE_TURN
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-// START MAIN
-typedef struct StateOpponent {
-    Board2* board;
-    int rootIndex;
-} StateOpponent;
-
-
-StateOpponent* initializeStateOpponent() {
-    StateOpponent* state = malloc(sizeof(StateOpponent));
-    state->board = createBoard2();
-    state->rootIndex = createMCTSRootNode2(state->board);
-    return state;
-}
-
-
-void freeStateOpponent(StateOpponent* stateOpponent) {
-    if (stateOpponent == NULL) {
-        return;
-    }
-    freeBoard2(stateOpponent->board);
-    free(stateOpponent);
-}
-
-
-Square2 playTurnOpponent(StateOpponent** state, double allocatedTime, Square2 enemyMove) {
-    HandleTurnResult2 result = handleTurn2((*state)->board, (*state)->rootIndex, allocatedTime, enemyMove);
-    (*state)->rootIndex = result.newRootIndex;
-    if (getWinner2((*state)->board) != NONE) {
-        freeStateOpponent(*state);
-        *state = NULL;
-    }
-    return result.move;
-}
-// END MAIN
\ No newline at end of file
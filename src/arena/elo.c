@@ -0,0 +1,68 @@
+#include <math.h>
+#include "elo.h"
+
+
+int getAmountOfGames(const GameResults* results) {
+    return results->wins + results->draws + results->losses;
+}
+
+
+double getScore(const GameResults* results) {
+    int games = getAmountOfGames(results);
+    return games == 0? 0.5 : (results->wins + 0.5 * results->draws) / games;
+}
+
+
+double scoreToElo(double score) {
+    return -400 * log10(1 / score - 1);
+}
+
+
+double eloToScore(double elo) {
+    return 1 / (1 + pow(10, -elo / 400));
+}
+
+
+// Variance of the points of a single game
+double getScoreVariance(const GameResults* results) {
+    int games = getAmountOfGames(results);
+    double score = getScore(results);
+    return (results->wins * (1 - score) * (1 - score) + results->draws * (0.5 - score) * (0.5 - score)
+            + results->losses * score * score) / games;
+}
+
+
+EloEstimate estimateElo(const GameResults* results) {
+    int games = getAmountOfGames(results);
+    double score = getScore(results);
+    double margin = games == 0? 0.5 : 1.959964 * sqrt(getScoreVariance(results) / games);
+    EloEstimate estimate = {scoreToElo(score), scoreToElo(fmax(score - margin, 0)), scoreToElo(fmin(score + margin, 1))};
+    return estimate;
+}
+
+
+void initializeSPRT(SPRT* sprt, double elo0, double elo1, double alpha, double beta) {
+    sprt->elo0 = elo0;
+    sprt->elo1 = elo1;
+    sprt->lowerBound = log(beta / (1 - alpha));
+    sprt->upperBound = log((1 - beta) / alpha);
+}
+
+
+double getLogLikelihoodRatio(const SPRT* sprt, const GameResults* results) {
+    if (results->wins == 0 || results->draws == 0 || results->losses == 0) {
+        return 0;
+    }
+    double score0 = eloToScore(sprt->elo0);
+    double score1 = eloToScore(sprt->elo1);
+    return getAmountOfGames(results) * (score1 - score0) * (2 * getScore(results) - score0 - score1)
+           / (2 * getScoreVariance(results));
+}
+
+
+SPRTResult testSPRT(const SPRT* sprt, const GameResults* results) {
+    double logLikelihoodRatio = getLogLikelihoodRatio(sprt, results);
+    return logLikelihoodRatio >= sprt->upperBound? SPRT_ACCEPT_H1
+           : logLikelihoodRatio <= sprt->lowerBound? SPRT_ACCEPT_H0
+           : SPRT_CONTINUE;
+}
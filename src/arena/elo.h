@@ -0,0 +1,52 @@
+#ifndef UTTT2_ELO_H
+#define UTTT2_ELO_H
+
+#include <stdbool.h>
+
+typedef struct GameResults {
+    int wins;
+    int draws;
+    int losses;
+} GameResults;
+
+int getAmountOfGames(const GameResults* results);
+
+// Points per game, a draw is half a point
+double getScore(const GameResults* results);
+
+double scoreToElo(double score);
+
+double eloToScore(double elo);
+
+// Elo difference with a 95% confidence interval, from the normal approximation of the score
+typedef struct EloEstimate {
+    double elo;
+    double lower;
+    double upper;
+} EloEstimate;
+
+EloEstimate estimateElo(const GameResults* results);
+
+typedef enum SPRTResult {
+    SPRT_CONTINUE,
+    SPRT_ACCEPT_H0,  // The Elo difference is at most elo0
+    SPRT_ACCEPT_H1  // The Elo difference is at least elo1
+} SPRTResult;
+
+// Sequential probability ratio test of elo0 against elo1, with false positive rate alpha and false negative rate beta
+typedef struct SPRT {
+    double elo0;
+    double elo1;
+    double lowerBound;
+    double upperBound;
+} SPRT;
+
+void initializeSPRT(SPRT* sprt, double elo0, double elo1, double alpha, double beta);
+
+// Generalized SPRT log likelihood ratio, as fishtest and cutechess use it
+double getLogLikelihoodRatio(const SPRT* sprt, const GameResults* results);
+
+// Holds off until there was at least one win, draw and loss: before that the variance of the score says nothing
+SPRTResult testSPRT(const SPRT* sprt, const GameResults* results);
+
+#endif //UTTT2_ELO_H
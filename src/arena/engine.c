@@ -0,0 +1,72 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "engine.h"
+#include "../nn/network.h"
+
+
+const Network* loadEngineNetwork(const EngineConfig* config, const char* filename) {
+    Network* network = loadNetwork(filename);
+    if (network == NULL) {
+        fprintf(stderr, "Couldn't load the network of engine %s\n", config->name);
+        exit(1);
+    }
+    return network;
+}
+
+
+void loadEngineConfig(EngineConfig* config) {
+    config->network = config->networkFilename == NULL? &defaultNetwork
+                      : loadEngineNetwork(config, config->networkFilename);
+    config->fastNetwork = config->fastNetworkFilename == NULL? NULL
+                          : loadEngineNetwork(config, config->fastNetworkFilename);
+    if (config->usePUCT && config->network->policyWeights == NULL) {
+        fprintf(stderr, "The network of engine %s has no policy head, playing without PUCT\n", config->name);
+        config->usePUCT = false;
+    }
+}
+
+
+void unloadEngineConfig(EngineConfig* config) {
+    if (config->networkFilename != NULL) {
+        freeNetwork((Network*) config->network);
+    }
+    if (config->fastNetwork != NULL) {
+        freeNetwork((Network*) config->fastNetwork);
+    }
+    config->network = NULL;
+    config->fastNetwork = NULL;
+}
+
+
+bool engineUsesExtraThread(const EngineConfig* config) {
+    return config->ponder;
+}
+
+
+Engine* createEngine(const EngineConfig* config) {
+    Engine* engine = config->interface->create(config);
+    engine->config = config;
+    EngineStatistics statistics = {0, 0, 0, 0, 0, 0, 0};
+    engine->statistics = statistics;
+    return engine;
+}
+
+
+void resetEngine(Engine* engine) {
+    engine->config->interface->reset(engine);
+}
+
+
+Square playEngineTurn(Engine* engine, SearchLimits limits, Square enemyMove) {
+    return engine->config->interface->playTurn(engine, limits, enemyMove);
+}
+
+
+void freeEngine(Engine* engine) {
+    engine->config->interface->free(engine);
+}
+
+
+const char* getEngineName(const Engine* engine) {
+    return engine->config->name;
+}
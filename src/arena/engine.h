@@ -0,0 +1,81 @@
+#ifndef UTTT2_ENGINE_H
+#define UTTT2_ENGINE_H
+
+#include <stdbool.h>
+#include "../board/square.h"
+#include "../mcts/find_next_move.h"
+
+// An arena player. Every kind of engine implements EngineInterface, so the arena can play any two configs against
+// each other without knowing what's behind them. One engine plays one game at a time and keeps its memory between
+// games, which is why every worker of the arena makes its own.
+
+typedef struct Engine Engine;
+
+typedef struct EngineConfig EngineConfig;
+
+typedef struct EngineInterface {
+    Engine* (*create)(const EngineConfig* config);
+    // Starts a new game. Also called once a game is over, to stop everything the engine still runs for it.
+    void (*reset)(Engine* engine);
+    // The enemy move is {9, 9} when the engine moves first. limits.time is the budget of a normal move, a positive
+    // amount of simulations replaces it. Never called again once the game is over, an illegal move ends the game.
+    Square (*playTurn)(Engine* engine, SearchLimits limits, Square enemyMove);
+    void (*free)(Engine* engine);
+} EngineInterface;
+
+struct EngineConfig {
+    const char* name;
+    const EngineInterface* interface;
+
+    // Options of mctsEngine, see mcts_engine.h
+    const char* networkFilename;  // NULL for the built-in weights
+    bool usePUCT;  // Select children by policy priors, needs a network with a policy head
+    const char* fastNetworkFilename;  // Scores new children until they are first visited, NULL to not use one
+    int evalCacheLog2Entries;  // 0 for no eval cache
+    bool adaptiveTime;  // Lets the time manager stop early or take longer per move, see time_manager.h
+    double timeBank;  // Seconds for a whole game instead of the budget per move, 0 for no time bank
+    bool ponder;  // Keep searching on another thread during the enemy's turn
+
+    // Options of processEngine, see process_engine.h
+    const char* command;  // Run by /bin/sh for every game
+    double moveTimeout;  // Seconds until a move that didn't arrive loses the game
+
+    // Filled by loadEngineConfig, shared read-only by every engine made from this config
+    const Network* network;
+    const Network* fastNetwork;
+};
+
+typedef struct EngineStatistics {
+    int moves;
+    long simulations;
+    double time;  // Spent searching, on the clock the limits asked for
+    double slowestMove;
+    int earlyStops;
+    int extensions;
+    int forfeits;  // Games lost by an illegal move or none at all, counted by the arena
+} EngineStatistics;
+
+struct Engine {
+    const EngineConfig* config;
+    EngineStatistics statistics;  // Summed over all games since the engine was created
+};
+
+// Loads the weight files of the config once, before any engine gets made from it. Exits when one can't be loaded.
+void loadEngineConfig(EngineConfig* config);
+
+void unloadEngineConfig(EngineConfig* config);
+
+// Whether an engine of this config starts a thread of its own
+bool engineUsesExtraThread(const EngineConfig* config);
+
+Engine* createEngine(const EngineConfig* config);
+
+void resetEngine(Engine* engine);
+
+Square playEngineTurn(Engine* engine, SearchLimits limits, Square enemyMove);
+
+void freeEngine(Engine* engine);
+
+const char* getEngineName(const Engine* engine);
+
+#endif //UTTT2_ENGINE_H
@@ -0,0 +1,122 @@
+#include <math.h>
+#include "mcts_engine.h"
+#include "../handle_turn.h"
+#include "../mcts/ponder.h"
+#include "../nn/eval_cache.h"
+#include "../misc/util.h"
+#include "../misc/trace.h"
+#include "../misc/timer.h"
+
+typedef struct MCTSEngine {
+    Engine engine;
+    Board* board;
+    int rootIndex;
+    TimeManager timeManager;
+    bool newGame;
+    Ponder ponderer;
+    bool pondering;
+    uint64_t ponderTraceStart;
+} MCTSEngine;
+
+
+Engine* createMCTSEngine(const EngineConfig* config) {
+    MCTSEngine* engine = safeMalloc(sizeof(MCTSEngine));
+    engine->board = createBoard();
+    engine->board->network = config->network;
+    engine->board->fastNetwork = config->fastNetwork;
+    engine->board->usePUCT = config->usePUCT;
+    if (config->evalCacheLog2Entries > 0) {
+        engine->board->evalCache = createEvalCache(config->evalCacheLog2Entries);
+        clearEvalCache(engine->board->evalCache, config->network);
+    }
+    engine->pondering = false;
+    engine->newGame = true;
+    engine->rootIndex = createMCTSRootNode(engine->board);
+    return &engine->engine;
+}
+
+
+// The simulations done while pondering stay in the tree, so they count for the next move
+void stopMCTSEnginePondering(MCTSEngine* engine) {
+    if (engine->pondering) {
+        int ponderSimulations = stopPondering(&engine->ponderer);
+        endTraceSpan("ponder", engine->ponderTraceStart, "simulations", ponderSimulations);
+        engine->engine.statistics.simulations += ponderSimulations;
+        engine->pondering = false;
+    }
+}
+
+
+void resetMCTSEngine(Engine* engine) {
+    MCTSEngine* mcts = (MCTSEngine*) engine;
+    stopMCTSEnginePondering(mcts);
+    resetBoard(mcts->board);
+    mcts->rootIndex = createMCTSRootNode(mcts->board);
+    mcts->newGame = true;
+}
+
+
+// The time manager starts over every game, so a time bank lasts for one game
+HandleTurnResult searchWithTimeManager(MCTSEngine* engine, SearchLimits limits, Square enemyMove) {
+    const EngineConfig* config = engine->engine.config;
+    TimeManager* timeManager = &engine->timeManager;
+    if (engine->newGame) {
+        initializeTimeManager(timeManager, config->timeBank > 0? 0 : limits.time, config->timeBank,
+                              config->adaptiveTime);
+    }
+    if (config->timeBank == 0) {
+        timeManager->timePerMove = limits.time;
+    }
+    timeManager->threadCpuTime = limits.threadCpuTime;
+    double timeUsedBefore = timeManager->timeUsed;
+    int earlyStopsBefore = timeManager->earlyStops;
+    int extensionsBefore = timeManager->extensions;
+    HandleTurnResult result = handleTurnWithTimeManager(engine->board, engine->rootIndex, timeManager, enemyMove);
+    EngineStatistics* statistics = &engine->engine.statistics;
+    statistics->time += timeManager->timeUsed - timeUsedBefore;
+    statistics->slowestMove = fmax(statistics->slowestMove, timeManager->timeUsed - timeUsedBefore);
+    statistics->earlyStops += timeManager->earlyStops - earlyStopsBefore;
+    statistics->extensions += timeManager->extensions - extensionsBefore;
+    return result;
+}
+
+
+Square playMCTSEngineTurn(Engine* engine, SearchLimits limits, Square enemyMove) {
+    MCTSEngine* mcts = (MCTSEngine*) engine;
+    stopMCTSEnginePondering(mcts);
+    HandleTurnResult result;
+    if (limits.simulations > 0) {
+        double start = getMonotonicTime();
+        result = handleTurnWithLimits(mcts->board, mcts->rootIndex, limits, enemyMove);
+        double time = getMonotonicTime() - start;
+        engine->statistics.time += time;
+        engine->statistics.slowestMove = fmax(engine->statistics.slowestMove, time);
+    } else {
+        result = searchWithTimeManager(mcts, limits, enemyMove);
+    }
+    mcts->newGame = false;
+    mcts->rootIndex = result.newRootIndex;
+    engine->statistics.moves++;
+    engine->statistics.simulations += result.amountOfSimulations;
+    // Pondering would make searches with a fixed amount of simulations depend on timing
+    if (engine->config->ponder && limits.simulations <= 0 && mcts->board->state.winner == NONE) {
+        mcts->ponderTraceStart = startTraceSpan();
+        startPondering(&mcts->ponderer, mcts->board, mcts->rootIndex);
+        mcts->pondering = true;
+    }
+    return result.move;
+}
+
+
+void freeMCTSEngine(Engine* engine) {
+    MCTSEngine* mcts = (MCTSEngine*) engine;
+    stopMCTSEnginePondering(mcts);
+    if (mcts->board->evalCache != NULL) {
+        freeEvalCache(mcts->board->evalCache);
+    }
+    freeBoard(mcts->board);
+    safeFree(mcts);
+}
+
+
+const EngineInterface mctsEngine = {createMCTSEngine, resetMCTSEngine, playMCTSEngineTurn, freeMCTSEngine};
@@ -0,0 +1,10 @@
+#ifndef UTTT2_MCTS_ENGINE_H
+#define UTTT2_MCTS_ENGINE_H
+
+#include "engine.h"
+
+// The search of this build as an arena engine. Everything it needs besides its node pool, pondering thread and eval
+// cache comes read-only from its config, so any amount of them can play in one process.
+extern const EngineInterface mctsEngine;
+
+#endif //UTTT2_MCTS_ENGINE_H
@@ -3,17 +3,39 @@ from torch import nn
 
 
 class NeuralNetwork(nn.Module):
-    def __init__(self):
+    def __init__(self, hidden_neurons=256, hidden2_neurons=0, policy=False):
         super(NeuralNetwork, self).__init__()
-        self.l1 = nn.Linear(190, 256)
-        self.l2 = nn.Linear(256, 1)
+        self.l1 = nn.Linear(190, hidden_neurons)
+        self.hidden2 = nn.Linear(hidden_neurons, hidden2_neurons) if hidden2_neurons > 0 else None
+        self.l2 = nn.Linear(hidden2_neurons if hidden2_neurons > 0 else hidden_neurons, 1)
+        # One logit per square (9 * small board + square), computed from the same hidden layer as the value
+        self.policy = nn.Linear(hidden_neurons, 81) if policy else None
 
     def forward(self, x):
+        return self.forward_with_policy(x)[0]
+
+    def forward_with_policy(self, x):
+        """Returns the value and the policy logits, or None for the logits without a policy head"""
         x = self.l1(x)
         x = torch.clamp(x, min=0, max=1)
+        policy = getattr(self, 'policy', None)
+        logits = policy(x) if policy is not None else None
+        if getattr(self, 'hidden2', None) is not None:
+            x = self.hidden2(x)
+            x = torch.clamp(x, min=0, max=1)
         x = self.l2(x)
         x = torch.clamp(x, min=-0.5, max=0.5)
-        return x
+        return x, logits
+
+
+def legal_move_mask(X):
+    """Legal moves of a batch of network inputs: the empty squares of the current small board, or of every undecided
+    small board when the current board is 9 (any board)"""
+    occupied = X[:, 9:90] + X[:, 99:180]
+    decided = X[:, 0:9] + X[:, 90:99]
+    current_board = X[:, 180:190]
+    allowed_boards = current_board[:, :9] + current_board[:, 9:10] * (1 - decided)
+    return (1 - occupied) * torch.repeat_interleave(allowed_boards, 9, dim=1) > 0
 
 
 class WeightClipper(object):
@@ -0,0 +1,58 @@
+import time
+import torch
+from torch import nn
+from torch.utils.data import DataLoader
+from neural_network.network import NeuralNetwork, WeightClipper
+from neural_network.training import PositionDataset
+from neural_network.scripts.export_model import export_binary
+
+TEACHER_FILENAME = '../model_latest.pth'
+STUDENT_FILENAME = '../model_fast.pth'
+# The fast network scores new children in the search (Board.fastNetwork), so it should be as small as possible
+HIDDEN_NEURONS = 32
+# Weight of the game results next to the teacher's evals
+LABEL_WEIGHT = 0.1
+
+
+def train_epoch(dataloader, teacher, student, optimizer, scheduler, batch_size):
+    loss_fn = nn.MSELoss()
+    clipper = WeightClipper()
+    train_loss = 0
+    for i, (X, y, *_) in enumerate(dataloader):
+        X, y = X.cuda(), y.cuda()
+        with torch.no_grad():
+            target = teacher(X)
+        pred = student(X)
+        loss = (1 - LABEL_WEIGHT) * loss_fn(pred, target) + LABEL_WEIGHT * loss_fn(pred, y)
+        train_loss += loss.item()
+        optimizer.zero_grad()
+        loss.backward()
+        optimizer.step()
+        if i % clipper.frequency == 0:
+            student.apply(clipper)
+    train_loss /= len(dataloader) // batch_size
+    scheduler.step(train_loss)
+    print(f'Train average loss: {train_loss:>8f}')
+
+
+def main():
+    learning_rate = 0.4
+    batch_size = 16384
+    epochs = 100
+    teacher = torch.load(TEACHER_FILENAME).cuda().eval()
+    student = NeuralNetwork(HIDDEN_NEURONS).cuda()
+    dataloader = DataLoader(PositionDataset(True, batch_size), batch_size=1, num_workers=8, persistent_workers=True,
+                            pin_memory=True)
+    optimizer = torch.optim.SGD(student.parameters(), lr=learning_rate, momentum=0.9, nesterov=True)
+    scheduler = torch.optim.lr_scheduler.ReduceLROnPlateau(optimizer, patience=3, threshold=0.0002, factor=0.5)
+    for i in range(epochs):
+        print(f'Epoch {i+1}')
+        start = time.time()
+        train_epoch(dataloader, teacher, student, optimizer, scheduler, batch_size)
+        print(f'Epoch completed in {time.time() - start:<7f}\n')
+        torch.save(student, STUDENT_FILENAME)
+    export_binary(student.cpu(), 'fast_network.bin')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,59 @@
+import torch
+from torch import nn
+from torch.utils.data import DataLoader
+from neural_network.training import PositionDataset
+
+MODEL_FILENAME = '../model_latest.pth'
+
+
+def quantized_forward(model, X, hidden_scale, smallest, largest):
+    """Emulates the integer inference of forward.c for a first layer quantized at `hidden_scale`"""
+    hidden_weights = torch.clamp(torch.round(model.l1.weight * hidden_scale), smallest, largest)
+    hidden_biases = torch.round(model.l1.bias * hidden_scale)
+    x = X @ hidden_weights.T + hidden_biases
+    x = torch.clamp(x * round(127 / hidden_scale), -32768, 32767)
+    x = torch.clamp(x, 0, 127)
+    hidden2 = getattr(model, 'hidden2', None)
+    if hidden2 is not None:
+        hidden2_weights = torch.clamp(torch.round(hidden2.weight * 64), -128, 127)
+        x = torch.floor((x @ hidden2_weights.T + torch.round(hidden2.bias * 127 * 64)) / 64)
+        x = torch.clamp(x, 0, 127)
+    output_weights = torch.clamp(torch.round(model.l2.weight * 64), -128, 127)
+    x = (x @ output_weights.T) / (127 * 64) + model.l2.bias
+    return torch.clamp(x, min=-0.5, max=0.5)
+
+
+def main():
+    batch_size = 16384
+    model = torch.load(MODEL_FILENAME).cpu()
+    dataloader = DataLoader(PositionDataset(False, batch_size), batch_size=1)
+    loss_fn = nn.MSELoss(reduction='sum')
+    names = ('float', 'int16', 'int8')
+    losses = dict.fromkeys(names, 0.0)
+    differences = dict.fromkeys(names[1:], 0.0)
+    max_differences = dict.fromkeys(names[1:], 0.0)
+    amount = 0
+    with torch.no_grad():
+        for X, y in dataloader:
+            X, y = X[0], y[0]
+            predictions = {
+                'float': model(X),
+                'int16': quantized_forward(model, X, 127, -32768, 32767),
+                'int8': quantized_forward(model, X, 63.5, -128, 127),
+            }
+            for name, pred in predictions.items():
+                losses[name] += loss_fn(pred, y).item()
+                if name != 'float':
+                    difference = torch.abs(pred - predictions['float'])
+                    differences[name] += difference.sum().item()
+                    max_differences[name] = max(max_differences[name], difference.max().item())
+            amount += len(y)
+    for name in names:
+        print(f'{name:>5s}: test loss {losses[name] / amount:>8f}', end='')
+        if name != 'float':
+            print(f', mean |eval - float eval| {differences[name] / amount:>8f}, max {max_differences[name]:>8f}', end='')
+        print()
+
+
+if __name__ == '__main__':
+    main()
@@ -1,8 +1,12 @@
+import struct
 import torch
 import shutil
+import numpy as np
 
 VERSION = 'MCTS_20ms'
 MODEL_FILENAME = '../model_latest.pth'
+# Export the first layer at half scale as int8 (build with -DINT8_HIDDEN_WEIGHTS=ON to use it)
+INT8_HIDDEN_WEIGHTS = False
 
 
 def clamp(n, smallest, largest):
@@ -17,6 +21,21 @@ def double_to_int(value, scaling_factor, smallest, largest):
     return str(clamp(x, smallest, largest))
 
 
+def quantize(value, scaling_factor, smallest, largest):
+    return str(clamp(round(value * scaling_factor), smallest, largest))
+
+
+def to_packed_order(parameters):
+    """Pads to a multiple of 32 and swaps the middle two groups of 8 in every block of 32 neurons, the order
+    _mm256_packs_epi16 leaves them in"""
+    parameters = list(parameters) + [0] * (-len(parameters) % 32)
+    result = []
+    for i in range(0, len(parameters), 32):
+        block = parameters[i:i+32]
+        result.extend(block[0:8] + block[16:24] + block[8:16] + block[24:32])
+    return result
+
+
 def export2d(filename, parameters, scaling_factor, smallest, largest):
     with open(f'../parameters/{VERSION}/{filename}', 'w') as f:
         f.write('{')
@@ -35,13 +54,73 @@ def export1d(filename, parameters, scaling_factor, smallest, largest):
         f.write('{' + line + '}')
 
 
+def export_int8_hidden_layer(model):
+    with open(f'../parameters/{VERSION}/hidden_layer_weights_int8.txt', 'w') as f:
+        rows = ('{' + ','.join(quantize(v, 63.5, -128, 127) for v in line) + '}' for line in model.l1.weight.T.tolist())
+        f.write('{' + ',\n'.join(rows) + '}')
+    with open(f'../parameters/{VERSION}/hidden_layer_biases_int8.txt', 'w') as f:
+        f.write('{' + ','.join(quantize(v, 63.5, -32768, 32767) for v in model.l1.bias.tolist()) + '}')
+
+
+def fnv1a(data):
+    h = 0xcbf29ce484222325
+    for byte in data:
+        h = ((h ^ byte) * 0x100000001b3) & 0xffffffffffffffff
+    return h
+
+
+def aligned(array, alignment=64):
+    data = array.tobytes()
+    return data + bytes(-len(data) % alignment)
+
+
+def export_binary(model, filename='network.bin'):
+    """Writes the versioned weight file read by loadNetwork() in src/nn/network.c"""
+    hidden_scale, hidden_type = (63.5, np.int8) if INT8_HIDDEN_WEIGHTS else (127, np.int16)
+    info = np.iinfo(hidden_type)
+    hidden_weights = np.clip(np.round(model.l1.weight.T.detach().numpy() * hidden_scale), info.min, info.max)
+    hidden_biases = np.clip(np.round(model.l1.bias.detach().numpy() * hidden_scale), -32768, 32767)
+    hidden2 = getattr(model, 'hidden2', None)
+    if hidden2 is None:
+        hidden2_weights = np.zeros(0)
+        hidden2_biases = np.zeros(0)
+        output_weights = to_packed_order(model.l2.weight.tolist()[0])
+    else:
+        hidden2_weights = np.clip(np.round(np.array([to_packed_order(row) for row in hidden2.weight.tolist()]) * 64),
+                                  -128, 127)
+        hidden2_biases = np.round(hidden2.bias.detach().numpy() * 127 * 64)
+        output_weights = model.l2.weight.tolist()[0]
+    output_weights = np.clip(np.round(np.array(output_weights) * 64), -128, 127)
+    policy = getattr(model, 'policy', None)
+    if policy is None:
+        policy_weights = np.zeros(0)
+        policy_biases = np.zeros(0)
+    else:
+        policy_weights = np.clip(np.round(np.array([to_packed_order(row) for row in policy.weight.tolist()]) * 64),
+                                 -128, 127)
+        policy_biases = np.round(policy.bias.detach().numpy() * 127 * 64)
+    payload = (aligned(hidden_weights.astype(hidden_type)) + aligned(hidden_biases.astype(np.int16))
+               + aligned(hidden2_weights.astype(np.int8)) + aligned(hidden2_biases.astype(np.int32))
+               + aligned(output_weights.astype(np.int8))
+               + aligned(policy_weights.astype(np.int8)) + aligned(policy_biases.astype(np.int32)))
+    inputs, hidden = hidden_weights.shape
+    header = struct.pack('<8sIIIIIIfffIQQ', b'UTTTNET', 3, inputs, hidden, len(hidden2_biases), 1,
+                         8 * np.dtype(hidden_type).itemsize, hidden_scale, 64, model.l2.bias.item(),
+                         len(policy_biases), len(payload), fnv1a(payload))
+    with open(f'../parameters/{VERSION}/{filename}', 'wb') as f:
+        f.write(header + payload)
+
+
 def main():
     model = torch.load(MODEL_FILENAME)
     export2d('hidden_layer_weights.txt', model.l1.weight.T.tolist(), 127, -32768, 32767)
     export1d('hidden_layer_biases.txt', model.l1.bias.tolist(), 127, -32768, 32767)
-    export1d('output_layer_weights.txt', model.l2.weight.tolist()[0], 64, -127, 128)
+    if INT8_HIDDEN_WEIGHTS:
+        export_int8_hidden_layer(model)
+    export1d('output_layer_weights.txt', to_packed_order(model.l2.weight.tolist()[0]), 64, -127, 128)
     with open(f'../parameters/{VERSION}/output_layer_bias.txt', 'w') as f:
         f.write(str(model.l2.bias.item()))
+    export_binary(model)
     shutil.copyfile(MODEL_FILENAME, f'../parameters/{VERSION}/{MODEL_FILENAME[3:]}')
 
 
@@ -1,6 +1,7 @@
 import os
 import csv
 import random
+from symmetry import canonical_key
 
 
 def merge():
@@ -28,7 +29,7 @@ def remove_duplicates():
         with open('../unique_positions.csv', 'w') as write_file:
             write_file.write(','.join(next(reader)) + '\n')  # Write header
             for row in reader:
-                key = ','.join(row[:-3])
+                key = canonical_key(*row[:-3])
                 if key not in seen:
                     seen.add(key)
                     write_file.write(','.join(row) + '\n')
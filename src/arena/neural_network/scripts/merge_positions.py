@@ -1,19 +1,38 @@
 import os
 import random
+from symmetry import canonical_key
 
 PATH = '../positions_mcts_20ms'
 LINE_SIZE = 197
 
 
+def is_new_position(line, seen):
+    """Drops positions already seen in any of their 8 symmetric versions. Only 64-bit hashes of the keys are kept to
+    fit all positions in memory, so a collision can rarely drop a new position."""
+    row = line.rstrip('\n').split(',')
+    if len(row) != 8:
+        return True
+    key = hash(canonical_key(*row[:6]))
+    if key in seen:
+        return False
+    seen.add(key)
+    return True
+
+
 def write_positions(path, write_file):
+    seen = set()
+    duplicates = 0
     for _, _, files in os.walk(path):
         for filename in files:
             print(filename)
             with open(f'{path}/{filename}', 'r') as f:
                 lines = f.readlines()
                 random.shuffle(lines)
-                write_file.writelines(lines)
+                new_lines = [line for line in lines if is_new_position(line, seen)]
+                duplicates += len(lines) - len(new_lines)
+                write_file.writelines(new_lines)
                 write_file.write('\n')
+    print(f'Removed {duplicates} duplicate or symmetric positions')
 
 
 def merge():
@@ -1,13 +1,19 @@
 import csv
 
 
-def convert(position) -> (bytes, bytes):
+def move_to_index(move_played):
+    """move_played is the small board digit followed by the square digit; the policy head uses 9 * board + square"""
+    return 9 * int(move_played[0]) + int(move_played[1])
+
+
+def convert(position) -> (bytes, bytes, bytes):
     if len(position) != 8 or sum(map(len, position)) != 190:
-        return b'', b''
+        return b'', b'', b''
     try:
         float(position[6])
+        move = move_to_index(position[7])
     except ValueError:
-        return b'', b''
+        return b'', b'', b''
     current_board = ['0'] * 10
     current_board[int(position[5])] = '1'
     current_board = ''.join(current_board)
@@ -16,7 +22,7 @@ def convert(position) -> (bytes, bytes):
     else:
         X = position[3] + position[1] + position[2] + position[0] + current_board + '00'
     b = bytes(int(X[i:i+8], 2) for i in range(0, len(X), 8))
-    return b, bytes(position[6], encoding='UTF-8')
+    return b, bytes(position[6], encoding='UTF-8'), bytes([move])
 
 
 def convert_positions(filename, new_filename):
@@ -25,12 +31,14 @@ def convert_positions(filename, new_filename):
         next(reader)
         converted = map(convert, reader)
         with open(f'../{new_filename}_compressed_positions.csv', 'wb') as positions_file:
-            with open(f'../{new_filename}_compressed_evaluations.csv', 'wb') as evaluations_file:
+            with open(f'../{new_filename}_compressed_evaluations.csv', 'wb') as evaluations_file, \
+                    open(f'../{new_filename}_compressed_moves.csv', 'wb') as moves_file:
                 i = 0
-                for position, evaluation in converted:
+                for position, evaluation, move in converted:
                     if position != b'' and evaluation != b'':
                         positions_file.write(position)
                         evaluations_file.write(evaluation)
+                        moves_file.write(move)
                     if i % 1_000_000 == 0:
                         print(f'{i:>7d}/?')
                     i += 1
@@ -0,0 +1,45 @@
+"""The 8 symmetries of the board, numbered like src/board/symmetry.c: transform t rotates the board by (t % 4) quarter
+turns, then mirrors it left-right if t >= 4. Small boards and the squares in them move together."""
+
+
+def transform_index(index, transform):
+    row, column = divmod(index, 3)
+    for _ in range(transform % 4):
+        row, column = column, 2 - row
+    if transform >= 4:
+        column = 2 - column
+    return 3 * row + column
+
+
+SYMMETRIES = 8
+INDEX_TRANSFORMS = [[transform_index(i, t) for i in range(9)] for t in range(SYMMETRIES)]
+# SQUARE_TRANSFORMS[t][9 * board + square] is the index that square moves to, the order of the mark strings
+SQUARE_TRANSFORMS = [[9 * INDEX_TRANSFORMS[t][i // 9] + INDEX_TRANSFORMS[t][i % 9] for i in range(81)]
+                     for t in range(SYMMETRIES)]
+
+
+def transform_bits(bits, permutation):
+    result = [''] * len(bits)
+    for i, bit in enumerate(bits):
+        result[permutation[i]] = bit
+    return ''.join(result)
+
+
+def transform_position(p1_small, p2_small, p1_big, p2_big, current_board, transform):
+    """Transforms the board columns of a positions.csv row; current_board 9 means any board"""
+    return (transform_bits(p1_small, SQUARE_TRANSFORMS[transform]),
+            transform_bits(p2_small, SQUARE_TRANSFORMS[transform]),
+            transform_bits(p1_big, INDEX_TRANSFORMS[transform]),
+            transform_bits(p2_big, INDEX_TRANSFORMS[transform]),
+            current_board if current_board == '9' else str(INDEX_TRANSFORMS[transform][int(current_board)]))
+
+
+def transform_move(move_played, transform):
+    """move_played is the small board digit followed by the square digit"""
+    return ''.join(str(INDEX_TRANSFORMS[transform][int(digit)]) for digit in move_played)
+
+
+def canonical_key(p1_small, p2_small, p1_big, p2_big, current_player, current_board):
+    """The same string for all 8 symmetric versions of a position"""
+    return min(','.join(transform_position(p1_small, p2_small, p1_big, p2_big, current_board, t)) + ',' + current_player
+               for t in range(SYMMETRIES))
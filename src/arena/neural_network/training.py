@@ -4,14 +4,18 @@ import torch
 from torch import nn
 from torch.utils.data import IterableDataset, DataLoader
 import numpy as np
-from neural_network.network import NeuralNetwork, WeightClipper
+from neural_network.network import NeuralNetwork, WeightClipper, legal_move_mask
+
+# Weight of the policy cross entropy relative to the value MSE
+POLICY_LOSS_WEIGHT = 0.01
 
 
 class PositionDataset(IterableDataset):
     POSITIONS_LINE_LENGTH = 24
     EVALUATIONS_LINE_LENGTH = 6
+    MOVES_LINE_LENGTH = 1
 
-    def __init__(self, is_train: bool, batch_size: int):
+    def __init__(self, is_train: bool, batch_size: int, with_moves=False):
         self.batch_size = batch_size
         base_filename = f"../{'train' if is_train else 'test'}_compressed"
         positions_filename = f'{base_filename}_positions.csv'
@@ -28,6 +32,11 @@ class PositionDataset(IterableDataset):
                 evals.append(float(e) - 0.5)
             self.evaluations = np.array(evals, dtype=np.float32)
             self.evaluations = torch.from_numpy(self.evaluations)
+        self.moves = None
+        if with_moves:
+            moves = np.fromfile(f'{base_filename}_moves.csv', dtype=np.uint8).astype(np.int64)
+            assert len(moves) == self.amount_of_lines, 'Moves and positions are out of sync, rerun pickle_positions.py'
+            self.moves = torch.from_numpy(moves)
 
     def __len__(self):
         return self.amount_of_lines
@@ -46,16 +55,28 @@ class PositionDataset(IterableDataset):
         for i in range(iter_start, iter_end, self.batch_size):
             X = np.unpackbits(self.positions[i:i+self.batch_size], axis=1)[:, :190].astype(np.float32)
             y = self.evaluations[i:i+self.batch_size].reshape((self.batch_size, 1))
-            yield X, y
+            if self.moves is None:
+                yield X, y
+            else:
+                yield X, y, self.moves[i:i+self.batch_size]
+
+
+def policy_loss(logits, X, moves):
+    """Cross entropy of the played moves, with illegal moves masked out of the softmax"""
+    X, logits, moves = X.reshape(-1, 190), logits.reshape(-1, 81), moves.reshape(-1)
+    logits = logits.masked_fill(~legal_move_mask(X), float('-inf'))
+    return nn.functional.cross_entropy(logits, moves)
 
 
 def train_loop(dataloader, model, loss_fn, optimizer, scheduler, batch_size):
     train_loss = 0
     clipper = WeightClipper()
-    for i, (X, y) in enumerate(dataloader):
+    for i, (X, y, *moves) in enumerate(dataloader):
         X, y = X.cuda(), y.cuda()
-        pred = model(X)
+        pred, logits = model.forward_with_policy(X)
         loss = loss_fn(pred, y)
+        if logits is not None:
+            loss = loss + POLICY_LOSS_WEIGHT * policy_loss(logits, X, moves[0].cuda())
         train_loss += loss.item()
         optimizer.zero_grad()
         loss.backward()
@@ -71,7 +92,7 @@ def train_loop(dataloader, model, loss_fn, optimizer, scheduler, batch_size):
 def test_loop(dataloader, model, loss_fn, batch_size):
     test_loss = 0
     with torch.no_grad():
-        for X, y in dataloader:
+        for X, y, *_ in dataloader:
             X, y = X.cuda(), y.cuda()
             pred = model(X)
             test_loss += loss_fn(pred, y).item()
@@ -81,16 +102,21 @@ def test_loop(dataloader, model, loss_fn, batch_size):
 
 
 def main():
+    # The C inference has kernels for 32/64/128/256/512/1024 hidden neurons and up to 64 in the second layer (0 = none)
+    hidden_neurons = 256
+    hidden2_neurons = 0
+    # Trains a policy head on the played moves as well, for PUCT search (needs the _moves.csv files)
+    policy = False
     learning_rate = 0.4
     batch_size = 16384
     epochs = 600
 
-    training_data = PositionDataset(True, batch_size)
+    training_data = PositionDataset(True, batch_size, policy)
     # testing_data = PositionDataset(False, batch_size)
     train_dataloader = DataLoader(training_data, batch_size=1, num_workers=8, persistent_workers=True,
                                   pin_memory=True)
     # test_dataloader = DataLoader(testing_data, batch_size=1)
-    model = NeuralNetwork().cuda()
+    model = NeuralNetwork(hidden_neurons, hidden2_neurons, policy).cuda()
     loss_fn = nn.MSELoss()
     optimizer = torch.optim.SGD(model.parameters(), lr=learning_rate, momentum=0.9, nesterov=True)
     scheduler = torch.optim.lr_scheduler.ReduceLROnPlateau(optimizer, patience=3, threshold=0.0002, factor=0.5)
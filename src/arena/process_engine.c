@@ -0,0 +1,226 @@
+#define _GNU_SOURCE  // pipe2
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "process_engine.h"
+#include "../misc/timer.h"
+#include "../misc/util.h"
+
+// CodinGame gives 1000 ms for the first move and 100 ms for the others. The first move also includes starting up.
+#define FIRST_MOVE_TIMEOUT_FACTOR 10
+#define LINE_LENGTH 256
+
+extern char** environ;
+
+typedef struct ProcessEngine {
+    Engine engine;
+    Board* board;  // Only its state is used, to tell the program the valid actions
+    pid_t pid;  // 0 while no program runs
+    int input;  // Write end of the stdin of the program
+    int output;  // Read end of the stdout of the program
+    char buffer[LINE_LENGTH];
+    int buffered;
+} ProcessEngine;
+
+
+Engine* createProcessEngine(const EngineConfig* config) {
+    (void) config;
+    // Writing to a program that exited has to fail instead of ending the arena
+    signal(SIGPIPE, SIG_IGN);
+    ProcessEngine* engine = safeMalloc(sizeof(ProcessEngine));
+    engine->board = createBoard();
+    engine->pid = 0;
+    return &engine->engine;
+}
+
+
+// The pipes are close-on-exec, so the programs of other workers don't keep them open. The program inherits the CPUs
+// the worker is pinned to.
+void startProgram(ProcessEngine* engine) {
+    int inputPipe[2];
+    int outputPipe[2];
+    if (pipe2(inputPipe, O_CLOEXEC) != 0 || pipe2(outputPipe, O_CLOEXEC) != 0) {
+        perror("pipe2");
+        exit(1);
+    }
+    const char* command = engine->engine.config->command;
+    // With exec the shell gets replaced, so the pid is the program's and killing it doesn't leave orphans
+    size_t commandLength = strlen(command) + sizeof("exec ");
+    char* shellCommand = safeMalloc(commandLength);
+    snprintf(shellCommand, commandLength, "exec %s", command);
+    char* arguments[] = {"sh", "-c", shellCommand, NULL};
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, inputPipe[0], STDIN_FILENO);
+    posix_spawn_file_actions_adddup2(&actions, outputPipe[1], STDOUT_FILENO);
+    int error = posix_spawn(&engine->pid, "/bin/sh", &actions, NULL, arguments, environ);
+    posix_spawn_file_actions_destroy(&actions);
+    safeFree(shellCommand);
+    if (error != 0) {
+        fprintf(stderr, "Couldn't start %s: %s\n", command, strerror(error));
+        exit(1);
+    }
+    close(inputPipe[0]);
+    close(outputPipe[1]);
+    engine->input = inputPipe[1];
+    engine->output = outputPipe[0];
+    engine->buffered = 0;
+}
+
+
+void stopProgram(ProcessEngine* engine) {
+    if (engine->pid == 0) {
+        return;
+    }
+    close(engine->input);
+    close(engine->output);
+    kill(engine->pid, SIGKILL);
+    waitpid(engine->pid, NULL, 0);
+    engine->pid = 0;
+}
+
+
+void resetProcessEngine(Engine* engine) {
+    ProcessEngine* process = (ProcessEngine*) engine;
+    stopProgram(process);
+    resetBoard(process->board);
+}
+
+
+bool writeAll(int fd, const char* text, int length) {
+    while (length > 0) {
+        ssize_t written = write(fd, text, length);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return false;
+        }
+        text += written;
+        length -= (int) written;
+    }
+    return true;
+}
+
+
+// Returns false when the program closed its stdout, or didn't finish the line before endTime or within LINE_LENGTH
+bool readLine(ProcessEngine* engine, double endTime, char line[LINE_LENGTH]) {
+    while (true) {
+        char* newline = memchr(engine->buffer, '\n', engine->buffered);
+        if (newline != NULL) {
+            int length = (int) (newline - engine->buffer);
+            memcpy(line, engine->buffer, length);
+            line[length] = '\0';
+            engine->buffered -= length + 1;
+            memmove(engine->buffer, newline + 1, engine->buffered);
+            return true;
+        }
+        double remainingTime = endTime - getMonotonicTime();
+        if (engine->buffered == LINE_LENGTH || remainingTime <= 0) {
+            return false;
+        }
+        struct pollfd pollFd = {engine->output, POLLIN, 0};
+        int ready = poll(&pollFd, 1, (int) ceil(remainingTime * 1000));
+        if (ready <= 0) {
+            continue;
+        }
+        ssize_t amount = read(engine->output, engine->buffer + engine->buffered, LINE_LENGTH - engine->buffered);
+        if (amount < 0 && errno == EINTR) {
+            continue;
+        }
+        if (amount <= 0) {
+            return false;
+        }
+        engine->buffered += (int) amount;
+    }
+}
+
+
+// The enemy move, the amount of valid actions and the actions, all in game notation
+int writeTurnInput(Board* board, Square enemyMove, char* text) {
+    int length;
+    if (enemyMove.board == 9 && enemyMove.position == 9) {
+        length = sprintf(text, "-1 -1\n");
+    } else {
+        Square enemyMoveGameNotation = toGameNotation(enemyMove);
+        length = sprintf(text, "%d %d\n", enemyMoveGameNotation.board, enemyMoveGameNotation.position);
+    }
+    Square moves[TOTAL_SMALL_SQUARES];
+    int8_t amountOfMoves = generateMoves(board, moves);
+    length += sprintf(text + length, "%d\n", amountOfMoves);
+    for (int i = 0; i < amountOfMoves; i++) {
+        Square move = toGameNotation(moves[i]);
+        length += sprintf(text + length, "%d %d\n", move.board, move.position);
+    }
+    return length;
+}
+
+
+Square playProcessEngineTurn(Engine* engine, SearchLimits limits, Square enemyMove) {
+    (void) limits;
+    ProcessEngine* process = (ProcessEngine*) engine;
+    Board* board = process->board;
+    Square noMove = {9, 9};
+    if (process->pid == 0) {
+        startProgram(process);
+    }
+    if (enemyMove.board != 9) {
+        makePermanentMove(board, enemyMove);
+    }
+    char input[8 * (TOTAL_SMALL_SQUARES + 2)];
+    int inputLength = writeTurnInput(board, enemyMove, input);
+    double timeout = engine->config->moveTimeout * (board->state.ply <= 1? FIRST_MOVE_TIMEOUT_FACTOR : 1);
+    if (!writeAll(process->input, input, inputLength)) {
+        fprintf(stderr, "%s exited before its move\n", engine->config->name);
+        return noMove;
+    }
+    double start = getMonotonicTime();
+    char line[LINE_LENGTH];
+    bool answered = readLine(process, start + timeout, line);
+    double time = getMonotonicTime() - start;
+    engine->statistics.moves++;
+    engine->statistics.time += time;
+    engine->statistics.slowestMove = fmax(engine->statistics.slowestMove, time);
+    int row;
+    int column;
+    if (!answered) {
+        if (time >= timeout) {
+            fprintf(stderr, "%s didn't answer within %.3fs\n", engine->config->name, timeout);
+        } else {
+            fprintf(stderr, "%s stopped answering\n", engine->config->name);
+        }
+        return noMove;
+    }
+    int parsed = sscanf(line, "%d%d", &row, &column);  // NOLINT(cert-err34-c)
+    if (parsed != 2 || row < 0 || row > 8 || column < 0 || column > 8) {
+        fprintf(stderr, "%s answered \"%s\" instead of a move\n", engine->config->name, line);
+        return noMove;
+    }
+    Square moveGameNotation = {row, column};
+    Square move = toOurNotation(moveGameNotation);
+    // The arena ends the game on an illegal move, so the board doesn't need it
+    if (isLegalMove(board, move)) {
+        makePermanentMove(board, move);
+    }
+    return move;
+}
+
+
+void freeProcessEngine(Engine* engine) {
+    ProcessEngine* process = (ProcessEngine*) engine;
+    stopProgram(process);
+    freeBoard(process->board);
+    safeFree(process);
+}
+
+
+const EngineInterface processEngine = {createProcessEngine, resetProcessEngine, playProcessEngineTurn,
+                                       freeProcessEngine};
@@ -0,0 +1,17 @@
+#ifndef UTTT2_PROCESS_ENGINE_H
+#define UTTT2_PROCESS_ENGINE_H
+
+#include "engine.h"
+
+// Another program as an arena engine, for example an older release or a CodinGame bundle. It gets started by /bin/sh
+// from the command of its config for every game and has to speak the CodinGame protocol on stdin and stdout: every
+// turn it reads the enemy move as "row column" (-1 -1 when it moves first), the amount of valid actions and one
+// "row column" line per action, and answers with a line that starts with "row column".
+//
+// The program keeps its own time, so the limits of the arena don't reach it. A move that doesn't arrive within the
+// moveTimeout of the config, the first move within FIRST_MOVE_TIMEOUT_FACTOR times as long, is returned as {9, 9},
+// which loses the game like any other illegal move. The time per move is measured from the last line sent to the
+// answer, on the wall clock.
+extern const EngineInterface processEngine;
+
+#endif //UTTT2_PROCESS_ENGINE_H
@@ -0,0 +1,344 @@
+#define _GNU_SOURCE  // rand_r, truncate
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "tournament.h"
+#include "../misc/util.h"
+
+#define CHECKPOINT_HEADER "UTTT2 tournament"
+#define CHECKPOINT_LINE_LENGTH 256
+#define PRIOR_DRAWS 1.0
+#define MAX_RATING_ITERATIONS 1000
+#define RATING_PRECISION 1e-4
+#define BOOTSTRAP_SAMPLES 1000
+#define BOOTSTRAP_SEED 12345
+
+
+void initializeTournament(Tournament* tournament, int amountOfEngines, const char* const* names, TournamentType type,
+                          int pairsPerPairing) {
+    tournament->amountOfEngines = amountOfEngines;
+    tournament->names = names;
+    tournament->type = type;
+    tournament->pairsPerPairing = pairsPerPairing;
+    tournament->amountOfPairings = type == GAUNTLET? amountOfEngines - 1 : amountOfEngines * (amountOfEngines - 1) / 2;
+    tournament->pairings = safeMalloc(tournament->amountOfPairings * sizeof(Pairing));
+    int pairing = 0;
+    for (int first = 0; first < amountOfEngines; first++) {
+        for (int second = first + 1; second < amountOfEngines; second++) {
+            if (type == ROUND_ROBIN || first == 0) {
+                Pairing newPairing = {first, second, {0, 0, 0}};
+                tournament->pairings[pairing++] = newPairing;
+            }
+        }
+    }
+    tournament->taskIsDone = safeMalloc(getAmountOfTasks(tournament) * sizeof(bool));
+    memset(tournament->taskIsDone, 0, getAmountOfTasks(tournament) * sizeof(bool));
+    tournament->checkpoint = NULL;
+}
+
+
+void freeTournament(Tournament* tournament) {
+    if (tournament->checkpoint != NULL) {
+        fclose(tournament->checkpoint);
+    }
+    safeFree(tournament->pairings);
+    safeFree(tournament->taskIsDone);
+}
+
+
+int getAmountOfTasks(const Tournament* tournament) {
+    return tournament->amountOfPairings * tournament->pairsPerPairing;
+}
+
+
+Pairing* getTaskPairing(const Tournament* tournament, int task) {
+    return &tournament->pairings[task % tournament->amountOfPairings];
+}
+
+
+void addTaskResults(Tournament* tournament, int task, const GameResults* results) {
+    GameResults* pairingResults = &getTaskPairing(tournament, task)->results;
+    pairingResults->wins += results->wins;
+    pairingResults->draws += results->draws;
+    pairingResults->losses += results->losses;
+    tournament->taskIsDone[task] = true;
+}
+
+
+void writeCheckpointHeader(const Tournament* tournament, FILE* file) {
+    fprintf(file, "%s %d %d %d\n", CHECKPOINT_HEADER, tournament->type, tournament->amountOfEngines,
+            tournament->pairsPerPairing);
+    for (int i = 0; i < tournament->amountOfEngines; i++) {
+        fprintf(file, "%s\n", tournament->names[i]);
+    }
+}
+
+
+// Compares the header of the file with the one this tournament would write
+bool checkpointMatches(const Tournament* tournament, FILE* file) {
+    char expected[CHECKPOINT_LINE_LENGTH];
+    char line[CHECKPOINT_LINE_LENGTH];
+    snprintf(expected, sizeof(expected), "%s %d %d %d\n", CHECKPOINT_HEADER, tournament->type,
+             tournament->amountOfEngines, tournament->pairsPerPairing);
+    if (fgets(line, sizeof(line), file) == NULL || strcmp(line, expected) != 0) {
+        return false;
+    }
+    for (int i = 0; i < tournament->amountOfEngines; i++) {
+        snprintf(expected, sizeof(expected), "%s\n", tournament->names[i]);
+        if (fgets(line, sizeof(line), file) == NULL || strcmp(line, expected) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+// Reads result lines up to the first incomplete one, which an interrupted write can leave at the end. Returns the
+// size of the file without it.
+long readCheckpointResults(Tournament* tournament, FILE* file) {
+    long validSize = ftell(file);
+    char line[CHECKPOINT_LINE_LENGTH];
+    while (fgets(line, sizeof(line), file) != NULL) {
+        int task;
+        GameResults results;
+        char end;
+        int parsed = sscanf(line, "%d%d%d%d%c", &task, &results.wins, &results.draws, &results.losses, &end);  // NOLINT(cert-err34-c)
+        if (parsed != 5 || end != '\n' || task < 0 || task >= getAmountOfTasks(tournament)) {
+            break;
+        }
+        if (!tournament->taskIsDone[task]) {
+            addTaskResults(tournament, task, &results);
+        }
+        validSize = ftell(file);
+    }
+    return validSize;
+}
+
+
+bool openCheckpoint(Tournament* tournament, const char* filename) {
+    FILE* file = fopen(filename, "r");
+    if (file != NULL) {
+        if (!checkpointMatches(tournament, file)) {
+            fprintf(stderr, "%s is the checkpoint of a different tournament\n", filename);
+            fclose(file);
+            return false;
+        }
+        long validSize = readCheckpointResults(tournament, file);
+        fclose(file);
+        if (truncate(filename, validSize) != 0) {
+            perror(filename);
+            return false;
+        }
+        tournament->checkpoint = fopen(filename, "a");
+    } else {
+        tournament->checkpoint = fopen(filename, "w");
+        if (tournament->checkpoint != NULL) {
+            writeCheckpointHeader(tournament, tournament->checkpoint);
+        }
+    }
+    if (tournament->checkpoint == NULL) {
+        perror(filename);
+        return false;
+    }
+    fflush(tournament->checkpoint);
+    return true;
+}
+
+
+void recordTaskResults(Tournament* tournament, int task, const GameResults* results) {
+    addTaskResults(tournament, task, results);
+    if (tournament->checkpoint != NULL) {
+        fprintf(tournament->checkpoint, "%d %d %d %d\n", task, results->wins, results->draws, results->losses);
+        fflush(tournament->checkpoint);
+    }
+}
+
+
+double getPoints(const GameResults* results, bool first) {
+    return (first? results->wins : results->losses) + 0.5 * results->draws;
+}
+
+
+// Newton steps for one engine at a time, until no rating moves by more than RATING_PRECISION
+void fitRatings(const Tournament* tournament, const GameResults* results, double* ratings) {
+    int amountOfEngines = tournament->amountOfEngines;
+    for (int i = 0; i < amountOfEngines; i++) {
+        ratings[i] = 0;
+    }
+    for (int iteration = 0; iteration < MAX_RATING_ITERATIONS; iteration++) {
+        double maxChange = 0;
+        for (int engine = 0; engine < amountOfEngines; engine++) {
+            double points = 0;
+            double expectedPoints = 0;
+            double derivative = 0;
+            for (int i = 0; i < tournament->amountOfPairings; i++) {
+                const Pairing* pairing = &tournament->pairings[i];
+                if (pairing->first != engine && pairing->second != engine) {
+                    continue;
+                }
+                bool first = pairing->first == engine;
+                double games = getAmountOfGames(&results[i]) + PRIOR_DRAWS;
+                double score = eloToScore(ratings[engine] - ratings[first? pairing->second : pairing->first]);
+                points += getPoints(&results[i], first) + 0.5 * PRIOR_DRAWS;
+                expectedPoints += games * score;
+                derivative += games * score * (1 - score) * log(10) / 400;
+            }
+            if (derivative > 0) {
+                double change = fmax(fmin((points - expectedPoints) / derivative, 400), -400);
+                ratings[engine] += change;
+                maxChange = fmax(maxChange, fabs(change));
+            }
+        }
+        double mean = 0;
+        for (int i = 0; i < amountOfEngines; i++) {
+            mean += ratings[i] / amountOfEngines;
+        }
+        for (int i = 0; i < amountOfEngines; i++) {
+            ratings[i] -= mean;
+        }
+        if (maxChange < RATING_PRECISION) {
+            break;
+        }
+    }
+}
+
+
+// Draws as many games as the pairing played, each with the observed probabilities of a win, draw and loss
+GameResults resampleResults(const GameResults* results, unsigned int* seed) {
+    int games = getAmountOfGames(results);
+    GameResults resampled = {0, 0, 0};
+    for (int i = 0; i < games; i++) {
+        int outcome = (int) (rand_r(seed) / (RAND_MAX + 1.0) * games);
+        if (outcome < results->wins) {
+            resampled.wins++;
+        } else if (outcome < results->wins + results->draws) {
+            resampled.draws++;
+        } else {
+            resampled.losses++;
+        }
+    }
+    return resampled;
+}
+
+
+int compareSamples(const void* a, const void* b) {
+    double difference = *(const double*) a - *(const double*) b;
+    return (difference > 0) - (difference < 0);
+}
+
+
+void computeRatings(const Tournament* tournament, EloEstimate* ratings) {
+    int amountOfEngines = tournament->amountOfEngines;
+    GameResults* results = safeMalloc(tournament->amountOfPairings * sizeof(GameResults));
+    double* fitted = safeMalloc(amountOfEngines * sizeof(double));
+    double* samples = safeMalloc(amountOfEngines * BOOTSTRAP_SAMPLES * sizeof(double));
+    for (int i = 0; i < tournament->amountOfPairings; i++) {
+        results[i] = tournament->pairings[i].results;
+    }
+    fitRatings(tournament, results, fitted);
+    for (int i = 0; i < amountOfEngines; i++) {
+        ratings[i].elo = fitted[i];
+    }
+    unsigned int seed = BOOTSTRAP_SEED;
+    for (int sample = 0; sample < BOOTSTRAP_SAMPLES; sample++) {
+        for (int i = 0; i < tournament->amountOfPairings; i++) {
+            results[i] = resampleResults(&tournament->pairings[i].results, &seed);
+        }
+        fitRatings(tournament, results, fitted);
+        for (int i = 0; i < amountOfEngines; i++) {
+            samples[i * BOOTSTRAP_SAMPLES + sample] = fitted[i];
+        }
+    }
+    int tail = (int) (0.025 * BOOTSTRAP_SAMPLES);
+    for (int i = 0; i < amountOfEngines; i++) {
+        double* engineSamples = &samples[i * BOOTSTRAP_SAMPLES];
+        qsort(engineSamples, BOOTSTRAP_SAMPLES, sizeof(double), compareSamples);
+        ratings[i].lower = engineSamples[tail];
+        ratings[i].upper = engineSamples[BOOTSTRAP_SAMPLES - 1 - tail];
+    }
+    safeFree(results);
+    safeFree(fitted);
+    safeFree(samples);
+}
+
+
+GameResults getEngineResults(const Tournament* tournament, int engine) {
+    GameResults total = {0, 0, 0};
+    for (int i = 0; i < tournament->amountOfPairings; i++) {
+        const Pairing* pairing = &tournament->pairings[i];
+        if (pairing->first == engine) {
+            total.wins += pairing->results.wins;
+            total.losses += pairing->results.losses;
+        } else if (pairing->second == engine) {
+            total.wins += pairing->results.losses;
+            total.losses += pairing->results.wins;
+        } else {
+            continue;
+        }
+        total.draws += pairing->results.draws;
+    }
+    return total;
+}
+
+
+const Pairing* findPairing(const Tournament* tournament, int engine, int opponent) {
+    for (int i = 0; i < tournament->amountOfPairings; i++) {
+        const Pairing* pairing = &tournament->pairings[i];
+        if ((pairing->first == engine && pairing->second == opponent)
+            || (pairing->first == opponent && pairing->second == engine)) {
+            return pairing;
+        }
+    }
+    return NULL;
+}
+
+
+void printTournament(FILE* file, const Tournament* tournament) {
+    int amountOfEngines = tournament->amountOfEngines;
+    EloEstimate* ratings = safeMalloc(amountOfEngines * sizeof(EloEstimate));
+    int* ranking = safeMalloc(amountOfEngines * sizeof(int));
+    computeRatings(tournament, ratings);
+    int nameWidth = 4;
+    for (int i = 0; i < amountOfEngines; i++) {
+        ranking[i] = i;
+        nameWidth = strlen(tournament->names[i]) > (size_t) nameWidth? (int) strlen(tournament->names[i]) : nameWidth;
+    }
+    for (int i = 1; i < amountOfEngines; i++) {
+        for (int j = i; j > 0 && ratings[ranking[j]].elo > ratings[ranking[j - 1]].elo; j--) {
+            int swap = ranking[j];
+            ranking[j] = ranking[j - 1];
+            ranking[j - 1] = swap;
+        }
+    }
+    fprintf(file, "Rank %-*s     Elo     95%% interval    Points  Games  Score\n", nameWidth, "Name");
+    for (int rank = 0; rank < amountOfEngines; rank++) {
+        int engine = ranking[rank];
+        GameResults results = getEngineResults(tournament, engine);
+        fprintf(file, "%4d %-*s  %+6.1f  %+7.1f %+7.1f  %6.1f  %5d  %4.1f%%\n", rank + 1, nameWidth,
+                tournament->names[engine], ratings[engine].elo, ratings[engine].lower, ratings[engine].upper,
+                getPoints(&results, true), getAmountOfGames(&results), 100 * getScore(&results));
+    }
+    int cellWidth = nameWidth > 11? nameWidth : 11;
+    fprintf(file, "\nPoints of the row against the column:\n%-*s", nameWidth, "");
+    for (int rank = 0; rank < amountOfEngines; rank++) {
+        fprintf(file, "  %*s", cellWidth, tournament->names[ranking[rank]]);
+    }
+    fprintf(file, "\n");
+    for (int row = 0; row < amountOfEngines; row++) {
+        int engine = ranking[row];
+        fprintf(file, "%-*s", nameWidth, tournament->names[engine]);
+        for (int column = 0; column < amountOfEngines; column++) {
+            const Pairing* pairing = findPairing(tournament, engine, ranking[column]);
+            char cell[32] = "-";
+            if (pairing != NULL) {
+                snprintf(cell, sizeof(cell), "%.1f/%d", getPoints(&pairing->results, pairing->first == engine),
+                         getAmountOfGames(&pairing->results));
+            }
+            fprintf(file, "  %*s", cellWidth, cell);
+        }
+        fprintf(file, "\n");
+    }
+    safeFree(ratings);
+    safeFree(ranking);
+}
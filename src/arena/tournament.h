@@ -0,0 +1,58 @@
+#ifndef UTTT2_TOURNAMENT_H
+#define UTTT2_TOURNAMENT_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "elo.h"
+
+// The results of a tournament between several engines, independent of how the games get played. Every pairing plays
+// pairsPerPairing game pairs, one with either engine going first. A task is one game pair, and the tasks take turns
+// between the pairings, so all of them progress at once.
+
+typedef enum TournamentType {
+    ROUND_ROBIN,  // Every engine plays every other one
+    GAUNTLET  // The first engine plays every other one
+} TournamentType;
+
+typedef struct Pairing {
+    int first;
+    int second;
+    GameResults results;  // From the side of first
+} Pairing;
+
+typedef struct Tournament {
+    int amountOfEngines;
+    const char* const* names;
+    TournamentType type;
+    int pairsPerPairing;
+    int amountOfPairings;
+    Pairing* pairings;
+    bool* taskIsDone;
+    FILE* checkpoint;
+} Tournament;
+
+void initializeTournament(Tournament* tournament, int amountOfEngines, const char* const* names, TournamentType type,
+                          int pairsPerPairing);
+
+void freeTournament(Tournament* tournament);
+
+int getAmountOfTasks(const Tournament* tournament);
+
+Pairing* getTaskPairing(const Tournament* tournament, int task);
+
+// Takes the results of the tasks that already ran from the checkpoint file, if it exists, and appends every result
+// recorded from now on to it. A line is written at once, so an interrupted tournament loses at most the pairs that
+// were still being played. Returns false when the file belongs to a different tournament or can't be opened.
+bool openCheckpoint(Tournament* tournament, const char* filename);
+
+void recordTaskResults(Tournament* tournament, int task, const GameResults* results);
+
+// Maximum likelihood ratings with a mean of 0 and 95% confidence intervals, from resampling the results of every
+// pairing like Ordo does. Like BayesElo, every pairing gets a virtual draw, which keeps the ratings of engines that
+// won or lost all their games finite.
+void computeRatings(const Tournament* tournament, EloEstimate* ratings);
+
+// Ratings sorted from best to worst, then the points of every engine against every other one
+void printTournament(FILE* file, const Tournament* tournament);
+
+#endif //UTTT2_TOURNAMENT_H
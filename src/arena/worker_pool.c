@@ -0,0 +1,116 @@
+#define _GNU_SOURCE  // CPU affinity
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "worker_pool.h"
+#include "../misc/timer.h"
+#include "../misc/util.h"
+
+typedef struct Worker {
+    WorkerPool* pool;
+    int index;
+    pthread_t thread;
+    double busyTime;
+} Worker;
+
+
+int getAmountOfAvailableCpus() {
+    cpu_set_t available;
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &available) != 0) {
+        return 1;
+    }
+    return CPU_COUNT(&available);
+}
+
+
+void initializeWorkerPool(WorkerPool* pool, int amountOfWorkers, int cpusPerWorker, int amountOfTasks) {
+    pool->cpusPerWorker = cpusPerWorker;
+    pool->amountOfWorkers = amountOfWorkers > 0? amountOfWorkers : getAmountOfAvailableCpus() / cpusPerWorker;
+    pool->amountOfWorkers = pool->amountOfWorkers < 1? 1 : pool->amountOfWorkers;
+    pool->amountOfWorkers = pool->amountOfWorkers > amountOfTasks? amountOfTasks : pool->amountOfWorkers;
+    pool->amountOfTasks = amountOfTasks;
+    pool->createContext = NULL;
+    pool->freeContext = NULL;
+    pool->runTask = NULL;
+    pool->argument = NULL;
+    atomic_init(&pool->nextTask, 0);
+    atomic_init(&pool->stopped, false);
+    atomic_init(&pool->tasksRun, 0);
+    pool->wallTime = 0;
+    pool->busyTime = 0;
+}
+
+
+// The i-th worker gets the i-th group of cpusPerWorker available CPUs. With more workers than CPUs pinning would
+// only keep the kernel from balancing them, so they stay unpinned.
+void pinWorker(const WorkerPool* pool, int index) {
+    cpu_set_t available;
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &available) != 0
+        || pool->amountOfWorkers * pool->cpusPerWorker > CPU_COUNT(&available)) {
+        return;
+    }
+    cpu_set_t pinned;
+    CPU_ZERO(&pinned);
+    int availableIndex = 0;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (CPU_ISSET(cpu, &available)) {
+            if (availableIndex / pool->cpusPerWorker == index) {
+                CPU_SET(cpu, &pinned);
+            }
+            availableIndex++;
+        }
+    }
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &pinned);
+}
+
+
+void* runWorker(void* argument) {
+    Worker* worker = argument;
+    WorkerPool* pool = worker->pool;
+    pinWorker(pool, worker->index);
+    void* context = pool->createContext == NULL? NULL : pool->createContext(pool->argument);
+    while (!atomic_load(&pool->stopped)) {
+        int task = atomic_fetch_add(&pool->nextTask, 1);
+        if (task >= pool->amountOfTasks) {
+            break;
+        }
+        double start = getMonotonicTime();
+        bool keepGoing = pool->runTask(task, context, pool->argument);
+        worker->busyTime += getMonotonicTime() - start;
+        atomic_fetch_add(&pool->tasksRun, 1);
+        if (!keepGoing) {
+            atomic_store(&pool->stopped, true);
+        }
+    }
+    if (pool->freeContext != NULL) {
+        pool->freeContext(context);
+    }
+    return NULL;
+}
+
+
+void runWorkerPool(WorkerPool* pool) {
+    Worker* workers = safeMalloc(pool->amountOfWorkers * sizeof(Worker));
+    double start = getMonotonicTime();
+    for (int i = 0; i < pool->amountOfWorkers; i++) {
+        workers[i].pool = pool;
+        workers[i].index = i;
+        workers[i].busyTime = 0;
+        if (pthread_create(&workers[i].thread, NULL, runWorker, &workers[i]) != 0) {
+            fprintf(stderr, "Couldn't start worker thread %d!\n", i);
+            exit(1);
+        }
+    }
+    for (int i = 0; i < pool->amountOfWorkers; i++) {
+        pthread_join(workers[i].thread, NULL);
+        pool->busyTime += workers[i].busyTime;
+    }
+    pool->wallTime = getMonotonicTime() - start;
+    safeFree(workers);
+}
+
+
+double getWorkerUtilization(const WorkerPool* pool) {
+    return pool->wallTime > 0? pool->busyTime / (pool->wallTime * pool->amountOfWorkers) : 0;
+}
@@ -0,0 +1,38 @@
+#ifndef UTTT2_WORKER_POOL_H
+#define UTTT2_WORKER_POOL_H
+
+#include <stdbool.h>
+#include <stdatomic.h>
+
+// Long-lived worker threads that take tasks from a shared counter until none are left. Games take very different
+// amounts of time, so a worker that finishes early just takes the next task. Every worker is pinned to its own CPUs
+// and keeps one context, for example boards, for all its tasks.
+
+typedef struct WorkerPool {
+    int amountOfWorkers;
+    int cpusPerWorker;  // A worker whose task starts threads of its own, like pondering, needs more than one
+    int amountOfTasks;
+    void* (*createContext)(void* argument);
+    void (*freeContext)(void* context);
+    // Returns false to skip all tasks that haven't started yet
+    bool (*runTask)(int task, void* context, void* argument);
+    void* argument;
+    atomic_int nextTask;
+    atomic_bool stopped;
+    atomic_int tasksRun;
+    double wallTime;
+    double busyTime;  // Summed over all workers
+} WorkerPool;
+
+int getAmountOfAvailableCpus();
+
+// One worker per cpusPerWorker available CPUs when amountOfWorkers is 0, never more workers than tasks
+void initializeWorkerPool(WorkerPool* pool, int amountOfWorkers, int cpusPerWorker, int amountOfTasks);
+
+// Returns once every task ran or the pool was stopped
+void runWorkerPool(WorkerPool* pool);
+
+// Share of the workers' time spent in tasks
+double getWorkerUtilization(const WorkerPool* pool);
+
+#endif //UTTT2_WORKER_POOL_H
@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <string.h>
+#include "bench.h"
+#include "../handle_turn.h"
+#include "../misc/timer.h"
+
+#define AMOUNT_OF_POSITIONS 50
+
+// Moves from the empty board as digit pairs of board and position (our notation), taken from self-play games
+const char* benchPositions[AMOUNT_OF_POSITIONS] = {
+        // Openings
+        "3664444888800002222111",
+        "6008888777755554444002",
+        "36622225555888",
+        "6001111222255557777333",
+        "1005555777700003333444",
+        "4441111333355557",
+        "6775555333311117",
+        "33311112",
+        "00077771111222244446",
+        "75522221",
+        "73344446666000088881",
+        "41144777755553333771",
+        "400443333555",
+        "81111555533337777444",
+        "488447777111",
+        // Middlegames, mostly with the move on any board
+        "3664444888800002222111155557777661177112255113311005533228866335",
+        "600888877775555444400222266333311113355771177442233000011006",
+        "366222255558888444400001111777766772211661188553333557",
+        "60011112222555577773333444488880033117755223366224",
+        "100555577770000333344448888222266663377335533113366886622881155665500446",
+        "444111133335555777766668888222211770000330044558844336655005566228811551",
+        "67755553333111177118888222244446644000055880033770066115577225511008",
+        "3331111222244448888666600007777555511773377445533556622552",
+        "0007777111122224444666688883333776655551177885533880",
+        "75522221111000066664444117788883333555533008855114400225588007",
+        "7334444666600008888111155553377775566771122225500113366887744338",
+        "4114477775555333377115588887733444866660000227722220033552255112266118855006622880",
+        "4004433335555777711117755110077006666336677332277662222887788112266444",
+        "8111155553333777744446666880000552222335511003344887711775577667788886622661188228",
+        "48844777711112222555533332211887700007722003355881155227",
+        "477333355551111777766663366553300006677001155225",
+        "7115555117777000033335522221188887722444466881",
+        "7113333117777222288884444000066667766115555116622332255770022443366330",
+        "88811113333444400007777112222337788226666880",
+        "2112277773333555577444488886666000011552",
+        // Endgames
+        "600888877775555444400222266333311113355771177442233000011006611220033441148118846553055007",
+        "600111122225555777733334444888800331177552233662244771155882211887700007744664866885088332",
+        "100555577770000333344448888222266663377335533113366886622881155665500446677664433002244220088761144111",
+        "444111133335555777766668888222211770000330044558844336655005566228811551144886244027788771",
+        "67755553333111177118888222244446644000055880033770066115577225511008811228844883388778864330077335",
+        "00077771111222244446666888833337766555511778855338800662255775544334477332233113300441100115211402",
+        "75522221111000066664444117788883333555533008855114400225588007777336600337700443344663388774310550018223542726",
+        "733444466660000888811115555337777556677112222550011336688774433882211448866220022442266110",
+        "4004433335555777711117755110077006666336677332277662222887788112266444477224455225540882233774",
+        "8111155553333777744446666880000552222335511003344887711775577667788886622661188228855006600112200224",
+        "48844777711112222555533332211887700007722003355881155227766665511773388886677880011661100444",
+        "4773333555511117777666633665533000066770011552255880088883388444488110022446644334400332200485166228",
+        "7115555117777000033335522221188887722444466881166226600110022331133773344775588448855665",
+        "21122777733335555774444888866660000115522447700668800883300443366337766113311667455332033810",
+        "622333355552222444488880000777711113366778811776611441155330033773344556600550088558833884400226755447722770"
+};
+
+
+void setUpPosition(Board* board, const char* moves) {
+    for (size_t i = 0; i + 1 < strlen(moves); i += 2) {
+        Square move = {moves[i] - '0', moves[i + 1] - '0'};
+        makePermanentMove(board, move);
+    }
+}
+
+
+void runBench(int simulationsPerPosition) {
+    long totalSimulations = 0;
+    long totalNodes = 0;
+    uint64_t signature = 0;
+    double startTime = getMonotonicTime();
+    for (int i = 0; i < AMOUNT_OF_POSITIONS; i++) {
+        Board* board = createBoard();
+        setUpPosition(board, benchPositions[i]);
+        int rootIndex = createMCTSRootNode(board);
+        SearchLimits limits = {0, simulationsPerPosition, 0, false};
+        totalSimulations += findNextMoveWithLimits(board, rootIndex, limits);
+        Square move = getMostPromisingMove(board, &board->nodes[rootIndex]);
+        totalNodes += board->currentNodeIndex;
+        // Any change to what the search does shows up in the tree sizes or the moves
+        signature = mix64(signature ^ ((uint64_t) board->currentNodeIndex << 16 | move.board << 8 | move.position));
+        freeBoard(board);
+    }
+    double elapsedTime = getMonotonicTime() - startTime;
+    printf("Positions: %d\n", AMOUNT_OF_POSITIONS);
+    printf("Simulations: %ld\n", totalSimulations);
+    printf("Tree nodes: %ld\n", totalNodes);
+    printf("Time: %.3fs\n", elapsedTime);
+    printf("Simulations per second: %.0f\n", totalSimulations / elapsedTime);
+    printf("Signature: %016llx\n", (unsigned long long) signature);
+}
@@ -0,0 +1,10 @@
+#ifndef UTTT2_BENCH_H
+#define UTTT2_BENCH_H
+
+#define DEFAULT_BENCH_SIMULATIONS 20000
+
+// Searches a fixed suite of positions for a fixed amount of simulations each. The signature only changes when the
+// search does, the simulations per second track throughput.
+void runBench(int simulationsPerPosition);
+
+#endif //UTTT2_BENCH_H
@@ -0,0 +1,260 @@
+#define _GNU_SOURCE  // rand_r
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <x86intrin.h>
+#include "../mcts/find_next_move.h"
+#include "../nn/forward.h"
+#include "../misc/timer.h"
+#include "../misc/util.h"
+#include "../misc/perf_counters.h"
+
+// Timing of the hot kernels on their own. Every kernel runs over the same inputs, sampled from fixed-simulation
+// self-play games, so a change to one kernel can be judged without the noise of a whole search.
+
+#define GAMES 40
+#define SIMULATIONS_PER_MOVE 300
+#define MAX_POSITIONS (GAMES * TOTAL_SMALL_SQUARES)
+#define MAX_PATHS 4096
+#define WARM_UP_REPETITIONS 20
+#define REPETITIONS 200
+
+typedef struct Inputs {
+    State positions[MAX_POSITIONS];
+    Square moves[MAX_POSITIONS];  // A legal move in each position
+    uint16_t smallBoards[MAX_POSITIONS];
+    int features[MAX_POSITIONS][4];
+    int amountOfPositions;
+    Board* tree;  // Search tree of one middlegame position, for the MCTS kernels
+    int nodeIndices[MAX_PATHS];  // Expanded nodes of the tree
+    int paths[MAX_PATHS][TOTAL_SMALL_SQUARES];  // Parent indices from a leaf up to the root, as selectLeaf gives them
+    int leafIndices[MAX_PATHS];
+    int amountOfPaths;
+    int amountOfNodeIndices;
+} Inputs;
+
+Inputs inputs;
+Board* board;
+Accumulator accumulator;
+PerfCounters perfCounters;
+bool hasHardwareCounters;
+volatile uint64_t sink;
+
+
+void sampleTree(const State* position) {
+    inputs.tree = createBoard();
+    inputs.tree->state = *position;
+    inputs.tree->stateCheckpoint = *position;
+    int rootIndex = createMCTSRootNode(inputs.tree);
+    SearchLimits limits = {0, 20000, 0, false};
+    findNextMoveWithLimits(inputs.tree, rootIndex, limits);
+    inputs.amountOfNodeIndices = 0;
+    for (int i = 0; i < inputs.tree->currentNodeIndex && inputs.amountOfNodeIndices < MAX_PATHS; i++) {
+        if (inputs.tree->nodes[i].numChildren > 0 && inputs.tree->nodes[i].sims > 0) {
+            inputs.nodeIndices[inputs.amountOfNodeIndices++] = i;
+        }
+    }
+    // The same descent as selectLeaf, which also changes the tree the way a search would
+    for (inputs.amountOfPaths = 0; inputs.amountOfPaths < MAX_PATHS; inputs.amountOfPaths++) {
+        int* path = inputs.paths[inputs.amountOfPaths];
+        int depth = 0;
+        int nodeIndex = rootIndex;
+        int reversed[TOTAL_SMALL_SQUARES];
+        while (inputs.tree->nodes[nodeIndex].numChildren > 0 && inputs.tree->nodes[nodeIndex].sims > 0) {
+            reversed[depth++] = nodeIndex;
+            nodeIndex = selectNextChild(inputs.tree, nodeIndex);
+            visitNode(nodeIndex, inputs.tree);
+        }
+        for (int i = 0; i < depth; i++) {
+            path[i] = reversed[depth - 1 - i];
+        }
+        path[depth] = -1;
+        inputs.leafIndices[inputs.amountOfPaths] = nodeIndex;
+        backpropagateEval(inputs.tree, &inputs.tree->nodes[nodeIndex], path);
+        revertToCheckpoint(inputs.tree);
+    }
+}
+
+
+void sampleInputs() {
+    inputs.amountOfPositions = 0;
+    unsigned int seed = 1;
+    for (int game = 0; game < GAMES; game++) {
+        Board* gameBoard = createBoard();
+        int rootIndex = createMCTSRootNode(gameBoard);
+        while (gameBoard->state.winner == NONE) {
+            Square moves[TOTAL_SMALL_SQUARES];
+            int8_t amountOfMoves = generateMoves(gameBoard, moves);
+            int i = inputs.amountOfPositions++;
+            inputs.positions[i] = gameBoard->state;
+            inputs.moves[i] = moves[rand_r(&seed) % amountOfMoves];
+            inputs.smallBoards[i] = extractSmallBoard(&gameBoard->state.player1 + gameBoard->state.currentPlayer,
+                                                      inputs.moves[i].board) | 1 << inputs.moves[i].position;
+            inputs.features[i][0] = inputs.moves[i].position + 99 + 9*inputs.moves[i].board;
+            inputs.features[i][1] = inputs.moves[i].position + 180;
+            inputs.features[i][2] = inputs.moves[i].board;
+            inputs.features[i][3] = inputs.moves[i].board + 90;
+            if (game == 0 && gameBoard->state.ply == 24) {
+                sampleTree(&gameBoard->state);
+            }
+            SearchLimits limits = {0, SIMULATIONS_PER_MOVE, 0, false};
+            findNextMoveWithLimits(gameBoard, rootIndex, limits);
+            Square move = getMostPromisingMove(gameBoard, &gameBoard->nodes[rootIndex]);
+            rootIndex = updateRoot(&gameBoard->nodes[rootIndex], gameBoard, move);
+            makePermanentMove(gameBoard, move);
+        }
+        freeBoard(gameBoard);
+    }
+}
+
+
+void runGenerateMoves(int amount) {
+    Square moves[TOTAL_SMALL_SQUARES];
+    for (int i = 0; i < amount; i++) {
+        board->state = inputs.positions[i];
+        sink += generateMoves(board, moves);
+    }
+}
+
+
+void runMakeTemporaryMove(int amount) {
+    for (int i = 0; i < amount; i++) {
+        board->state = inputs.positions[i];
+        makeTemporaryMove(board, inputs.moves[i]);
+        sink += board->state.currentBoard;
+    }
+}
+
+
+void runGetWinnerAfterMove(int amount) {
+    for (int i = 0; i < amount; i++) {
+        board->state = inputs.positions[i];
+        sink += getWinnerAfterMove(board, inputs.moves[i]);
+    }
+}
+
+
+void runIsWin(int amount) {
+    for (int i = 0; i < amount; i++) {
+        sink += isWin(inputs.smallBoards[i]);
+    }
+}
+
+
+void runExtractSmallBoard(int amount) {
+    for (int i = 0; i < amount; i++) {
+        sink += extractSmallBoard(&inputs.positions[i].player1, inputs.moves[i].board);
+    }
+}
+
+
+void runBoardToInput(int amount) {
+    for (int i = 0; i < amount; i++) {
+        board->state = inputs.positions[i];
+        boardToInput(board->network, board, &accumulator);
+        sink += accumulator.neurons[i % MAX_HIDDEN_NEURONS];
+    }
+}
+
+
+// Adds two features to a parent's accumulator and runs the rest of the network, as every child evaluation does
+void runEvalWithTwoFeatures(int amount) {
+    for (int i = 0; i < amount; i++) {
+        sink += (uint64_t) (1000 * neuralNetworkEvalWithFeatures(board->network, &accumulator, inputs.features[i], 2));
+    }
+}
+
+
+// Children that decide their small board also add its big board features
+void runEvalWithFourFeatures(int amount) {
+    for (int i = 0; i < amount; i++) {
+        sink += (uint64_t) (1000 * neuralNetworkEvalWithFeatures(board->network, &accumulator, inputs.features[i], 4));
+    }
+}
+
+
+void runSelectNextChild(int amount) {
+    for (int i = 0; i < amount; i++) {
+        sink += selectNextChild(inputs.tree, inputs.nodeIndices[i % inputs.amountOfNodeIndices]);
+    }
+}
+
+
+void runBackpropagateEval(int amount) {
+    for (int i = 0; i < amount; i++) {
+        int path = i % inputs.amountOfPaths;
+        backpropagateEval(inputs.tree, &inputs.tree->nodes[inputs.leafIndices[path]], inputs.paths[path]);
+    }
+}
+
+
+void runAllocateNodes(int amount) {
+    board->currentNodeIndex = 0;
+    for (int i = 0; i < amount; i++) {
+        sink += allocateNodes(board, 1 + i % TOTAL_SMALL_SQUARES);
+    }
+}
+
+
+int compareCycles(const void* a, const void* b) {
+    double difference = *(const double*) a - *(const double*) b;
+    return (difference > 0) - (difference < 0);
+}
+
+
+void measure(const char* name, void (*kernel)(int), int amount) {
+    double cycles[REPETITIONS];
+    for (int i = 0; i < WARM_UP_REPETITIONS; i++) {
+        kernel(amount);
+    }
+    startPerfMeasurement(&perfCounters);
+    for (int i = 0; i < REPETITIONS; i++) {
+        uint64_t start = __rdtsc();
+        kernel(amount);
+        cycles[i] = (double) (__rdtsc() - start) / amount;
+    }
+    stopPerfMeasurement(&perfCounters);
+    qsort(cycles, REPETITIONS, sizeof(double), compareCycles);
+    double median = cycles[REPETITIONS / 2];
+    printf("%-36s %9.1f %9.1f %9.1f %9.1f %9.2f\n", name, median, cycles[REPETITIONS / 10],
+           cycles[REPETITIONS * 9 / 10], cycles[REPETITIONS * 99 / 100], 1e9 * median / getTimestampCounterFrequency());
+    if (hasHardwareCounters) {
+        printf("    ");
+        printPerfDeltas(stdout, &perfCounters, perfCounters.last, (double) REPETITIONS * amount);
+    }
+}
+
+
+int main() {
+#ifndef __OPTIMIZE__
+    printf("Warning: built without optimizations\n");
+#endif
+    hasHardwareCounters = openPerfCounters(&perfCounters);
+    if (!hasHardwareCounters) {
+        printf("Hardware performance counters are not available, only timing kernels\n");
+    }
+    sampleInputs();
+    board = createBoard();
+    board->state = inputs.positions[inputs.amountOfPositions / 2];
+    boardToInput(board->network, board, &accumulator);
+    int amount = inputs.amountOfPositions;
+    printf("%d positions from %d games, %d tree nodes, %d paths\n", amount, GAMES, inputs.amountOfNodeIndices,
+           inputs.amountOfPaths);
+    printf("%-36s %9s %9s %9s %9s %9s\n", "Time stamp counter cycles per call", "median", "p10", "p90", "p99",
+           "ns");
+    measure("generateMoves", runGenerateMoves, amount);
+    measure("makeTemporaryMove", runMakeTemporaryMove, amount);
+    measure("getWinnerAfterMove", runGetWinnerAfterMove, amount);
+    measure("isWin", runIsWin, amount);
+    measure("extractSmallBoard", runExtractSmallBoard, amount);
+    measure("boardToInput", runBoardToInput, amount);
+    measure("neuralNetworkEvalWithFeatures (2)", runEvalWithTwoFeatures, amount);
+    measure("neuralNetworkEvalWithFeatures (4)", runEvalWithFourFeatures, amount);
+    measure("selectNextChild", runSelectNextChild, amount);
+    measure("backpropagateEval", runBackpropagateEval, amount);
+    measure("allocateNodes", runAllocateNodes, amount);
+    printf("(checksum %llu)\n", (unsigned long long) sink);
+    freeBoard(board);
+    freeBoard(inputs.tree);
+    closePerfCounters(&perfCounters);
+}
@@ -1,7 +1,10 @@
 #include <assert.h>
 #include "board.h"
 #include "../mcts/mcts_node.h"
+#include "../nn/network.h"
 #include "../misc/util.h"
+#include "../misc/instrumentation.h"
+#include "../misc/trace.h"
 
 
 Winner calculateWinner(uint16_t player1BigBoard, uint16_t player2BigBoard, Player currentPlayer) {
@@ -38,7 +41,12 @@ Board* createBoard() {
     board->stateCheckpoint = board->state;
     board->nodes = safeMalloc(NUM_NODES * sizeof(MCTSNode));
     board->currentNodeIndex = 0;
+    board->nodeHighWaterMark = 0;
     board->me = PLAYER2;
+    board->network = &defaultNetwork;
+    board->fastNetwork = NULL;
+    board->evalCache = NULL;
+    board->usePUCT = false;
     return board;
 }
 
@@ -49,13 +57,39 @@ void freeBoard(Board* board) {
 }
 
 
+void resetBoard(Board* board) {
+    initializePlayerBitBoard(&board->state.player1);
+    initializePlayerBitBoard(&board->state.player2);
+    board->state.currentPlayer = PLAYER1;
+    board->state.currentBoard = ANY_BOARD;
+    board->state.winner = NONE;
+    board->state.ply = 0;
+    board->stateCheckpoint = board->state;
+    board->currentNodeIndex = 0;
+    board->nodeHighWaterMark = 0;
+    board->me = PLAYER2;
+}
+
+
 int allocateNodes(Board* board, uint8_t amount) {
     int result = (amount > NUM_NODES - board->currentNodeIndex)? 0 : board->currentNodeIndex;
+    COUNT(nodesAllocated, amount);
+    COUNT(nodePoolWraps, result == 0 && board->currentNodeIndex != 0);
+    if (result == 0 && board->currentNodeIndex != 0) {
+        traceInstant("node pool wrap", "nodes", board->currentNodeIndex);
+        board->nodeHighWaterMark = board->currentNodeIndex > board->nodeHighWaterMark
+                                   ? board->currentNodeIndex : board->nodeHighWaterMark;
+    }
     board->currentNodeIndex = result + amount;
     return result;
 }
 
 
+int getNodePoolSize() {
+    return NUM_NODES;
+}
+
+
 uint16_t extractCombinedSmallBoard(Board* board, uint8_t boardIndex) {
     return extractSmallBoard(&board->state.player1, boardIndex) | extractSmallBoard(&board->state.player2, boardIndex);
 }
@@ -98,6 +132,19 @@ int8_t generateMoves(Board* board, Square moves[TOTAL_SMALL_SQUARES]) {
 }
 
 
+// Only for moves from outside the search, like those of other programs
+bool isLegalMove(Board* board, Square square) {
+    Square moves[TOTAL_SMALL_SQUARES];
+    int8_t amountOfMoves = generateMoves(board, moves);
+    for (int i = 0; i < amountOfMoves; i++) {
+        if (squaresAreEqual(moves[i], square)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
 uint8_t getNextBoard(Board* board, uint8_t previousPosition) {
     bool smallBoardIsDecided = BIT_CHECK(board->state.player1.bigBoard | board->state.player2.bigBoard, previousPosition);
     return smallBoardIsDecided ? ANY_BOARD : previousPosition;
@@ -148,3 +195,25 @@ Winner getWinnerAfterMove(Board* board, Square square) {
     board->state = tempCheckpoint;
     return winner;
 }
+
+
+// splitmix64 finalizer
+uint64_t mix64(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+
+// The marks and the current board determine the whole State: the big boards, current player, winner and ply all
+// follow from the marks.
+uint64_t hashPosition(__uint128_t player1Marks, __uint128_t player2Marks, uint8_t currentBoard) {
+    uint64_t highBits = (uint64_t) (player1Marks >> 64) | (uint64_t) (player2Marks >> 64) << 17
+                        | (uint64_t) currentBoard << 34;
+    return mix64((uint64_t) player1Marks ^ mix64((uint64_t) player2Marks ^ mix64(highBits)));
+}
+
+
+uint64_t hashState(const State* state) {
+    return hashPosition(state->player1.marks, state->player2.marks, state->currentBoard);
+}
@@ -19,22 +19,38 @@ typedef struct State {
 
 typedef struct MCTSNode MCTSNode;
 
+typedef struct Network Network;
+
+typedef struct EvalCache EvalCache;
+
 typedef struct Board {
     State state;
     State stateCheckpoint;
     MCTSNode* nodes;
     int currentNodeIndex;
+    int nodeHighWaterMark;  // Highest currentNodeIndex before the node pool last started over
     Player me;
+    const Network* network;
+    const Network* fastNetwork;  // Scores new children until they are first visited, NULL to always use network
+    EvalCache* evalCache;
+    bool usePUCT;  // Select children by policy priors, needs a network with a policy head
 } Board;
 
 Board* createBoard();
 
 void freeBoard(Board* board);
 
+// Starts a new game on the same node memory, keeps the networks and search settings
+void resetBoard(Board* board);
+
 int allocateNodes(Board* board, uint8_t amount);
 
+int getNodePoolSize();
+
 int8_t generateMoves(Board* board, Square moves[TOTAL_SMALL_SQUARES]);
 
+bool isLegalMove(Board* board, Square square);
+
 uint8_t getNextBoard(Board* board, uint8_t previousPosition);
 
 bool nextBoardIsEmpty(Board* board);
@@ -49,4 +65,10 @@ void makePermanentMove(Board* board, Square square);
 
 Winner getWinnerAfterMove(Board* board, Square square);
 
+uint64_t mix64(uint64_t x);
+
+uint64_t hashPosition(__uint128_t player1Marks, __uint128_t player2Marks, uint8_t currentBoard);
+
+uint64_t hashState(const State* state);
+
 #endif //UTTT2_BOARD_H
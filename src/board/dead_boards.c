@@ -0,0 +1,74 @@
+#include "dead_boards.h"
+
+#define SMALL_BOARD_STATES 19683
+
+uint16_t base3Digits[512];
+uint8_t winnability[SMALL_BOARD_STATES];
+
+
+// Runs before main, so the tables are ready for every thread without locking
+__attribute__((constructor)) void initializeDeadBoardTables() {
+    for (int smallBoard = 0; smallBoard < 512; smallBoard++) {
+        int value = 0;
+        for (int i = 8; i >= 0; i--) {
+            value = 3*value + ((smallBoard >> i) & 1);
+        }
+        base3Digits[smallBoard] = value;
+    }
+    for (int player1SmallBoard = 0; player1SmallBoard < 512; player1SmallBoard++) {
+        for (int player2SmallBoard = 0; player2SmallBoard < 512; player2SmallBoard++) {
+            if (player1SmallBoard & player2SmallBoard) {
+                continue;
+            }
+            // A line is still possible for a player if none of its squares belong to the other player
+            uint8_t result = 0;
+            if (isWin(~player2SmallBoard & 511)) {
+                result |= WINNABLE_BY_P1;
+            }
+            if (isWin(~player1SmallBoard & 511)) {
+                result |= WINNABLE_BY_P2;
+            }
+            winnability[base3Digits[player1SmallBoard] + 2*base3Digits[player2SmallBoard]] = result;
+        }
+    }
+}
+
+
+uint8_t getSmallBoardWinnability(uint16_t player1SmallBoard, uint16_t player2SmallBoard) {
+    return winnability[base3Digits[player1SmallBoard] + 2*base3Digits[player2SmallBoard]];
+}
+
+
+Winner getForcedWinner(const State* state) {
+    uint16_t decided = state->player1.bigBoard | state->player2.bigBoard;
+    uint16_t player1Won = state->player1.bigBoard & ~state->player2.bigBoard;
+    uint16_t player2Won = state->player2.bigBoard & ~state->player1.bigBoard;
+    uint16_t winnableByPlayer1 = 0;
+    uint16_t winnableByPlayer2 = 0;
+    uint16_t undecided = ~decided & 511;
+    while (undecided) {
+        int boardIndex = __builtin_ffs(undecided) - 1;
+        uint16_t player1SmallBoard = (uint16_t) (state->player1.marks >> (9*boardIndex)) & 511;
+        uint16_t player2SmallBoard = (uint16_t) (state->player2.marks >> (9*boardIndex)) & 511;
+        uint8_t boardWinnability = getSmallBoardWinnability(player1SmallBoard, player2SmallBoard);
+        winnableByPlayer1 |= (boardWinnability & WINNABLE_BY_P1) << boardIndex;
+        winnableByPlayer2 |= ((boardWinnability & WINNABLE_BY_P2) >> 1) << boardIndex;
+        undecided &= undecided - 1;
+    }
+    if (isWin(player1Won | winnableByPlayer1) || isWin(player2Won | winnableByPlayer2)) {
+        return NONE;
+    }
+    // Without a line the game goes to whoever wins more small boards once all of them are decided
+    int player1Boards = __builtin_popcount(player1Won);
+    int player2Boards = __builtin_popcount(player2Won);
+    if (player1Boards > player2Boards + __builtin_popcount(winnableByPlayer2)) {
+        return WIN_P1;
+    }
+    if (player2Boards > player1Boards + __builtin_popcount(winnableByPlayer1)) {
+        return WIN_P2;
+    }
+    if ((winnableByPlayer1 | winnableByPlayer2) == 0) {
+        return player1Boards == player2Boards? DRAW : player1Boards > player2Boards? WIN_P1 : WIN_P2;
+    }
+    return NONE;
+}
@@ -0,0 +1,19 @@
+#ifndef UTTT2_DEAD_BOARDS_H
+#define UTTT2_DEAD_BOARDS_H
+
+#include <stdint.h>
+#include "board.h"
+
+#define WINNABLE_BY_P1 1
+#define WINNABLE_BY_P2 2
+
+// Whether each player can still complete a line on a small board, from a 3^9 table of all small board states. A board
+// nobody can win anymore is dead: it still has to be filled and routes moves as usual, but it ends up drawn.
+uint8_t getSmallBoardWinnability(uint16_t player1SmallBoard, uint16_t player2SmallBoard);
+
+// The result of the game if it is already decided however both players continue, NONE otherwise. The game is decided
+// when neither player can complete a line of small boards anymore and the boards still winnable can't change who
+// wins more boards. Only meant for search and adjudication, the state itself keeps following the real rules.
+Winner getForcedWinner(const State* state);
+
+#endif //UTTT2_DEAD_BOARDS_H
@@ -0,0 +1,129 @@
+#include <stddef.h>
+#include "symmetry.h"
+
+uint8_t indexTransforms[SYMMETRIES][9];
+uint16_t smallBoardTransforms[SYMMETRIES][512];
+int inverseTransforms[SYMMETRIES];
+
+
+uint8_t computeTransformedIndex(uint8_t index, int transform) {
+    int row = index / 3;
+    int column = index % 3;
+    for (int i = 0; i < transform % 4; i++) {
+        int rotatedRow = column;
+        column = 2 - row;
+        row = rotatedRow;
+    }
+    if (transform >= 4) {
+        column = 2 - column;
+    }
+    return 3*row + column;
+}
+
+
+// Runs before main, so the tables are ready for every thread without locking
+__attribute__((constructor)) void initializeSymmetryTables() {
+    for (int transform = 0; transform < SYMMETRIES; transform++) {
+        for (uint8_t i = 0; i < 9; i++) {
+            indexTransforms[transform][i] = computeTransformedIndex(i, transform);
+        }
+        for (int smallBoard = 0; smallBoard < 512; smallBoard++) {
+            uint16_t transformed = 0;
+            for (int i = 0; i < 9; i++) {
+                if (smallBoard & (1 << i)) {
+                    transformed |= 1 << indexTransforms[transform][i];
+                }
+            }
+            smallBoardTransforms[transform][smallBoard] = transformed;
+        }
+    }
+    for (int transform = 0; transform < SYMMETRIES; transform++) {
+        for (int inverse = 0; inverse < SYMMETRIES; inverse++) {
+            bool isInverse = true;
+            for (uint8_t i = 0; i < 9; i++) {
+                isInverse &= indexTransforms[inverse][indexTransforms[transform][i]] == i;
+            }
+            if (isInverse) {
+                inverseTransforms[transform] = inverse;
+            }
+        }
+    }
+}
+
+
+int inverseTransform(int transform) {
+    return inverseTransforms[transform];
+}
+
+
+uint8_t transformIndex(uint8_t index, int transform) {
+    return index == ANY_BOARD? ANY_BOARD : indexTransforms[transform][index];
+}
+
+
+Square transformSquare(Square square, int transform) {
+    Square result = {indexTransforms[transform][square.board], indexTransforms[transform][square.position]};
+    return result;
+}
+
+
+uint16_t transformSmallBoard(uint16_t smallBoard, int transform) {
+    return smallBoardTransforms[transform][smallBoard];
+}
+
+
+__uint128_t transformMarks(__uint128_t marks, int transform) {
+    const uint16_t* table = smallBoardTransforms[transform];
+    const uint8_t* indices = indexTransforms[transform];
+    __uint128_t result = 0;
+    for (int i = 0; i < 9; i++) {
+        uint16_t smallBoard = (uint16_t) (marks >> (9*i)) & 511;
+        result |= (__uint128_t) table[smallBoard] << (9*indices[i]);
+    }
+    return result;
+}
+
+
+PlayerBitBoard transformPlayerBitBoard(const PlayerBitBoard* playerBitBoard, int transform) {
+    PlayerBitBoard result;
+    result.marks = transformMarks(playerBitBoard->marks, transform);
+    result.bigBoard = smallBoardTransforms[transform][playerBitBoard->bigBoard];
+    return result;
+}
+
+
+State transformState(const State* state, int transform) {
+    State result = *state;
+    result.player1 = transformPlayerBitBoard(&state->player1, transform);
+    result.player2 = transformPlayerBitBoard(&state->player2, transform);
+    result.currentBoard = transformIndex(state->currentBoard, transform);
+    return result;
+}
+
+
+// The big boards follow from the marks, so comparing marks and the current board orders positions completely
+uint64_t canonicalKey(const State* state, int* transform) {
+    __uint128_t bestPlayer1Marks = state->player1.marks;
+    __uint128_t bestPlayer2Marks = state->player2.marks;
+    uint8_t bestCurrentBoard = state->currentBoard;
+    int bestTransform = IDENTITY_TRANSFORM;
+    for (int t = 1; t < SYMMETRIES; t++) {
+        __uint128_t player1Marks = transformMarks(state->player1.marks, t);
+        if (player1Marks > bestPlayer1Marks) {
+            continue;
+        }
+        __uint128_t player2Marks = transformMarks(state->player2.marks, t);
+        uint8_t currentBoard = transformIndex(state->currentBoard, t);
+        if (player1Marks < bestPlayer1Marks || player2Marks < bestPlayer2Marks
+            || (player2Marks == bestPlayer2Marks && currentBoard < bestCurrentBoard)) {
+            bestPlayer1Marks = player1Marks;
+            bestPlayer2Marks = player2Marks;
+            bestCurrentBoard = currentBoard;
+            bestTransform = t;
+        }
+    }
+    if (transform != NULL) {
+        *transform = bestTransform;
+    }
+    return hashPosition(bestPlayer1Marks, bestPlayer2Marks, bestCurrentBoard);
+}
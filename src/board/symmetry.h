@@ -0,0 +1,29 @@
+#ifndef UTTT2_SYMMETRY_H
+#define UTTT2_SYMMETRY_H
+
+#include <stdint.h>
+#include "board.h"
+
+// The 8 symmetries of the square: transform t rotates by (t % 4) quarter turns, then mirrors left-right if t >= 4.
+// A transform moves the small boards on the big board and the squares within every small board the same way, so it
+// maps legal moves, wins and draws onto legal moves, wins and draws.
+#define SYMMETRIES 8
+#define IDENTITY_TRANSFORM 0
+
+int inverseTransform(int transform);
+
+uint8_t transformIndex(uint8_t index, int transform);
+
+Square transformSquare(Square square, int transform);
+
+uint16_t transformSmallBoard(uint16_t smallBoard, int transform);
+
+PlayerBitBoard transformPlayerBitBoard(const PlayerBitBoard* playerBitBoard, int transform);
+
+State transformState(const State* state, int transform);
+
+// Hash of the smallest of the 8 transformed positions, equal for all symmetric positions. `transform` is set to the
+// transform that produces that position from `state`, unless it is NULL.
+uint64_t canonicalKey(const State* state, int* transform);
+
+#endif //UTTT2_SYMMETRY_H
@@ -14,14 +14,32 @@ int handleEnemyTurn(Board* board, int rootIndex, Square enemyMove) {
 }
 
 
-HandleTurnResult handleTurn(Board* board, int rootIndex, double allocatedTime, Square enemyMove) {
-    rootIndex = handleEnemyTurn(board, rootIndex, enemyMove);
+HandleTurnResult playMostPromisingMove(Board* board, int rootIndex, int amountOfSimulations) {
     MCTSNode* root = &board->nodes[rootIndex];
-    double time = board->state.ply <= 1? 10*allocatedTime : allocatedTime;
-    int amountOfSimulations = findNextMove(board, rootIndex, time);
     Square move = getMostPromisingMove(board, root);
     int newRootIndex = updateRoot(root, board, move);
     makePermanentMove(board, move);
-    HandleTurnResult result = {move, newRootIndex, amountOfSimulations};
+    HandleTurnResult result = {move, newRootIndex, amountOfSimulations, rootIndex};
     return result;
 }
+
+
+HandleTurnResult handleTurnWithTimeManager(Board* board, int rootIndex, TimeManager* timeManager, Square enemyMove) {
+    rootIndex = handleEnemyTurn(board, rootIndex, enemyMove);
+    int amountOfSimulations = findNextMoveWithTimeManager(board, rootIndex, timeManager);
+    return playMostPromisingMove(board, rootIndex, amountOfSimulations);
+}
+
+
+HandleTurnResult handleTurnWithLimits(Board* board, int rootIndex, SearchLimits limits, Square enemyMove) {
+    rootIndex = handleEnemyTurn(board, rootIndex, enemyMove);
+    int amountOfSimulations = findNextMoveWithLimits(board, rootIndex, limits);
+    return playMostPromisingMove(board, rootIndex, amountOfSimulations);
+}
+
+
+HandleTurnResult handleTurn(Board* board, int rootIndex, double allocatedTime, Square enemyMove) {
+    TimeManager timeManager;
+    initializeTimeManager(&timeManager, allocatedTime, 0, false);
+    return handleTurnWithTimeManager(board, rootIndex, &timeManager, enemyMove);
+}
@@ -7,8 +7,13 @@ typedef struct HandleTurnResult {
     Square move;
     int newRootIndex;
     int amountOfSimulations;
+    int searchRootIndex;  // The root the search ran from, its tree is still intact until the next search
 } HandleTurnResult;
 
+HandleTurnResult handleTurnWithTimeManager(Board* board, int rootIndex, TimeManager* timeManager, Square enemyMove);
+
+HandleTurnResult handleTurnWithLimits(Board* board, int rootIndex, SearchLimits limits, Square enemyMove);
+
 HandleTurnResult handleTurn(Board* board, int rootIndex, double allocatedTime, Square enemyMove);
 
 #endif //UTTT2_HANDLE_TURN_H
@@ -1,8 +1,15 @@
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "../test/tests_main.h"
-#include "main.h"
+#include "handle_turn.h"
 #include "misc/util.h"
+#include "misc/instrumentation.h"
+#include "misc/timer.h"
 #include "arena/arena.h"
+#include "mcts/ponder.h"
+#include "bench/bench.h"
+#include "mcts/tree_stats.h"
 
 
 void skipMovesInput(FILE* file) {
@@ -25,32 +32,34 @@ void printMove(MCTSNode* root, Square bestMove, int amountOfSimulations) {
     fflush(stdout);
 }
 
-int numMovesPlayed = 0;
-int numSims = 0;
 
-Square playTurn(Board* board, int* rootIndex, double allocatedTime, Square enemyMove) {
-    HandleTurnResult result = handleTurn(board, *rootIndex, allocatedTime, enemyMove);
-    /*
-    numSims += result.amountOfSimulations;
-    if (++numMovesPlayed % 300 == 0) {
-        printf("Sims: %f\n", numSims / 300.0);
-        numMovesPlayed = 0;
-        numSims = 0;
-        exit(0);
+// With SEARCH_INSTRUMENTATION or PRINT_TREE_STATS every move also prints lines of JSON to stderr. Walking the whole
+// tree takes a few milliseconds of the move's time on a full node pool.
+#define PRINT_TREE_STATS false
+void printMoveStats(Board* board, HandleTurnResult result) {
+    printSearchCounters(stderr);
+    if (PRINT_TREE_STATS) {
+        TreeStats stats;
+        computeTreeStats(board, result.searchRootIndex, &stats);
+        stats.reusedNodes = countReachableNodes(board, result.newRootIndex);
+        printTreeStats(stderr, &stats);
     }
-    */
-    *rootIndex = result.newRootIndex;
-    return result.move;
 }
 
 
-void playGame(FILE* file, double timePerMove) {
+void playGame(FILE* file, double timePerMove, bool ponder) {
+    // Calibrates while waiting for the first input instead of during the first move
+    getTimestampCounterFrequency();
     Board* board = createBoard();
     int rootIndex = createMCTSRootNode(board);
+    Ponder ponderer;
+    bool pondering = false;
     while (true) {
         int enemy_row;
         int enemy_col;
         int v = fscanf(file, "%d%d", &enemy_row, &enemy_col);  // NOLINT(cert-err34-c)
+        int amountOfPonderSimulations = pondering? stopPondering(&ponderer) : 0;
+        pondering = false;
         if (v == EOF) {
             break;
         }
@@ -58,16 +67,35 @@ void playGame(FILE* file, double timePerMove) {
         Square enemyMoveGameNotation = {enemy_row, enemy_col};
         Square enemyMove = toOurNotation(enemyMoveGameNotation);
         HandleTurnResult result = handleTurn(board, rootIndex, timePerMove, enemyMove);
+        printMoveStats(board, result);
         rootIndex = result.newRootIndex;
-        printMove(&board->nodes[rootIndex], result.move, result.amountOfSimulations);
+        printMove(&board->nodes[rootIndex], result.move, result.amountOfSimulations + amountOfPonderSimulations);
+        if (ponder && board->state.winner == NONE) {
+            startPondering(&ponderer, board, rootIndex);
+            pondering = true;
+        }
     }
     freeBoard(board);
 }
 
 
 #define TIME 0.0999
-int main() {
+int main(int argc, char** argv) {
+    if (argc >= 2 && strcmp(argv[1], "bench") == 0) {
+        runBench(argc >= 3? atoi(argv[2]) : DEFAULT_BENCH_SIMULATIONS);  // NOLINT(cert-err34-c)
+        return 0;
+    }
+    // Speaks the CodinGame protocol on stdin and stdout, for example as a process engine in the arena
+    if (argc >= 2 && strcmp(argv[1], "play") == 0) {
+        double timePerMove = argc >= 3? atof(argv[2]) : TIME;  // NOLINT(cert-err34-c)
+        playGame(stdin, timePerMove, argc >= 4 && strcmp(argv[3], "ponder") == 0);
+        return 0;
+    }
+    if (argc >= 2 && strcmp(argv[1], "tournament") == 0) {
+        runTournament();
+        return 0;
+    }
     // runTests();
     runArena();
-    // playGame(stdin, TIME);
+    // playGame(stdin, TIME, true);
 }
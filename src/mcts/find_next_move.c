@@ -1,6 +1,12 @@
-#include <sys/time.h>
+#include <assert.h>
+#include <limits.h>
+#include <math.h>
 #include "find_next_move.h"
 #include "../misc/util.h"
+#include "../misc/timer.h"
+#include "../misc/instrumentation.h"
+#include "../misc/trace.h"
+#include "../board/dead_boards.h"
 
 
 int selectLeaf(Board* board, int rootIndex, int* parentIndices, int* i) {
@@ -9,38 +15,103 @@ int selectLeaf(Board* board, int rootIndex, int* parentIndices, int* i) {
     int currentNodeIndex = rootIndex;
     while (!isLeafNode(currentNodeIndex, board) && board->state.winner == NONE) {
         parentIndices[(*i)--] = currentNodeIndex;
+        START_PHASE(start);
         currentNodeIndex = selectNextChild(board, currentNodeIndex);
+        END_PHASE(start, PHASE_SELECTION);
         visitNode(currentNodeIndex, board);
     }
     return currentNodeIndex;
 }
 
 
-bool hasTimeRemaining(struct timeval start, double allocatedTime) {
-    struct timeval end;
-    gettimeofday(&end, NULL);
-    double timePassed = (double) (end.tv_usec - start.tv_usec) / 1000000 + (double) (end.tv_sec - start.tv_sec);
-    return timePassed < allocatedTime;
+void runSimulation(Board* board, int rootIndex) {
+    int parentIndicesArray[TOTAL_SMALL_SQUARES];
+    int i;
+    int leafIndex = selectLeaf(board, rootIndex, parentIndicesArray, &i);
+    int* parentIndices = &parentIndicesArray[i + 1];
+    COUNT(simulations, 1);
+    COUNT(selectionDepth, TOTAL_SMALL_SQUARES - 2 - i);
+    COUNT_MAX(maxSelectionDepth, (uint64_t) (TOTAL_SMALL_SQUARES - 2 - i));
+    Winner winner = board->state.winner;
+    if (winner == NONE && leafIndex != rootIndex) {
+        // Decided positions are terminal for the search, but the root still needs moves to choose from
+        winner = getForcedWinner(&board->state);
+    }
+    Player player = OTHER_PLAYER(board->state.currentPlayer);
+    if (winner == NONE) {
+        if (leafIndex == rootIndex && board->nodes[rootIndex].numChildren == -2) {
+            // A child scored by the fast network can become the root through updateRoot. Its first visit would only
+            // replace the eval, which leaves a root without moves to choose from after a single simulation.
+            board->nodes[rootIndex].numChildren = -1;
+        }
+        START_PHASE(expansionStart);
+        MCTSNode* leaf = expandLeaf(leafIndex, board);
+        END_PHASE(expansionStart, PHASE_EXPANSION);
+        START_PHASE(backpropagationStart);
+        backpropagateEval(board, leaf, parentIndices);
+        END_PHASE(backpropagationStart, PHASE_BACKPROPAGATION);
+    } else {
+        COUNT(terminalHits, 1);
+        START_PHASE(backpropagationStart);
+        backpropagate(board, leafIndex, winner, player, parentIndices);
+        END_PHASE(backpropagationStart, PHASE_BACKPROPAGATION);
+    }
+    START_PHASE(revertStart);
+    revertToCheckpoint(board);
+    END_PHASE(revertStart, PHASE_REVERT);
+}
+
+
+// The limits are checked every simulation, so the search overruns its deadline by at most one simulation and its
+// node limit by at most one expansion. The root always gets at least one simulation, so it has children to choose
+// from.
+int findNextMoveWithLimits(Board* board, int rootIndex, SearchLimits limits) {
+    assert((limits.time > 0 || limits.simulations > 0 || limits.nodes > 0) && "findNextMoveWithLimits: no limits");
+    int amountOfSimulations = 0;
+    int firstNodeIndex = board->currentNodeIndex;
+    int maxSimulations = limits.simulations > 0? limits.simulations : INT_MAX;
+    int maxNodes = limits.nodes > 0? limits.nodes : INT_MAX;
+    uint64_t traceStart = startTraceSpan();
+    Deadline deadline;
+    startDeadlineWithClock(&deadline, limits.time > 0? limits.time : INFINITY, limits.threadCpuTime);
+    bool reachedLimit;
+    do {
+        runSimulation(board, rootIndex);
+        amountOfSimulations++;
+        // The node pool starting over at index 0 counts as running out of nodes
+        int allocatedNodes = board->currentNodeIndex - firstNodeIndex;
+        reachedLimit = amountOfSimulations >= maxSimulations || allocatedNodes >= maxNodes || allocatedNodes < 0;
+    } while (!reachedLimit && !deadlineExpired(&deadline));
+    stopDeadline(&deadline);
+    endTraceSpan("search", traceStart, "simulations", amountOfSimulations);
+    return amountOfSimulations;
 }
 
 
 int findNextMove(Board* board, int rootIndex, double allocatedTime) {
+    SearchLimits limits = {allocatedTime, 0, 0, false};
+    return findNextMoveWithLimits(board, rootIndex, limits);
+}
+
+
+// The deadline enforces the hard limit of the time manager, its other decisions only need a look at the root every
+// so often
+#define TIME_MANAGER_CHECK_INTERVAL 512
+int findNextMoveWithTimeManager(Board* board, int rootIndex, TimeManager* timeManager) {
     int amountOfSimulations = 0;
-    struct timeval start;
-    gettimeofday(&start, NULL);
-    while (++amountOfSimulations % 512 != 0 || hasTimeRemaining(start, allocatedTime)) {
-        int parentIndicesArray[TOTAL_SMALL_SQUARES];
-        int i;
-        int leafIndex = selectLeaf(board, rootIndex, parentIndicesArray, &i);
-        int* parentIndices = &parentIndicesArray[i + 1];
-        Winner winner = board->state.winner;
-        Player player = OTHER_PLAYER(board->state.currentPlayer);
-        if (winner == NONE) {
-            backpropagateEval(board, expandLeaf(leafIndex, board), parentIndices);
-        } else {
-            backpropagate(board, leafIndex, winner, player, parentIndices);
-        }
-        revertToCheckpoint(board);
-    }
+    // The first deadline of a process calibrates the time stamp counter, which mustn't count against the move
+    getTimestampCounterFrequency();
+    startMove(timeManager, &board->state);
+    uint64_t traceStart = startTraceSpan();
+    Deadline deadline;
+    startDeadlineWithClock(&deadline, timeManager->maximumTime, timeManager->threadCpuTime);
+    do {
+        runSimulation(board, rootIndex);
+        amountOfSimulations++;
+    } while (!deadlineExpired(&deadline) && (amountOfSimulations % TIME_MANAGER_CHECK_INTERVAL != 0
+                                             || !shouldStopSearch(timeManager, board, rootIndex, amountOfSimulations)));
+    stopDeadline(&deadline);
+    endTraceSpan("search", traceStart, "simulations", amountOfSimulations);
+    finishMove(timeManager);
     return amountOfSimulations;
 }
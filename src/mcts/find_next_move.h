@@ -3,7 +3,23 @@
 
 #include "../board/board.h"
 #include "mcts_node.h"
+#include "time_manager.h"
+
+// Zero means no limit. Searches without a time limit are deterministic: the same board and tree always grow into the
+// same tree, so results can be compared exactly between runs and builds.
+typedef struct SearchLimits {
+    double time;
+    int simulations;
+    int nodes;  // Nodes allocated from the pool during this search
+    bool threadCpuTime;  // Measure the time limit in CPU time of the searching thread instead of wall time
+} SearchLimits;
+
+void runSimulation(Board* board, int rootIndex);
+
+int findNextMoveWithLimits(Board* board, int rootIndex, SearchLimits limits);
 
 int findNextMove(Board* board, int rootIndex, double allocatedTime);
 
+int findNextMoveWithTimeManager(Board* board, int rootIndex, TimeManager* timeManager);
+
 #endif //UTTT2_FIND_NEXT_MOVE_H
@@ -1,10 +1,12 @@
 #include <assert.h>
+#include <math.h>
 #include <string.h>
 #include <immintrin.h>
-#include <stdalign.h>
 #include "mcts_node.h"
 #include "../misc/util.h"
+#include "../misc/instrumentation.h"
 #include "../nn/forward.h"
+#include "../nn/eval_cache.h"
 
 
 int createMCTSRootNode(Board* board) {
@@ -17,6 +19,7 @@ int createMCTSRootNode(Board* board) {
     root->square.board = 9;
     root->square.position = 9;
     root->numChildren = -1;
+    root->prior = 0;
     return rootIndex;
 }
 
@@ -28,6 +31,42 @@ void initializeMCTSNode(Square square, float eval, MCTSNode* node) {
     node->sims = 0.0f;
     node->square = square;
     node->numChildren = -1;
+    node->prior = 0;
+}
+
+
+// Child evals in initializeChildNodes only add a few features to the parent's accumulator, which is cheaper than a
+// cache probe, so only full evaluations go through the cache
+float probeCachedEval(Board* board) {
+    EvalCache* cache = board->evalCache;
+    if (cache == NULL) {
+        return neuralNetworkEval(board->network, board);
+    }
+    if (cache->network != board->network) {
+        clearEvalCache(cache, board->network);
+    }
+    uint64_t hash = hashState(&board->state);
+    int32_t cachedOutput;
+    bool hit = probeEvalCache(cache, hash, &cachedOutput);
+    if (hit && !cache->verify) {
+        return outputToEval(board->network, cachedOutput);
+    }
+    int32_t output = neuralNetworkOutput(board->network, board);
+    if (!hit) {
+        storeEvalCache(cache, hash, output);
+    } else if (outputToEval(board->network, cachedOutput) != outputToEval(board->network, output)) {
+        cache->collisions++;
+    }
+    return outputToEval(board->network, output);
+}
+
+
+float getCachedEval(Board* board) {
+    START_PHASE(start);
+    float eval = probeCachedEval(board);
+    END_PHASE(start, PHASE_EVALUATION);
+    COUNT(evaluations, 1);
+    return eval;
 }
 
 
@@ -41,7 +80,7 @@ float getEvalOfMove(Board* board, Square square) {
     if (winner != NONE) {
         eval = winner == DRAW? 0.5f : player + 1 == winner? 10000.0f : -10000.0f;
     } else {
-        eval = neuralNetworkEval(board);
+        eval = getCachedEval(board);
     }
     revertToCheckpoint(board);
     board->stateCheckpoint = temp;
@@ -55,6 +94,7 @@ void singleChild(int nodeIndex, Board* board, Square square) {
     node->childrenIndex = allocateNodes(board, 1);
     float eval = getEvalOfMove(board, square);
     initializeMCTSNode(square, eval, &board->nodes[node->childrenIndex + 0]);
+    board->nodes[node->childrenIndex + 0].prior = UINT8_MAX;
 }
 
 
@@ -81,16 +121,18 @@ bool isBadMove(Board* board, Square square, Winner winner, Player player) {
 }
 
 
+// With a fast network most children are scored by it, since most are never visited. They are marked with
+// numChildren = -2 and get a full network eval on their first visit (see expandLeaf).
 void initializeChildNodes(int parentIndex, Board* board, Square* moves, Winner* winners) {
     MCTSNode* parent = &board->nodes[parentIndex];
-    __m256i regs[16];
+    const Network* network = board->fastNetwork != NULL? board->fastNetwork : board->network;
+    int8_t unexpanded = board->fastNetwork != NULL? -2 : -1;
+    Accumulator accumulator;
+    START_PHASE(start);
     board->state.currentPlayer ^= 1;
-    boardToInput(board, regs);
+    boardToInput(network, board, &accumulator);
     board->state.currentPlayer ^= 1;
-    alignas(32) int16_t NNInputs[256];
-    for (int i = 0; i < 16; i++) {
-        _mm256_store_si256((__m256i*) &NNInputs[i * 16], regs[i]);
-    }
+    END_PHASE(start, PHASE_EVALUATION);
     int8_t amountOfMoves = parent->numChildren;
     PlayerBitBoard* p1 = &board->state.player1;
     PlayerBitBoard* currentPlayerBitBoard = p1 + board->state.currentPlayer;
@@ -110,32 +152,73 @@ void initializeChildNodes(int parentIndex, Board* board, Square* moves, Winner*
         uint16_t smallBoard = extractSmallBoard(currentPlayerBitBoard, move.board);
         BIT_SET(smallBoard, move.position);
         bool smallBoardIsDecided;
-        for (int j = 0; j < 16; j++) {
-            regs[j] = _mm256_load_si256((__m256i*) &NNInputs[j * 16]);
-        }
+        int features[4];
+        int amountOfFeatures = 0;
         if (isWin(smallBoard)) {
             smallBoardIsDecided = BIT_CHECK(board->state.player1.bigBoard | board->state.player2.bigBoard
                                             | (1 << move.board), move.position);
-            addFeature(move.board + 90, regs);
+            features[amountOfFeatures++] = move.board + 90;
         } else if (isDraw(smallBoard, extractSmallBoard(otherPlayerBitBoard, move.board))) {
             smallBoardIsDecided = BIT_CHECK(board->state.player1.bigBoard | board->state.player2.bigBoard
                                             | (1 << move.board), move.position);
-            addFeature(move.board, regs);
-            addFeature(move.board + 90, regs);
+            features[amountOfFeatures++] = move.board;
+            features[amountOfFeatures++] = move.board + 90;
         } else {
             smallBoardIsDecided = BIT_CHECK(board->state.player1.bigBoard | board->state.player2.bigBoard, move.position);
         }
-        addFeature(move.position + 99 + 9*move.board, regs);
-        addFeature((smallBoardIsDecided? ANY_BOARD : move.position) + 180, regs);
-        float eval = neuralNetworkEvalFromHidden(regs);
+        features[amountOfFeatures++] = move.position + 99 + 9*move.board;
+        features[amountOfFeatures++] = (smallBoardIsDecided? ANY_BOARD : move.position) + 180;
+        START_PHASE(evalStart);
+        float eval = neuralNetworkEvalWithFeatures(network, &accumulator, features, amountOfFeatures);
+        END_PHASE(evalStart, PHASE_EVALUATION);
+        COUNT(evaluations, 1);
         initializeMCTSNode(move, eval, child);
+        child->numChildren = unexpanded;
+    }
+}
+
+
+// One network call for the whole node: children start at the value of this position and get a prior from the policy
+// head instead of being evaluated one by one
+void initializeChildNodesWithPolicy(int parentIndex, Board* board, Square* moves, Winner* winners) {
+    MCTSNode* parent = &board->nodes[parentIndex];
+    int8_t amountOfMoves = parent->numChildren;
+    int32_t logits[TOTAL_SMALL_SQUARES];
+    START_PHASE(start);
+    int32_t output = neuralNetworkOutputWithPolicy(board->network, board, moves, amountOfMoves, logits);
+    END_PHASE(start, PHASE_EVALUATION);
+    COUNT(evaluations, 1);
+    // The network evaluates positions for the player who moved into them, the children are moves of the other player
+    float childEval = 1 - outputToEval(board->network, output);
+    int32_t maxLogit = INT32_MIN;
+    for (int i = 0; i < amountOfMoves; i++) {
+        maxLogit = logits[i] > maxLogit? logits[i] : maxLogit;
+    }
+    float probabilities[TOTAL_SMALL_SQUARES];
+    float probabilitySum = 0.0f;
+    int childIndex = 0;
+    for (int i = 0; i < amountOfMoves; i++) {
+        Square move = moves[i];
+        if (isBadMove(board, move, winners[i], board->state.currentPlayer) && parent->numChildren > 1) {
+            parent->numChildren--;
+            continue;
+        }
+        MCTSNode* child = &board->nodes[parent->childrenIndex + childIndex];
+        initializeMCTSNode(move, winners[i] == DRAW? 0.5f : childEval, child);
+        probabilities[childIndex] = expf((float) (logits[i] - maxLogit) * (1.0f / (127*64)));
+        probabilitySum += probabilities[childIndex++];
+    }
+    for (int i = 0; i < parent->numChildren; i++) {
+        // Every move keeps a prior of at least 1/255 so it can still be explored
+        float prior = roundf(probabilities[i] / probabilitySum * UINT8_MAX);
+        board->nodes[parent->childrenIndex + i].prior = prior < 1? 1 : (uint8_t) prior;
     }
 }
 
 
 void discoverChildNodes(int nodeIndex, Board* board) {
     MCTSNode* node = &board->nodes[nodeIndex];
-    if (node->numChildren == -1 && !handleSpecialCases(nodeIndex, board)) {
+    if (node->numChildren < 0 && !handleSpecialCases(nodeIndex, board)) {
         Square moves[TOTAL_SMALL_SQUARES];
         int8_t amountOfMoves = generateMoves(board, moves);
         Player player = board->state.currentPlayer;
@@ -148,6 +231,7 @@ void discoverChildNodes(int nodeIndex, Board* board) {
                     node->numChildren = 1;
                     node->childrenIndex = allocateNodes(board, 1);
                     initializeMCTSNode(moves[i], 10000.0f, &board->nodes[node->childrenIndex]);
+                    board->nodes[node->childrenIndex].prior = UINT8_MAX;
                     return;
                 } else {
                     winners[i] = winner;
@@ -156,7 +240,11 @@ void discoverChildNodes(int nodeIndex, Board* board) {
         }
         node->numChildren = amountOfMoves;
         node->childrenIndex = allocateNodes(board, amountOfMoves);
-        initializeChildNodes(nodeIndex, board, moves, winners);
+        if (board->usePUCT) {
+            initializeChildNodesWithPolicy(nodeIndex, board, moves, winners);
+        } else {
+            initializeChildNodes(nodeIndex, board, moves, winners);
+        }
     }
 }
 
@@ -184,6 +272,14 @@ float getUCTValue(MCTSNode* node, float parentLogSims) {
 }
 
 
+#define PUCT_EXPLORATION 1.0f
+float getPUCTValue(MCTSNode* node, float parentSqrtSims) {
+    float exploitation = (EXPLOITATION_LAMBDA * node->eval) + ((1 - EXPLOITATION_LAMBDA) * (node->evalSum / (node->sims + 1)));
+    float exploration = PUCT_EXPLORATION * (node->prior * (1.0f / UINT8_MAX)) * parentSqrtSims / (node->sims + 1);
+    return exploitation + exploration;
+}
+
+
 // From: https://github.com/etheory/fastapprox/blob/master/fastapprox/src/fastlog.h
 float fastLog2(float x) {
     union { float f; uint32_t i; } vx = { x };
@@ -193,9 +289,29 @@ float fastLog2(float x) {
 }
 
 
+int selectNextChildPUCT(Board* board, MCTSNode* node) {
+    float sqrtSims = fastSquareRoot(node->sims + 1);
+    int highestPUCTChildIndex = -1;
+    float highestPUCT = -100000.0f;
+    for (int i = 0; i < node->numChildren; i++) {
+        int childIndex = node->childrenIndex + i;
+        float PUCT = getPUCTValue(&board->nodes[childIndex], sqrtSims);
+        if (PUCT > highestPUCT) {
+            highestPUCTChildIndex = childIndex;
+            highestPUCT = PUCT;
+        }
+    }
+    assert(highestPUCTChildIndex != -1);
+    return highestPUCTChildIndex;
+}
+
+
 int selectNextChild(Board* board, int nodeIndex) {
     MCTSNode* node = &board->nodes[nodeIndex];
     assert(node->numChildren > 0);
+    if (board->usePUCT) {
+        return selectNextChildPUCT(board, node);
+    }
     float logSims = EXPLORATION_PARAMETER*EXPLORATION_PARAMETER * fastLog2(node->sims);
     int highestUCTChildIndex = -1;
     float highestUCT = -100000.0f;
@@ -212,9 +328,20 @@ int selectNextChild(Board* board, int nodeIndex) {
 }
 
 
+// The first visit of a child scored by the fast network only replaces its eval with the full network's. Expanding it
+// would overwrite that eval with its children's right away.
 MCTSNode* expandLeaf(int leafIndex, Board* board) {
     assert(isLeafNode(leafIndex, board));
+    MCTSNode* leaf = &board->nodes[leafIndex];
+    if (leaf->numChildren == -2) {
+        leaf->eval = getCachedEval(board);
+        leaf->evalSum = leaf->eval;
+        leaf->numChildren = -1;
+        return leaf;
+    }
     discoverChildNodes(leafIndex, board);
+    COUNT(expansions, 1);
+    COUNT(childrenCreated, board->nodes[leafIndex].numChildren);
     return &board->nodes[leafIndex];
 }
 
@@ -278,13 +405,18 @@ void visitNode(int nodeIndex, Board* board) {
 }
 
 
+float getMoveScore(float eval, float sims) {
+    return eval + fastLog2(sims);
+}
+
+
 Square getMostPromisingMove(Board* board, MCTSNode* node) {
     assert(node->numChildren > 0 && "getMostPromisingMove: node has no children");
     MCTSNode* highestScoreChild = &board->nodes[node->childrenIndex + 0];
-    float highestScore = highestScoreChild->eval + fastLog2(highestScoreChild->sims);
+    float highestScore = getMoveScore(highestScoreChild->eval, highestScoreChild->sims);
     for (int i = 1; i < node->numChildren; i++) {
         MCTSNode* child = &board->nodes[node->childrenIndex + i];
-        float score = child->eval + fastLog2(child->sims);
+        float score = getMoveScore(child->eval, child->sims);
         if (score > highestScore) {
             highestScoreChild = child;
             highestScore = score;
@@ -10,11 +10,14 @@ typedef struct MCTSNode {
     float evalSum;
     float sims;
     Square square;
-    int8_t numChildren;
+    int8_t numChildren;  // -1 before expansion, -2 while the eval still comes from the board's fast network
+    uint8_t prior;  // Policy probability * 255, only used in PUCT mode
 } MCTSNode;
 
 int createMCTSRootNode(Board* board);
 
+float getEvalOfMove(Board* board, Square square);
+
 void discoverChildNodes(int nodeIndex, Board* board);
 
 bool isLeafNode(int nodeIndex, Board* board);
@@ -31,6 +34,9 @@ void backpropagateEval(Board* board, MCTSNode* node, const int* parentIndices);
 
 void visitNode(int nodeIndex, Board* board);
 
+// How getMostPromisingMove ranks the children of the root
+float getMoveScore(float eval, float sims);
+
 Square getMostPromisingMove(Board* board, MCTSNode* node);
 
 #endif //UTTT2_MCTS_NODE_H
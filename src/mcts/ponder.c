@@ -0,0 +1,36 @@
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "ponder.h"
+#include "find_next_move.h"
+
+
+void* runPondering(void* argument) {
+    Ponder* ponder = argument;
+    while (!deadlineExpired(&ponder->deadline)) {
+        runSimulation(ponder->board, ponder->rootIndex);
+        ponder->amountOfSimulations++;
+    }
+    return NULL;
+}
+
+
+void startPondering(Ponder* ponder, Board* board, int rootIndex) {
+    assert(board->state.winner == NONE && "startPondering: the game is already over");
+    ponder->board = board;
+    ponder->rootIndex = rootIndex;
+    ponder->amountOfSimulations = 0;
+    startDeadline(&ponder->deadline, INFINITY);
+    if (pthread_create(&ponder->thread, NULL, runPondering, ponder) != 0) {
+        fprintf(stderr, "Couldn't start the pondering thread!\n");
+        exit(1);
+    }
+}
+
+
+int stopPondering(Ponder* ponder) {
+    stopDeadline(&ponder->deadline);
+    pthread_join(ponder->thread, NULL);
+    return ponder->amountOfSimulations;
+}
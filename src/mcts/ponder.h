@@ -0,0 +1,23 @@
+#ifndef UTTT2_PONDER_H
+#define UTTT2_PONDER_H
+
+#include <pthread.h>
+#include "../board/board.h"
+#include "../misc/timer.h"
+
+typedef struct Ponder {
+    pthread_t thread;
+    Board* board;
+    int rootIndex;
+    Deadline deadline;
+    int amountOfSimulations;
+} Ponder;
+
+// Keeps searching from rootIndex on another thread while the opponent thinks. The board belongs to that thread until
+// stopPondering returns.
+void startPondering(Ponder* ponder, Board* board, int rootIndex);
+
+// Returns the amount of simulations done while pondering, which stay in the tree for the next search
+int stopPondering(Ponder* ponder);
+
+#endif //UTTT2_PONDER_H
@@ -0,0 +1,136 @@
+#include <assert.h>
+#include <math.h>
+#include "time_manager.h"
+#include "mcts_node.h"
+#include "../misc/timer.h"
+
+// Matches the old fixed schedule, which searched the first move of either side ten times longer
+#define OPENING_TIME_FACTOR 10
+#define EXPECTED_GAME_LENGTH 60
+#define MIN_MOVES_TO_GO 6
+#define MAX_BANK_FRACTION 0.25
+#define EXTENSION_FACTOR 2.0
+#define LATE_CHANGE_FRACTION 0.5
+#define UNSTABLE_EVAL 0.05f
+// How much the eval of a child that isn't the best yet could still improve in the remaining time
+#define EVAL_MARGIN 0.05f
+
+
+void initializeTimeManager(TimeManager* timeManager, double timePerMove, double timeBank, bool adaptive) {
+    assert((timePerMove > 0 || timeBank > 0) && "initializeTimeManager: needs a time per move or a time bank");
+    timeManager->timePerMove = timePerMove;
+    timeManager->timeBank = timeBank;
+    timeManager->useTimeBank = timeBank > 0;
+    timeManager->adaptive = adaptive;
+    timeManager->threadCpuTime = false;
+    timeManager->moves = 0;
+    timeManager->timeUsed = 0;
+    timeManager->earlyStops = 0;
+    timeManager->extensions = 0;
+}
+
+
+double getTimeManagerTime(const TimeManager* timeManager) {
+    return timeManager->threadCpuTime? getThreadCpuTime() : getMonotonicTime();
+}
+
+
+void startMove(TimeManager* timeManager, const State* state) {
+    timeManager->start = getTimeManagerTime(timeManager);
+    double budget = timeManager->timePerMove > 0? timeManager->timePerMove : INFINITY;
+    if (state->ply <= 1) {
+        budget *= OPENING_TIME_FACTOR;
+    }
+    double maximumTime = timeManager->adaptive? EXTENSION_FACTOR * budget : budget;
+    if (timeManager->useTimeBank) {
+        double timeBank = fmax(timeManager->timeBank, 0);
+        int movesToGo = (EXPECTED_GAME_LENGTH - state->ply) / 2;
+        movesToGo = movesToGo > MIN_MOVES_TO_GO? movesToGo : MIN_MOVES_TO_GO;
+        budget = fmin(budget, timeBank / movesToGo);
+        maximumTime = fmin(timeManager->adaptive? EXTENSION_FACTOR * budget : budget, MAX_BANK_FRACTION * timeBank);
+        budget = fmin(budget, maximumTime);
+    }
+    timeManager->budget = budget;
+    timeManager->maximumTime = maximumTime;
+    timeManager->bestChildIndex = -1;
+    timeManager->lastBestChangeTime = 0;
+    timeManager->hasReferenceEval = false;
+    timeManager->extended = false;
+}
+
+
+// The best child can't be overtaken if no other child reaches its score, even when it gets all the remaining
+// simulations and its eval still improves a little
+bool bestChildIsSettled(Board* board, MCTSNode* root, int bestChildIndex, float bestScore, float remainingSimulations) {
+    for (int i = 0; i < root->numChildren; i++) {
+        MCTSNode* child = &board->nodes[root->childrenIndex + i];
+        if (root->childrenIndex + i == bestChildIndex) {
+            continue;
+        }
+        if (getMoveScore(child->eval + EVAL_MARGIN, child->sims + remainingSimulations) >= bestScore) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+bool shouldStopSearch(TimeManager* timeManager, Board* board, int rootIndex, int amountOfSimulations) {
+    double elapsedTime = getTimeManagerTime(timeManager) - timeManager->start;
+    if (elapsedTime >= timeManager->maximumTime) {
+        return true;
+    }
+    MCTSNode* root = &board->nodes[rootIndex];
+    if (!timeManager->adaptive || root->numChildren <= 0) {
+        return elapsedTime >= timeManager->budget;
+    }
+
+    int bestChildIndex = root->childrenIndex;
+    float bestScore = -INFINITY;
+    for (int i = 0; i < root->numChildren; i++) {
+        MCTSNode* child = &board->nodes[root->childrenIndex + i];
+        float score = getMoveScore(child->eval, child->sims);
+        if (score > bestScore) {
+            bestChildIndex = root->childrenIndex + i;
+            bestScore = score;
+        }
+    }
+    if (bestChildIndex != timeManager->bestChildIndex) {
+        timeManager->bestChildIndex = bestChildIndex;
+        timeManager->lastBestChangeTime = elapsedTime;
+    }
+    if (!timeManager->hasReferenceEval && elapsedTime >= timeManager->budget / 2) {
+        timeManager->referenceEval = root->eval;
+        timeManager->hasReferenceEval = true;
+    }
+
+    double deadline = timeManager->budget;
+    bool bestChangedLate = timeManager->lastBestChangeTime > LATE_CHANGE_FRACTION * timeManager->budget;
+    bool evalIsUnstable = timeManager->hasReferenceEval && fabsf(root->eval - timeManager->referenceEval) > UNSTABLE_EVAL;
+    if (bestChangedLate || evalIsUnstable) {
+        deadline = timeManager->maximumTime;
+        if (!timeManager->extended && elapsedTime >= timeManager->budget) {
+            timeManager->extended = true;
+            timeManager->extensions++;
+        }
+    }
+    if (elapsedTime >= deadline) {
+        return true;
+    }
+    float remainingSimulations = (float) (amountOfSimulations / elapsedTime * (deadline - elapsedTime));
+    if (bestChildIsSettled(board, root, bestChildIndex, bestScore, remainingSimulations)) {
+        timeManager->earlyStops++;
+        return true;
+    }
+    return false;
+}
+
+
+void finishMove(TimeManager* timeManager) {
+    double elapsedTime = getTimeManagerTime(timeManager) - timeManager->start;
+    timeManager->moves++;
+    timeManager->timeUsed += elapsedTime;
+    if (timeManager->useTimeBank) {
+        timeManager->timeBank -= elapsedTime;
+    }
+}
@@ -0,0 +1,37 @@
+#ifndef UTTT2_TIME_MANAGER_H
+#define UTTT2_TIME_MANAGER_H
+
+#include <stdbool.h>
+#include "../board/board.h"
+
+typedef struct TimeManager {
+    double timePerMove;  // Budget of a normal move, <= 0 to only spend from the time bank
+    double timeBank;  // Time left for the rest of the game when useTimeBank is set
+    bool useTimeBank;
+    bool adaptive;  // Stop as soon as the best move is settled, take longer when it isn't
+    bool threadCpuTime;  // Count only the time the searching thread ran instead of wall time, false by default
+
+    double start;
+    double budget;
+    double maximumTime;
+    int bestChildIndex;
+    double lastBestChangeTime;
+    float referenceEval;
+    bool hasReferenceEval;
+    bool extended;
+
+    int moves;
+    double timeUsed;
+    int earlyStops;
+    int extensions;
+} TimeManager;
+
+void initializeTimeManager(TimeManager* timeManager, double timePerMove, double timeBank, bool adaptive);
+
+void startMove(TimeManager* timeManager, const State* state);
+
+bool shouldStopSearch(TimeManager* timeManager, Board* board, int rootIndex, int amountOfSimulations);
+
+void finishMove(TimeManager* timeManager);
+
+#endif //UTTT2_TIME_MANAGER_H
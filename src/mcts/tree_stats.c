@@ -0,0 +1,106 @@
+#include <string.h>
+#include "tree_stats.h"
+#include "../misc/util.h"
+
+#define MAX_TREE_STACK (TOTAL_SMALL_SQUARES * MAX_TREE_DEPTH)
+
+
+// Depth first with an explicit stack. After the node pool started over, old nodes can point to children that were
+// overwritten since, the depth limit keeps the walk finite anyway.
+int walkTree(Board* board, int rootIndex, TreeStats* stats) {
+    int nodeStack[MAX_TREE_STACK];
+    uint8_t depthStack[MAX_TREE_STACK];
+    int stackSize = 0;
+    int reachableNodes = 0;
+    nodeStack[stackSize] = rootIndex;
+    depthStack[stackSize++] = 0;
+    while (stackSize > 0) {
+        stackSize--;
+        MCTSNode* node = &board->nodes[nodeStack[stackSize]];
+        uint8_t depth = depthStack[stackSize];
+        reachableNodes++;
+        if (stats != NULL) {
+            stats->depthHistogram[depth]++;
+            stats->maxDepth = depth > stats->maxDepth? depth : stats->maxDepth;
+        }
+        if (node->numChildren <= 0 || depth + 1 >= MAX_TREE_DEPTH) {
+            continue;
+        }
+        if (stats != NULL) {
+            stats->branchingHistogram[node->numChildren]++;
+            stats->maxBranching = node->numChildren > stats->maxBranching? node->numChildren : stats->maxBranching;
+        }
+        for (int i = 0; i < node->numChildren; i++) {
+            nodeStack[stackSize] = node->childrenIndex + i;
+            depthStack[stackSize++] = depth + 1;
+        }
+    }
+    return reachableNodes;
+}
+
+
+int countReachableNodes(Board* board, int rootIndex) {
+    return walkTree(board, rootIndex, NULL);
+}
+
+
+void findPrincipalVariation(Board* board, int rootIndex, TreeStats* stats) {
+    MCTSNode* node = &board->nodes[rootIndex];
+    stats->principalVariationLength = 0;
+    while (node->numChildren > 0 && node->sims > 0 && stats->principalVariationLength < MAX_TREE_DEPTH) {
+        MCTSNode* best = &board->nodes[node->childrenIndex];
+        for (int i = 1; i < node->numChildren; i++) {
+            MCTSNode* child = &board->nodes[node->childrenIndex + i];
+            if (getMoveScore(child->eval, child->sims) > getMoveScore(best->eval, best->sims)) {
+                best = child;
+            }
+        }
+        stats->principalVariation[stats->principalVariationLength] = best->square;
+        stats->principalVariationSims[stats->principalVariationLength++] = best->sims;
+        node = best;
+    }
+}
+
+
+void computeTreeStats(Board* board, int rootIndex, TreeStats* stats) {
+    memset(stats, 0, sizeof(TreeStats));
+    stats->ply = board->state.ply;
+    stats->allocatedNodes = board->currentNodeIndex;
+    stats->poolSize = getNodePoolSize();
+    stats->highWaterMark = board->nodeHighWaterMark > board->currentNodeIndex
+                           ? board->nodeHighWaterMark : board->currentNodeIndex;
+    stats->reachableNodes = walkTree(board, rootIndex, stats);
+    findPrincipalVariation(board, rootIndex, stats);
+    stats->reusedNodes = -1;
+}
+
+
+void printIntArray(FILE* file, const char* name, const int* values, int amount) {
+    fprintf(file, "\"%s\":[", name);
+    for (int i = 0; i < amount; i++) {
+        fprintf(file, i == 0? "%d" : ",%d", values[i]);
+    }
+    fprintf(file, "]");
+}
+
+
+void printTreeStats(FILE* file, const TreeStats* stats) {
+    fprintf(file, "{\"ply\":%d,\"reachableNodes\":%d,\"allocatedNodes\":%d,\"poolSize\":%d,\"poolUtilization\":%.4f,"
+                  "\"highWaterMark\":%d,", stats->ply, stats->reachableNodes, stats->allocatedNodes, stats->poolSize,
+            (double) stats->allocatedNodes / stats->poolSize, stats->highWaterMark);
+    if (stats->reusedNodes >= 0) {
+        fprintf(file, "\"reusedNodes\":%d,\"reusedPercentage\":%.2f,", stats->reusedNodes,
+                100.0 * stats->reusedNodes / stats->reachableNodes);
+    }
+    printIntArray(file, "depthHistogram", stats->depthHistogram, stats->maxDepth + 1);
+    fprintf(file, ",");
+    printIntArray(file, "branchingHistogram", stats->branchingHistogram, stats->maxBranching + 1);
+    fprintf(file, ",\"principalVariation\":[");
+    for (int i = 0; i < stats->principalVariationLength; i++) {
+        Square move = toGameNotation(stats->principalVariation[i]);
+        fprintf(file, "%s{\"row\":%d,\"column\":%d,\"sims\":%.0f}", i == 0? "" : ",", move.board, move.position,
+                stats->principalVariationSims[i]);
+    }
+    fprintf(file, "]}\n");
+    fflush(file);
+}
@@ -0,0 +1,33 @@
+#ifndef UTTT2_TREE_STATS_H
+#define UTTT2_TREE_STATS_H
+
+#include <stdio.h>
+#include "mcts_node.h"
+
+#define MAX_TREE_DEPTH (TOTAL_SMALL_SQUARES + 1)
+
+// Shape of the search tree below a root and how much of the node pool it takes up
+typedef struct TreeStats {
+    uint8_t ply;
+    int reachableNodes;
+    int allocatedNodes;  // currentNodeIndex, nodes in use since the pool last started over
+    int poolSize;
+    int highWaterMark;
+    int maxDepth;
+    int depthHistogram[MAX_TREE_DEPTH];  // Reachable nodes per depth, the root is at depth 0
+    int maxBranching;
+    int branchingHistogram[TOTAL_SMALL_SQUARES + 1];  // Expanded nodes per amount of children
+    int principalVariationLength;
+    Square principalVariation[MAX_TREE_DEPTH];  // The moves getMostPromisingMove would pick, in our notation
+    float principalVariationSims[MAX_TREE_DEPTH];
+    int reusedNodes;  // Nodes still reachable after updateRoot, -1 if not measured
+} TreeStats;
+
+int countReachableNodes(Board* board, int rootIndex);
+
+void computeTreeStats(Board* board, int rootIndex, TreeStats* stats);
+
+// One line of JSON
+void printTreeStats(FILE* file, const TreeStats* stats);
+
+#endif //UTTT2_TREE_STATS_H
@@ -0,0 +1,37 @@
+#include <string.h>
+#include "instrumentation.h"
+
+#ifdef SEARCH_INSTRUMENTATION
+
+_Thread_local SearchCounters searchCounters;
+
+
+void printSearchCounters(FILE* file) {
+    SearchCounters* c = &searchCounters;
+    double simulations = c->simulations > 0? (double) c->simulations : 1;
+    // Network evals happen during expansion, the expansion time is reported without them
+    uint64_t expansionCycles = c->cycles[PHASE_EXPANSION] > c->cycles[PHASE_EVALUATION]
+                               ? c->cycles[PHASE_EXPANSION] - c->cycles[PHASE_EVALUATION] : 0;
+    fprintf(file, "{\"simulations\":%llu,\"averageSelectionDepth\":%.2f,\"maxSelectionDepth\":%llu,"
+                  "\"expansions\":%llu,\"childrenPerExpansion\":%.2f,\"evaluations\":%llu,\"nodesAllocated\":%llu,"
+                  "\"nodePoolWraps\":%llu,\"terminalHits\":%llu,\"cyclesPerSimulation\":{\"selection\":%.0f,"
+                  "\"expansion\":%.0f,\"evaluation\":%.0f,\"backpropagation\":%.0f,\"revert\":%.0f}}\n",
+            (unsigned long long) c->simulations, (double) c->selectionDepth / simulations,
+            (unsigned long long) c->maxSelectionDepth, (unsigned long long) c->expansions,
+            c->expansions > 0? (double) c->childrenCreated / (double) c->expansions : 0.0,
+            (unsigned long long) c->evaluations, (unsigned long long) c->nodesAllocated,
+            (unsigned long long) c->nodePoolWraps, (unsigned long long) c->terminalHits,
+            (double) c->cycles[PHASE_SELECTION] / simulations, (double) expansionCycles / simulations,
+            (double) c->cycles[PHASE_EVALUATION] / simulations, (double) c->cycles[PHASE_BACKPROPAGATION] / simulations,
+            (double) c->cycles[PHASE_REVERT] / simulations);
+    fflush(file);
+    memset(c, 0, sizeof(SearchCounters));
+}
+
+#else
+
+void printSearchCounters(FILE* file) {
+    (void) file;
+}
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef UTTT2_INSTRUMENTATION_H
+#define UTTT2_INSTRUMENTATION_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+// Counters that show where the time of a simulation goes. They are compiled out unless SEARCH_INSTRUMENTATION is
+// defined: reading the time stamp counter around every child eval costs a third of the eval.
+
+typedef enum SearchPhase {
+    PHASE_SELECTION,  // selectNextChild
+    PHASE_EXPANSION,  // expandLeaf, which includes the network evals below
+    PHASE_EVALUATION,
+    PHASE_BACKPROPAGATION,
+    PHASE_REVERT,
+    AMOUNT_OF_PHASES
+} SearchPhase;
+
+typedef struct SearchCounters {
+    uint64_t simulations;
+    uint64_t selectionDepth;  // Summed over all simulations
+    uint64_t maxSelectionDepth;
+    uint64_t expansions;
+    uint64_t childrenCreated;
+    uint64_t evaluations;
+    uint64_t nodesAllocated;
+    uint64_t nodePoolWraps;
+    uint64_t terminalHits;
+    uint64_t cycles[AMOUNT_OF_PHASES];
+} SearchCounters;
+
+#ifdef SEARCH_INSTRUMENTATION
+#include <x86intrin.h>
+
+// Per thread, so arena games and pondering don't mix their counts
+extern _Thread_local SearchCounters searchCounters;
+
+#define COUNT(counter, amount) (searchCounters.counter += (amount))
+#define COUNT_MAX(counter, value) (searchCounters.counter = (value) > searchCounters.counter? (value) : searchCounters.counter)
+#define START_PHASE(start) uint64_t start = __rdtsc()
+#define END_PHASE(start, phase) (searchCounters.cycles[phase] += __rdtsc() - (start))
+#else
+#define COUNT(counter, amount) ((void) 0)
+#define COUNT_MAX(counter, value) ((void) 0)
+#define START_PHASE(start) ((void) 0)
+#define END_PHASE(start, phase) ((void) 0)
+#endif
+
+// Prints this thread's counters since the last call as one line of JSON and resets them. Does nothing when the
+// counters are compiled out.
+void printSearchCounters(FILE* file);
+
+#endif //UTTT2_INSTRUMENTATION_H
@@ -0,0 +1,120 @@
+#define _GNU_SOURCE  // syscall
+#include <string.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "perf_counters.h"
+
+const char* const perfEventNames[AMOUNT_OF_PERF_EVENTS] = {
+        "task clock ns", "cycles", "instructions", "L1D misses", "LLC misses", "dTLB misses"
+};
+
+
+#define CACHE_READ_MISSES(cache) ((cache) | PERF_COUNT_HW_CACHE_OP_READ << 8 | PERF_COUNT_HW_CACHE_RESULT_MISS << 16)
+int openPerfEvent(PerfEvent event) {
+    struct perf_event_attr attributes;
+    memset(&attributes, 0, sizeof(attributes));
+    attributes.size = sizeof(attributes);
+    switch (event) {
+        case PERF_TASK_CLOCK:
+            attributes.type = PERF_TYPE_SOFTWARE;
+            attributes.config = PERF_COUNT_SW_TASK_CLOCK;
+            break;
+        case PERF_CYCLES:
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case PERF_INSTRUCTIONS:
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case PERF_L1D_MISSES:
+            attributes.type = PERF_TYPE_HW_CACHE;
+            attributes.config = CACHE_READ_MISSES(PERF_COUNT_HW_CACHE_L1D);
+            break;
+        case PERF_LLC_MISSES:
+            attributes.type = PERF_TYPE_HW_CACHE;
+            attributes.config = CACHE_READ_MISSES(PERF_COUNT_HW_CACHE_LL);
+            break;
+        default:
+            attributes.type = PERF_TYPE_HW_CACHE;
+            attributes.config = CACHE_READ_MISSES(PERF_COUNT_HW_CACHE_DTLB);
+            break;
+    }
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    // When there are more events than counters the kernel takes turns, the read values get scaled up to make up for it
+    attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int) syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+}
+
+
+bool openPerfCounters(PerfCounters* counters) {
+    memset(counters, 0, sizeof(PerfCounters));
+    bool hardwareIsAvailable = false;
+    for (int i = 0; i < AMOUNT_OF_PERF_EVENTS; i++) {
+        counters->fds[i] = openPerfEvent(i);
+        hardwareIsAvailable |= i != PERF_TASK_CLOCK && counters->fds[i] >= 0;
+    }
+    return hardwareIsAvailable;
+}
+
+
+void closePerfCounters(PerfCounters* counters) {
+    for (int i = 0; i < AMOUNT_OF_PERF_EVENTS; i++) {
+        if (counters->fds[i] >= 0) {
+            close(counters->fds[i]);
+            counters->fds[i] = -1;
+        }
+    }
+}
+
+
+bool perfEventIsAvailable(const PerfCounters* counters, PerfEvent event) {
+    return counters->fds[event] >= 0;
+}
+
+
+double readPerfEvent(int fd) {
+    uint64_t values[3];
+    if (read(fd, values, sizeof(values)) != sizeof(values) || values[2] == 0) {
+        return 0;
+    }
+    return (double) values[0] * ((double) values[1] / (double) values[2]);
+}
+
+
+void startPerfMeasurement(PerfCounters* counters) {
+    for (int i = 0; i < AMOUNT_OF_PERF_EVENTS; i++) {
+        if (counters->fds[i] >= 0) {
+            counters->start[i] = readPerfEvent(counters->fds[i]);
+        }
+    }
+}
+
+
+void stopPerfMeasurement(PerfCounters* counters) {
+    for (int i = 0; i < AMOUNT_OF_PERF_EVENTS; i++) {
+        if (counters->fds[i] >= 0) {
+            counters->last[i] = readPerfEvent(counters->fds[i]) - counters->start[i];
+            counters->totals[i] += counters->last[i];
+        }
+    }
+    counters->measurements++;
+}
+
+
+void printPerfDeltas(FILE* file, const PerfCounters* counters, const double* deltas, double amount) {
+    const char* separator = "";
+    for (int i = 0; i < AMOUNT_OF_PERF_EVENTS; i++) {
+        if (perfEventIsAvailable(counters, i)) {
+            fprintf(file, "%s%s %.1f", separator, perfEventNames[i], deltas[i] / amount);
+            separator = ", ";
+        }
+    }
+    if (perfEventIsAvailable(counters, PERF_CYCLES) && perfEventIsAvailable(counters, PERF_INSTRUCTIONS)
+        && deltas[PERF_CYCLES] > 0) {
+        fprintf(file, ", IPC %.2f", deltas[PERF_INSTRUCTIONS] / deltas[PERF_CYCLES]);
+    }
+    fprintf(file, "\n");
+}
@@ -0,0 +1,47 @@
+#ifndef UTTT2_PERF_COUNTERS_H
+#define UTTT2_PERF_COUNTERS_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Hardware performance counters of the calling thread through perf_event_open, user space only. Containers and
+// virtual machines often don't expose them: events that can't be opened are left out of every report, and the task
+// clock, a software event, is usually still there.
+
+typedef enum PerfEvent {
+    PERF_TASK_CLOCK,  // Nanoseconds on the CPU
+    PERF_CYCLES,
+    PERF_INSTRUCTIONS,
+    PERF_L1D_MISSES,
+    PERF_LLC_MISSES,
+    PERF_DTLB_MISSES,
+    AMOUNT_OF_PERF_EVENTS
+} PerfEvent;
+
+extern const char* const perfEventNames[AMOUNT_OF_PERF_EVENTS];
+
+typedef struct PerfCounters {
+    int fds[AMOUNT_OF_PERF_EVENTS];  // -1 for events that aren't available
+    double start[AMOUNT_OF_PERF_EVENTS];
+    double last[AMOUNT_OF_PERF_EVENTS];  // Deltas of the last measurement
+    double totals[AMOUNT_OF_PERF_EVENTS];  // Deltas of all measurements
+    int measurements;
+} PerfCounters;
+
+// Returns whether any hardware event is available
+bool openPerfCounters(PerfCounters* counters);
+
+void closePerfCounters(PerfCounters* counters);
+
+bool perfEventIsAvailable(const PerfCounters* counters, PerfEvent event);
+
+void startPerfMeasurement(PerfCounters* counters);
+
+// Stores the deltas since startPerfMeasurement in last and adds them to totals
+void stopPerfMeasurement(PerfCounters* counters);
+
+// Prints the available events of deltas divided by amount, for example per simulation, on one line
+void printPerfDeltas(FILE* file, const PerfCounters* counters, const double* deltas, double amount);
+
+#endif //UTTT2_PERF_COUNTERS_H
@@ -0,0 +1,88 @@
+#define _POSIX_C_SOURCE 200112L  // clock_gettime, pthread_once
+#include <math.h>
+#include <pthread.h>
+#include <time.h>
+#include "timer.h"
+
+#define CALIBRATION_TIME 0.01
+
+double timestampCounterFrequency;
+pthread_once_t calibrationOnce = PTHREAD_ONCE_INIT;
+
+
+double getClockTime(clockid_t clock) {
+    struct timespec now;
+    clock_gettime(clock, &now);
+    return (double) now.tv_sec + (double) now.tv_nsec / 1000000000;
+}
+
+
+double getMonotonicTime() {
+    return getClockTime(CLOCK_MONOTONIC);
+}
+
+
+double getThreadCpuTime() {
+    return getClockTime(CLOCK_THREAD_CPUTIME_ID);
+}
+
+
+// Relies on an invariant time stamp counter, which every CPU with AVX2 has
+void calibrateTimestampCounter() {
+    double startTime = getMonotonicTime();
+    uint64_t startTimestamp = __rdtsc();
+    struct timespec sleepTime = {0, (long) (CALIBRATION_TIME * 1000000000)};
+    nanosleep(&sleepTime, NULL);
+    double endTime = getMonotonicTime();
+    uint64_t endTimestamp = __rdtsc();
+    timestampCounterFrequency = (double) (endTimestamp - startTimestamp) / (endTime - startTime);
+}
+
+
+// Calibrating takes CALIBRATION_TIME, so processes that never time anything, like the programs the arena starts for
+// every game, don't pay for it
+double getTimestampCounterFrequency() {
+    pthread_once(&calibrationOnce, calibrateTimestampCounter);
+    return timestampCounterFrequency;
+}
+
+
+void setEndTimestamp(Deadline* deadline, double seconds) {
+    double ticks = seconds * getTimestampCounterFrequency();
+    deadline->endTimestamp = ticks < 0x1p62? __rdtsc() + (uint64_t) fmax(ticks, 0) : UINT64_MAX;
+}
+
+
+double getDeadlineTime(const Deadline* deadline) {
+    return deadline->threadCpuTime? getThreadCpuTime() : getMonotonicTime();
+}
+
+
+void startDeadlineWithClock(Deadline* deadline, double seconds, bool threadCpuTime) {
+    // Calibrating before the clock gets read keeps it out of the first deadline
+    getTimestampCounterFrequency();
+    deadline->threadCpuTime = threadCpuTime;
+    deadline->endTime = getDeadlineTime(deadline) + seconds;
+    setEndTimestamp(deadline, seconds);
+    atomic_init(&deadline->stopped, false);
+}
+
+
+void startDeadline(Deadline* deadline, double seconds) {
+    startDeadlineWithClock(deadline, seconds, false);
+}
+
+
+bool deadlineReached(Deadline* deadline) {
+    double remainingTime = deadline->endTime - getDeadlineTime(deadline);
+    if (remainingTime <= 0) {
+        return true;
+    }
+    setEndTimestamp(deadline, remainingTime);
+    return false;
+}
+
+
+void stopDeadline(Deadline* deadline) {
+    atomic_store_explicit(&deadline->stopped, true, memory_order_relaxed);
+}
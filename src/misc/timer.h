@@ -0,0 +1,45 @@
+#ifndef UTTT2_TIMER_H
+#define UTTT2_TIMER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <x86intrin.h>
+
+// Seconds on CLOCK_MONOTONIC, which doesn't jump when the wall clock gets adjusted
+double getMonotonicTime();
+
+// Seconds the calling thread ran, which other threads competing for its CPU don't count against
+double getThreadCpuTime();
+
+// Ticks of the time stamp counter per second, calibrated against CLOCK_MONOTONIC on the first call
+double getTimestampCounterFrequency();
+
+// Reading the time stamp counter is cheap enough to check a deadline every simulation. Once it says the deadline
+// passed, the clock of the deadline has the final say, so calibration errors can't end the search early. A thread
+// never runs faster than the wall clock, so on thread CPU time the time stamp counter only makes the clock get read
+// more often when the thread was preempted. stopDeadline may be called from another thread to end the search
+// before the deadline.
+typedef struct Deadline {
+    uint64_t endTimestamp;
+    double endTime;
+    bool threadCpuTime;
+    atomic_bool stopped;
+} Deadline;
+
+// A non-finite amount of seconds only expires through stopDeadline
+void startDeadline(Deadline* deadline, double seconds);
+
+// With threadCpuTime the deadline measures getThreadCpuTime of the thread that checks it
+void startDeadlineWithClock(Deadline* deadline, double seconds, bool threadCpuTime);
+
+void stopDeadline(Deadline* deadline);
+
+bool deadlineReached(Deadline* deadline);
+
+inline __attribute__((always_inline)) bool deadlineExpired(Deadline* deadline) {
+    return atomic_load_explicit(&deadline->stopped, memory_order_relaxed)
+           || (__rdtsc() >= deadline->endTimestamp && deadlineReached(deadline));
+}
+
+#endif //UTTT2_TIMER_H
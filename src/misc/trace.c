@@ -0,0 +1,120 @@
+#define _GNU_SOURCE  // syscall
+#include <stdio.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include "trace.h"
+#include "timer.h"
+#include "util.h"
+
+typedef struct TraceEvent {
+    const char* name;
+    const char* argumentName;
+    int64_t argument;
+    uint64_t start;
+    uint64_t end;
+    bool instant;
+} TraceEvent;
+
+typedef struct TraceBuffer {
+    TraceEvent* events;
+    uint64_t written;  // The oldest events get overwritten once this passes the capacity
+    int threadId;
+    struct TraceBuffer* next;
+} TraceBuffer;
+
+bool tracingEnabled = false;
+pthread_mutex_t traceBuffersMutex = PTHREAD_MUTEX_INITIALIZER;
+TraceBuffer* traceBuffers = NULL;
+int traceCapacity;
+int traceGeneration = 0;
+uint64_t traceStartTimestamp;
+
+// A thread's buffer from an earlier trace has been freed, the generation tells them apart
+_Thread_local TraceBuffer* threadTraceBuffer = NULL;
+_Thread_local int threadTraceGeneration = -1;
+
+
+void startTracing(int eventsPerThread) {
+    traceCapacity = eventsPerThread;
+    traceGeneration++;
+    traceStartTimestamp = __rdtsc();
+    tracingEnabled = true;
+}
+
+
+TraceBuffer* registerTraceBuffer() {
+    TraceBuffer* buffer = safeMalloc(sizeof(TraceBuffer));
+    buffer->events = safeMalloc(traceCapacity * sizeof(TraceEvent));
+    buffer->written = 0;
+    buffer->threadId = (int) syscall(SYS_gettid);
+    pthread_mutex_lock(&traceBuffersMutex);
+    buffer->next = traceBuffers;
+    traceBuffers = buffer;
+    pthread_mutex_unlock(&traceBuffersMutex);
+    threadTraceBuffer = buffer;
+    threadTraceGeneration = traceGeneration;
+    return buffer;
+}
+
+
+void recordTraceEvent(const char* name, uint64_t start, uint64_t end, bool instant, const char* argumentName,
+                      int64_t argument) {
+    TraceBuffer* buffer = threadTraceGeneration == traceGeneration? threadTraceBuffer : registerTraceBuffer();
+    TraceEvent* event = &buffer->events[buffer->written++ % traceCapacity];
+    event->name = name;
+    event->argumentName = argumentName;
+    event->argument = argument;
+    event->start = start;
+    event->end = end;
+    event->instant = instant;
+}
+
+
+void writeTraceEvent(FILE* file, const TraceEvent* event, int threadId, bool first) {
+    double microsecondsPerTick = 1e6 / getTimestampCounterFrequency();
+    // Spans that started before tracing did get cut off at the start of the trace
+    double start = event->start > traceStartTimestamp? (double) (event->start - traceStartTimestamp) : 0;
+    fprintf(file, "%s\n{\"name\":\"%s\",\"ph\":\"%s\",\"ts\":%.3f,", first? "" : ",", event->name,
+            event->instant? "i\",\"s\":\"t" : "X", start * microsecondsPerTick);
+    if (!event->instant) {
+        fprintf(file, "\"dur\":%.3f,", ((double) (event->end - traceStartTimestamp) - start) * microsecondsPerTick);
+    }
+    fprintf(file, "\"pid\":1,\"tid\":%d", threadId);
+    if (event->argumentName != NULL) {
+        fprintf(file, ",\"args\":{\"%s\":%lld}", event->argumentName, (long long) event->argument);
+    }
+    fprintf(file, "}");
+}
+
+
+bool stopTracing(const char* filename) {
+    tracingEnabled = false;
+    FILE* file = fopen(filename, "w");
+    bool success = file != NULL;
+    if (success) {
+        fprintf(file, "{\"traceEvents\":[");
+    }
+    bool first = true;
+    TraceBuffer* buffer = traceBuffers;
+    while (buffer != NULL) {
+        uint64_t oldest = buffer->written > (uint64_t) traceCapacity? buffer->written - traceCapacity : 0;
+        for (uint64_t i = oldest; i < buffer->written && success; i++) {
+            writeTraceEvent(file, &buffer->events[i % traceCapacity], buffer->threadId, first);
+            first = false;
+        }
+        TraceBuffer* next = buffer->next;
+        safeFree(buffer->events);
+        safeFree(buffer);
+        buffer = next;
+    }
+    traceBuffers = NULL;
+    if (file != NULL) {
+        fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+        success = fclose(file) == 0 && success;
+    }
+    if (!success) {
+        perror(filename);
+    }
+    return success;
+}
@@ -0,0 +1,42 @@
+#ifndef UTTT2_TRACE_H
+#define UTTT2_TRACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <x86intrin.h>
+
+// Timeline of spans per thread, written as Chrome trace JSON that opens in Perfetto (ui.perfetto.dev) or
+// chrome://tracing. Every thread records into its own ring buffer, so threads never wait on each other and only the
+// last events survive a long run. While tracing is off, a span costs one load and branch.
+
+extern bool tracingEnabled;
+
+// Only call these while no other thread traces, for example around the arena's parallel loop
+void startTracing(int eventsPerThread);
+
+// Writes the events of all threads to filename and frees the buffers
+bool stopTracing(const char* filename);
+
+void recordTraceEvent(const char* name, uint64_t start, uint64_t end, bool instant, const char* argumentName,
+                      int64_t argument);
+
+inline __attribute__((always_inline)) uint64_t startTraceSpan() {
+    return tracingEnabled? __rdtsc() : 0;
+}
+
+// Names and argument names have to outlive the trace, string literals are best
+inline __attribute__((always_inline)) void endTraceSpan(const char* name, uint64_t start, const char* argumentName,
+                                                        int64_t argument) {
+    if (tracingEnabled) {
+        recordTraceEvent(name, start, __rdtsc(), false, argumentName, argument);
+    }
+}
+
+inline __attribute__((always_inline)) void traceInstant(const char* name, const char* argumentName, int64_t argument) {
+    if (tracingEnabled) {
+        uint64_t now = __rdtsc();
+        recordTraceEvent(name, now, now, true, argumentName, argument);
+    }
+}
+
+#endif //UTTT2_TRACE_H
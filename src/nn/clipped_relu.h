@@ -4,12 +4,21 @@
 #include <stdint.h>
 #include <immintrin.h>
 
-inline __attribute__((always_inline)) void applyClippedReLU256(__m256i regs[16]) {
+// Packs `registers` registers of 16 int16 neurons into (registers + 1) / 2 registers of 32 int8 activations. `registers`
+// must be a compile-time constant for the loop to unroll into a kernel per network size.
+inline __attribute__((always_inline)) void applyClippedReLU(__m256i* regs, int registers) {
     __m256i zero = _mm256_setzero_si256();
-    for (int i = 0; i < 8; i++) {
+    for (int i = 0; i < (registers + 1) / 2; i++) {
         __m256i in0 = regs[2*i];
-        __m256i in1 = regs[2*i + 1];
-        regs[i] = _mm256_permute4x64_epi64(_mm256_max_epi8(_mm256_packs_epi16(in0, in1), zero), 0b11011000);
+        __m256i in1 = 2*i + 1 < registers? regs[2*i + 1] : zero;
+#ifdef INT8_HIDDEN_WEIGHTS
+        // Back from the half scale of the int8 first layer, saturating so large sums still clip to 127
+        in0 = _mm256_adds_epi16(in0, in0);
+        in1 = _mm256_adds_epi16(in1, in1);
+#endif
+        // packs_epi16 interleaves the 128-bit lanes of in0 and in1; the next layer's weights are stored in that order
+        // instead of permuting the neurons back
+        regs[i] = _mm256_max_epi8(_mm256_packs_epi16(in0, in1), zero);
     }
 }
 
@@ -0,0 +1,68 @@
+#include <string.h>
+#include <assert.h>
+#include "eval_cache.h"
+#include "../misc/util.h"
+
+#define WAYS 2
+
+
+EvalCache* createEvalCache(int log2Entries) {
+    assert(log2Entries >= 1 && log2Entries < 40);
+    EvalCache* cache = safeMalloc(sizeof(EvalCache));
+    uint64_t amountOfEntries = 1ULL << log2Entries;
+    cache->entries = safeMalloc(amountOfEntries * sizeof(EvalCacheEntry));
+    cache->bucketMask = amountOfEntries / WAYS - 1;
+    clearEvalCache(cache, NULL);
+    cache->verify = false;
+    return cache;
+}
+
+
+void freeEvalCache(EvalCache* cache) {
+    safeFree(cache->entries);
+    safeFree(cache);
+}
+
+
+void clearEvalCache(EvalCache* cache, const Network* network) {
+    memset(cache->entries, 0, (cache->bucketMask + 1) * WAYS * sizeof(EvalCacheEntry));
+    cache->network = network;
+    cache->probes = 0;
+    cache->hits = 0;
+    cache->collisions = 0;
+}
+
+
+// The low bits of the hash pick the bucket, the high bits are kept to tell positions apart. The check is never 0, so
+// empty entries can't match.
+uint32_t getCheck(uint64_t hash) {
+    return (uint32_t) (hash >> 32) | 1;
+}
+
+
+bool probeEvalCache(EvalCache* cache, uint64_t hash, int32_t* output) {
+    EvalCacheEntry* bucket = &cache->entries[(hash & cache->bucketMask) * WAYS];
+    uint32_t check = getCheck(hash);
+    cache->probes++;
+    for (int i = 0; i < WAYS; i++) {
+        if (bucket[i].check == check) {
+            cache->hits++;
+            *output = bucket[i].output;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+void storeEvalCache(EvalCache* cache, uint64_t hash, int32_t output) {
+    EvalCacheEntry* bucket = &cache->entries[(hash & cache->bucketMask) * WAYS];
+    bucket[1] = bucket[0];
+    bucket[0].check = getCheck(hash);
+    bucket[0].output = (int16_t) (output < INT16_MIN? INT16_MIN : output > INT16_MAX? INT16_MAX : output);
+}
+
+
+double evalCacheHitRate(const EvalCache* cache) {
+    return cache->probes == 0? 0.0 : (double) cache->hits / (double) cache->probes;
+}
@@ -0,0 +1,41 @@
+#ifndef UTTT2_EVAL_CACHE_H
+#define UTTT2_EVAL_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "network.h"
+
+#define DEFAULT_EVAL_CACHE_LOG2_ENTRIES 20
+
+// Stores the integer network output, saturated to int16. The eval saturates long before that (see outputToEval), so a
+// hit returns exactly the eval a fresh evaluation would have.
+typedef struct EvalCacheEntry {
+    uint32_t check;
+    int16_t output;
+    uint16_t unused;
+} EvalCacheEntry;
+
+// 2-way set associative: a bucket holds the two most recently stored positions that map to it
+typedef struct EvalCache {
+    EvalCacheEntry* entries;
+    uint64_t bucketMask;
+    const Network* network;
+    bool verify;
+    uint64_t probes;
+    uint64_t hits;
+    uint64_t collisions;
+} EvalCache;
+
+EvalCache* createEvalCache(int log2Entries);
+
+void freeEvalCache(EvalCache* cache);
+
+void clearEvalCache(EvalCache* cache, const Network* network);
+
+bool probeEvalCache(EvalCache* cache, uint64_t hash, int32_t* output);
+
+void storeEvalCache(EvalCache* cache, uint64_t hash, int32_t output);
+
+double evalCacheHitRate(const EvalCache* cache);
+
+#endif //UTTT2_EVAL_CACHE_H
@@ -3,56 +3,201 @@
 #pragma GCC target("avx2", "fma")
 
 
+#include <assert.h>
+#include <stdlib.h>
 #include "forward.h"
 #include "clipped_relu.h"
 #include "linear.h"
 
-#define HIDDEN_NEURONS 256
+
+// All kernels below take the amount of 16-neuron registers as a compile-time constant; DEFINE_KERNELS instantiates
+// them once per size in FOR_EACH_HIDDEN_SIZE so the accumulators stay in registers.
+inline __attribute__((always_inline)) void addFeature(const Network* network, int feature, __m256i* regs,
+                                                      int registers) {
+    const HiddenWeight* weights = &network->hiddenWeights[feature * registers * 16];
+    for (int i = 0; i < registers; i++) {
+#ifdef INT8_HIDDEN_WEIGHTS
+        // Sign-extend to int16 before adding: at most ~100 features are active at once, so the half scale sums stay
+        // below 100*127 + |bias| and can't overflow the int16 accumulators.
+        __m256i featureWeights = _mm256_cvtepi8_epi16(_mm_load_si128((__m128i*) &weights[i * 16]));
+#else
+        __m256i featureWeights = _mm256_load_si256((__m256i*) &weights[i * 16]);
+#endif
+        regs[i] = _mm256_add_epi16(regs[i], featureWeights);
+    }
+}
 
 
-void handlePlayerInput(PlayerBitBoard* playerBitBoard, bool isCurrentPlayer, __m256i regs[16]) {
+inline __attribute__((always_inline)) void handlePlayerInput(const Network* network, PlayerBitBoard* playerBitBoard,
+                                                             bool isCurrentPlayer, __m256i* regs, int registers) {
     uint16_t bigBoard = playerBitBoard->bigBoard;
     int bigBoardOffset = isCurrentPlayer? 0 : 90;
     while (bigBoard) {
-        addFeature(__builtin_ffs(bigBoard) - 1 + bigBoardOffset, regs);
+        addFeature(network, __builtin_ffs(bigBoard) - 1 + bigBoardOffset, regs, registers);
         bigBoard &= bigBoard - 1;
     }
     int smallBoardOffset = isCurrentPlayer? 9 : 99;
     int64_t lowBits = (int64_t) playerBitBoard->marks;
     int64_t highBits = (int64_t) (playerBitBoard->marks >> 64);
     while (lowBits) {
-        addFeature(__builtin_ffsl(lowBits) - 1 + smallBoardOffset, regs);
+        addFeature(network, __builtin_ffsl(lowBits) - 1 + smallBoardOffset, regs, registers);
         lowBits &= lowBits - 1;
     }
     while (highBits) {
-        addFeature(__builtin_ffsl(highBits) - 1 + smallBoardOffset + 64, regs);
+        addFeature(network, __builtin_ffsl(highBits) - 1 + smallBoardOffset + 64, regs, registers);
         highBits &= highBits - 1;
     }
 }
 
 
-void boardToInput(Board* board, __m256i regs[16]) {
-    for (int i = 0; i < 16; i++) {
-        regs[i] = _mm256_load_si256((__m256i*) &hiddenBiases[i * 16]);
+inline __attribute__((always_inline)) void boardToHidden(const Network* network, Board* board, __m256i* regs,
+                                                         int registers) {
+    for (int i = 0; i < registers; i++) {
+        regs[i] = _mm256_load_si256((__m256i*) &network->hiddenBiases[i * 16]);
     }
     PlayerBitBoard* p1 = &board->state.player1;
     PlayerBitBoard* currentPlayer = p1 + board->state.currentPlayer;
     PlayerBitBoard* otherPlayer = p1 + !board->state.currentPlayer;
-    handlePlayerInput(currentPlayer, true, regs);
-    handlePlayerInput(otherPlayer, false, regs);
+    handlePlayerInput(network, currentPlayer, true, regs, registers);
+    handlePlayerInput(network, otherPlayer, false, regs, registers);
+}
+
+
+int32_t applyHidden2Layer(const Network* network, const __m256i* regs, int registers) {
+    int32_t output = 0;
+    for (int i = 0; i < network->hidden2Neurons; i++) {
+        const int8_t* weights = &network->hidden2Weights[i * registers * 32];
+        // Weights are scaled by 64, shift back to the 0-127 activation scale
+        int32_t x = (applyLinear_1(regs, weights, registers) + network->hidden2Biases[i]) >> 6;
+        x = x < 0? 0 : x > 127? 127 : x;
+        output += x * network->outputWeights[i];
+    }
+    return output;
+}
+
+
+inline __attribute__((always_inline)) int32_t activationsToOutput(const Network* network, const __m256i* regs,
+                                                                  int packedRegisters) {
+    return network->hidden2Neurons == 0
+           ? applyLinear_1(regs, network->outputWeights, packedRegisters)
+           : applyHidden2Layer(network, regs, packedRegisters);
+}
+
+
+inline __attribute__((always_inline)) int32_t hiddenToOutput(const Network* network, __m256i* regs, int registers) {
+    applyClippedReLU(regs, registers);
+    return activationsToOutput(network, regs, (registers + 1) / 2);
+}
+
+
+// Only the logits of the given moves are computed, one dot product each
+inline __attribute__((always_inline)) void applyPolicy(const Network* network, const __m256i* regs,
+                                                       int packedRegisters, const Square* moves, int amountOfMoves,
+                                                       int32_t* logits) {
+    for (int i = 0; i < amountOfMoves; i++) {
+        int move = 9*moves[i].board + moves[i].position;
+        const int8_t* weights = &network->policyWeights[move * packedRegisters * 32];
+        logits[i] = applyLinear_1(regs, weights, packedRegisters) + network->policyBiases[move];
+    }
+}
+
+
+#define DEFINE_KERNELS(width)                                                                                         \
+void boardToInput##width(const Network* network, Board* board, Accumulator* accumulator) {                            \
+    __m256i regs[(width) / 16];                                                                                       \
+    boardToHidden(network, board, regs, (width) / 16);                                                                \
+    for (int i = 0; i < (width) / 16; i++) {                                                                          \
+        _mm256_store_si256((__m256i*) &accumulator->neurons[i * 16], regs[i]);                                        \
+    }                                                                                                                 \
+}                                                                                                                     \
+                                                                                                                      \
+int32_t outputWithFeatures##width(const Network* network, const Accumulator* accumulator, const int* features,        \
+                                  int amountOfFeatures) {                                                             \
+    __m256i regs[(width) / 16];                                                                                       \
+    for (int i = 0; i < (width) / 16; i++) {                                                                          \
+        regs[i] = _mm256_load_si256((__m256i*) &accumulator->neurons[i * 16]);                                        \
+    }                                                                                                                 \
+    for (int i = 0; i < amountOfFeatures; i++) {                                                                      \
+        addFeature(network, features[i], regs, (width) / 16);                                                         \
+    }                                                                                                                 \
+    return hiddenToOutput(network, regs, (width) / 16);                                                               \
+}                                                                                                                     \
+                                                                                                                      \
+int32_t output##width(const Network* network, Board* board) {                                                         \
+    __m256i regs[(width) / 16];                                                                                       \
+    boardToHidden(network, board, regs, (width) / 16);                                                                \
+    addFeature(network, board->state.currentBoard + 180, regs, (width) / 16);                                         \
+    return hiddenToOutput(network, regs, (width) / 16);                                                               \
+}                                                                                                                     \
+                                                                                                                      \
+int32_t outputWithPolicy##width(const Network* network, Board* board, const Square* moves, int amountOfMoves,         \
+                                int32_t* logits) {                                                                    \
+    __m256i regs[(width) / 16];                                                                                       \
+    boardToHidden(network, board, regs, (width) / 16);                                                                \
+    addFeature(network, board->state.currentBoard + 180, regs, (width) / 16);                                         \
+    applyClippedReLU(regs, (width) / 16);                                                                             \
+    applyPolicy(network, regs, ((width) / 16 + 1) / 2, moves, amountOfMoves, logits);                                 \
+    return activationsToOutput(network, regs, ((width) / 16 + 1) / 2);                                                \
 }
 
+FOR_EACH_HIDDEN_SIZE(DEFINE_KERNELS)
 
-float neuralNetworkEvalFromHidden(__m256i regs[16]) {
-    applyClippedReLU256(regs);
-    float x = applyLinear256_1(regs) + outputBias + 0.5f;
+
+void boardToInput(const Network* network, Board* board, Accumulator* accumulator) {
+    switch (network->hiddenNeurons) {
+#define CASE(width) case width: boardToInput##width(network, board, accumulator); return;
+        FOR_EACH_HIDDEN_SIZE(CASE)
+#undef CASE
+        default: assert(false && "boardToInput: unsupported network size"); abort();
+    }
+}
+
+
+int32_t neuralNetworkOutputWithFeatures(const Network* network, const Accumulator* accumulator, const int* features,
+                                        int amountOfFeatures) {
+    switch (network->hiddenNeurons) {
+#define CASE(width) case width: return outputWithFeatures##width(network, accumulator, features, amountOfFeatures);
+        FOR_EACH_HIDDEN_SIZE(CASE)
+#undef CASE
+        default: assert(false && "neuralNetworkOutputWithFeatures: unsupported network size"); abort();
+    }
+}
+
+
+int32_t neuralNetworkOutput(const Network* network, Board* board) {
+    switch (network->hiddenNeurons) {
+#define CASE(width) case width: return output##width(network, board);
+        FOR_EACH_HIDDEN_SIZE(CASE)
+#undef CASE
+        default: assert(false && "neuralNetworkOutput: unsupported network size"); abort();
+    }
+}
+
+
+int32_t neuralNetworkOutputWithPolicy(const Network* network, Board* board, const Square* moves, int amountOfMoves,
+                                      int32_t* logits) {
+    assert(network->policyWeights != NULL && "neuralNetworkOutputWithPolicy: network has no policy head");
+    switch (network->hiddenNeurons) {
+#define CASE(width) case width: return outputWithPolicy##width(network, board, moves, amountOfMoves, logits);
+        FOR_EACH_HIDDEN_SIZE(CASE)
+#undef CASE
+        default: assert(false && "neuralNetworkOutputWithPolicy: unsupported network size"); abort();
+    }
+}
+
+
+float outputToEval(const Network* network, int32_t output) {
+    float x = (float)output * (1.0f / (127*64)) + network->outputBias + 0.5f;
     return x < 0? 0 : x > 1? 1 : x;
 }
 
 
-float neuralNetworkEval(Board* board) {
-    __m256i regs[16];
-    boardToInput(board, regs);
-    addFeature(board->state.currentBoard + 180, regs);
-    return neuralNetworkEvalFromHidden(regs);
+float neuralNetworkEvalWithFeatures(const Network* network, const Accumulator* accumulator, const int* features,
+                                    int amountOfFeatures) {
+    return outputToEval(network, neuralNetworkOutputWithFeatures(network, accumulator, features, amountOfFeatures));
+}
+
+
+float neuralNetworkEval(const Network* network, Board* board) {
+    return outputToEval(network, neuralNetworkOutput(network, board));
 }
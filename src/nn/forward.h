@@ -1,20 +1,34 @@
 #ifndef UTTT2_FORWARD_H
 #define UTTT2_FORWARD_H
 
-#include <immintrin.h>
+#include <stdalign.h>
 #include "../board/board.h"
-#include "parameters.h"
+#include "network.h"
 
-inline __attribute__((always_inline)) void addFeature(int feature, __m256i regs[16]) {
-    for (int i = 0; i < 16; i++) {
-        regs[i] = _mm256_add_epi16(regs[i], _mm256_load_si256((__m256i*) &hiddenWeights[feature][i * 16]));
-    }
-}
+// First layer sums of a position, before the clipped ReLU
+typedef struct Accumulator {
+    alignas(32) int16_t neurons[MAX_HIDDEN_NEURONS];
+} Accumulator;
 
-void boardToInput(Board* board, __m256i regs[16]);
+// The network output is an integer scaled by 127*64; this converts it to a win probability for the player to move.
+// Every eval goes through this one compiled copy, so an output converted anywhere else, like a hit of the eval cache,
+// gives exactly the same float whatever flags the caller was built with.
+float outputToEval(const Network* network, int32_t output);
 
-float neuralNetworkEvalFromHidden(__m256i regs[16]);
+void boardToInput(const Network* network, Board* board, Accumulator* accumulator);
 
-float neuralNetworkEval(Board* board);
+int32_t neuralNetworkOutputWithFeatures(const Network* network, const Accumulator* accumulator, const int* features,
+                                        int amountOfFeatures);
+
+int32_t neuralNetworkOutput(const Network* network, Board* board);
+
+// Also writes the policy logits of `moves` (scaled by 127*64) to `logits`, from the same hidden layer
+int32_t neuralNetworkOutputWithPolicy(const Network* network, Board* board, const Square* moves, int amountOfMoves,
+                                      int32_t* logits);
+
+float neuralNetworkEvalWithFeatures(const Network* network, const Accumulator* accumulator, const int* features,
+                                    int amountOfFeatures);
+
+float neuralNetworkEval(const Network* network, Board* board);
 
 #endif //UTTT2_FORWARD_H
@@ -3,7 +3,6 @@
 
 #include <stdint.h>
 #include <immintrin.h>
-#include "parameters.h"
 
 
 inline __attribute__((always_inline)) void m256_add_dpbusd_epi32(__m256i* acc, __m256i a, __m256i b) {
@@ -14,18 +13,23 @@ inline __attribute__((always_inline)) void m256_add_dpbusd_epi32(__m256i* acc, _
 }
 
 
-inline __attribute__((always_inline)) float applyLinear256_1(__m256i regs[16]) {
-    __m256i sum = _mm256_setzero_si256();
-    for (int i = 0; i < 8; i++) {
-        m256_add_dpbusd_epi32(&sum, regs[i], _mm256_load_si256((__m256i*) &outputWeights[i * 32]));
-    }
+inline __attribute__((always_inline)) int32_t m256_hadd_epi32(__m256i sum) {
     __m128i sum128lo = _mm256_castsi256_si128(sum);
     __m128i sum128hi = _mm256_extracti128_si256(sum, 1);
     __m128i sum128 = _mm_add_epi32(sum128lo, sum128hi);
-    int output[4];
-    _mm_store_si128((__m128i*) &output[0], sum128);
-    int result = output[0] + output[1] + output[2] + output[3];
-    return (float)result * (1.0f / (127*64));
+    sum128 = _mm_add_epi32(sum128, _mm_shuffle_epi32(sum128, 0b01001110));
+    sum128 = _mm_add_epi32(sum128, _mm_shuffle_epi32(sum128, 0b10110001));
+    return _mm_cvtsi128_si32(sum128);
+}
+
+
+// Dot product of `registers` registers of packed int8 activations with a row of int8 weights
+inline __attribute__((always_inline)) int32_t applyLinear_1(const __m256i* regs, const int8_t* weights, int registers) {
+    __m256i sum = _mm256_setzero_si256();
+    for (int i = 0; i < registers; i++) {
+        m256_add_dpbusd_epi32(&sum, regs[i], _mm256_load_si256((__m256i*) &weights[i * 32]));
+    }
+    return m256_hadd_epi32(sum);
 }
 
 #endif //UTTT2_LINEAR_H
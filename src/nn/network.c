@@ -0,0 +1,216 @@
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "network.h"
+#include "../misc/util.h"
+
+#define ALIGN_UP(x) (((x) + NETWORK_FILE_ALIGNMENT - 1) / NETWORK_FILE_ALIGNMENT * NETWORK_FILE_ALIGNMENT)
+
+#ifdef INT8_HIDDEN_WEIGHTS
+#define HIDDEN_SCALE 63.5f
+#else
+#define HIDDEN_SCALE 127.0f
+#endif
+#define OUTPUT_SCALE 64.0f
+
+_Static_assert(sizeof(NetworkFileHeader) == NETWORK_FILE_ALIGNMENT, "NetworkFileHeader must keep the payload aligned");
+
+
+typedef struct NetworkLayout {
+    size_t hiddenWeightsOffset;
+    size_t hiddenWeightsSize;
+    size_t hiddenBiasesOffset;
+    size_t hiddenBiasesSize;
+    size_t hidden2WeightsOffset;
+    size_t hidden2WeightsSize;
+    size_t hidden2BiasesOffset;
+    size_t hidden2BiasesSize;
+    size_t outputWeightsOffset;
+    size_t outputWeightsSize;
+    size_t policyWeightsOffset;
+    size_t policyWeightsSize;
+    size_t policyBiasesOffset;
+    size_t policyBiasesSize;
+    size_t payloadSize;
+} NetworkLayout;
+
+
+NetworkLayout getNetworkLayout(int hiddenNeurons, int hidden2Neurons, int policyOutputs) {
+    NetworkLayout layout;
+    layout.hiddenWeightsOffset = 0;
+    layout.hiddenWeightsSize = INPUT_NEURONS * hiddenNeurons * sizeof(HiddenWeight);
+    layout.hiddenBiasesOffset = ALIGN_UP(layout.hiddenWeightsOffset + layout.hiddenWeightsSize);
+    layout.hiddenBiasesSize = hiddenNeurons * sizeof(int16_t);
+    layout.hidden2WeightsOffset = ALIGN_UP(layout.hiddenBiasesOffset + layout.hiddenBiasesSize);
+    layout.hidden2WeightsSize = hidden2Neurons * PADDED_NEURONS(hiddenNeurons) * sizeof(int8_t);
+    layout.hidden2BiasesOffset = ALIGN_UP(layout.hidden2WeightsOffset + layout.hidden2WeightsSize);
+    layout.hidden2BiasesSize = hidden2Neurons * sizeof(int32_t);
+    layout.outputWeightsOffset = ALIGN_UP(layout.hidden2BiasesOffset + layout.hidden2BiasesSize);
+    layout.outputWeightsSize = (hidden2Neurons > 0? hidden2Neurons : PADDED_NEURONS(hiddenNeurons)) * sizeof(int8_t);
+    layout.policyWeightsOffset = ALIGN_UP(layout.outputWeightsOffset + layout.outputWeightsSize);
+    layout.policyWeightsSize = policyOutputs * PADDED_NEURONS(hiddenNeurons) * sizeof(int8_t);
+    layout.policyBiasesOffset = ALIGN_UP(layout.policyWeightsOffset + layout.policyWeightsSize);
+    layout.policyBiasesSize = policyOutputs * sizeof(int32_t);
+    layout.payloadSize = ALIGN_UP(layout.policyBiasesOffset + layout.policyBiasesSize);
+    return layout;
+}
+
+
+int toPackedOrder(int neuron) {
+    int offset = neuron % 32;
+    int group = offset / 8;
+    return neuron - offset + (group == 1? offset + 8 : group == 2? offset - 8 : offset);
+}
+
+
+#define IS_HIDDEN_SIZE(neurons) || hiddenNeurons == (neurons)
+bool networkIsSupported(int hiddenNeurons, int hidden2Neurons) {
+    return (false FOR_EACH_HIDDEN_SIZE(IS_HIDDEN_SIZE)) && hidden2Neurons >= 0 && hidden2Neurons <= MAX_HIDDEN2_NEURONS;
+}
+
+
+uint64_t fnv1a(const uint8_t* data, size_t size) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+
+NetworkFileHeader createHeader(const Network* network, uint64_t checksum) {
+    NetworkFileHeader header;
+    memset(&header, 0, sizeof(NetworkFileHeader));
+    memcpy(header.magic, NETWORK_FILE_MAGIC, sizeof(NETWORK_FILE_MAGIC));
+    header.version = NETWORK_FILE_VERSION;
+    header.inputNeurons = INPUT_NEURONS;
+    header.hiddenNeurons = network->hiddenNeurons;
+    header.hidden2Neurons = network->hidden2Neurons;
+    header.outputNeurons = 1;
+    header.hiddenWeightBits = 8 * sizeof(HiddenWeight);
+    header.hiddenScale = HIDDEN_SCALE;
+    header.outputScale = OUTPUT_SCALE;
+    header.outputBias = network->outputBias;
+    header.policyOutputs = network->policyWeights != NULL? POLICY_OUTPUTS : 0;
+    header.payloadSize = getNetworkLayout(network->hiddenNeurons, network->hidden2Neurons,
+                                          (int) header.policyOutputs).payloadSize;
+    header.checksum = checksum;
+    return header;
+}
+
+
+bool headerIsCompatible(const NetworkFileHeader* header, const char* filename) {
+    if (memcmp(header->magic, NETWORK_FILE_MAGIC, sizeof(NETWORK_FILE_MAGIC)) != 0
+        || header->version != NETWORK_FILE_VERSION) {
+        fprintf(stderr, "%s is not a version %d network file\n", filename, NETWORK_FILE_VERSION);
+        return false;
+    }
+    if (header->inputNeurons != INPUT_NEURONS || header->outputNeurons != 1
+        || !networkIsSupported((int) header->hiddenNeurons, (int) header->hidden2Neurons)
+        || header->hiddenWeightBits != 8 * sizeof(HiddenWeight)
+        || (header->policyOutputs != 0 && header->policyOutputs != POLICY_OUTPUTS)
+        || header->hiddenScale != HIDDEN_SCALE || header->outputScale != OUTPUT_SCALE
+        || header->payloadSize != getNetworkLayout((int) header->hiddenNeurons, (int) header->hidden2Neurons,
+                                                   (int) header->policyOutputs).payloadSize) {
+        fprintf(stderr, "%s has a %ux%ux%ux%u network with %u policy outputs and %u-bit hidden weights, "
+                        "which this build can't run\n", filename, header->inputNeurons, header->hiddenNeurons,
+                header->hidden2Neurons, header->outputNeurons, header->policyOutputs, header->hiddenWeightBits);
+        return false;
+    }
+    return true;
+}
+
+
+Network* loadNetwork(const char* filename) {
+    int fd = open(filename, O_RDONLY);
+    if (fd == -1) {
+        perror(filename);
+        return NULL;
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) == -1 || fileStat.st_size < (off_t) sizeof(NetworkFileHeader)) {
+        fprintf(stderr, "%s is too small to be a network file\n", filename);
+        close(fd);
+        return NULL;
+    }
+    size_t size = fileStat.st_size;
+    // Mapped read-only and shared, so every process using the same file shares one physical copy of the weights
+    uint8_t* mapping = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        perror(filename);
+        return NULL;
+    }
+    const NetworkFileHeader* header = (const NetworkFileHeader*) mapping;
+    const uint8_t* payload = mapping + sizeof(NetworkFileHeader);
+    if (!headerIsCompatible(header, filename)) {
+        munmap(mapping, size);
+        return NULL;
+    }
+    if (size != sizeof(NetworkFileHeader) + header->payloadSize || fnv1a(payload, header->payloadSize) != header->checksum) {
+        fprintf(stderr, "%s is corrupt: checksum mismatch\n", filename);
+        munmap(mapping, size);
+        return NULL;
+    }
+    NetworkLayout layout = getNetworkLayout((int) header->hiddenNeurons, (int) header->hidden2Neurons,
+                                            (int) header->policyOutputs);
+    bool hasPolicy = header->policyOutputs > 0;
+    Network* network = safeMalloc(sizeof(Network));
+    network->hiddenNeurons = (int) header->hiddenNeurons;
+    network->hidden2Neurons = (int) header->hidden2Neurons;
+    network->hiddenWeights = (const HiddenWeight*) (payload + layout.hiddenWeightsOffset);
+    network->hiddenBiases = (const int16_t*) (payload + layout.hiddenBiasesOffset);
+    network->hidden2Weights = network->hidden2Neurons > 0? (const int8_t*) (payload + layout.hidden2WeightsOffset) : NULL;
+    network->hidden2Biases = network->hidden2Neurons > 0? (const int32_t*) (payload + layout.hidden2BiasesOffset) : NULL;
+    network->outputWeights = (const int8_t*) (payload + layout.outputWeightsOffset);
+    network->outputBias = header->outputBias;
+    network->policyWeights = hasPolicy? (const int8_t*) (payload + layout.policyWeightsOffset) : NULL;
+    network->policyBiases = hasPolicy? (const int32_t*) (payload + layout.policyBiasesOffset) : NULL;
+    network->mapping = mapping;
+    network->mappingSize = size;
+    return network;
+}
+
+
+void freeNetwork(Network* network) {
+    if (network->mapping != NULL) {
+        munmap(network->mapping, network->mappingSize);
+    }
+    safeFree(network);
+}
+
+
+bool saveNetwork(const Network* network, const char* filename) {
+    bool hasPolicy = network->policyWeights != NULL;
+    NetworkLayout layout = getNetworkLayout(network->hiddenNeurons, network->hidden2Neurons,
+                                            hasPolicy? POLICY_OUTPUTS : 0);
+    uint8_t* payload = safeMalloc(layout.payloadSize);
+    memset(payload, 0, layout.payloadSize);
+    memcpy(payload + layout.hiddenWeightsOffset, network->hiddenWeights, layout.hiddenWeightsSize);
+    memcpy(payload + layout.hiddenBiasesOffset, network->hiddenBiases, layout.hiddenBiasesSize);
+    if (network->hidden2Neurons > 0) {
+        memcpy(payload + layout.hidden2WeightsOffset, network->hidden2Weights, layout.hidden2WeightsSize);
+        memcpy(payload + layout.hidden2BiasesOffset, network->hidden2Biases, layout.hidden2BiasesSize);
+    }
+    memcpy(payload + layout.outputWeightsOffset, network->outputWeights, layout.outputWeightsSize);
+    if (hasPolicy) {
+        memcpy(payload + layout.policyWeightsOffset, network->policyWeights, layout.policyWeightsSize);
+        memcpy(payload + layout.policyBiasesOffset, network->policyBiases, layout.policyBiasesSize);
+    }
+    NetworkFileHeader header = createHeader(network, fnv1a(payload, layout.payloadSize));
+    FILE* file = fopen(filename, "wb");
+    bool success = file != NULL
+                   && fwrite(&header, sizeof(NetworkFileHeader), 1, file) == 1
+                   && fwrite(payload, layout.payloadSize, 1, file) == 1;
+    if (file != NULL) {
+        success = fclose(file) == 0 && success;
+    }
+    if (!success) {
+        perror(filename);
+    }
+    safeFree(payload);
+    return success;
+}
@@ -0,0 +1,74 @@
+#ifndef UTTT2_NETWORK_H
+#define UTTT2_NETWORK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "parameters.h"
+
+#define INPUT_NEURONS 190
+#define MAX_HIDDEN_NEURONS 1024
+#define MAX_HIDDEN2_NEURONS 64
+#define POLICY_OUTPUTS 81
+
+// Hidden layer widths with a compiled SIMD kernel. The kernels work for any multiple of 16, adding a width here is
+// enough to support it.
+#define FOR_EACH_HIDDEN_SIZE(X) X(32) X(64) X(128) X(256) X(512) X(1024)
+
+// The clipped ReLU packs pairs of 16-neuron registers into one register of 32 int8 activations, so everything
+// consuming them is padded to a multiple of 32 and stored in that packed order (see toPackedOrder)
+#define PADDED_NEURONS(n) (((n) + 31) / 32 * 32)
+
+#define NETWORK_FILE_MAGIC "UTTTNET"
+#define NETWORK_FILE_VERSION 3
+#define NETWORK_FILE_ALIGNMENT 64
+
+// Layout of a weight file: this header followed by hiddenWeights, hiddenBiases, hidden2Weights, hidden2Biases,
+// outputWeights, policyWeights and policyBiases, each starting at a multiple of NETWORK_FILE_ALIGNMENT bytes (the
+// hidden2 arrays are empty without a second hidden layer, the policy arrays without a policy head). The checksum is a
+// 64-bit FNV-1a hash of everything after the header.
+typedef struct NetworkFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t inputNeurons;
+    uint32_t hiddenNeurons;
+    uint32_t hidden2Neurons;
+    uint32_t outputNeurons;
+    uint32_t hiddenWeightBits;
+    float hiddenScale;
+    float outputScale;
+    float outputBias;
+    uint32_t policyOutputs;
+    uint64_t payloadSize;
+    uint64_t checksum;
+} NetworkFileHeader;
+
+// input -> hidden (int16 accumulators) -> clipped ReLU -> [hidden2 (int32) -> clipped ReLU] -> output
+//                                                      \-> [policy: one logit per square]
+typedef struct Network {
+    int hiddenNeurons;
+    int hidden2Neurons;
+    const HiddenWeight* hiddenWeights;  // [INPUT_NEURONS][hiddenNeurons]
+    const int16_t* hiddenBiases;        // [hiddenNeurons]
+    const int8_t* hidden2Weights;       // [hidden2Neurons][PADDED_NEURONS(hiddenNeurons)], inputs in packed order
+    const int32_t* hidden2Biases;       // [hidden2Neurons]
+    const int8_t* outputWeights;        // packed order after the first layer, natural order after the second
+    float outputBias;
+    const int8_t* policyWeights;        // [POLICY_OUTPUTS][PADDED_NEURONS(hiddenNeurons)] in packed order, or NULL
+    const int32_t* policyBiases;        // [POLICY_OUTPUTS], scaled by 127*64 like the output
+    void* mapping;
+    size_t mappingSize;
+} Network;
+
+extern const Network defaultNetwork;
+
+int toPackedOrder(int neuron);
+
+bool networkIsSupported(int hiddenNeurons, int hidden2Neurons);
+
+Network* loadNetwork(const char* filename);
+
+void freeNetwork(Network* network);
+
+bool saveNetwork(const Network* network, const char* filename);
+
+#endif //UTTT2_NETWORK_H
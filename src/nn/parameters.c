@@ -1,6 +1,7 @@
 #include <stdalign.h>
-#include "parameters.h"
+#include "network.h"
 
+#ifndef INT8_HIDDEN_WEIGHTS
 alignas(32) int16_t hiddenWeights[190][256] = {{16,2,-2,15,-136,-9,-9,3,-10,7,8,-1,8,12,-5,0,12,10,-6,-14,9,20,6,3,59,-33,17,9,-15,18,20,-47,-3,29,-78,-167,14,-29,-8,17,12,16,1,-57,5,19,6,-9,6,-35,9,28,87,-135,-7,-1,-4,9,9,6,-11,1,3,0,-134,1,-1,11,-28,-41,2,-137,-7,11,-86,8,9,-18,-73,2,-6,-20,-1,0,-6,-1,-4,5,-28,-52,-7,22,-1,-7,-157,-138,-11,7,-3,10,-169,-2,2,7,-5,3,9,4,-5,10,1,-51,5,41,-46,-2,-13,1,2,-8,25,2,10,10,-49,45,7,3,128,-4,1,15,2,0,8,-16,5,-75,-80,-2,4,-44,-50,5,43,0,-6,5,37,23,-4,-2,-93,16,25,8,-1,24,-18,-2,-79,-3,8,53,-4,-9,-43,7,-94,1,-21,1,2,10,5,-23,5,-153,-168,11,11,2,-5,23,-82,-73,-11,-164,9,-11,-18,6,6,5,7,24,11,-8,-4,10,32,-6,-5,-11,17,11,-10,6,8,7,4,24,-7,-11,26,2,-1,-5,-17,15,41,5,5,-167,78,-4,-32,-16,8,3,21,2,18,5,4,-5,-42,-40,7,-16,-2,-15,-18,-50,12,2,-18,139,-26,8,-106,3,0,2,-6,-35},
                                                {7,4,6,9,-1,-20,-140,-2,1,24,-1,-159,3,16,6,14,-16,4,-6,-16,5,7,17,-160,-46,-9,-111,3,-3,-90,-110,-44,7,-25,14,-5,10,-20,6,15,1,31,8,24,13,29,17,-11,-3,-15,-1,11,15,10,-6,-9,6,-99,-6,4,5,9,1,6,8,6,-2,-86,-13,-29,14,38,-147,5,-4,10,10,13,-18,19,-1,0,-10,1,-114,7,-6,3,7,-39,-10,10,-2,21,14,-156,2,-10,3,11,-4,9,-5,0,7,5,11,0,-8,-10,10,12,2,-32,-39,7,3,9,9,8,-25,10,13,8,-38,-6,13,-10,-22,1,-133,-93,1,9,-1,-3,-10,8,6,-154,10,-13,-33,214,43,-5,-2,-2,40,28,4,-135,-5,2,27,2,-24,-9,20,15,9,1,-8,44,6,2,-20,5,-21,2,-8,12,-4,-84,-1,16,9,2,4,11,12,-27,-6,-31,15,10,63,4,3,3,8,1,4,-50,5,5,2,1,9,4,24,-15,53,7,12,8,-4,7,-15,-4,-10,27,-11,8,29,-7,-2,4,28,14,-7,14,13,7,2,-81,6,12,7,10,-32,-19,-1,13,7,-91,65,-28,13,-2,-1,-6,167,54,-3,7,-5,-3,-18,7,11,7,-2,-1,1,-10},
                                                {-127,5,11,54,-3,-16,-5,-9,-8,0,9,-4,8,6,10,-2,3,5,-4,-80,-9,17,3,4,-51,-17,10,-13,-50,14,19,15,-89,-19,14,7,27,-40,4,-90,3,13,0,10,5,16,7,0,-11,-15,-19,11,6,1,-11,-1,15,11,5,8,14,-3,1,-87,7,-141,-8,11,30,-38,-3,30,3,1,7,12,-76,4,-11,4,-5,-25,-5,2,0,-148,-7,0,-1,14,-1,19,-2,13,18,-135,-6,10,-6,-2,0,1,-9,-1,-1,5,-95,-3,55,-11,-8,18,-1,-67,53,-7,5,3,13,3,-52,1,-7,-73,-62,-8,5,-7,18,-5,7,12,7,-3,-4,14,10,2,-7,-6,-2,40,46,10,-128,-3,-6,8,33,-161,-141,6,37,2,-5,1,-5,21,-17,6,7,-35,-5,56,1,-6,-18,1,-6,-8,7,1,242,4,8,4,12,3,3,-85,-31,-3,11,-74,10,8,-16,-4,5,-1,-20,36,15,0,-15,20,3,5,5,-1,7,11,-5,-16,16,2,-154,0,6,-5,15,1,-12,12,23,-85,-2,-3,12,-7,-17,-10,4,6,-11,-4,11,6,12,8,-43,-9,11,5,-91,9,-41,-38,-130,-1,-17,-18,-4,-62,25,-138,1,12,-14,-141,12,-7,1,4,-4,21},
@@ -193,7 +194,202 @@ alignas(32) int16_t hiddenWeights[190][256] = {{16,2,-2,15,-136,-9,-9,3,-10,7,8,
                                                {-45,-1,-32,-13,-16,-1,-10,-27,-7,-4,3,-10,3,23,8,-9,4,-16,-13,5,8,63,-6,-8,25,4,0,3,-3,-26,-4,23,5,32,9,-17,5,6,-24,7,14,-43,-16,11,-19,-36,0,-7,7,-29,-1,4,-8,-14,-8,-3,22,0,1,6,-14,0,-15,6,-50,-14,-24,29,47,14,-8,-43,7,-1,5,-37,0,22,5,-12,-16,-39,20,-9,1,-19,-40,8,-21,41,9,-8,-10,-27,-33,-28,6,5,-18,-11,-20,-18,-8,22,-18,12,7,-4,-27,-7,-15,-13,-11,19,22,-23,1,-12,7,-15,-6,-8,4,10,18,23,-32,7,-10,-13,-12,3,-15,-15,5,2,-1,4,7,-13,-11,0,23,-4,-58,0,-22,8,12,-54,-14,-11,3,-3,-11,10,-51,1,0,-16,-1,-20,0,-21,-19,-26,16,-26,-27,12,8,-19,-8,6,6,-26,11,-11,-16,4,-46,16,5,47,3,2,19,-21,-11,1,-3,-12,-4,-7,4,29,-8,8,-12,6,7,16,-27,-12,-49,6,-18,-3,13,-2,3,-6,-26,7,12,9,-7,-24,-18,-84,14,3,-19,-15,-18,-3,38,6,-11,-6,11,-21,15,-26,17,7,7,27,-22,-6,3,7,8,14,19,-17,2,16,48,-9,-4,-15,-3,-10,-14,0}};
 
 alignas(32) int16_t hiddenBiases[256] = {-141,-105,-158,-76,-84,-79,-96,-73,-80,-25,-49,-75,-113,-87,-143,-92,-76,-81,-72,-96,-93,-116,-123,-89,-149,-66,-72,-109,-76,-102,-120,-86,-80,-118,-78,-72,-19,-82,-87,-67,-103,-105,-86,-72,-138,-121,-55,-78,-97,-84,-77,-249,-105,-49,-84,-11,-92,-63,-74,-76,-83,-99,-128,-67,-133,-117,-91,-83,-123,-114,-34,-144,3,-100,-88,-205,-101,-195,-115,-64,-110,-146,-109,-115,-116,-72,-160,-81,-65,-96,-69,-103,-74,-93,-46,-83,0,-66,-128,-114,-129,-138,-10,-114,-130,-121,-84,-104,-91,-68,-69,-210,-77,-84,-143,-97,-114,-109,-89,-67,-44,-49,-74,-97,-82,-119,-80,-78,-95,-69,-87,-69,-164,-80,-123,-72,-106,-82,-81,-53,-81,34,-81,-76,-166,-12,-74,-80,-92,-102,-56,-80,-98,-124,-96,-74,-137,-44,-95,-79,-112,-147,-4,-108,-110,-139,17,-63,-73,-167,-22,-87,-97,-70,-66,-134,-49,-70,-65,-79,-139,-183,-80,-97,-86,-125,-98,-66,-69,-126,-83,-114,-119,-64,-99,-144,-53,-75,-68,-66,-49,-79,-103,-78,-127,-104,-108,-110,-108,4,13,-40,-81,-98,-52,-79,-52,-133,-65,-121,-1,-61,-78,-127,-97,-18,-104,-61,-82,-75,-71,-61,-27,-121,-2,-76,-117,-138,-24,-75,-60,7,-91,-79,-19,-69,-68,11,-40,-54,-120,-104,-55,-73,-88,-31};
+#else
+alignas(32) int8_t hiddenWeights[190][256] = {{8,1,-1,8,-68,-5,-5,2,-5,4,4,-1,4,6,-3,0,6,5,-3,-7,5,10,3,2,30,-17,9,5,-8,9,10,-24,-2,15,-39,-84,7,-15,-4,9,6,8,1,-29,3,10,3,-5,3,-18,5,14,44,-68,-4,-1,-2,5,5,3,-6,1,2,0,-67,1,-1,6,-14,-21,1,-69,-4,6,-43,4,5,-9,-37,1,-3,-10,-1,0,-3,-1,-2,3,-14,-26,-4,11,-1,-4,-79,-69,-6,4,-2,5,-85,-1,1,4,-3,2,5,2,-3,5,1,-26,3,21,-23,-1,-7,1,1,-4,13,1,5,5,-25,23,4,2,64,-2,1,8,1,0,4,-8,3,-38,-40,-1,2,-22,-25,3,22,0,-3,3,19,12,-2,-1,-47,8,13,4,-1,12,-9,-1,-40,-2,4,27,-2,-5,-22,4,-47,1,-11,1,1,5,3,-12,3,-77,-84,6,6,1,-3,12,-41,-37,-6,-82,5,-6,-9,3,3,3,4,12,6,-4,-2,5,16,-3,-3,-6,9,6,-5,3,4,4,2,12,-4,-6,13,1,-1,-3,-9,8,21,3,3,-84,39,-2,-16,-8,4,2,11,1,9,3,2,-3,-21,-20,4,-8,-1,-8,-9,-25,6,1,-9,70,-13,4,-53,2,0,1,-3,-18},
+                                              {4,2,3,5,-1,-10,-70,-1,1,12,-1,-80,2,8,3,7,-8,2,-3,-8,3,4,9,-80,-23,-5,-56,2,-2,-45,-55,-22,4,-13,7,-3,5,-10,3,8,1,16,4,12,7,15,9,-6,-2,-8,-1,6,8,5,-3,-5,3,-50,-3,2,3,5,1,3,4,3,-1,-43,-7,-15,7,19,-74,3,-2,5,5,7,-9,10,-1,0,-5,1,-57,4,-3,2,4,-20,-5,5,-1,11,7,-78,1,-5,2,6,-2,5,-3,0,4,3,6,0,-4,-5,5,6,1,-16,-20,4,2,5,5,4,-13,5,7,4,-19,-3,7,-5,-11,1,-67,-47,1,5,-1,-2,-5,4,3,-77,5,-7,-17,107,22,-3,-1,-1,20,14,2,-68,-3,1,14,1,-12,-5,10,8,5,1,-4,22,3,1,-10,3,-11,1,-4,6,-2,-42,-1,8,5,1,2,6,6,-14,-3,-16,8,5,32,2,2,2,4,1,2,-25,3,3,1,1,5,2,12,-8,27,4,6,4,-2,4,-8,-2,-5,14,-6,4,15,-4,-1,2,14,7,-4,7,7,4,1,-41,3,6,4,5,-16,-10,-1,7,4,-46,33,-14,7,-1,-1,-3,84,27,-2,4,-3,-2,-9,4,6,4,-1,-1,1,-5},
+                                              {-64,3,6,27,-2,-8,-3,-5,-4,0,5,-2,4,3,5,-1,2,3,-2,-40,-5,9,2,2,-26,-9,5,-7,-25,7,10,8,-45,-10,7,4,14,-20,2,-45,2,7,0,5,3,8,4,0,-6,-8,-10,6,3,1,-6,-1,8,6,3,4,7,-2,1,-44,4,-71,-4,6,15,-19,-2,15,2,1,4,6,-38,2,-6,2,-3,-13,-3,1,0,-74,-4,0,-1,7,-1,10,-1,7,9,-68,-3,5,-3,-1,0,1,-5,-1,-1,3,-48,-2,28,-6,-4,9,-1,-34,27,-4,3,2,7,2,-26,1,-4,-37,-31,-4,3,-4,9,-3,4,6,4,-2,-2,7,5,1,-4,-3,-1,20,23,5,-64,-2,-3,4,17,-81,-71,3,19,1,-3,1,-3,11,-9,3,4,-18,-3,28,1,-3,-9,1,-3,-4,4,1,121,2,4,2,6,2,2,-43,-16,-2,6,-37,5,4,-8,-2,3,-1,-10,18,8,0,-8,10,2,3,3,-1,4,6,-3,-8,8,1,-77,0,3,-3,8,1,-6,6,12,-43,-1,-2,6,-4,-9,-5,2,3,-6,-2,6,3,6,4,-22,-5,6,3,-46,5,-21,-19,-65,-1,-9,-9,-2,-31,13,-69,1,6,-7,-71,6,-4,1,2,-2,11},
+                                              {1,-38,3,5,-1,-3,4,5,-71,12,-5,7,0,14,-5,8,7,5,7,0,4,7,4,5,35,-11,-3,2,-61,10,2,-17,-6,-23,4,3,8,-11,-9,5,-69,8,-1,18,6,15,-4,-4,-2,-35,-52,15,4,-82,-8,-4,4,-44,127,-4,9,2,5,-1,-69,6,2,5,-7,-12,-64,16,-7,5,7,-25,2,-14,5,-71,22,-8,0,-54,3,3,-3,-1,7,-23,5,5,3,12,9,4,1,1,1,5,2,-2,-1,0,4,-6,2,0,-3,-8,2,9,-6,25,-22,0,1,2,-4,0,-10,-68,-6,1,31,-9,19,1,-2,-2,3,2,-60,-72,5,3,5,5,7,6,1,-4,-15,5,23,-34,1,-4,-14,14,2,3,-2,-67,2,9,-2,1,16,-16,5,6,-1,-4,-54,0,-6,6,32,2,7,7,2,-1,4,7,3,-4,5,-7,12,7,3,-1,-2,-8,1,2,-9,-7,0,-1,2,11,5,10,-17,4,-1,-49,11,-6,-1,3,9,3,6,8,2,-5,-3,4,1,3,-9,-1,4,2,56,-38,0,0,3,3,-1,4,-18,0,5,-4,-22,-16,10,-4,3,-1,-13,41,6,1,-44,-6,2,-18,-2,6,5,3,-1,-1,5,-76,4,0,6,-6},
+                                              {20,-66,14,-11,-3,78,-6,-88,-6,-4,1,-9,2,10,3,-5,2,-3,-5,2,-26,-33,4,-3,-21,5,-4,2,13,-45,-6,13,3,21,2,-4,4,-27,-85,6,-31,-27,-6,-19,-2,-114,5,-5,4,-12,3,-39,14,9,-6,2,-27,13,8,1,5,-2,-99,3,23,0,-28,-9,18,-15,-2,-83,5,1,-3,9,-7,-70,2,-4,-6,65,9,7,7,-6,1,2,-7,18,1,-54,-5,-35,-88,11,-4,-1,-4,2,-1,-3,-5,-33,-3,-48,3,4,2,-27,1,-1,-3,-29,-21,-6,-6,-1,-32,-2,-21,-41,-9,2,17,22,-38,3,-3,-6,-80,2,9,-4,1,3,-110,1,3,-5,-5,-12,-36,-7,-81,7,2,1,-20,-96,-1,-9,20,-5,7,1,1,6,22,10,-7,-5,-4,-16,-5,-6,-20,10,7,-19,19,-5,9,6,3,-22,2,-4,0,-1,7,-4,-4,15,1,0,-4,-1,-6,2,3,15,-6,4,-7,12,-6,6,-5,6,8,-8,-1,-5,17,-36,1,5,-34,-5,30,-13,-88,-28,-23,-1,-7,47,-7,-61,15,4,-94,-1,0,-6,3,6,5,-4,14,-77,-1,-90,2,4,25,23,-72,-7,4,1,33,21,1,1,5,27,-34,5,4,-1,-8,-3,2,5},
+                                              {-76,-61,4,4,6,-8,4,-4,1,14,6,5,4,27,9,-49,1,6,5,4,3,-54,3,6,-20,-36,-2,-9,-4,7,2,-19,6,-13,2,6,-24,-13,7,13,-3,7,-75,12,4,15,-1,-4,-5,-4,2,12,2,0,6,1,5,1,-6,-7,7,-1,4,2,-1,0,1,2,-18,-10,0,16,-72,3,2,-21,4,5,0,2,3,-2,-5,8,2,-1,-3,2,4,-8,3,7,2,15,9,5,-2,7,1,-1,6,5,0,-3,1,-8,3,-2,-3,-6,-3,6,-3,-13,29,2,5,6,5,5,25,-68,1,-8,27,6,-49,2,-4,-83,3,0,7,-2,1,-36,6,-1,-5,5,0,-6,21,3,19,-20,8,-3,-13,15,1,8,7,3,-2,-4,-3,10,24,2,2,1,0,6,-2,5,-15,10,-62,5,-28,3,-4,-2,-37,8,3,1,8,-3,1,5,-44,-11,-5,1,-2,3,-58,2,3,2,-40,8,1,9,2,1,-67,7,10,-8,-2,3,7,-6,3,-39,3,2,0,-6,3,4,-10,5,5,3,2,-48,1,-1,1,8,0,-3,2,1,114,-1,-15,-10,-4,0,4,1,-16,39,8,-1,7,-4,-1,-17,3,5,-36,5,-2,-90,5,4,1,6,5,-5},
+                                              {9,1,4,-28,-1,3,-2,4,-1,-8,-4,3,-9,16,-6,4,-40,-1,-2,3,-3,10,-2,4,28,2,-3,3,15,4,-2,11,0,-11,-6,-3,10,15,-3,12,7,5,3,13,-2,5,6,-2,107,-10,6,-69,6,-66,-7,2,7,8,10,-37,15,6,-2,4,-62,3,-3,3,14,18,1,19,-33,1,4,9,-8,1,5,-2,-8,-2,2,-3,1,2,-3,-4,-1,14,-33,5,-1,3,8,3,4,2,46,-1,2,-91,3,6,-3,1,-1,-2,-1,-3,-75,10,-28,20,-26,-6,3,-86,5,-3,5,6,0,4,-26,-25,3,4,-1,5,6,-10,-5,-4,-30,-8,7,-3,4,-2,-1,-3,-32,4,-70,3,-61,4,-21,-82,-3,-1,7,8,-1,-36,-6,15,6,8,3,-3,-3,-11,-4,-2,-7,-71,-7,2,-10,2,9,2,-7,2,-67,1,-1,2,12,4,-1,-10,2,-8,1,1,-3,-44,5,2,2,14,-32,9,1,-38,-2,-1,13,28,-4,-2,-60,4,2,6,2,6,5,-1,3,5,-16,2,-3,-11,-16,19,-73,5,-2,0,0,-3,-47,-1,4,-78,-5,3,-43,0,13,-15,-20,-20,-70,1,4,-22,5,-22,7,-4,4,2,-3,5,6,-4,-3,-80,-2,9},
+                                              {7,2,-48,1,5,0,2,1,5,3,4,2,-8,-59,8,8,-4,-3,-72,1,5,4,-65,5,-19,-18,5,4,-58,11,-1,-19,1,-14,-3,0,9,21,3,13,3,-51,5,13,-1,15,4,17,3,-6,-2,13,3,6,-5,-3,-3,3,3,7,17,-71,-1,1,4,6,1,8,-15,23,7,15,-7,125,-5,2,2,4,0,3,-1,-15,-1,3,9,6,-4,4,5,-6,7,-7,-75,21,8,4,-31,-3,3,-2,7,3,1,-61,2,3,-7,6,-2,-2,2,7,-8,-14,-23,1,5,-5,4,6,-17,1,4,0,-19,-2,6,6,-5,6,-69,5,-1,6,-9,1,6,0,1,3,3,-5,-16,-1,23,2,1,6,-14,18,4,0,9,3,14,4,58,-19,-26,23,0,6,-1,-5,2,5,-13,-81,-5,1,-1,5,2,8,-2,2,-4,6,1,0,8,2,-2,-8,1,0,-8,5,1,3,-55,2,3,21,6,6,4,5,10,1,-34,-11,-5,6,-70,4,6,4,-8,-3,-3,8,5,4,-7,-7,-74,3,11,7,-6,-46,-7,6,-3,3,11,-57,9,3,-21,-9,6,6,4,6,35,-18,5,-7,1,-3,7,29,6,1,1,3,-2,6,1,3,-74,-6,2,-5},
+                                              {-58,-2,1,3,3,0,1,-2,3,-1,-27,-4,-26,13,-53,2,3,-74,0,6,3,6,-1,5,-24,5,1,-25,8,1,2,-25,6,13,2,5,11,16,6,-9,2,7,-2,13,-83,6,-4,-4,4,-6,-9,14,-25,2,-5,-1,-72,-40,2,6,-3,6,4,-2,4,1,1,5,-28,18,-1,-69,-3,4,2,6,4,1,4,2,-1,-6,2,1,2,2,42,-36,3,1,5,7,2,14,-76,5,3,-37,-1,-74,5,2,3,8,-20,3,-2,124,-6,2,-2,-23,3,-31,26,-1,-34,-2,5,-85,-11,1,13,-7,-30,14,4,-30,-13,4,4,-6,3,-1,-9,8,4,4,1,-2,-77,-10,20,6,23,-5,3,-36,-22,15,2,4,1,2,10,-2,-4,14,7,8,-9,0,-1,1,3,1,-13,-65,-2,-3,0,-55,-6,-13,1,-7,-4,3,-2,3,12,3,7,13,2,3,1,-2,2,2,6,2,8,15,1,-52,-3,-2,1,-9,9,-10,-4,-3,-74,2,3,-3,3,1,6,-10,3,-7,-11,5,-2,-4,13,13,13,-1,-4,3,-5,1,12,5,7,1,12,1,7,5,1,3,-21,-20,5,22,-1,-4,2,-33,-55,1,4,-18,-6,-45,12,0,-3,5,-81,-13},
+                                              {8,6,-3,-1,-37,5,-1,1,-1,-2,2,3,0,-6,3,2,-1,2,-1,1,-1,1,-2,3,17,4,1,-1,2,0,3,-8,1,10,-21,10,-5,-2,-3,3,4,6,3,-7,1,7,4,-2,4,6,2,-1,11,-5,-3,-6,0,-4,7,0,0,-1,2,2,-4,3,-2,2,-3,-2,-2,-3,2,4,-22,-1,1,7,53,2,-1,-3,-3,5,3,1,-4,2,9,3,0,-2,-2,-6,-7,-1,0,-1,1,3,-39,0,-9,-2,1,-1,-2,5,-2,-4,4,27,3,16,-2,2,3,3,2,-3,0,4,-5,-2,-3,-5,6,1,33,1,6,2,1,3,1,1,0,-23,-21,1,4,-2,-4,9,12,-1,1,2,10,11,0,-2,8,2,-18,1,2,0,-13,3,54,3,-2,9,1,-32,-6,3,-5,1,-1,2,2,0,-2,2,1,12,9,1,4,8,-1,9,-25,57,2,11,2,3,-2,3,-1,7,0,-2,3,4,-1,1,-2,-4,-2,2,8,1,0,-1,-2,2,2,-9,-1,2,8,0,1,-2,2,3,9,-2,2,-37,15,-1,3,3,5,3,16,0,-1,2,1,3,-1,-4,5,-1,2,-3,4,-3,12,3,2,-1,3,5,32,2,0,2,-2,-3},
+                                              {5,6,2,-1,4,4,-1,2,-1,4,1,-1,-2,8,-1,-1,-1,1,1,1,0,2,-4,-1,7,3,-6,-2,6,2,-5,-2,-1,3,-8,-55,-6,-3,0,1,4,4,2,3,1,3,4,-1,3,2,0,4,5,-5,-3,1,1,8,6,-2,-1,-2,1,0,-6,1,1,6,-4,-3,0,-7,4,1,36,-1,0,2,33,-1,-3,-4,8,3,-5,1,-2,-1,14,-3,1,-3,1,-2,-7,-7,1,-1,-1,0,-75,2,1,-1,2,-2,-3,2,-3,-1,0,0,-2,9,-5,3,0,2,1,-1,2,-1,-4,-3,-6,6,6,1,8,2,2,-3,-1,2,-2,0,0,-15,-10,1,1,-1,-3,2,6,1,-1,-1,4,7,1,-4,-5,0,-5,-1,-1,2,-5,4,-13,1,-1,2,1,14,-1,5,-7,-4,-1,2,2,-7,-2,2,-2,12,9,-1,5,7,-1,4,-14,-8,-2,15,-1,0,-3,4,-2,-5,-1,4,4,3,2,-2,1,2,-2,3,7,-3,1,-3,-1,2,0,4,2,0,5,-3,3,-1,1,5,0,-5,3,18,15,-3,3,0,2,3,6,0,-3,2,1,-9,-4,-5,6,-1,1,0,7,-6,9,2,1,-4,2,6,6,-1,0,0,-3,-3},
+                                              {2,7,4,-5,10,4,1,0,-1,-2,1,2,-2,-3,0,-1,-1,3,-1,-6,3,-1,-2,2,8,-4,1,-1,-2,-2,2,-5,-5,5,-12,18,-5,-3,-2,7,1,1,1,-6,2,7,2,-3,4,4,1,0,10,-9,-3,-2,-1,8,4,-2,-3,-1,1,-3,-9,-1,-4,1,-2,-3,-2,-9,3,5,-14,2,-4,4,31,2,-2,-5,9,3,3,2,-2,-1,-54,-3,1,-3,0,0,-10,-8,1,-2,-3,-3,-72,0,-6,-1,4,-1,-5,3,-1,-2,-1,2,2,10,-6,1,0,1,2,1,5,4,-8,-7,-5,3,1,2,16,2,7,-1,-1,0,0,-1,1,30,30,1,2,-5,-7,4,5,1,-2,-2,7,7,-1,-1,4,1,-10,0,-4,2,-10,-7,-13,0,-2,2,1,16,-7,7,-6,-1,3,4,5,-3,-2,2,-1,19,17,-4,6,4,-1,3,-14,-10,-1,-64,2,1,-1,3,-2,-2,3,2,4,4,4,1,1,-1,-3,2,6,-1,-2,-2,-2,4,-2,3,-1,1,6,-7,0,-4,6,8,2,-2,4,20,17,-1,0,1,4,0,7,4,2,2,-1,2,-4,-3,5,-2,3,-5,2,-2,11,2,0,-4,1,2,13,-2,-3,-1,-1,-1},
+                                              {3,3,4,0,-60,1,-1,1,-7,1,2,1,-2,2,0,-1,-3,3,-1,0,-2,1,-3,1,6,-6,1,-3,0,-2,0,-2,1,4,-11,11,-2,-3,-1,0,2,2,2,6,2,5,3,-2,2,0,-6,5,5,-6,0,-2,1,8,5,-1,-2,-1,2,0,-9,0,2,1,-4,-4,-3,-7,3,3,-15,6,-2,4,-9,-3,-2,-6,-4,-3,3,-1,-1,-1,12,-3,-1,-4,-1,-2,-9,-7,-2,-1,-1,0,12,1,-1,-1,2,-2,-2,3,-4,-1,2,-3,1,11,-4,3,-1,3,2,0,3,1,-7,-2,-6,3,2,0,6,2,3,1,1,2,-2,-1,-1,-12,-9,2,-1,-1,-3,4,4,-1,4,-1,4,9,-1,-2,-2,-9,-3,-2,-5,1,-3,-2,-11,2,-3,1,-1,15,-1,3,-3,-5,0,5,1,0,-2,5,-1,-63,10,1,-1,1,-3,4,37,32,-2,11,2,1,-2,1,-1,-1,-2,1,4,1,1,-8,-2,2,-2,-1,4,-2,-1,-4,-3,4,-2,3,1,-1,4,-1,-1,-1,2,-4,1,-2,2,-68,16,-2,2,2,1,3,5,3,2,1,0,2,-5,-2,5,0,-7,-1,1,-6,9,1,-3,-7,-1,4,8,-1,1,2,-1,-2},
+                                              {2,4,3,2,14,-2,2,5,1,3,5,1,1,-1,1,0,1,3,1,-1,-2,-3,-1,1,10,-1,1,0,0,1,4,-10,2,5,-31,-59,-5,-4,1,-3,1,1,5,-33,1,8,-2,-1,7,-2,0,5,16,-12,-3,-5,-3,7,3,1,-4,-1,6,3,-11,2,-2,2,-1,-9,1,-13,0,4,39,1,2,-5,-21,4,-1,-5,2,4,4,-2,-6,2,-45,-9,2,-1,3,-2,-14,-13,-1,-1,-1,1,16,-2,1,-1,1,-4,-2,4,-4,-2,-1,-3,5,9,-8,2,2,3,-1,1,8,-4,-7,-1,-11,-2,2,2,24,1,1,1,0,2,2,3,1,37,-24,2,3,-6,-6,3,4,2,1,-1,5,7,-1,-1,10,3,-8,2,-1,2,-8,-5,35,0,1,4,3,-62,-8,7,-8,-8,2,3,1,-1,-2,1,1,-58,20,1,3,-5,-1,9,39,-24,1,19,0,2,-2,2,-1,4,3,-4,3,4,3,-2,1,-2,2,-1,4,-3,-1,-1,-4,1,-1,-3,3,-4,5,0,-1,-8,4,0,15,-3,5,19,18,-2,0,1,4,1,12,2,-1,5,1,4,-6,-10,1,-4,2,-5,3,-10,12,1,1,-6,-6,8,6,0,1,0,-1,-6},
+                                              {2,-1,-1,-2,8,3,1,3,-4,4,1,-1,-1,-2,1,-6,-1,2,2,-1,1,3,-3,1,7,-3,1,-1,1,6,1,-3,-1,4,-13,14,-9,-4,1,1,3,3,1,-1,2,3,2,-2,3,2,1,3,5,-5,-2,-3,2,9,3,1,-1,-1,3,1,-7,1,1,1,-4,-3,2,-9,4,2,-15,4,0,3,-9,4,-1,-3,1,2,1,0,-1,-1,16,-3,-1,-3,0,-7,-7,-5,2,-1,-3,-2,10,1,-1,1,1,0,-3,3,-2,1,0,1,2,8,-5,1,-1,3,1,0,2,3,-1,0,-3,1,6,1,11,-1,5,1,-1,2,1,-5,-3,-11,30,1,1,-4,-2,4,6,0,-1,2,5,6,3,-2,1,1,-5,1,-3,4,-7,5,-10,2,3,3,-1,14,1,5,-6,-3,-13,1,1,-1,-7,3,-2,-67,11,-1,2,5,-8,3,33,-6,-1,-68,7,1,-3,1,-7,2,0,1,2,1,-2,-3,-3,5,-1,4,3,1,0,-7,-2,1,-4,0,2,0,4,-1,0,0,-2,2,2,-4,4,12,15,0,1,-2,5,1,4,1,-4,1,2,2,-4,-3,6,-4,-2,-3,3,-4,11,1,-7,-5,-2,4,4,0,-2,2,0,-2},
+                                              {5,6,3,2,-55,4,3,-1,0,-1,3,2,-2,2,1,-2,-6,2,0,0,3,3,-3,3,11,-3,2,-3,7,1,3,-4,1,4,32,18,-5,-5,-1,2,3,2,2,-2,1,8,-4,-1,5,3,0,1,9,-9,-3,-2,-2,10,2,-7,-6,-3,1,2,-11,1,-3,2,-1,-5,-1,-12,-2,2,-12,3,2,4,-13,2,-1,-8,-3,3,2,-1,-2,0,-63,-5,-6,-1,-3,1,-11,-8,-3,-1,-4,-2,16,0,-2,-2,2,-2,-2,2,-4,2,1,0,5,11,-6,1,1,2,2,-1,-1,6,-6,-3,-4,3,2,2,19,2,5,1,2,1,-3,1,0,29,-13,1,3,-6,-5,3,5,-1,1,-1,5,4,0,-1,2,1,-9,-4,-2,6,-7,3,-13,-1,1,2,4,17,-6,1,-12,-2,-5,4,1,-2,-1,0,-5,19,-64,1,2,4,-1,4,-17,33,-3,16,5,-4,-2,1,-1,4,-6,2,4,-5,-1,-2,2,4,-2,-1,-1,-1,0,-2,-2,0,2,2,-1,1,6,-2,-2,-1,-3,4,1,-2,2,-63,16,0,-11,2,4,3,6,2,-3,2,5,4,-5,-7,5,-2,2,-7,3,-7,11,2,1,-5,-1,7,8,2,2,2,-2,-8},
+                                              {6,5,6,-1,7,4,1,3,-3,4,2,3,-1,-9,0,-2,0,3,-5,0,-1,2,-9,2,7,-6,0,-3,1,-1,2,-2,-1,5,31,-58,-6,-3,2,-1,4,10,3,0,1,3,2,1,3,3,1,2,7,-5,-2,1,2,7,4,-1,-2,-6,3,1,-2,1,2,1,-2,-3,0,-6,3,4,32,2,1,0,-8,1,-2,-5,-1,1,1,2,-3,1,12,-7,0,-2,-1,-3,-9,-5,-1,-2,-2,1,9,1,-5,-1,2,-3,0,2,-3,-1,2,0,5,9,-3,3,-1,2,0,1,5,3,-7,-1,-5,1,4,1,7,3,1,-1,1,1,1,1,-1,-14,-13,-2,3,1,-3,3,6,0,2,-1,5,7,1,-1,5,0,-4,-1,-2,-8,-7,2,-13,0,3,2,1,12,1,0,-5,-4,-1,2,2,-2,-1,4,2,14,-60,0,1,4,-2,1,-17,-12,1,11,4,1,-12,2,-1,4,-1,0,4,3,1,1,-3,-1,-1,1,1,-3,1,-3,-1,2,-2,1,1,-1,4,-1,-3,-1,5,4,2,-6,2,13,15,-2,-1,-7,3,3,5,1,2,3,-3,-1,-2,-5,4,-3,1,-3,2,-2,9,1,-1,-5,1,9,2,4,-3,3,-2,-3},
+                                              {2,7,5,2,14,3,2,-2,-3,-6,1,0,-5,5,-7,1,-2,1,-1,0,-1,-1,-2,2,8,-3,3,-5,1,3,1,-6,0,4,31,17,-5,-1,-1,2,4,2,3,1,-1,5,4,-2,5,0,1,5,14,-8,-2,-2,5,5,4,-2,-2,-4,3,1,-5,0,0,2,-4,-6,1,-10,-1,2,-16,2,2,2,-14,1,-1,-11,2,3,3,2,-4,-5,14,-5,1,-1,-2,1,-8,-7,-2,-7,0,0,14,1,-3,-5,1,-2,-1,5,-4,-4,3,43,6,10,-7,4,-6,1,3,-2,7,5,-3,0,-5,2,3,-5,16,1,3,2,-1,-1,-1,1,1,-17,30,-1,2,-5,-6,4,6,0,2,-5,5,9,1,-2,-4,1,-2,0,-3,10,-6,1,30,1,-1,-3,0,-70,-7,1,-8,-2,3,-2,3,1,-2,1,3,20,-59,-1,-1,4,-2,10,-19,-16,-2,-62,2,1,-3,2,-1,3,0,5,4,3,0,1,1,2,-2,2,0,-1,-1,-3,-2,4,-1,-1,0,2,5,-1,2,-2,6,3,13,-4,2,16,17,-2,-1,-1,3,3,14,2,-2,3,1,2,-3,-5,4,-3,2,-3,2,-5,8,1,0,-7,2,2,6,2,-1,1,-5,-3},
+                                              {5,6,1,2,1,7,-58,0,0,3,-1,19,-3,0,-2,3,1,0,2,1,-1,3,2,14,-4,4,-13,-3,3,-1,-15,-4,-1,-1,-4,-2,-3,-2,-1,-1,-1,2,3,9,2,3,8,-2,1,5,-2,1,3,0,-4,-1,-1,-11,6,-2,2,3,-3,-1,3,4,1,-2,0,-2,3,2,-5,3,-4,0,1,3,-6,1,-5,2,3,-1,33,2,-3,0,3,-4,3,-3,1,8,2,-7,2,1,1,3,-1,1,-2,3,2,-2,-1,2,-3,-1,5,5,2,-4,-6,1,-1,3,-1,2,-1,5,0,0,-2,-2,3,1,-4,1,-8,-11,-1,3,-2,-1,1,-3,-7,21,2,0,-2,-14,4,2,2,-2,7,5,2,-47,-1,0,4,-2,-3,6,2,3,-6,4,1,-2,0,1,2,6,0,1,-1,-1,2,-15,-4,1,-3,4,4,-1,0,2,1,-3,-4,-4,19,2,2,-1,6,4,-2,-9,-2,2,-1,-2,4,-2,4,-1,16,0,5,0,1,-1,0,1,3,-1,0,-1,8,2,2,-1,1,1,-2,0,2,1,-3,7,-1,4,5,3,-2,3,1,-1,-1,33,10,-5,6,-1,1,-1,-6,10,2,2,4,-4,3,7,1,2,4,-1,0,-3},
+                                              {2,12,-4,1,2,5,-45,1,1,1,-2,-2,-3,1,-2,-2,-1,-2,0,2,-1,3,2,-4,-3,-6,-26,-2,-6,3,49,-6,-1,-7,-1,0,-2,2,3,1,3,13,1,0,3,-1,-11,1,1,4,-2,-5,-3,2,-2,-2,-2,-6,5,-4,-3,2,-4,-1,0,2,1,1,1,6,-1,1,-3,0,1,-5,2,0,3,2,-4,1,16,-2,49,3,2,-4,4,-8,2,-3,6,12,4,-1,4,-1,1,1,-1,3,-3,1,4,-2,-1,2,2,2,3,-1,-5,-1,3,1,-3,2,-2,3,-12,-2,3,0,-6,4,4,2,-3,-2,0,-19,-3,6,-3,-1,-1,-1,0,4,1,3,-2,-18,5,1,-2,-4,9,4,2,1,-1,-2,3,-3,-2,-10,1,-4,1,3,1,-7,2,2,8,2,-6,2,-3,1,7,-23,-5,1,-2,2,0,-1,0,7,-1,-5,-1,0,2,2,0,-2,-1,5,-3,-14,-2,5,5,-3,3,-2,5,-7,23,1,0,-1,3,-2,2,6,1,-5,-2,-3,6,1,7,2,-1,-3,-4,-1,3,3,-2,5,-3,2,4,4,-3,-5,-2,0,0,-24,13,1,2,1,-1,1,-6,11,-1,2,1,4,3,2,-2,0,7,-2,-1,-5},
+                                              {3,10,-2,-2,5,5,-66,-1,1,1,-3,-60,-3,5,-3,1,1,3,0,-4,2,1,2,14,-5,3,-12,-1,2,-3,-14,-3,-5,-4,-1,1,-3,-2,2,3,1,0,2,2,4,4,2,-4,3,4,-4,1,3,6,-4,3,-1,-6,5,-2,3,2,-4,-5,7,2,-2,-3,1,-2,1,3,-4,4,1,1,-3,2,2,3,-4,1,8,-1,34,4,-1,-2,4,-3,2,-3,2,10,6,-8,4,1,0,1,2,2,3,2,6,-2,-4,1,-2,0,1,2,-4,-3,-5,-1,-3,3,-1,7,-2,3,0,-4,-1,6,0,3,-3,3,-6,-13,0,4,-2,-1,1,1,0,22,3,-3,-2,-17,3,1,-2,-3,8,2,3,18,-2,-1,3,-2,-4,-4,-3,0,1,3,-1,3,1,2,1,8,-2,3,1,3,0,28,-5,1,-3,3,2,-5,8,2,0,-2,0,-1,18,2,3,-2,7,8,-2,-15,2,1,1,-2,5,-1,4,-5,15,0,7,1,-1,-2,1,4,1,-6,-1,-2,7,-5,3,-2,5,0,-5,3,4,2,-2,4,-2,2,4,1,-3,1,3,0,-2,-14,10,-4,3,1,2,-3,-3,11,0,4,1,-2,4,2,1,-1,1,-2,2,-2},
+                                              {5,5,2,1,3,3,9,2,-5,3,-1,12,-2,4,-1,-2,-2,2,1,0,-2,3,1,-58,-1,2,29,-3,-1,0,-11,-4,1,-1,-1,2,1,-2,1,4,0,4,2,-1,4,2,2,-3,1,2,-9,1,-2,1,-2,2,-1,-5,3,-3,2,3,-4,-2,0,2,3,-2,-4,-2,-1,2,-3,3,-1,3,-1,-1,1,-1,1,-1,0,-6,-10,1,0,-2,2,-1,0,-4,2,6,3,-7,1,0,0,2,2,3,-6,3,3,-2,-1,2,-3,2,3,0,1,-1,-3,2,-3,4,-2,3,-4,1,-1,1,0,3,-1,0,-2,-1,-5,-11,0,3,-3,-2,1,1,-1,13,1,2,1,-10,5,1,3,-3,3,5,-1,-49,1,-9,3,-3,-7,-1,1,-2,-1,5,2,0,2,4,4,4,1,-1,-3,4,2,-8,-5,3,-3,2,2,-1,-3,-1,-2,-4,-1,1,9,2,2,-2,3,3,-3,-12,-2,3,2,-3,2,-9,5,-1,14,1,4,-1,2,-3,0,6,1,-3,2,-3,3,-1,2,2,1,-4,-3,1,3,1,-2,4,0,3,3,2,-3,1,4,-1,-3,35,6,-2,4,1,-8,2,-6,3,-1,1,-2,-1,2,5,1,1,4,-1,1,-3},
+                                              {6,6,4,3,2,4,23,3,2,0,-1,22,-2,8,-3,2,1,1,0,2,-1,-1,0,-60,-6,2,34,-1,7,-45,39,-6,2,-4,2,-1,-2,-1,3,-1,5,1,5,5,3,9,8,-3,4,4,-2,5,-1,3,-5,-1,-3,-12,6,-2,6,1,0,1,7,4,0,-3,-4,-6,1,2,-11,3,4,3,3,-7,2,3,-4,-1,1,-1,-18,1,-3,-1,4,-8,4,-1,4,9,2,-13,-1,3,-1,1,1,2,2,-8,2,-4,1,3,-6,-1,2,2,-2,-5,-9,-1,0,4,-2,5,-3,1,2,1,-7,5,-2,2,-2,3,-11,-24,1,5,-2,1,2,4,0,17,3,0,-5,-26,5,1,1,-2,7,3,1,23,2,1,5,-2,-7,-5,3,5,2,1,1,1,4,1,2,9,-3,-6,1,1,2,-20,-5,2,0,3,0,1,1,-7,3,-3,1,1,27,2,2,-2,7,6,-2,-18,1,3,1,-3,6,-2,3,2,18,-3,6,-5,1,-1,-3,2,-3,-3,-1,-4,9,3,1,-7,4,1,-3,1,5,2,-4,-19,-2,2,5,5,-10,-4,2,3,9,-22,14,-8,2,-1,3,-3,-10,17,-4,0,3,-1,1,6,1,1,2,-3,-1,-5},
+                                              {-1,1,4,1,4,4,10,3,-3,5,-1,-57,-2,4,-2,-2,0,1,3,1,-1,4,1,-58,-3,2,28,-2,1,4,-10,-3,-1,-4,0,2,-6,-1,4,-3,1,6,2,1,3,-1,1,-2,0,3,-2,3,-1,3,0,-4,-1,-1,4,-1,2,3,-3,0,4,2,3,-2,-3,-1,2,3,-2,3,2,2,1,0,1,2,-4,-1,5,-2,-11,1,-1,-5,5,-2,1,-3,3,6,5,-4,3,-1,-2,0,2,3,-3,5,4,-1,-2,2,-2,4,2,1,1,-1,-4,1,-3,4,-2,2,-1,2,1,2,-1,2,2,1,0,0,-4,-11,-1,3,-2,-7,-2,1,1,14,1,0,0,-9,8,2,-1,-1,5,3,3,12,-2,-3,3,-2,-5,-3,5,5,0,2,2,1,0,4,5,6,1,-2,-4,2,2,29,-10,2,-3,3,2,-1,3,2,-5,-1,0,1,8,2,5,-2,4,5,-8,-9,-1,1,0,-3,1,-4,-2,4,13,3,6,1,2,-8,0,0,-2,-2,2,-2,3,-1,3,3,0,-1,-3,-1,5,2,-3,6,-2,1,3,2,-4,0,-3,-1,1,-10,5,-3,6,-2,-3,-1,-5,3,4,2,-5,1,0,4,0,-1,3,-1,2,-3},
+                                              {3,8,3,3,4,4,16,-1,2,-3,-2,18,-2,4,-2,-2,-6,2,1,0,2,5,2,20,-4,2,-18,-2,2,-1,-17,-2,0,-2,-1,2,-1,-1,1,3,3,0,3,3,2,4,-4,-3,1,2,-2,1,2,2,-3,-2,-2,-8,2,-8,3,2,-4,0,1,3,-2,-1,-2,-3,3,2,-5,3,1,1,1,1,1,3,-4,0,0,-2,-14,2,0,-3,1,-1,-5,-1,0,4,5,-6,1,0,-1,2,1,3,1,1,4,-1,-1,0,-3,4,3,1,-1,-4,-3,1,-3,4,-1,3,-5,3,0,-1,-4,6,-1,1,-2,2,-8,28,2,4,-4,-1,3,1,-1,-54,3,-2,-1,-17,1,1,-1,-3,5,1,1,-59,1,0,1,-6,-4,-6,4,5,2,2,-1,-3,2,3,2,4,-5,0,-2,2,3,-19,-5,-1,-7,2,1,-1,1,1,0,-7,-2,1,16,2,4,-5,5,1,-2,-13,-7,3,2,-10,1,-2,3,3,13,-1,1,-1,3,-3,0,1,-1,-4,-1,-1,4,1,0,-2,5,0,-4,1,2,1,-3,12,-12,3,4,4,-4,3,-1,1,5,31,8,-5,4,-1,1,-3,-5,7,-3,0,2,1,0,7,1,3,4,-4,2,-5},
+                                              {8,7,7,1,3,4,12,3,-1,4,-1,12,-2,-2,-1,1,2,3,-1,1,-1,3,-5,8,-4,1,-11,-2,0,1,35,-2,-1,-4,2,-1,-3,-1,3,-2,2,12,4,3,3,-1,-2,3,0,2,-3,1,3,5,-3,-1,1,-6,4,-3,4,-3,-2,-1,6,2,3,-2,-2,-1,1,3,-2,-1,2,0,1,-2,1,0,-5,-3,2,-2,-10,2,-2,-2,4,-4,1,-2,4,7,3,-5,5,1,-1,2,1,2,-3,3,4,-3,1,1,-3,2,4,1,0,-1,-3,0,-3,3,-3,4,-3,4,-2,0,-3,-1,2,1,1,1,-8,33,0,3,-1,-1,1,1,-1,-58,4,2,-1,-11,6,1,2,-3,6,4,1,10,0,-1,6,-3,-4,-3,-2,9,2,2,1,2,2,2,4,1,-3,-2,0,3,1,-10,-3,3,-1,3,1,-1,1,2,-1,-3,-1,-1,10,1,5,-2,-5,5,-2,-9,-2,1,4,-2,3,-2,3,-2,15,1,1,-2,2,-3,2,3,1,-3,1,-3,5,1,3,3,2,-1,-2,-3,3,1,-3,-32,-3,-4,4,3,-3,-3,2,2,-3,-9,8,-4,3,-2,1,-1,-4,7,1,1,0,0,3,7,0,3,3,0,1,-4},
+                                              {1,10,1,2,4,5,15,-2,1,5,-5,-65,-6,4,-7,2,0,-2,2,1,-1,3,3,20,-3,1,-21,-7,3,1,-18,-5,0,-1,0,-1,1,-1,2,4,3,-1,2,1,2,3,8,-2,2,5,-3,1,-3,6,-4,-5,5,-7,6,-4,0,1,-3,-1,7,1,1,-2,-3,-6,4,2,-4,2,0,0,3,1,-1,1,-4,-3,2,-1,-14,4,-3,-8,3,-3,3,-1,1,5,3,-5,1,-6,1,2,2,3,2,1,2,-1,1,6,-4,-1,4,3,3,-2,-6,2,-8,1,-2,3,-4,3,3,2,-2,2,1,-7,-3,1,-7,28,-2,3,-3,-1,1,1,-1,-50,2,-2,-4,-19,5,-1,0,-7,4,5,2,19,1,-1,5,-4,-4,-4,1,0,1,3,2,0,2,1,1,4,2,0,-1,-2,3,26,-4,-2,0,3,1,-1,0,2,1,-4,-2,-1,16,0,2,-2,5,3,-1,-10,-1,5,3,-4,4,-2,2,1,14,-2,2,-1,2,-2,1,3,1,-1,-1,1,6,2,5,-2,2,-1,-1,1,3,1,-3,9,-3,2,3,4,-2,1,1,0,1,-21,9,-5,5,-3,1,-1,-8,8,-4,2,1,-5,5,4,-3,3,2,-1,-3,-2},
+                                              {-5,2,3,18,-1,4,2,-1,1,2,-1,2,-2,-4,2,-1,-1,-3,1,29,1,3,-1,2,-9,-1,-1,-1,-9,-2,2,6,30,-1,-5,0,-1,-5,1,12,0,5,1,3,2,5,2,-3,1,2,0,0,3,-1,-4,3,1,9,3,1,6,-1,3,27,0,15,-1,-1,2,-5,1,5,8,3,-6,3,-15,-1,-7,3,-3,-6,6,-1,3,18,-5,2,-4,6,3,-3,-1,0,4,-8,-1,-2,-2,3,-1,1,-1,2,-3,-1,-12,3,20,-2,0,3,4,-13,8,-2,2,3,1,-1,-7,7,1,-19,-9,4,1,1,-5,-1,6,2,0,2,1,2,1,-2,-7,1,1,-5,9,2,-11,-2,0,-1,6,-10,-55,2,2,-1,-5,3,1,8,2,-9,-7,17,-2,-3,0,-2,-3,4,-1,0,2,-2,-5,2,-1,2,-2,1,2,-12,-5,6,2,-6,-4,-6,-2,-1,0,0,0,5,2,1,-1,-2,-3,1,-1,-1,3,5,-1,-57,5,2,-74,4,-1,-2,2,-4,-1,3,8,-16,1,-1,3,8,-4,2,2,1,-3,1,3,-2,2,2,-6,-1,14,3,-13,2,-5,-7,-16,-3,0,-2,4,-6,2,16,4,0,4,-9,13,1,0,2,0,-1},
+                                              {-6,0,1,10,0,2,-2,0,0,6,-2,-3,-3,3,1,-1,0,-3,1,29,2,2,-2,-1,-5,-3,-7,-1,-3,1,-4,6,-10,-4,-2,3,0,-4,2,-12,1,6,-2,0,2,0,-13,-2,2,1,-2,-1,3,5,-4,-3,-1,3,4,-1,6,-1,2,-12,5,11,-1,5,4,-5,-1,5,7,-1,-2,-1,-11,-3,2,1,-3,-4,14,-1,-4,12,-2,-1,-1,0,3,-2,3,-4,7,-6,2,-1,-2,1,1,2,-3,1,-1,-1,-10,2,20,2,-1,1,-2,-7,4,-1,0,2,-1,0,-6,3,-1,-7,-8,3,2,1,-4,-2,1,-4,-1,3,-1,1,1,2,-1,-1,-1,-2,7,4,-10,-1,-1,-2,4,-9,14,1,2,-2,2,1,0,-8,-4,-3,-1,14,0,-3,1,1,2,5,-3,-2,-2,1,-3,-6,-1,-2,-3,0,1,-12,5,7,1,-3,-1,-2,-5,3,-2,-2,-1,4,1,-4,1,3,0,1,-1,-3,2,6,-1,17,8,1,-77,2,1,1,-1,2,1,0,4,32,4,1,3,7,-5,-1,2,4,-2,-4,0,-4,3,2,-3,-3,12,2,-10,-7,-4,-4,-13,-1,-1,1,2,-9,-3,12,2,3,3,-8,2,-2,-1,2,-2,-3},
+                                              {1,6,-1,20,3,4,0,-2,-1,-7,-1,2,-3,4,1,2,0,1,-2,45,5,2,-2,3,-1,-4,1,2,-7,0,2,16,-25,-6,-1,1,0,-2,2,3,2,3,-2,-4,3,1,-5,-5,2,3,1,1,5,4,-2,-8,1,4,6,2,5,0,1,-19,9,-38,-4,-1,5,-2,-1,11,8,4,-2,-1,46,-1,2,4,-4,-4,12,-1,4,12,-1,1,-1,5,2,-2,1,4,6,-4,0,-2,-2,1,2,3,-2,3,1,1,-17,4,12,-2,-2,1,-1,-7,14,-3,1,3,2,4,-5,6,2,47,-6,1,-4,1,-1,1,4,1,1,2,2,2,0,3,-1,3,3,-2,13,1,-12,1,0,-1,11,-9,10,3,-2,-3,2,2,2,-2,-3,-19,0,-29,-3,-1,-1,1,-3,6,3,3,3,2,-20,2,0,-3,-1,1,1,-19,-11,6,1,3,1,-2,0,0,2,-1,3,10,2,5,5,1,0,1,2,1,2,2,2,15,10,4,-36,4,1,3,0,-7,-2,2,9,-18,2,-1,-1,8,-3,4,4,2,0,-2,1,-2,3,2,-4,-2,23,3,-4,2,-3,-6,-11,1,2,-3,6,-4,1,13,2,2,6,-7,4,-2,-2,2,1,14},
+                                              {-7,1,2,12,3,2,1,0,-4,-6,1,1,-3,1,1,-1,-1,2,-1,-10,-1,2,-2,1,-8,-4,1,-2,-11,-1,0,6,29,-1,0,3,4,-4,0,-8,1,5,-2,-3,4,3,3,-4,0,4,-9,-1,2,2,-2,-1,1,0,5,0,7,-1,2,-10,1,7,-1,1,4,-6,-3,6,7,4,-2,5,-11,-1,0,-1,-2,-4,0,-6,2,-66,-2,1,-4,2,-1,-2,-1,-1,6,-6,-2,-1,-2,3,1,2,2,3,1,-1,-13,2,20,2,1,0,1,-8,6,-1,-1,4,0,1,-2,2,-1,-9,-8,1,-2,-1,-1,1,3,1,2,-1,-1,0,0,2,-1,2,-2,1,9,2,-12,-2,2,-1,4,-10,-48,0,3,-10,3,0,-2,4,1,-9,-1,12,1,-3,0,2,2,3,6,-3,-1,3,-3,2,0,2,-2,-1,1,28,6,4,-1,-9,-1,0,-3,1,3,-2,-2,2,2,-1,-1,1,1,-1,-1,-8,-2,6,-1,15,6,1,8,2,-1,2,0,11,1,0,6,-14,0,1,5,-3,-4,2,2,0,0,-4,3,-2,3,2,-4,1,14,1,-13,2,-6,-5,-12,-1,-9,2,3,-7,-3,9,-1,2,1,-6,3,0,-1,4,2,1},
+                                              {-11,-1,3,32,3,-1,2,2,1,-2,2,1,-2,-1,2,0,-1,-1,1,-23,-3,-2,0,-1,-10,-4,2,1,-6,-4,4,15,-30,2,1,0,3,-4,3,-1,0,2,2,5,3,7,1,-2,2,-3,0,-3,3,3,-1,2,2,8,4,0,2,-1,7,34,4,18,-2,0,6,-9,2,5,7,2,1,3,34,-6,1,5,-2,-6,-1,0,3,-60,-2,4,-3,6,3,1,4,-3,2,-10,-2,0,-3,1,1,2,3,4,-3,-4,-38,3,16,-1,-2,2,8,-13,9,-1,4,4,-1,1,-10,-2,-2,-28,-13,4,-5,1,-2,-1,0,2,-1,3,2,2,1,4,1,4,-1,-15,10,-1,-12,-2,1,-1,5,-17,17,3,-3,-1,-1,3,1,4,1,-6,2,-62,5,1,2,-1,-1,5,-2,-7,4,-1,-16,4,-1,7,1,-1,0,32,1,-5,2,-16,2,0,-2,0,0,-1,1,15,4,4,2,1,-2,-1,4,-1,1,7,2,-57,5,-2,17,4,-4,-3,-3,-6,1,-4,6,33,2,-4,3,4,-5,3,4,3,-2,-3,1,-2,1,2,-10,2,20,6,-11,2,-8,-9,-15,-2,0,-2,3,-13,-1,15,2,4,-1,-12,4,-1,-1,2,-1,14},
+                                              {-6,-2,-1,9,2,2,1,3,-1,1,1,0,-2,2,1,-3,-2,-1,0,-8,2,4,-2,0,-5,-3,0,1,-8,4,1,6,-9,-6,-1,3,-5,-3,2,2,1,5,-4,-2,3,1,11,-3,-2,1,0,0,-1,3,-3,-4,1,8,-1,1,2,1,2,-12,6,-72,0,1,0,-4,-1,4,7,2,-1,6,-11,-3,0,6,-1,-4,5,-3,2,-55,-3,1,-1,5,1,-4,1,-4,7,-5,1,-2,-5,0,2,2,2,4,-2,1,-12,3,19,2,-2,1,2,-9,7,-2,-1,4,-2,0,-2,4,3,29,-6,2,0,1,-2,-3,4,0,-1,3,-1,-6,-2,1,1,1,-1,-3,9,2,-9,-1,0,0,4,-10,10,0,-1,-3,1,2,1,9,-1,-1,-1,14,-2,-2,-1,2,2,4,1,-2,-7,1,-3,3,-7,3,-3,0,1,32,-7,3,-5,-3,0,-2,-3,1,4,-2,0,3,-5,3,0,2,-4,-1,-1,-6,-2,9,-1,14,5,3,10,-5,-1,-2,-3,-1,0,0,5,-12,1,2,4,1,-3,1,3,1,-2,-2,-1,-4,3,1,-6,-2,10,2,-12,1,-4,-5,-12,-3,-4,-1,1,-8,2,13,-6,4,-1,-4,-2,0,-1,2,2,-1},
+                                              {-6,2,6,30,3,3,1,-1,2,7,-1,1,-1,1,3,-2,-7,1,-1,-12,3,3,0,1,-8,-4,1,-1,-2,0,3,17,29,-3,1,2,-1,-4,1,-4,2,2,-1,-1,2,5,-2,-2,1,-2,0,-4,3,0,-2,-5,-1,4,-1,-6,5,-2,3,-15,2,14,-3,2,7,-6,0,6,4,1,-1,2,29,-3,0,5,-1,-8,-1,-1,3,17,-1,2,-2,6,-5,0,-2,1,7,-8,-3,-1,-4,2,2,2,1,-2,1,-2,31,3,17,4,-3,2,0,-12,7,-2,1,3,0,1,-5,4,-6,-21,-9,1,-3,2,-1,-1,4,1,3,1,-2,0,2,1,1,1,2,-13,9,2,-12,-2,1,0,4,-14,-61,1,1,0,2,-3,0,4,0,-4,1,-73,-3,-3,2,1,-1,1,-2,-2,-1,-1,-7,2,1,1,-7,-2,1,-17,-1,2,1,-9,1,-1,-4,1,2,-4,1,10,3,3,-6,4,1,-7,-4,-2,-1,12,1,13,1,2,15,3,-1,-1,-1,0,-1,1,5,-17,-1,0,3,8,-5,3,1,2,-1,-2,-8,-2,3,2,-7,1,16,3,-10,4,-5,-8,-9,-2,1,-3,3,-9,-4,-61,2,6,-1,-9,4,2,1,0,-1,10},
+                                              {-5,4,7,12,3,3,1,0,1,-3,1,3,-2,-6,2,1,1,3,-5,-10,1,4,-8,2,-6,-4,0,-1,-12,-1,3,6,-15,-3,1,1,-2,-3,2,8,2,10,0,1,3,2,4,-3,-1,3,-2,1,4,6,-3,-1,2,8,3,0,5,-5,3,-15,5,8,1,0,3,-5,-1,6,8,5,-1,1,-14,-5,1,1,-3,-3,0,-2,1,9,-3,1,0,3,0,-2,1,-5,6,-5,1,-1,-3,1,2,2,-5,3,0,-2,31,3,22,2,1,-1,2,-7,6,-1,1,2,-2,1,-4,5,-1,-9,-8,3,0,0,-3,1,0,1,1,2,2,2,0,1,-2,-2,2,1,9,1,-7,-2,1,-1,5,-11,10,1,2,-2,1,-1,-2,5,0,-6,-1,11,-3,-1,1,1,2,-1,2,-2,0,2,-4,0,1,2,-1,1,1,-16,2,4,1,-9,-1,-2,-1,1,3,-2,-9,2,2,1,-1,1,-1,1,1,-1,-3,6,1,16,0,-1,11,1,0,0,-2,6,-1,-1,6,30,-1,1,5,4,-3,-5,2,1,-1,-3,1,-8,2,2,-4,-3,14,3,-14,2,-4,-5,-14,-2,-2,1,1,-4,2,-68,1,4,2,-5,-1,2,-4,3,0,-1},
+                                              {-7,6,1,20,4,3,2,-2,1,-1,-2,0,-7,2,-5,1,-1,-2,1,-12,0,3,0,4,-7,-2,2,-7,-9,4,1,5,-18,-1,-1,-1,1,-5,1,-23,1,3,1,-1,0,5,-7,-3,1,3,-1,-1,-3,5,-4,3,5,2,6,-1,6,-2,2,29,8,-77,-1,2,5,-6,1,4,6,2,-3,2,-10,-3,-1,2,-3,-10,6,-1,2,17,-2,-4,-4,1,2,-1,-1,1,6,-7,-2,-6,-2,-1,1,3,-1,0,-2,-1,34,5,21,-2,0,2,8,-9,8,1,-6,1,-1,1,-5,7,2,29,-7,3,-2,-6,-2,-1,4,2,-1,2,-2,0,0,1,-1,0,2,-9,10,2,-13,-2,-1,-5,5,-10,15,2,1,-1,4,2,1,-7,-1,-7,1,15,-1,-2,1,-1,-4,3,3,-2,1,-4,-8,4,-1,1,0,-1,1,-18,5,4,0,-10,-1,-2,-2,-2,3,-3,0,5,2,3,0,0,1,-1,0,-1,5,9,1,-56,1,2,15,2,-1,1,2,-3,-1,2,7,-10,4,1,2,7,-3,2,2,-2,-3,-3,1,-4,4,2,-3,0,16,3,-13,1,-6,-8,-17,-8,0,-1,3,-9,-4,-56,2,0,2,-9,2,2,0,2,-2,0},
+                                              {4,-6,2,-3,-3,5,2,2,-53,-2,1,5,-3,3,3,6,0,3,3,-1,-1,1,-1,3,10,1,-1,-3,-10,1,-3,-4,1,-1,-7,2,5,-5,-2,-1,-1,4,4,4,1,-1,-5,-2,2,3,-15,5,3,-6,-3,2,0,-9,-24,3,4,2,2,-1,-9,5,3,1,-3,0,-1,5,0,4,-3,4,-2,4,-5,19,21,-1,0,38,-1,3,-4,-1,2,-4,0,-3,1,3,1,3,2,-3,-1,5,2,0,0,2,3,1,-1,1,1,1,2,5,-3,10,-2,2,-1,3,2,-2,-3,-6,-8,-2,12,3,2,-2,-1,0,4,-1,7,20,2,4,0,-4,-4,4,1,1,-2,4,4,2,1,1,-1,6,2,0,2,-20,-1,2,1,-2,4,-3,-5,4,-4,2,-64,-1,-6,4,14,2,1,2,1,-2,2,-2,-2,-1,3,1,-4,-1,2,-2,-4,-4,1,4,1,2,-3,0,2,4,0,1,-1,0,-1,-15,5,-1,0,3,5,0,4,3,-2,1,4,2,2,-1,-2,-1,-1,-1,-9,-7,-1,-2,1,-2,-3,4,6,2,4,1,-1,1,1,0,-3,0,-3,8,5,0,32,-2,4,1,1,5,5,-5,4,2,3,18,5,3,2,-2},
+                                              {4,-1,2,-3,-2,3,3,4,-54,2,0,3,-3,1,1,3,1,1,1,-1,-1,1,-2,-3,6,-1,-7,-2,-1,3,-7,-3,-2,-4,-1,2,2,-3,1,1,3,7,3,1,4,-2,-5,-2,2,2,-11,3,1,-4,-2,-6,-1,-4,-18,1,6,-1,2,-2,-5,3,3,4,-3,-2,2,7,4,3,1,2,-2,-1,2,14,17,-1,2,-17,-8,3,-2,-2,2,-3,2,-2,3,5,5,1,2,-2,-2,4,1,2,1,2,4,-1,-2,1,-1,5,2,2,-5,7,-1,2,-3,2,1,-1,-3,-7,-3,-2,6,4,4,0,-1,2,1,-4,4,15,0,2,-2,-2,0,1,-1,2,-3,4,5,2,-1,1,-2,6,3,-1,1,-14,2,1,-1,7,5,-1,1,1,-1,1,11,1,1,4,11,-1,2,3,1,-8,2,-2,-3,1,1,0,0,1,1,1,1,1,9,3,-1,1,-3,2,1,-5,0,3,28,-1,0,-12,2,-1,-2,4,5,-1,3,1,-1,-78,-1,-1,3,-2,-2,-3,1,1,-3,-3,-3,-4,3,3,-4,1,2,1,3,1,-2,-1,-1,1,2,-9,-2,7,3,1,30,3,7,-2,-3,3,1,-1,2,2,1,12,4,2,2,-1},
+                                              {2,3,3,-7,0,4,2,1,-64,-5,1,4,-3,5,1,6,1,4,2,-5,2,-1,-1,2,5,-4,0,-2,-5,1,-4,-2,-6,-4,-2,1,3,-3,1,1,-1,2,1,-3,4,1,-5,-2,1,1,31,-1,3,-7,-3,0,0,-1,-22,2,3,1,0,-6,-2,3,-1,-1,-2,1,2,5,-1,4,1,3,-6,1,2,22,20,-3,-2,-16,-1,1,0,-3,2,-2,-1,-3,2,6,5,1,1,-4,-3,2,3,2,-3,4,6,1,-5,-1,1,3,-1,2,-2,6,-1,0,-3,2,3,2,-2,-10,-6,-6,11,3,-3,-1,2,1,5,-3,4,-65,1,2,-1,1,1,4,1,-1,-3,0,5,3,-1,-1,-2,0,0,1,-1,-19,1,-1,-2,1,2,-2,1,2,1,3,21,2,1,8,13,2,-1,4,0,-3,1,-3,-3,2,3,-5,1,-1,1,-1,2,1,-2,1,-2,0,-1,4,1,0,2,-1,-3,1,2,-12,5,-3,3,4,6,-1,3,2,-2,-6,-3,4,1,-2,-2,-7,1,-1,-3,-9,-2,1,3,2,-2,2,1,1,3,-1,-3,1,3,0,-3,-1,-2,9,3,1,31,0,4,2,-3,2,0,-1,6,-1,2,13,3,2,5,2},
+                                              {-3,4,-5,-3,-2,3,2,4,-4,-4,-1,5,-3,1,5,6,0,4,2,-2,-3,0,-1,-2,5,-10,0,-2,-8,1,-3,1,1,1,-1,4,2,-1,-2,4,5,7,3,1,4,1,-13,-4,5,2,-25,-9,-7,-7,0,1,-3,-8,-19,1,-2,1,3,-2,-11,3,2,-2,-9,-1,12,3,1,4,1,6,-3,-3,0,1,19,1,-17,41,-1,1,4,-1,3,-6,-1,-1,1,2,4,3,-1,-3,2,4,2,1,2,-4,4,1,-1,0,3,3,3,-1,-3,10,-3,3,-3,2,1,-3,0,-4,-9,-2,15,1,4,-3,-5,2,7,0,8,5,-2,0,-1,1,-1,3,-2,5,1,5,-5,0,3,1,-2,7,-1,-2,-3,44,9,0,2,-5,2,-9,-1,4,0,-9,-44,3,5,1,0,-2,3,5,4,-2,3,4,-2,2,2,2,-7,-3,0,-8,-2,2,-3,3,-2,2,-1,0,-1,1,-1,-3,12,-2,-5,-25,5,-2,3,4,1,0,4,1,-2,-2,1,-7,4,-4,-2,-2,-4,1,-13,1,-3,1,2,-1,2,-2,1,-1,3,-1,-2,1,1,0,-2,-1,-1,14,0,-2,-22,3,2,-4,-4,3,1,-1,3,1,-2,-52,6,4,3,-2},
+                                              {4,-20,2,-1,-2,3,3,5,28,0,3,6,-1,4,3,6,2,4,4,-1,-2,-2,1,1,9,-4,2,-2,-6,2,-1,-6,3,-3,1,0,5,-5,-1,2,-5,4,5,-2,3,7,9,-2,3,-3,-19,4,2,-15,-2,-4,-2,-6,-35,5,9,3,4,0,-13,6,1,-1,-3,-4,-12,4,-6,4,3,0,1,-11,2,19,30,-6,-3,-11,0,0,-3,1,1,-9,-1,0,5,4,1,4,1,-2,-1,5,2,0,2,2,1,-1,-1,2,-2,0,1,1,1,12,-2,2,1,2,-2,-2,-6,-8,-9,-1,16,3,1,-2,0,-1,2,-2,3,28,1,5,-1,2,2,4,0,-1,-3,1,3,2,3,2,-5,4,2,3,5,43,4,2,-2,6,12,2,3,2,-4,7,17,-1,4,6,17,-10,6,4,0,-1,2,1,-1,-1,2,3,-2,-8,-1,-5,4,2,-1,1,-2,1,0,0,1,1,2,-1,-45,2,0,-13,4,-3,2,4,3,-5,4,1,-4,-50,8,-7,4,-4,-2,0,-2,-3,-12,-6,-3,-1,3,-1,-4,-1,1,4,1,-2,-8,-10,3,0,0,2,-8,15,-2,-2,-15,0,6,-7,-5,3,0,0,5,4,2,-50,7,1,3,-4},
+                                              {3,-10,2,-2,0,1,3,4,9,-4,-1,2,-2,-4,2,2,0,3,3,-2,-2,1,-2,1,8,0,1,-1,-7,6,-3,-3,-2,-4,-1,3,-1,-3,1,-2,2,5,2,4,3,-4,2,-1,1,0,36,6,-1,-4,2,0,1,2,-14,2,7,1,5,-1,-5,2,3,0,-1,0,5,4,-1,2,2,47,-3,1,1,13,13,1,-2,-11,-2,2,-1,-3,3,-6,-2,-4,3,-1,6,5,2,-2,-4,2,2,2,-6,4,3,1,-3,1,0,5,1,3,-1,9,-1,2,-2,2,1,-1,-5,-4,-6,-1,10,3,5,-3,1,1,5,-2,3,-52,0,-4,-3,-1,2,3,-1,1,0,4,5,4,2,1,-3,2,4,-2,-2,34,2,3,-2,-1,5,2,1,2,-2,3,14,2,4,4,10,-1,-6,2,1,-1,-4,2,-3,1,2,0,-2,-2,-4,-1,1,1,2,2,-1,0,-2,1,-6,1,-1,1,-6,-2,-3,-11,1,6,-1,5,4,1,4,-5,-3,-7,-5,-2,4,-3,-2,-3,0,1,-5,-1,-2,-2,3,0,-3,2,2,-1,1,-2,-3,-1,-1,-1,-1,-2,-4,11,5,-2,-8,0,3,-2,-2,2,-4,-1,1,1,0,-66,5,3,4,-2},
+                                              {2,-7,1,-1,0,4,4,2,20,1,2,5,-2,3,4,2,-4,3,2,-1,1,2,1,3,11,-2,2,-3,-5,3,-2,0,1,-3,-2,2,3,-5,-1,1,2,2,3,-2,2,1,7,-2,0,1,-16,5,2,-6,-2,1,-1,-5,-27,-4,9,0,3,-1,-12,3,0,2,-1,-1,4,5,-1,4,1,2,-1,2,0,-50,22,-3,-4,38,-2,2,1,-2,2,-4,-6,-1,0,4,5,6,-2,-3,-3,4,4,1,-4,2,5,-1,-2,0,1,8,3,2,-8,11,-2,1,-2,3,2,1,-6,-11,-5,-3,11,1,1,-1,-1,3,3,-1,10,20,-2,4,-1,-2,1,4,2,-3,-3,1,4,0,3,0,-5,3,1,-1,-1,-17,1,-3,-1,7,7,1,1,2,0,-1,-51,2,-5,2,13,-2,0,4,3,-4,3,-4,-7,0,0,1,-2,-2,1,-3,2,2,-1,2,4,-3,-1,-2,2,1,-4,1,-6,-7,-3,34,8,3,1,3,1,-1,4,1,-2,-3,1,8,2,-3,-2,-2,-1,-1,-4,-8,-3,-1,-1,2,-2,2,-10,3,3,-2,-3,4,0,1,2,1,-4,9,3,-1,-9,-3,5,-4,-5,1,3,-2,1,2,1,19,6,3,4,-4},
+                                              {6,-4,8,-3,1,2,2,4,13,2,2,4,-2,3,1,4,2,3,-2,-1,-1,0,-7,2,5,-1,-2,-3,-7,3,-3,-1,-1,-2,0,0,3,-3,2,2,2,9,3,2,2,-3,3,3,1,0,-11,1,3,-3,-2,-5,1,-1,-21,2,6,-4,3,-2,-3,3,4,1,-4,-1,-15,8,2,2,1,4,-2,0,2,-52,18,-2,-6,-14,-3,3,-2,-3,4,-3,-1,-4,3,4,4,4,4,-3,-3,4,3,1,-1,3,4,-1,0,2,0,5,3,2,-1,7,1,1,-3,2,1,1,1,-7,-4,-2,6,2,2,-2,1,2,0,-3,7,14,3,3,-3,1,1,-3,2,1,-1,4,5,2,3,-1,-3,5,1,0,2,-13,2,0,-1,-3,2,-2,2,2,-1,2,12,2,1,-1,7,1,1,3,1,-3,3,2,-1,2,3,1,-4,-1,0,-4,0,1,0,3,1,1,-9,2,2,2,-1,1,-76,-1,-2,33,0,-1,1,3,0,-2,4,0,-1,8,-2,8,3,-3,-2,-1,-4,2,-6,-1,-1,-4,3,-1,-4,1,2,-5,3,1,-4,-1,4,-1,-2,-2,-1,5,1,-2,-12,2,0,-1,1,1,0,2,4,4,0,14,2,3,2,-2},
+                                              {1,-5,2,-2,1,3,4,0,16,0,-3,2,-7,2,-8,7,0,3,2,-2,-1,-1,0,2,5,-5,2,-7,-4,4,-3,-5,1,-3,-2,1,6,-2,1,-3,0,4,1,-2,2,0,-6,-2,1,2,32,3,-2,-6,-1,2,4,-9,-19,1,2,-1,2,-3,-1,3,2,1,-3,-2,9,4,-2,2,0,4,-2,2,-1,-58,17,-6,-3,-15,-2,3,-2,-7,4,-5,-1,-2,0,2,3,6,1,-8,-2,3,3,3,-6,2,3,1,-1,3,0,2,3,2,-1,7,-2,2,-8,1,2,-3,-2,-8,-5,-1,9,3,-1,-8,-1,1,3,-1,6,-64,-1,2,-1,-1,0,2,-1,-1,-3,1,2,1,1,-4,-3,6,4,1,2,-18,2,0,-2,-7,7,-2,2,4,-6,4,22,-1,1,2,15,0,1,2,-1,-1,2,-2,0,0,2,0,-3,-1,1,1,1,0,0,-1,-1,0,-1,1,2,0,0,5,-8,-2,-1,29,4,-3,-1,4,-2,-1,4,1,-2,-14,1,-10,2,1,-2,-2,2,-1,-5,0,-2,-2,2,-1,-3,0,2,-1,2,1,-2,3,2,0,-1,-3,-3,7,2,-1,-11,1,5,-2,-6,3,-1,-5,4,-1,-1,15,4,3,3,-2},
+                                              {6,-11,4,-4,-4,-18,-2,19,0,-1,1,3,-1,2,-2,-3,0,-3,-2,-2,-8,-4,-1,-2,-5,2,0,0,4,-6,2,4,0,6,-7,-3,-1,-2,-71,2,11,4,-1,-9,-2,-1,-3,-3,4,2,-2,-4,1,1,-2,-2,-10,14,3,1,2,2,18,1,5,2,15,5,3,-3,-1,-14,1,2,-5,1,-1,47,-5,0,-3,23,4,-1,1,-2,-9,3,-3,4,-2,-18,-1,-6,-9,4,1,1,-3,2,-2,-2,2,-9,-4,-15,-2,4,-2,-51,0,3,-1,-6,-4,-4,2,-1,31,-1,-4,2,-10,-2,12,0,8,-1,-4,-2,-7,-1,-1,1,1,1,29,-3,-7,2,-3,-5,-4,3,-17,0,-1,1,-2,-8,0,3,8,2,-3,-1,-1,2,5,1,-7,-2,5,0,0,-4,-7,7,2,-19,6,-3,1,0,-1,-64,-2,-3,-3,1,2,47,3,6,-6,-5,-2,-1,-1,1,1,-5,1,-2,-1,-2,-4,2,-1,1,-7,3,-4,-4,8,-18,0,3,-9,1,-16,-7,-61,29,-3,0,-4,27,-2,-12,15,-2,19,-2,-4,1,3,2,0,-1,12,30,-6,16,-4,1,9,9,-5,-3,-2,-5,-2,14,1,2,2,6,-5,7,12,-1,-1,-3,-1,2},
+                                              {4,-10,-1,-1,-3,-16,-1,11,1,2,-2,1,-3,1,-2,-5,0,-3,-2,-2,-9,-3,-3,-10,-1,2,-7,-2,4,-62,-6,3,-3,0,-4,-2,-2,-2,12,0,-6,-4,-3,4,0,1,1,-1,3,-1,-4,-2,-4,5,-1,2,-12,-1,3,-1,5,1,-80,-1,3,0,15,-40,2,-2,-5,-7,2,3,1,-4,-1,-27,-1,-3,-3,9,5,-1,-7,0,1,-1,-2,1,-1,-8,-1,-9,-8,1,2,2,-2,-3,-3,-2,3,-11,-3,-14,-3,2,-1,14,-1,-1,-4,0,-1,-2,-1,-3,-10,2,-3,-3,-8,-3,7,-3,9,-1,1,-2,-5,-7,-3,-3,-1,-1,34,-1,-3,-1,-3,-3,-1,4,-6,-1,-2,0,-1,-7,1,3,-4,3,0,-1,-3,-1,3,8,-2,-1,-5,6,-3,-3,4,6,-4,-19,-2,2,-1,-8,-2,17,-3,-5,-3,0,0,45,4,6,-1,-2,-9,1,-5,-2,-5,-4,2,-8,-1,4,2,0,-1,-2,-5,-1,-5,-3,6,-11,0,-1,42,6,-27,5,-71,-9,-3,-1,-4,22,1,-6,5,-5,12,2,-2,-5,-2,-3,1,2,4,-25,-5,25,-2,-9,8,6,-6,-3,-3,-5,-15,10,-3,0,0,6,-19,1,-3,-4,-2,-2,-1,1},
+                                              {1,-6,-1,-12,0,-24,-1,-59,1,1,-2,2,-2,3,-2,-2,1,-2,-1,-6,29,12,-1,1,-2,2,2,1,-4,-4,2,13,-5,6,-3,-2,-5,-2,16,2,-11,1,-1,2,-1,-1,2,-2,6,5,-1,2,-4,6,-1,-3,-4,6,-2,1,-4,2,20,-4,10,0,-85,6,5,-1,-4,-16,6,2,0,-5,-5,-23,-1,1,0,19,6,0,1,-1,-2,1,-2,8,-1,-19,1,-5,-9,2,2,1,-3,-2,-2,0,2,-9,-1,-12,-6,2,1,12,-2,-1,-7,-2,-6,-4,0,-1,-19,2,-3,-2,-4,-6,10,3,-5,-1,-2,1,-6,-3,2,0,1,-2,30,1,-2,2,-3,-9,-6,-1,-23,-1,-2,0,-2,-11,0,3,2,2,5,-1,-2,6,-1,-1,-2,-1,6,2,-1,-4,-9,9,3,-24,9,1,2,0,-2,12,-1,-2,-1,-5,1,49,2,-4,0,-1,-2,1,1,1,1,1,0,-2,4,4,0,1,2,3,-6,1,-1,-1,8,34,-1,0,-10,3,-31,3,-60,-8,-2,-6,-4,21,2,-22,6,-1,19,-1,0,1,-2,-1,1,-2,6,24,-4,16,-7,-2,8,7,-6,-1,1,-5,1,14,-3,2,-1,6,-21,-1,2,-5,-3,-2,1,14},
+                                              {6,-10,4,-5,-2,-15,-2,15,-5,4,-1,0,-2,3,-1,-3,-1,-1,-4,-2,-10,12,-1,-6,-1,1,2,-2,-2,2,2,7,0,7,-4,1,-4,-2,-78,2,-62,3,-4,7,1,6,10,-4,2,-3,-10,-1,-4,1,2,-2,-13,-2,1,1,7,2,26,0,1,-1,16,-1,2,-2,-5,-7,-1,3,-1,-1,-2,49,-3,-6,-1,26,1,-4,1,-3,-1,1,-4,7,-4,-5,-2,-7,-9,4,2,2,-2,-4,-2,-1,1,-18,-2,53,-1,3,-2,19,0,-2,3,-1,-2,-1,0,1,32,1,-8,0,-12,-3,11,0,-12,-3,-3,-1,-7,-1,8,-2,-2,-2,-10,1,-3,1,-3,-1,-1,3,-8,1,1,0,-2,-6,-2,0,1,-9,3,-3,-5,3,5,2,-4,-1,0,4,-2,-2,2,4,5,-19,-2,5,-1,1,-2,17,-2,-4,-3,1,-4,-29,2,-6,-1,-1,-5,2,-1,-2,-3,-6,0,-7,-1,4,-2,-1,-2,-9,-4,0,-4,-3,4,-16,-1,-3,-11,6,-17,-3,15,-9,-2,0,-6,20,3,-5,7,-1,14,-1,0,-5,1,0,0,-2,4,-16,-3,-66,-4,1,8,9,-8,-2,-12,-1,-8,12,-3,-1,-2,6,-13,5,-1,-7,-2,-2,1,3},
+                                              {-34,-38,-39,-27,-21,-50,-22,1,-18,-9,-11,-18,-31,-23,-39,-27,-19,-24,-24,-26,30,-26,-30,-27,-46,-22,-15,-30,-17,-33,-26,-16,-19,-19,-21,-25,-1,-21,-5,-19,-16,-31,-23,-22,-36,-17,-19,-21,-23,-29,-24,-65,-33,-9,-22,-7,-60,-12,-23,-15,-18,-22,-68,-19,-25,-32,-76,-20,-25,-32,-15,-39,-4,-19,-19,-52,-26,-75,-25,-21,-26,-6,-33,-29,-32,-24,-47,-20,-27,-18,-17,-58,-19,-33,-19,-20,-1,-19,-36,-32,-31,-39,-5,-35,-37,22,-21,-21,-23,-65,-21,-49,-21,-25,-42,-29,-25,-32,-50,-17,-22,-19,-27,-26,-10,-28,-26,-20,-29,-17,-28,-15,-43,-20,-31,-17,-69,-16,-16,-17,-22,-2,-24,-18,-54,-4,-20,-19,-31,-36,-19,-21,-24,-27,-25,-20,-33,-10,-18,-19,-33,-46,-8,-27,-28,-36,-6,-12,-22,-57,-11,-26,-27,-17,-15,-76,-11,-23,-21,-16,-37,-68,-16,-20,-21,-26,-27,-18,-15,-30,-24,-35,-29,-19,-24,-38,-14,-22,-18,-14,-24,-23,-30,-25,-30,-52,-32,-30,29,2,38,-7,2,27,-19,-20,-15,-11,-15,-42,11,-17,-8,-37,-26,-6,-29,-18,-25,-24,-11,-57,-8,-72,4,-20,-21,-24,-15,-19,-17,0,-28,-6,-8,-22,-19,10,-27,-14,-34,-27,-13,-25,-18,-6},
+                                              {1,-17,-2,-2,-2,-20,-2,-64,-4,-2,-2,-2,-2,-1,-3,-7,-1,-3,-2,-3,-9,-58,-2,-4,-5,-1,4,-1,3,11,4,3,-1,-1,-1,-1,-4,-2,12,2,5,8,-3,4,-1,3,-9,-4,1,1,-4,1,-2,5,-3,2,6,7,2,2,4,3,30,1,8,0,16,1,3,0,-2,-6,1,3,1,2,-2,-18,-2,-1,-1,18,0,-4,0,-2,-2,-1,-1,-2,-3,-7,-1,-10,-6,4,3,1,-4,-2,-1,-1,-6,-17,-2,55,-4,2,-2,15,0,-1,2,-2,-1,-2,-1,-2,-16,-1,-2,4,-4,-1,11,-6,-71,-2,-1,-1,-6,-2,-2,-2,1,-7,-3,1,-2,0,-4,-4,0,4,-2,2,-1,2,-3,-4,1,-1,-2,-1,3,1,-4,-3,5,5,-1,-1,-4,5,-5,-3,8,4,5,-33,-10,-1,0,1,-9,20,-4,-3,-2,-1,-1,-27,-6,8,-1,-1,-3,3,-1,-2,-3,-7,-7,-3,0,2,-2,0,-2,-5,-7,-2,-5,-1,4,37,-1,-5,-12,2,-27,1,15,-9,1,-1,-6,17,0,5,8,-2,14,-2,-3,-3,-4,-2,2,-1,3,-23,-7,-87,-3,-1,7,7,-3,-3,-7,-6,-9,10,0,-2,-7,9,-25,0,-3,-2,-2,1,0,3},
+                                              {3,-12,1,-10,-2,-23,-1,19,4,-9,-2,2,-1,3,-2,-5,-6,-3,1,0,29,-6,-1,-3,-3,5,3,-2,9,7,3,11,1,3,-3,-3,-2,-4,-58,2,14,-5,-1,5,-1,-2,-1,-2,3,2,-3,52,-5,2,-1,0,9,8,-1,-6,2,-1,17,2,3,2,-66,-1,5,-2,-2,-15,-1,4,1,-4,1,50,-1,2,-1,21,-3,0,1,-2,-1,2,-2,7,-7,29,-3,-7,-10,6,-2,0,-1,-1,-2,0,1,21,-3,-11,-1,2,0,16,0,-2,2,-3,-4,-2,1,0,29,0,-4,-1,-3,-2,8,1,6,-1,-5,1,-8,1,8,1,-6,2,-20,1,-1,-1,-3,-10,-5,3,-19,-2,2,1,-3,-11,-2,1,6,3,2,-5,-1,-2,8,7,0,-3,3,1,1,-4,-8,2,3,47,4,1,2,0,0,11,-4,-5,-3,1,0,-21,2,3,1,1,-2,2,4,-3,-2,-11,2,-4,-5,2,-2,-7,-3,0,-4,-11,-3,-3,-2,-16,2,1,-9,2,-4,3,18,-10,-5,0,-5,23,1,-8,3,-1,-64,-1,-1,-2,-15,2,-1,-2,4,21,-6,16,-2,3,6,6,-5,-3,-2,-6,-5,10,-3,0,2,8,-16,6,-2,0,2,-4,3,8},
+                                              {7,-11,12,-5,-1,-17,-2,13,-1,0,-1,2,-2,0,-2,-4,1,-2,-3,-2,-9,-8,-6,-1,-4,-7,3,-2,-1,-11,3,6,0,5,-2,-2,-2,-2,15,0,-8,-59,-3,1,1,3,-6,-6,1,2,-2,0,-2,6,-2,2,14,9,-1,-1,6,-7,-73,0,7,1,19,4,6,1,-7,-7,-1,4,1,-1,-1,-23,-1,-3,-1,31,3,-1,-3,0,-3,1,0,1,-3,36,1,-6,-7,6,5,1,-4,1,-2,1,-5,-32,-1,-12,1,0,-1,18,0,0,5,-2,0,-2,-2,-2,-14,2,-9,1,-9,-2,11,-2,1,-3,-3,-1,-8,-2,3,-3,2,1,-19,2,-2,-2,-1,-3,-2,-1,-9,-1,2,-1,-2,-6,1,1,-2,2,3,-1,-1,1,1,4,0,-4,1,2,-2,-3,-1,2,1,48,-1,2,-1,-2,0,21,1,-3,-2,1,1,-25,2,-5,1,-2,4,1,-3,-2,-11,-4,3,-3,-1,-3,3,-1,-2,2,-8,2,-2,-1,3,-14,1,0,41,5,-27,-10,15,-10,-4,0,-6,14,2,-3,7,-7,-83,-2,-2,-3,-2,-8,1,-1,5,-32,-4,26,-4,-2,10,8,-9,-2,-3,-2,3,15,-2,1,-1,6,-24,4,-1,-2,-2,-3,0,3},
+                                              {2,-11,5,-4,-1,-23,-1,-60,1,2,-5,-1,-5,4,-8,-2,-1,-5,0,-2,-8,10,-2,-2,-5,6,4,-5,-1,9,2,4,-1,4,-3,-2,-1,-3,18,4,-8,-4,-2,1,-3,0,2,-2,5,2,-1,-2,-8,5,-1,-2,-58,1,1,-1,2,-1,22,1,8,0,16,0,6,-4,-1,-15,-1,3,-1,-3,0,-22,-2,-1,1,23,2,1,1,-2,0,-5,-2,3,-2,36,0,-8,-8,6,-1,-5,-2,1,-2,0,2,34,-2,-12,-1,5,-1,-49,0,1,6,-2,-3,-2,-5,-3,-23,-2,-2,-1,-3,0,12,3,-4,-7,-5,-1,-8,2,0,-2,1,-2,-22,2,-2,0,-3,-9,-6,4,-17,-1,-1,-5,-1,-9,1,3,2,1,5,-2,-2,4,-3,2,1,-3,2,5,-1,-5,-9,4,5,45,9,-4,-1,2,-2,-59,1,-2,-2,1,3,-25,0,10,-2,-1,1,-2,-2,-2,-3,-3,1,-6,0,3,3,1,-1,1,-1,8,-2,-2,1,33,0,0,-13,6,-30,4,20,29,-4,1,-1,23,2,-12,18,-2,-71,-2,-3,-2,-3,-1,1,-2,12,26,-5,19,-3,-1,8,9,-7,-7,-1,-4,-7,13,-3,1,0,3,-28,1,-3,0,1,-3,-1,4},
+                                              {-6,-7,2,1,1,4,1,0,1,0,1,2,-1,-2,-1,14,-4,1,2,1,-1,-2,-3,1,-3,2,0,1,-1,2,-3,-4,-1,-2,-7,4,-6,-4,1,-2,1,3,16,8,2,3,-4,-2,-1,6,4,3,5,2,20,-2,0,6,6,1,-1,0,1,-1,-1,2,4,1,-3,-3,2,3,-2,3,-8,3,0,1,-8,2,-2,1,1,2,-2,0,-4,2,2,1,-2,-3,2,5,3,3,0,-1,-1,3,3,3,-2,2,1,1,0,2,-5,-2,2,4,-2,-3,7,3,2,4,-1,1,9,0,5,1,13,2,1,0,-4,-62,5,-2,0,1,0,26,-2,-7,-6,3,0,1,7,3,4,3,3,2,-1,5,2,2,1,2,0,1,-2,2,6,3,-9,4,-1,3,1,2,-1,5,1,1,-2,1,2,-1,-17,1,-5,1,3,3,0,2,-20,-6,-5,-6,1,-3,8,-1,-1,3,-19,5,-2,2,2,-2,-58,4,3,1,-3,-1,4,2,3,-14,-1,2,6,4,0,1,-3,1,3,-2,-3,-3,-1,2,1,5,-2,4,1,0,-17,1,-1,1,-3,-2,2,-1,-4,10,9,-3,3,1,4,-1,4,3,29,-3,4,-3,-3,4,0,5,2,-1},
+                                              {-4,-5,4,1,1,3,3,1,2,4,-1,-2,-1,-5,-1,8,-2,1,2,1,0,-2,-2,-4,0,0,-7,1,6,4,-8,-3,-1,-4,-3,4,-7,-2,4,-1,3,6,10,0,3,0,-9,-2,1,3,2,4,2,6,13,-5,-1,2,6,-1,1,-2,-1,-1,3,0,4,6,-1,-3,2,5,-1,2,-3,2,0,0,-1,3,-2,1,9,1,-8,1,-3,-2,3,-2,-1,-1,4,9,6,2,2,0,-1,1,2,4,-2,2,3,1,-2,5,-4,2,-2,3,-1,-2,6,1,1,3,-2,3,12,-2,2,1,6,3,5,1,-2,-62,1,-6,1,1,-2,-11,0,-3,0,1,0,1,4,3,2,-4,1,1,0,5,4,2,2,1,2,-1,-2,2,-2,4,-2,2,-4,3,1,3,4,5,-4,-1,3,3,3,-8,-7,1,-3,2,3,1,4,2,31,-1,-1,-2,1,1,9,-2,-2,3,-12,-4,-2,4,3,-3,11,2,-1,4,1,2,5,1,2,-10,0,2,1,-2,1,-2,-2,1,4,0,1,2,-4,-2,2,7,-2,-1,-2,-1,-10,1,-3,1,-4,-2,7,-8,-2,6,5,-2,2,2,2,-3,-2,3,31,1,3,-2,-1,1,2,3,1,-3},
+                                              {-9,-6,2,-1,4,3,3,-1,2,1,-1,2,-2,2,2,12,-3,2,2,-4,2,-2,-2,2,-1,-3,1,3,5,3,-2,-1,-5,-4,-3,4,-8,-3,2,0,1,3,-58,-1,4,4,8,-2,0,3,5,2,4,6,19,3,0,5,0,1,3,0,-1,-6,4,-3,1,1,-2,-3,-1,4,-3,3,-4,2,-5,-1,-1,4,-1,-2,4,2,-1,-2,-1,-2,3,3,-2,-2,3,9,7,2,2,-1,-2,-1,5,3,-5,2,5,1,-5,2,-2,1,-2,2,-2,-4,10,1,1,3,0,5,13,-2,3,-5,13,2,-1,2,-2,-58,5,-4,1,1,-1,-14,0,-2,2,4,1,-6,11,1,4,1,0,2,-1,3,4,4,-1,1,2,1,-3,3,3,2,-1,2,-3,2,0,4,-3,8,-3,2,2,4,3,-1,-12,-1,-5,4,4,-3,11,4,-11,2,1,-3,-1,1,20,-3,1,5,-18,5,1,3,3,-2,18,4,3,-2,-3,1,4,2,1,32,-1,4,3,4,-2,-1,-3,-5,3,0,7,-3,-4,4,2,7,0,4,-2,-2,-18,-1,-3,4,-1,-1,1,-3,-2,10,5,-4,5,-1,4,0,0,2,30,-1,3,-3,2,1,-2,3,4,0},
+                                              {-6,-12,5,3,2,1,3,2,-3,-3,0,1,-1,-2,2,-32,-3,3,1,0,-3,-2,-3,-2,-2,-3,0,1,4,3,-3,-3,1,-3,-4,5,-9,-2,2,-3,1,4,11,1,3,1,1,-2,0,-1,-4,5,1,4,12,-2,0,2,-2,0,5,-1,3,-2,-1,-1,4,1,-5,-4,-3,5,-1,4,-4,46,-1,-2,-3,-2,4,-1,-3,-4,-2,-3,-1,-2,1,1,-3,-2,2,7,3,3,-1,0,-1,1,2,4,3,1,4,1,-1,4,-4,2,0,0,2,-2,8,3,1,4,-1,1,14,-1,1,1,9,3,-1,-1,-4,9,4,-2,3,-2,-2,33,1,-2,-1,3,-1,2,8,4,3,-11,3,2,-2,4,1,1,2,-8,1,-2,-6,-1,4,2,-3,3,-3,5,1,5,2,3,0,-1,5,4,3,-1,-7,2,-4,2,2,2,-2,-2,-10,-7,-1,-2,-2,1,-69,-3,-1,1,37,2,-3,1,2,-4,-42,-5,2,3,-1,0,2,0,2,-11,-2,4,2,2,2,-3,-3,-1,1,1,2,-1,-5,1,2,3,1,-1,-1,0,-12,-1,-4,3,-1,-1,4,-1,-5,10,6,-3,-6,3,1,-4,1,2,-11,1,1,-1,1,-1,1,5,2,-3},
+                                              {-12,-17,2,4,4,0,3,0,0,-2,1,3,0,-1,2,-59,-2,2,5,1,-2,-5,0,0,-5,-3,2,2,5,2,0,-7,2,-4,-1,3,-8,-8,5,0,3,2,23,4,3,8,-18,-2,-1,1,5,6,1,6,29,-3,0,1,3,2,2,0,3,2,7,1,2,-1,-7,-5,1,3,-7,2,-3,5,2,-8,-2,0,-3,-4,-2,1,-1,-2,0,4,3,1,-1,1,5,9,1,4,1,1,-1,-2,3,4,0,-3,1,-3,0,5,-7,-1,-1,0,5,-5,12,2,3,5,-3,2,14,-8,5,2,18,-1,-22,0,-5,17,2,-3,0,1,0,-21,1,-1,2,6,-2,2,12,1,4,19,4,5,-5,2,3,4,3,2,3,2,-3,4,10,7,0,-2,-4,4,3,2,1,4,-7,-6,-2,4,3,2,-15,3,-3,1,3,4,4,-7,37,-7,3,-2,-1,-1,-31,-4,-1,6,36,5,1,2,-1,-3,23,3,2,0,-2,1,4,-2,1,-13,-3,-1,3,-7,2,-4,-4,2,3,-5,2,-8,-3,3,3,4,-2,2,0,-2,-25,0,-9,-6,-1,1,8,-1,-6,16,5,-6,2,3,7,-6,2,3,-24,-1,3,-7,-2,2,2,4,3,-4},
+                                              {-3,2,-3,-1,3,4,2,1,-1,-3,-2,-2,0,-1,-2,-50,-3,3,5,0,-1,-4,-1,-2,1,-5,-2,3,-5,8,-3,-4,-2,2,-1,6,-9,1,4,-6,3,3,-47,-4,3,1,2,-2,-2,4,2,-3,-2,2,18,0,-2,1,4,1,2,-1,1,-1,6,0,3,1,-3,-3,-1,3,-1,3,-3,10,-1,-1,-3,5,1,1,-3,1,-2,1,1,-2,3,-1,-1,-4,2,1,5,5,1,-1,-1,0,4,4,-7,2,2,2,-1,4,-1,2,1,1,-3,-2,8,2,1,4,-1,1,8,1,5,3,17,-2,1,2,-5,5,6,-3,1,-3,-1,-22,-2,-2,2,2,-3,1,7,4,12,3,4,2,2,-1,4,4,-3,0,5,2,1,-2,3,1,-1,2,-2,-6,1,4,5,4,1,5,8,-1,5,1,-25,1,-4,-1,3,1,7,0,-18,-7,-1,-2,-3,-1,-36,-2,2,-7,48,6,-1,2,-1,-4,2,1,1,-3,-1,4,2,0,3,45,-2,-1,-2,-6,3,-2,-2,-1,3,2,1,4,-3,-2,3,4,1,-3,-4,-1,-14,-2,-3,0,-5,-3,3,-1,-4,15,6,-5,1,2,-3,-3,3,4,-26,3,0,-1,-7,0,-5,4,4,-3},
+                                              {-4,-18,-1,3,2,4,4,-1,4,-6,-2,2,0,-3,1,15,-7,2,1,-1,2,0,-1,1,-3,0,2,1,6,3,-2,-2,1,-5,-3,4,-6,-2,2,2,5,2,17,1,2,3,-5,-4,-3,1,3,1,2,3,21,3,-1,6,0,-6,3,-2,-1,-1,3,0,1,1,-4,-3,0,4,-3,4,-3,2,1,-2,-2,4,0,-2,-4,1,-2,-2,-2,0,-2,1,-7,0,1,7,5,7,-3,-1,-4,4,3,5,0,1,3,0,-2,4,-4,4,-3,0,5,-3,7,1,2,5,-1,1,13,-9,1,1,11,2,-1,-1,-3,22,4,-3,1,-1,-3,26,-2,-3,2,4,0,-1,7,3,5,4,4,2,-4,1,1,2,1,2,3,-5,-1,5,2,5,-1,-1,0,-4,3,3,-3,4,1,-1,-3,1,4,-2,30,-1,-8,0,2,2,3,1,-26,-3,1,-1,-2,1,13,-5,1,0,-14,3,-7,3,4,-10,-69,4,5,4,-4,0,1,2,2,-16,-1,2,3,11,-1,-1,-3,-1,1,-2,5,1,-4,2,0,5,-2,1,-9,0,-18,-1,-4,2,-4,-1,6,1,-4,10,6,-5,3,-2,4,-4,-1,2,-11,2,0,-5,-1,4,2,3,1,-3},
+                                              {-5,-8,9,1,3,1,2,2,1,3,-1,2,0,4,3,9,-1,3,-1,1,-1,-2,-8,-1,-1,0,-2,1,-1,3,-3,-2,-1,-4,-2,2,-9,-3,5,-4,3,8,11,2,3,0,10,3,-1,3,3,-1,3,6,15,1,1,6,3,-1,-1,-5,1,0,6,1,5,0,-3,-2,0,5,0,2,-3,4,1,-4,-2,2,-1,1,-3,1,-4,1,-3,1,3,1,-2,-2,3,7,4,6,3,0,-2,2,3,5,1,2,4,0,1,2,-3,2,1,1,3,-2,6,2,0,4,-3,3,13,-2,4,1,8,1,2,1,-5,13,-1,-3,2,-1,1,-11,-1,-3,0,-2,3,2,6,4,3,-4,5,1,-2,3,3,2,4,1,4,-1,-4,-1,0,8,-1,3,-3,2,2,3,4,1,-3,-1,8,2,3,-2,32,3,-3,2,2,3,2,-1,31,-5,-1,-3,1,-1,9,-2,-8,3,-9,5,-3,3,2,-3,10,3,-1,1,-2,1,-1,-2,4,-13,-1,2,2,7,2,-2,-3,1,0,1,3,-1,-2,-3,2,5,-1,-1,-2,-6,-14,0,-4,2,-1,-2,-1,-2,-2,8,4,-3,2,2,1,-1,3,2,-9,1,3,-1,-3,3,-2,4,3,-3},
+                                              {-8,-7,1,2,4,4,3,-2,0,-3,-1,-1,-5,-2,-7,12,-3,3,2,-1,-1,-2,-1,1,-3,-7,2,-5,5,7,-3,-4,0,-1,-3,2,-6,-3,2,3,3,3,-63,1,1,4,8,-3,0,3,4,3,-2,6,21,-1,6,2,4,0,1,-2,1,-1,4,-1,3,1,-4,-4,3,5,-2,3,-4,2,1,-1,-4,2,-1,-4,-2,2,-2,-1,-2,-5,1,-2,-1,0,1,6,3,6,-2,-5,-1,2,3,5,-3,-2,2,1,1,6,-4,-1,1,2,6,-2,9,3,-4,2,-2,3,17,-2,6,3,13,2,1,-7,-5,17,3,-1,0,-1,-2,-16,-1,-2,1,2,-1,-4,9,3,5,-1,3,-2,-3,5,3,4,1,1,1,1,-2,-3,6,5,-1,2,-1,4,1,3,-4,3,1,-1,1,-5,4,2,31,1,-2,2,2,2,2,1,-17,-4,-2,-4,-2,-2,19,-3,-1,2,-14,3,-2,6,4,-4,16,4,2,2,-3,2,-1,1,2,32,-1,4,5,0,-1,0,-2,1,5,-2,0,-1,-2,2,1,3,-2,-1,-1,-2,-18,1,-2,4,-3,-2,3,-1,-4,10,7,-6,3,1,1,-3,-2,2,-12,-5,3,-4,-3,4,1,4,3,-2},
+                                              {6,6,-1,-2,-3,4,-1,1,3,-1,2,2,0,3,4,5,-9,1,-3,-1,1,1,2,4,8,7,-3,-2,10,1,-2,6,2,-5,-6,1,1,5,-2,3,2,-2,2,8,-1,4,4,-1,-5,3,1,-7,5,-11,-5,0,-1,7,7,-16,-10,1,1,0,-12,1,0,1,4,6,2,5,-6,4,-5,2,-1,4,-6,-4,-4,1,3,3,-2,3,-9,3,-3,4,30,2,-1,1,5,3,3,-2,24,4,2,-77,-2,1,-1,-1,1,4,-2,-4,21,4,13,11,-6,16,3,16,1,-3,1,8,3,-2,-3,3,6,-2,-3,-2,6,1,-2,-2,-16,1,0,-1,-5,1,1,5,-8,3,-7,-2,-62,1,-4,-8,-1,-3,5,3,-4,-15,-4,3,-4,7,-4,4,-2,-2,-1,-3,-3,-12,-5,2,-2,-3,4,-3,0,1,-12,2,-5,-1,3,-2,1,-1,-5,-5,-2,2,-1,35,0,-4,-3,4,-19,-1,-1,37,-2,4,4,-3,-3,1,-11,-2,1,-1,-1,-1,1,7,0,2,-6,-1,-2,-7,-8,6,-7,-1,-1,-4,-5,2,31,1,4,16,-6,2,-8,0,10,-1,-6,-6,-10,-3,-1,-13,2,-5,0,1,0,-1,5,7,15,2,2,20,-1,2},
+                                              {8,7,-1,-4,-2,1,0,1,3,-11,-2,-2,-1,-2,2,4,31,3,1,0,1,1,3,1,9,9,-9,-1,9,7,-7,5,-2,-5,-1,3,1,5,1,4,4,4,-1,2,2,0,5,1,-3,1,1,-6,2,-4,-2,1,-2,4,3,-15,-3,0,-1,-2,-8,1,0,6,4,4,2,2,-2,1,1,-1,-2,2,0,-3,-4,-1,5,0,-8,2,-3,1,0,3,29,1,4,-6,7,2,5,-1,18,3,2,12,-1,3,1,-1,-2,2,-1,0,11,1,-8,8,-4,16,1,11,0,0,2,3,6,-2,-4,3,7,0,1,-1,2,-5,-2,-1,-10,-2,1,1,-1,-1,2,3,-7,4,-8,-1,-62,-1,-4,-6,2,-6,1,2,-2,-12,-2,-2,4,2,1,2,-1,2,-1,-2,1,-7,0,1,-2,1,3,-8,-1,0,-8,1,-3,-2,5,0,-1,-2,-1,0,-2,0,-3,-9,-1,-2,-4,-2,-11,2,3,-12,1,2,3,-1,-3,1,-4,-1,1,-2,1,1,1,-7,3,-1,-5,-1,1,-1,5,2,-8,-2,1,3,-3,3,-10,-2,3,13,-2,1,-7,1,12,-12,-2,-3,-6,1,-1,-4,6,-2,-3,1,-3,1,6,5,2,0,2,-60,-1,2},
+                                              {1,7,1,-11,2,5,-1,-1,2,21,2,1,0,6,2,5,-13,4,-3,-5,4,-1,2,5,8,4,-2,1,7,0,-2,15,-4,-6,1,1,1,6,1,-1,2,-3,-1,0,2,5,9,-2,-7,-1,1,-3,3,-8,-2,1,-1,2,1,-13,-6,-1,-1,-7,-6,-1,-3,1,5,5,-1,6,-2,3,-1,1,-7,2,0,-2,-3,-6,4,3,-2,3,-3,1,-2,4,31,1,1,5,9,2,4,-2,17,3,2,15,2,2,2,-2,-3,3,1,-3,-60,3,22,8,-8,-62,0,16,2,1,2,4,0,-5,-4,-3,2,0,-1,0,5,0,-1,-2,-19,0,1,3,-1,1,1,1,-10,-1,-14,0,-60,-1,-3,-12,1,-2,2,2,1,31,-3,-4,-1,-1,1,1,2,1,1,-2,-5,-3,-2,6,3,0,4,-4,0,-1,-15,3,-2,-6,2,-2,-1,2,-2,0,-1,1,0,-15,1,2,-3,2,26,2,1,-10,1,5,4,2,-1,-1,-9,-2,-2,-3,-1,1,-2,1,0,-1,-5,-6,-2,-3,1,7,-5,1,2,-2,-1,3,-21,-1,0,14,-4,2,-4,1,7,-1,-3,-5,-3,-1,2,-5,1,-2,-2,-1,-4,4,8,-1,5,0,-2,15,1,14},
+                                              {2,3,0,-3,-1,3,0,2,-2,5,1,1,1,1,4,2,-12,3,-3,-2,0,1,3,2,9,7,-1,-2,10,2,-2,9,1,-2,-1,3,3,5,1,1,1,-1,0,-1,2,4,8,-3,-7,-4,-5,-10,2,-8,-1,2,-1,2,0,37,-4,1,1,-2,-9,-1,0,2,5,5,-1,3,-1,3,-2,2,-2,3,-2,-8,-1,-1,3,-6,-2,-1,-2,2,-3,3,-12,0,1,-3,7,4,2,-1,14,2,2,-78,0,1,1,-2,1,2,-1,-2,12,2,6,11,-3,16,-1,13,1,-1,-1,1,3,-2,-6,2,1,-3,-2,-1,3,1,71,-1,-10,-1,-2,3,-3,1,-1,7,-8,2,-4,-2,14,0,-3,-5,-2,-3,2,-6,-3,-9,-3,3,2,1,-1,2,0,3,-3,1,4,-9,-1,1,0,0,3,-2,-1,3,-5,2,-2,0,-1,-5,-3,-6,-2,1,-1,1,-1,31,-1,-4,-4,0,-13,0,0,-14,-3,-5,4,-4,-2,0,-7,-3,1,-5,-2,4,-2,5,3,-3,-6,-2,-4,-3,7,-2,-8,0,1,-2,-1,-2,38,-1,1,-61,-4,1,-4,-1,9,-1,-6,-4,-8,-1,-10,-4,3,-5,-3,-2,-6,0,4,3,3,-1,2,14,1,4},
+                                              {4,3,-2,-9,1,2,3,2,5,-15,3,2,1,-2,3,3,34,2,2,0,-2,-2,4,4,10,5,-1,1,11,0,1,11,4,-5,3,1,3,3,2,-1,3,-1,3,4,-1,8,1,-1,-7,-3,1,70,3,-11,-4,1,1,5,2,35,-8,1,3,-1,-10,5,-1,3,4,6,1,4,-9,3,2,-1,0,-3,-1,-1,-3,-8,4,3,-2,1,-5,5,-2,5,-26,3,5,-4,3,4,3,1,23,5,2,17,-1,2,-2,-5,2,4,-2,-3,17,2,20,8,-8,-69,4,18,-1,-2,3,-3,6,1,-9,9,5,-2,-1,2,1,1,3,2,-34,1,1,6,1,3,-1,0,-10,3,-11,-1,20,1,-5,-15,2,-1,5,3,0,-26,-2,1,2,6,4,1,1,6,2,-3,-4,-11,-1,-5,3,-2,2,-1,-1,1,-9,2,-4,1,0,-9,0,-3,-1,2,-1,-1,-2,-14,2,-13,-2,3,28,-1,1,38,0,4,6,5,-1,1,-9,-3,1,-1,-3,-2,0,2,2,-3,-6,1,-2,-4,5,-2,-6,-2,2,-4,-4,-1,-29,1,3,-51,-9,-1,-6,2,12,-1,-6,-5,-8,-4,-1,-9,-1,-9,-2,0,-3,5,4,4,4,-1,3,-55,-1,14},
+                                              {2,-3,-4,-5,1,1,1,2,1,-9,1,-2,1,-1,3,1,-15,3,0,-2,2,3,1,3,6,6,-1,1,8,6,-2,5,0,-3,0,3,-3,5,2,3,3,1,0,4,2,1,-3,-1,-6,-1,1,-4,-1,-5,-3,-2,1,5,3,31,-2,-1,1,-1,-7,1,2,2,1,4,3,4,-2,3,1,2,-3,2,-1,0,-1,-3,3,2,-2,1,-5,-1,-1,6,-12,-1,2,-3,7,7,6,-2,17,1,2,11,1,4,1,0,-1,2,1,-1,-64,1,-9,8,-2,15,1,11,-1,-1,2,2,1,1,-2,7,6,-2,-2,1,6,-2,7,1,-16,-8,-2,1,1,2,-1,1,-5,1,-8,-1,11,1,-5,-8,3,-3,4,0,1,31,-4,1,-3,11,1,2,0,1,-1,1,2,-6,-2,-1,-14,1,2,-2,-8,2,-4,2,-2,-1,4,-1,-7,-2,-1,0,-2,2,5,-8,1,-4,-7,3,-12,1,-3,-15,-3,-2,1,-1,-3,1,-8,0,2,-7,-1,-2,-2,7,3,-1,-3,-2,-2,-1,-4,0,-8,-2,1,-2,-3,-1,-12,-3,5,-69,-4,2,-10,-1,11,-3,-4,-6,-5,-2,-4,-6,2,-3,2,1,-7,2,2,3,-1,1,2,14,2,2},
+                                              {11,5,1,0,0,5,2,1,6,2,-2,3,1,4,7,1,-25,2,2,-1,4,4,4,6,21,4,-1,-1,11,7,-1,18,2,-1,0,2,4,11,-1,-5,4,-2,2,3,1,5,-11,0,-8,1,3,2,1,-5,-2,-5,-2,1,3,-28,-29,-1,1,1,-4,2,-3,4,9,13,0,9,-8,5,1,-1,0,4,-2,0,2,-2,-9,3,-2,2,1,1,-1,-3,-27,3,-1,-4,5,7,2,-2,19,3,3,-37,-8,-2,2,-1,-1,4,1,1,11,-1,-49,17,-4,-37,3,-35,0,-3,-7,4,8,-1,-4,4,4,0,1,0,5,1,17,3,58,1,0,2,-1,1,1,-3,-7,1,-2,-3,10,-1,-1,-7,0,-3,4,3,2,-22,2,-9,8,10,3,1,1,4,3,1,-6,-4,4,5,-1,2,4,-4,-1,-3,22,1,-4,0,4,0,-2,-4,-1,2,-1,2,4,63,2,-1,-1,3,44,9,0,-30,-4,2,8,-4,1,-1,-5,0,3,-2,1,-2,5,-12,1,-1,-3,-1,-4,-3,-4,4,-7,1,-1,2,-1,2,32,0,3,9,-5,-1,-5,1,10,2,-2,-4,-2,1,-1,-6,2,-3,1,-1,-3,2,4,6,2,3,3,11,2,10},
+                                              {7,3,16,-3,0,2,1,2,3,11,3,4,1,5,3,1,36,2,-3,-2,2,2,-7,4,7,9,-4,-1,9,2,-2,7,1,-3,0,-1,2,5,2,2,4,4,2,3,2,1,-4,-3,-4,1,0,-9,5,-4,-2,-3,1,10,3,-11,-5,-5,1,-2,-5,1,1,1,2,6,0,8,1,4,1,1,-2,-1,-2,-4,-4,0,-2,2,-4,3,-5,2,-3,4,-11,1,0,-3,8,5,8,1,15,3,1,12,-1,2,-1,-3,2,2,1,-1,11,3,6,10,-4,15,-1,-75,-2,1,4,3,5,-2,-5,0,5,-2,-1,1,1,-1,2,-1,34,0,0,2,-1,-2,1,5,-5,1,-5,-1,15,-2,-3,-6,1,-2,4,2,2,-12,-4,-3,-5,8,1,1,1,-1,0,-1,2,-8,0,0,1,1,3,-5,0,3,18,1,-3,-1,2,-3,-2,-4,-3,-1,1,0,3,-13,-8,-3,-3,3,-13,-1,0,-13,-2,3,3,-3,-1,-1,-7,-3,1,-4,-1,1,-2,1,2,-2,-5,-1,-5,-4,-4,3,-5,-6,1,-2,-2,-2,-12,-9,1,12,-5,-2,-5,0,7,-2,-6,-6,-8,-3,-2,2,-1,-5,-2,1,-3,1,6,8,-1,3,1,-57,1,3},
+                                              {3,6,1,-1,1,3,1,-3,2,-13,-2,-1,-6,1,-8,4,-17,1,-1,-2,0,2,3,4,9,11,-1,-5,9,5,-2,5,1,-4,1,1,6,8,1,5,3,0,0,3,-3,6,4,0,-6,1,1,-5,-1,-8,-3,4,5,-1,1,-11,-9,-3,1,0,-7,-1,1,2,5,6,3,2,-6,1,0,-2,-1,1,-3,-3,-2,-5,-1,2,-2,2,-3,-3,-4,3,-18,2,-1,1,7,7,4,-6,23,4,2,18,-3,1,-1,-2,1,6,-1,-5,-57,2,13,11,-7,20,-4,-74,-1,-2,8,5,9,0,-5,1,4,-7,-2,-1,6,2,-1,-2,31,-2,1,3,-2,1,1,-1,-11,2,-13,-2,19,-5,-4,-11,1,-1,3,3,2,31,-3,1,0,5,3,2,3,5,0,-2,-7,-9,2,3,2,-5,3,-1,-2,1,15,2,-2,-2,4,-3,-2,-2,-2,-1,-2,-3,-2,-17,-1,-4,-2,4,-15,3,3,31,-1,3,6,2,-2,-1,-11,-2,0,-4,-1,2,2,3,1,2,-5,-1,2,-4,8,4,-6,-2,-1,-2,-3,-1,-15,-2,2,18,-5,1,-6,1,12,-2,-4,-7,-11,-8,0,-1,4,-4,-5,-1,-4,0,6,1,0,1,3,19,1,3},
+                                              {4,5,8,-1,-1,5,-1,2,3,1,1,3,1,2,1,5,0,1,-62,-1,-1,2,-17,3,-3,-3,-1,-1,-9,2,2,-5,1,-3,-6,-1,3,5,-1,-4,-1,-3,5,7,0,4,-4,18,0,6,0,6,5,2,-2,-5,4,-1,4,1,2,-21,-1,-2,-1,6,2,0,-4,6,2,-1,0,-20,-6,2,-3,4,-8,2,-3,2,4,-1,3,3,-4,1,3,-4,1,0,12,4,0,2,-12,1,-2,4,4,-1,-1,-2,1,-1,1,3,-1,0,5,5,-1,-2,-2,2,1,1,-2,-1,-5,5,-2,-2,-2,2,7,1,-2,2,-4,4,1,2,3,-2,-3,-7,-8,2,1,3,-2,2,1,1,3,0,-2,7,2,2,4,-1,1,-1,21,1,-16,-1,-8,5,-4,2,-1,2,2,-8,0,1,1,0,-1,2,1,1,-1,4,0,-2,-1,-3,2,-3,-7,-7,0,3,-2,1,33,4,-2,9,0,2,1,1,2,2,-6,-1,-2,4,-5,-1,3,-1,-1,-1,0,4,1,-1,-2,1,-7,-2,-2,4,-2,-12,-1,3,-2,6,2,33,1,2,-2,7,0,-1,-4,3,10,-2,4,-3,2,-3,2,14,6,4,3,-5,4,5,-5,4,22,0,2,-1},
+                                              {1,8,9,-4,-1,2,2,3,3,-4,-2,0,0,-1,-1,5,1,1,-48,-1,-1,2,-16,0,-2,-4,-7,0,-2,4,-7,-3,-2,-5,-1,3,1,9,2,-1,3,-2,4,-2,1,1,1,13,1,3,-2,6,2,5,-2,-4,1,1,5,-1,7,-9,-2,-3,2,4,2,5,-4,5,1,3,2,-13,-1,0,-2,0,-1,1,-3,4,7,-1,-4,3,-4,-3,4,-1,3,3,16,6,4,-1,-82,1,-4,2,3,2,2,-2,2,-2,-1,4,-1,2,2,3,-4,-2,-3,2,-1,-2,-2,2,-4,2,1,-3,-5,1,9,2,1,2,-4,-3,1,1,1,-2,-2,-3,-2,1,1,4,-3,5,3,1,1,-1,-1,5,2,3,1,-1,1,-1,22,11,-8,2,-2,3,-4,-1,1,3,5,-5,-2,-1,-2,1,1,-5,-1,2,-1,3,1,-2,4,-2,1,-2,-3,-3,9,4,-3,-1,38,1,-2,3,1,2,3,-1,4,-1,-9,2,-2,4,-2,-1,2,-2,2,2,2,4,3,-2,-3,-1,14,-2,5,1,-4,-7,1,6,-2,3,-2,-8,3,3,-3,2,-1,1,-1,-8,9,-1,3,-3,-1,-1,1,11,4,1,-1,-2,3,2,-1,1,8,-2,1,-3},
+                                              {-1,5,9,-3,2,4,1,0,5,8,-2,1,-1,-4,1,5,1,3,-65,-6,2,1,-15,2,-4,-7,-1,1,-8,3,1,-3,-5,-5,-1,2,3,4,1,3,1,-5,2,-1,2,4,2,18,3,8,-3,3,3,6,-3,0,3,3,2,0,2,-17,-2,-7,5,3,-2,-1,-6,4,2,2,1,-20,-2,2,-6,3,-2,2,-2,-1,3,-1,3,3,-4,-2,2,3,0,-1,14,4,6,1,-8,1,-3,0,4,2,-3,1,4,-1,-4,3,0,2,0,1,-2,-3,-6,-1,-1,-1,-1,4,-6,4,2,-7,-3,6,3,1,2,3,-5,1,0,1,2,-2,-2,-3,-3,3,2,1,-3,0,1,1,1,-1,-1,2,2,1,1,-2,-3,-2,20,1,-5,2,-2,2,-4,2,1,3,0,-6,1,2,2,2,0,1,0,1,-3,5,1,-7,5,-4,-1,0,-3,-4,-1,3,-1,-2,35,7,-2,8,2,2,1,1,4,2,-10,-3,-2,3,-3,-1,2,-2,0,2,-4,-5,1,-1,-2,-6,21,-1,4,7,-5,33,1,6,-1,5,0,-17,1,1,-4,7,2,0,-5,2,10,-2,2,-2,1,-3,2,14,6,-2,0,-2,4,0,-1,2,-31,-2,3,2},
+                                              {0,1,6,-3,1,1,1,4,-1,-5,-1,1,0,-9,0,4,0,2,13,-2,-2,3,-12,2,-2,-5,0,-1,-3,3,-1,-2,0,-2,-3,3,5,5,1,-2,1,-2,3,0,1,2,5,10,1,3,-8,3,4,2,-2,-2,2,1,1,1,5,39,-1,-3,-2,3,3,1,-7,4,-1,3,3,-12,-2,4,-3,3,-3,-3,3,4,1,-6,3,-1,-2,-2,1,2,0,1,7,5,2,1,-8,1,-2,3,3,1,-5,-2,3,-1,-1,4,-1,3,4,1,-1,-3,-2,2,-1,0,-2,2,-6,2,-2,-3,-3,0,6,0,-1,1,-3,2,2,1,1,-3,-1,-2,-2,1,-1,6,-1,5,0,-2,4,-1,-2,6,-2,-1,1,-8,0,-1,22,-1,-3,4,-4,4,-3,-2,2,5,5,-7,1,-2,-1,4,1,2,-2,1,-1,3,1,-2,-1,-3,-2,-2,-3,-3,3,4,-4,-1,-13,3,-3,7,-2,2,4,-1,-1,-8,-7,-1,-3,3,-4,-2,2,-3,0,4,2,4,4,-3,-3,-1,-68,-2,0,3,-4,-7,-1,3,0,3,3,33,2,2,-4,5,4,-1,-3,2,7,-1,3,-2,-6,1,2,8,2,-1,-3,-3,1,3,-1,2,12,-1,4,-1},
+                                              {2,0,2,2,3,2,1,3,6,8,2,-2,2,3,-1,6,3,-1,27,-1,-2,-2,-17,-1,-6,4,-2,1,-3,5,4,-8,1,-4,1,1,9,5,1,-3,3,-18,6,4,1,9,0,34,4,4,-2,7,1,2,-3,2,2,3,3,1,5,44,2,-2,4,7,0,1,-10,8,1,1,-1,-33,2,4,-1,-5,-3,4,-3,-5,0,0,1,2,-4,1,3,-5,3,-3,21,6,-1,4,-27,5,-3,3,4,0,-5,-13,-2,-4,4,5,-3,2,2,-1,2,-5,-7,0,3,-1,-4,3,-4,-1,6,-2,-9,2,7,3,-5,4,-8,5,0,3,4,-1,-4,-3,-2,-2,1,-1,-4,-3,3,-1,2,1,-3,3,2,-1,4,1,1,-1,18,-3,-5,6,0,2,4,10,3,3,2,-18,-3,-6,2,2,-1,1,2,2,1,4,1,-2,6,-11,3,-3,-3,-2,-3,5,-2,0,-24,6,0,6,3,2,1,0,3,2,-11,-1,1,4,-15,-3,3,-1,-2,-1,-5,4,3,-4,-5,2,7,-1,-1,5,-7,-29,-1,3,-2,9,1,-26,2,1,-10,-2,2,3,-3,2,13,-7,1,-7,1,-3,5,20,12,0,-1,-1,2,6,-3,3,9,-3,2,-4},
+                                              {-1,-3,4,-2,2,2,2,4,0,-1,-1,0,1,-4,1,2,1,2,13,-2,-1,3,-11,2,-3,-4,-1,1,-5,7,0,-4,-1,-5,-1,3,-5,6,3,-3,2,-2,3,5,2,0,-2,10,1,6,-2,7,0,4,2,1,3,4,1,1,7,38,0,-2,3,3,4,1,-3,3,1,4,5,-12,0,4,-4,2,-2,3,-2,6,3,-3,3,1,-3,-3,4,-3,1,-1,9,4,4,3,-3,0,-4,1,5,2,2,-1,3,-1,-1,4,-1,3,1,1,2,-3,-2,2,-1,0,-3,1,1,2,2,-1,-2,3,5,1,-2,2,-2,2,-1,0,2,-8,-4,-2,-1,2,-1,2,2,4,7,1,2,1,-2,6,2,0,2,-4,2,0,22,-2,-9,2,-2,3,-3,1,-1,5,6,-4,2,0,-4,2,1,2,-6,5,-2,3,1,-2,3,1,-6,2,-2,-3,1,4,1,-1,-10,1,-7,10,-1,3,-2,-1,0,-4,-9,3,-2,3,-5,1,2,-8,0,-1,-2,-3,4,-2,-3,-2,8,-1,1,1,-2,33,1,2,-2,4,0,-11,0,0,-4,2,-3,-1,-1,1,7,1,5,-4,-4,-2,1,9,6,0,-6,-2,1,2,-1,-1,-69,-1,4,-2},
+                                              {2,4,11,2,1,4,3,1,5,10,-1,3,1,-5,1,4,-5,3,20,-2,1,3,36,3,-4,-11,2,-1,-3,4,2,-1,0,-5,1,2,4,8,0,1,4,-1,5,2,2,3,-3,19,-1,4,-2,4,2,3,-1,3,3,4,1,-5,10,-15,-2,-2,-1,5,-1,2,-7,7,2,3,1,-21,0,2,-2,1,-3,4,-2,2,1,-1,2,2,-3,-1,2,2,-5,1,-57,9,3,4,-7,1,-3,4,4,2,1,-1,3,-2,1,1,-1,5,2,1,-4,-3,-3,-1,-1,0,-2,2,-3,2,6,-3,-4,5,6,1,1,4,-6,4,2,2,-1,-2,-2,-3,-1,1,1,-1,-3,0,1,-1,5,-1,-2,2,-1,1,3,1,1,-5,21,8,-6,6,-1,2,-3,4,4,3,-1,-8,-1,2,-3,3,1,2,2,-1,-7,3,0,-2,4,-3,0,-2,-2,-2,-2,4,3,-4,-12,-1,-1,9,-5,1,1,-6,1,1,-7,4,-2,3,-8,0,3,-1,-1,-1,0,-3,2,-3,-4,0,-10,-2,-2,3,-5,-12,-2,6,-1,5,-11,33,1,3,-4,8,-1,-1,1,3,9,-4,3,-1,0,-4,4,13,5,1,1,-1,0,6,-1,5,21,-4,3,-4},
+                                              {2,6,1,-1,2,4,3,5,4,-8,1,6,1,12,3,3,0,2,2,-2,-2,2,47,4,-5,2,-1,-1,-14,-1,2,-1,1,-6,0,-1,1,19,3,-3,4,3,4,-6,1,1,-9,12,3,9,-1,-6,-3,4,0,-6,-1,-8,1,-1,1,-20,1,-1,4,6,3,-2,-5,5,2,3,2,-23,-1,-3,-2,-4,-2,-2,-3,1,-11,-2,3,3,-3,1,4,-7,1,-1,-54,-6,2,1,7,-1,0,2,5,0,2,-7,3,-2,2,3,2,2,2,-1,-1,-3,3,0,-1,-3,-3,1,-8,0,3,-2,-6,-1,5,1,-3,5,3,-3,-1,3,2,0,1,-2,-2,-10,2,2,-3,5,-11,-2,3,-1,2,8,1,2,-1,-1,4,-1,22,-4,-8,-7,-2,2,4,-2,1,5,5,-7,-7,4,1,5,3,3,-2,5,1,3,1,-1,0,-2,-3,-5,-2,-4,-2,4,-1,-2,-27,-4,-1,14,0,1,3,1,4,-4,-13,-5,2,3,-7,-2,4,-3,2,1,4,-6,4,-3,-2,1,-7,3,3,-3,-4,-24,-1,5,1,1,-4,-28,2,0,-3,-1,1,1,-2,2,16,-5,-2,-2,2,-2,-2,15,2,-2,-1,0,3,2,-5,3,-7,1,2,-3},
+                                              {0,5,13,-1,3,4,2,-1,4,3,-4,1,-5,-7,-8,5,1,-2,19,-2,-1,1,35,4,-5,-11,1,-5,-6,5,1,-5,0,-4,-1,2,6,8,1,0,3,-2,4,-3,-2,3,4,17,2,8,-2,5,-2,6,-3,2,8,3,4,-2,3,-13,0,-2,5,3,1,1,-6,6,3,4,2,-19,-2,0,-2,3,-4,2,-2,-3,4,-1,3,3,-3,-7,2,-2,2,1,-54,2,2,3,-6,-5,-2,3,4,2,-5,-3,1,-2,2,4,0,1,4,3,3,-3,-5,2,-5,-3,-2,2,-4,4,6,-1,-3,1,5,-5,-2,2,-5,4,-2,1,2,-3,-2,-3,-2,1,2,0,-5,1,3,-1,1,-4,-2,7,2,2,2,0,3,-2,23,-1,-10,4,-2,3,-4,4,1,3,-2,-6,3,2,1,-1,0,4,1,2,1,4,1,-2,4,-2,-2,-1,-4,-4,-1,1,1,-1,-11,4,-1,9,1,5,3,-1,3,1,-7,1,-1,2,-10,-1,3,-2,-1,3,1,-6,1,0,-3,0,18,-2,3,4,-3,33,-2,4,-2,4,-1,-16,3,1,-2,6,1,1,-4,1,9,-5,3,-3,1,-4,2,13,3,2,-1,-7,5,2,-3,5,-12,-1,4,-1},
+                                              {-1,6,-1,3,-1,4,1,-1,1,-4,30,1,-13,-3,43,-1,-3,17,1,-1,-2,3,1,3,-8,8,-2,-13,1,1,-2,-8,-1,5,-4,2,6,7,0,6,-1,-1,1,7,15,7,4,-3,4,5,2,6,-7,0,-4,-1,1,-7,4,-1,1,1,2,2,4,2,2,-1,-5,6,0,-10,1,3,-7,2,-1,0,-5,-3,-4,-2,3,-1,-1,3,22,-15,1,-3,1,1,0,1,-9,2,3,-16,-1,20,1,1,-4,2,-66,-2,0,-18,-4,-4,2,42,1,-6,7,1,29,-1,-2,-63,3,6,8,0,-5,-1,-1,32,-5,0,5,2,-2,-1,1,-1,1,-6,-5,1,20,2,7,2,7,2,2,-13,-4,9,-1,1,0,-2,4,2,-2,-5,-1,-1,-7,2,-3,-2,2,-1,-5,-9,2,5,-1,10,4,0,0,0,1,2,-1,-2,-3,-2,2,8,-7,-5,-1,-1,2,2,1,0,3,3,-1,-1,-2,2,1,1,8,3,-1,-2,-8,2,0,3,-2,-2,1,-9,1,2,-3,-1,0,-4,-2,3,14,2,-1,0,-3,3,1,2,3,2,15,1,-3,2,-2,-2,-4,-7,7,17,-2,-3,3,-5,-6,3,3,-9,4,-7,-2,1,-3,1,-64,-4},
+                                              {-5,8,0,-2,0,2,1,-1,1,4,-12,-3,-7,1,-17,-2,-2,-68,3,1,-1,4,1,1,-3,7,-9,-10,6,8,-7,-5,-3,4,0,2,6,6,3,11,2,1,1,-3,12,3,3,-1,6,2,0,4,-8,5,-3,-3,-1,-8,3,-1,-3,1,1,1,8,1,2,5,-5,4,-1,-4,3,3,-2,1,0,-2,-1,-2,-2,-2,9,-2,-7,4,23,-13,1,-1,1,0,4,-5,-7,1,3,30,0,12,1,3,-1,3,13,-2,-1,-16,-4,0,-1,0,-4,-5,6,1,-13,-1,-2,11,3,2,9,0,-6,4,2,31,-2,2,-1,-4,-2,2,-1,-1,-2,-2,-1,-3,14,1,7,2,4,2,1,-13,-3,7,1,1,5,-3,2,0,-4,-6,8,-5,-1,0,-1,7,3,2,0,-5,-1,3,0,7,1,-10,0,-1,1,0,-1,-1,3,2,2,5,-2,-3,1,2,2,-1,1,1,2,-2,0,-1,3,1,3,-2,2,-1,2,2,0,1,1,1,0,1,-1,6,2,1,-3,-1,3,-2,4,-1,3,-2,1,4,-2,1,-2,1,3,2,7,-1,-3,2,2,-10,-3,-6,5,15,-3,-2,6,-7,-7,1,0,-7,3,-5,2,1,-2,0,-67,-3},
+                                              {-9,10,-1,-4,2,5,1,-2,1,2,-9,1,-11,2,-29,1,-1,19,0,-5,2,3,1,4,-5,8,0,32,1,3,-2,-4,-5,8,1,2,8,7,2,-10,1,-4,-1,2,19,9,1,-4,4,2,2,3,-8,4,-3,4,1,-5,3,-1,-2,1,1,-3,10,-2,-3,1,-4,7,-3,-11,4,5,-4,1,-6,-1,-1,-2,-2,-2,5,-2,-1,4,25,30,2,-1,-1,-2,1,3,-11,3,4,-13,-2,-69,3,1,4,3,19,-2,-5,-25,-3,-2,-2,1,-3,-7,7,-1,-15,-2,-1,20,4,8,9,-6,-4,6,-3,33,-1,3,4,-1,-3,1,-1,-1,0,0,1,0,22,-6,9,2,4,2,-1,-14,-3,5,0,3,3,-2,6,1,-4,-2,5,-3,0,-1,-2,0,2,3,-7,-7,1,7,2,-36,3,-1,0,-1,1,3,0,-7,7,0,0,1,-2,-3,1,0,3,-1,2,4,3,4,3,-1,2,2,5,2,5,-4,1,-1,-8,2,-1,4,-2,1,-1,-12,-1,1,-3,-6,3,-4,3,9,2,4,1,2,-2,2,-3,-1,4,-1,9,1,1,2,-3,-2,-5,-6,4,24,0,-4,1,-7,-6,0,0,-6,4,-10,2,-1,-4,-2,-63,-3},
+                                              {-4,3,-1,-1,2,4,2,1,-3,-1,24,1,-10,0,44,-2,-2,12,-1,-1,-2,2,-1,2,-4,6,-1,-9,0,3,-3,-5,0,4,-1,3,6,6,2,1,1,0,-1,-2,11,5,3,-4,4,2,-8,5,-8,2,-2,2,0,-7,3,-1,1,1,2,1,4,0,2,2,-7,4,-2,-4,4,5,-3,4,-2,-1,-3,-7,1,-3,0,-6,-1,1,25,-14,-1,-1,-2,-2,0,-4,-8,3,1,-15,-1,13,2,1,-5,3,13,-2,-1,-15,-3,0,-1,-2,2,-4,6,3,-12,1,-2,-62,6,1,7,-1,-7,2,-3,-14,-2,2,1,1,0,-3,-1,-1,1,-1,-1,2,-60,3,7,5,4,1,2,31,-3,7,-3,-1,4,-10,6,-1,-5,-4,4,-5,-3,2,-4,0,2,3,1,-7,2,4,0,9,2,-1,-1,3,1,2,0,0,0,-5,-1,6,-2,-2,0,1,4,-1,-1,1,2,-4,0,0,1,1,2,-8,-1,2,-1,0,-7,1,0,1,-2,3,1,-10,3,-1,-4,-1,-1,-2,4,-4,3,3,0,0,-1,-1,-1,1,2,1,6,2,3,2,-2,-2,-5,-5,4,14,-9,-2,0,-7,-7,0,-2,-7,1,-4,2,1,-2,1,12,-4},
+                                              {-7,3,-3,1,2,2,2,2,4,2,-62,1,-23,1,-14,-2,0,-63,4,-1,-3,-1,3,2,-9,8,-1,-23,5,-3,1,-13,1,6,3,3,11,4,4,3,1,-3,3,4,18,11,0,-1,7,0,1,7,-22,4,-2,0,-10,-2,2,0,-6,1,6,3,9,2,1,1,-6,8,-1,-11,-2,4,-1,-1,2,-8,-1,-2,-1,-2,-3,-1,-1,1,25,40,3,-2,1,-2,5,-1,-14,4,3,35,-2,25,2,1,-5,2,-58,-6,1,-23,-5,0,-3,-1,3,-8,8,0,32,-1,-3,19,1,-2,10,1,-13,3,-2,-30,-8,4,0,1,-2,2,1,2,1,2,2,3,-54,-4,9,3,3,1,1,36,-5,4,-1,3,4,-1,5,3,-4,-8,7,1,1,-1,-2,4,4,0,-6,-13,-1,-2,5,7,1,1,-1,0,3,2,0,-1,3,-9,2,10,-1,-1,1,0,2,0,2,3,4,2,4,-2,0,2,6,0,5,-2,1,1,-13,-3,1,4,-4,-2,-1,1,4,-4,-4,-1,1,-7,3,-1,16,1,0,1,-3,-1,0,-1,2,2,15,-3,-1,5,1,-1,-7,-11,2,22,-1,-5,2,-12,-7,-1,-1,-7,0,-9,2,-1,-3,-2,22,-8},
+                                              {-4,1,-1,-1,2,4,1,3,-1,-4,-4,-1,-8,0,-20,-4,-2,10,2,-1,-2,5,1,2,-4,12,-1,32,3,8,-3,-3,-2,5,1,4,2,6,3,3,-1,-1,-3,1,14,4,4,-3,2,-1,2,3,-6,3,-2,-2,3,0,-1,-1,2,1,2,3,9,1,3,2,-3,4,-1,-5,3,4,-2,5,-2,-2,-2,0,1,1,4,-4,-2,2,22,-14,2,-3,-2,-3,1,-4,-8,6,3,-11,-2,-74,3,1,-5,5,16,-2,-1,-16,-3,1,-1,-2,-1,-5,7,1,-12,0,-2,11,5,4,11,2,-6,2,-1,-7,-2,2,3,0,-2,2,0,-6,-4,-1,1,1,-47,-1,9,2,8,2,1,35,-4,6,1,0,4,-3,3,1,-4,-4,4,0,1,-1,-2,3,1,2,0,-4,0,2,-5,-62,1,1,-7,2,1,1,-1,-2,2,-1,-5,3,-2,-3,-2,1,3,-1,1,2,-5,2,-1,-5,-3,0,2,-5,2,2,0,2,-7,3,1,-5,-2,-3,-3,6,3,-1,-1,-2,1,0,1,-4,3,2,2,0,-2,0,-2,-1,3,0,6,-1,-5,1,-1,-2,-4,-4,6,12,-5,-2,0,-7,-5,1,-6,-6,1,-3,0,-1,-3,0,16,-3},
+                                              {-8,6,1,3,1,5,4,-2,3,-8,29,3,31,0,46,-5,-8,20,2,-2,2,3,2,2,-7,14,0,-12,6,5,0,-5,-1,4,1,2,10,7,2,10,1,-3,1,-3,-74,10,2,-1,7,-2,1,1,-8,2,-2,-5,-1,-7,0,-6,-5,-1,1,1,7,1,-1,2,-6,8,0,-9,-1,3,-3,1,1,-2,-2,-1,0,-4,-1,-2,-1,1,25,33,-1,1,-5,3,-1,-1,-12,7,1,-16,-2,6,1,2,0,3,18,-3,0,-24,-4,3,-3,1,-1,-8,7,-1,-14,-1,-2,-66,4,6,12,-1,-8,2,-2,-14,-2,3,4,2,1,1,-4,-1,-2,-1,1,1,19,-4,8,0,4,0,3,-12,-4,3,-3,2,4,-1,7,-4,-5,-3,5,0,0,-2,2,7,3,3,-7,-9,2,3,-2,28,2,-1,1,-2,-5,0,-2,-2,3,-3,0,5,-2,-1,-2,0,6,-4,1,0,4,5,-5,-3,0,-6,1,-1,4,-11,1,-2,-11,2,0,2,-2,-2,-1,10,1,0,-3,-1,0,-4,6,-1,2,3,-2,2,-1,0,-12,1,3,3,7,3,-2,2,4,-1,-4,-7,5,23,-2,-7,4,-7,-8,-2,1,-6,1,-10,-1,1,0,-1,21,-8},
+                                              {-4,4,11,2,2,3,1,1,1,-2,-8,1,29,-4,-10,-2,-2,-51,-2,-2,-2,3,-6,2,-6,5,-3,-9,-1,3,-1,-4,-1,4,1,0,5,7,3,-1,1,7,1,0,-72,4,9,-2,2,0,0,1,-5,7,-3,3,3,-4,3,-3,1,-4,2,1,9,1,3,1,-4,4,-2,-5,5,4,-2,1,-1,-4,-2,-2,-2,-1,-1,-4,-3,3,22,-14,2,-4,-2,1,-1,-1,-8,5,5,34,-2,7,1,2,3,4,15,-3,1,-18,-3,1,1,-2,2,-3,7,-1,-13,-1,-4,14,5,2,9,0,-7,4,-2,-7,-1,4,-1,1,1,1,2,-1,-2,-1,-1,-3,12,1,9,1,6,1,1,-11,-3,8,-1,1,3,-3,5,1,-5,5,2,3,0,-1,-3,0,3,0,2,-7,-2,3,-2,16,3,-2,1,1,3,1,-1,-2,1,-2,1,4,-3,-3,0,-2,3,0,-8,-2,2,5,0,-2,1,1,2,0,4,1,-1,-1,-8,-1,1,2,-1,0,0,-5,2,-1,-3,-1,-2,-2,-1,2,3,-3,0,1,-2,-1,-4,-7,1,1,7,-4,1,2,-4,-4,-4,-6,3,15,-3,-2,0,-5,-7,-1,-1,-7,2,-1,-2,2,-5,2,13,-4},
+                                              {3,11,1,3,4,4,2,-3,1,-1,-21,-1,60,-3,-30,1,-2,8,4,-1,-2,4,3,4,-3,6,-1,56,4,6,-3,-9,0,10,1,3,14,14,2,5,3,1,1,-3,-30,6,-9,-2,2,2,2,5,-5,5,0,-8,1,-4,6,-2,2,0,3,2,13,0,1,2,0,13,1,-3,1,5,-3,1,2,0,-1,-2,-2,-5,0,-2,-1,4,42,-25,3,-8,1,2,-1,-2,-7,5,2,-24,0,-36,3,3,-5,3,-26,-2,1,-22,-3,-2,1,20,4,-3,16,2,50,-2,-3,9,6,5,14,2,-7,1,-1,-21,-1,3,3,2,-4,-1,1,1,1,1,1,-2,12,-3,13,2,8,2,0,-22,0,6,1,2,2,-3,4,-1,-1,-17,16,-7,1,1,-2,6,2,3,-7,-2,1,5,-2,-32,4,1,-1,-1,3,3,-1,-1,4,1,2,5,-1,-2,1,-2,4,-1,2,0,5,1,1,1,1,1,4,0,12,7,0,1,-3,2,1,4,-1,1,3,-7,1,1,-1,-1,3,-2,-3,7,10,1,0,2,0,-1,-2,-1,4,3,19,-1,0,3,-1,-3,-3,-8,3,11,-2,-1,-1,-4,-4,0,2,-3,4,-3,-5,1,-2,2,10,-4},
+                                              {-18,-15,2,2,-24,-2,-1,6,1,7,-4,2,0,2,-5,-3,2,-1,-4,-3,-3,5,2,5,-72,6,2,1,8,11,-2,11,-3,-64,-78,-36,-6,6,1,2,7,-2,4,-27,2,2,4,4,-4,6,-1,18,-2,17,5,-4,14,-56,-2,4,-3,5,2,-2,28,6,5,3,13,1,1,20,2,-3,-86,2,2,-6,-76,5,4,-3,6,1,-1,4,-2,0,-32,2,-6,1,5,4,15,19,1,2,-1,1,-35,-5,-2,6,-7,3,0,-6,-1,5,8,-57,2,-82,6,3,1,4,-6,1,2,-11,10,3,4,6,-6,-5,32,-3,-15,3,6,6,5,-1,-2,-17,-83,8,-1,-6,7,-4,-17,-3,-1,2,-79,-22,3,-1,-15,0,31,1,4,-5,22,-7,-12,1,3,10,2,-41,5,-15,9,4,-4,1,-9,3,7,-11,-1,-37,-35,2,-2,-1,6,-64,-79,-75,5,-34,8,-2,-2,-2,4,-14,-1,-5,-1,-7,-5,4,-13,7,2,4,-16,5,-6,2,2,-1,3,5,5,-4,-63,4,-3,-1,-7,-20,-84,3,6,-43,118,3,-8,-2,-7,4,-92,19,2,3,-1,-3,4,5,-9,7,-3,-4,-11,3,-60,6,-3,2,-1,-19,-76,10,2,7,0,11},
+                                              {-10,-16,2,4,1,0,-39,6,2,5,3,-44,7,-2,7,3,-3,-3,3,-3,-1,6,-2,-62,5,-2,-77,6,-1,-69,-82,12,4,14,2,1,-10,6,7,5,5,-3,2,10,2,6,-12,6,-2,17,4,14,-5,-9,3,-4,5,12,-6,6,-5,3,-9,5,-7,5,2,-41,16,-2,4,-10,3,-9,-2,3,3,2,-2,3,4,8,-1,3,-72,5,0,7,4,6,-2,9,8,-40,-11,22,10,-1,1,1,-9,2,-3,9,-1,4,2,-2,-4,1,3,5,10,8,4,0,5,2,3,0,24,-9,5,3,6,-7,6,-1,9,1,23,-81,4,1,7,5,-6,7,3,-46,2,7,6,12,-5,-1,-4,6,-83,-12,1,-47,-10,4,-9,6,4,3,-33,-21,4,2,-1,12,4,3,10,-7,19,1,7,2,-5,-76,5,8,3,6,5,1,0,-10,4,6,3,3,118,1,3,6,-3,-4,4,9,5,-4,6,6,1,5,-42,7,95,3,-13,2,-9,3,-3,4,-9,-11,-4,2,-71,-2,4,-10,1,-6,3,-3,7,6,-1,-48,7,-2,-4,3,9,-3,1,2,-55,-76,-84,4,-7,3,1,4,27,-78,0,5,0,-2,-4,-9,8,4,4,-7,-5,8},
+                                              {30,-7,2,58,1,-3,-2,2,-3,6,4,0,3,2,1,7,3,7,-5,-65,-3,1,3,5,3,4,-1,-2,38,6,0,-95,-79,23,4,3,-2,4,5,-48,7,1,-1,-6,6,-4,-4,3,-3,8,-2,18,-5,-15,5,-2,-1,8,1,4,-9,3,2,-15,-15,-42,-9,1,-72,-1,1,-14,-37,-3,4,2,-21,1,-2,0,-1,3,-3,3,-1,-44,3,-2,2,-58,-4,4,3,-7,-18,20,0,4,1,-6,-4,2,0,6,3,3,-80,-2,127,5,3,3,-1,1,-74,-9,2,3,4,5,3,-19,-6,-82,4,-4,6,-4,-8,2,-17,1,3,-6,4,1,-3,-2,-3,7,4,-2,-84,0,25,0,3,4,-76,18,-39,2,4,1,0,-3,-1,1,2,14,1,-51,6,7,2,5,9,-25,15,5,4,1,38,-2,1,1,-3,6,7,-82,18,-4,0,-17,3,4,1,3,8,3,-1,2,1,-18,-2,3,-3,1,5,3,1,5,1,-46,-18,-2,-39,-3,4,-3,4,-3,1,2,-76,-72,1,-3,1,-21,5,-5,6,9,-1,6,2,2,-3,4,8,6,-45,2,-1,1,3,3,12,1,-5,13,-4,3,-1,-42,-4,-21,5,21,1,1,-4,3,-1,-51},
+                                              {-9,36,4,-5,-9,2,5,4,-53,-3,0,2,6,4,1,14,3,2,1,6,1,12,3,1,-82,3,3,7,10,11,4,11,1,7,5,6,-46,8,-8,1,-64,8,8,10,2,3,-6,8,-3,13,-84,13,-2,22,1,2,7,17,10,-6,-5,3,-1,5,36,4,4,5,18,8,-33,-5,-3,-4,1,-33,5,-11,3,-60,124,1,14,-84,4,-2,-5,6,1,3,3,4,4,-12,-12,-7,5,6,7,1,4,-8,-1,4,-1,-1,6,-2,-4,0,8,3,-5,-91,6,4,4,3,-6,-3,1,16,10,6,-98,-12,7,5,12,8,-10,6,-68,-46,3,-3,2,4,2,3,-3,1,6,3,-7,-34,0,1,4,-13,1,1,-7,-72,-15,3,-1,-15,-36,7,3,1,-1,1,-55,4,28,-8,-25,-2,-24,3,-6,4,-2,4,2,-1,2,1,12,4,5,20,-3,-1,11,6,-9,-1,5,-2,2,-3,2,3,-68,4,5,-66,-41,-3,-2,0,-17,6,3,-2,2,-47,1,-3,5,0,7,7,3,2,-1,23,3,4,5,-5,-3,4,-7,1,-8,-2,8,-6,-67,-14,-2,2,6,-74,-5,5,-73,-4,-3,6,0,2,-2,-3,8,-2,3,-58,1,8,1,8},
+                                              {-9,25,13,-3,1,1,7,-26,5,-9,1,8,1,0,3,-10,-2,2,2,1,-38,-45,-5,-1,10,12,-6,1,-3,-22,-5,-99,3,-76,2,4,0,-33,-24,-1,-62,-26,5,-24,3,-9,-5,-2,-8,-2,-1,-69,28,-11,3,2,-47,27,-3,-1,-15,-3,-32,-5,-9,1,-29,-13,-77,28,-2,22,30,2,-4,10,-6,-85,0,5,2,-6,11,-6,-7,4,1,-4,2,-62,3,-85,5,-2,11,-9,-3,-3,2,3,2,3,-1,-60,-5,-80,3,-4,7,-52,4,6,-3,7,8,-6,-3,4,-95,5,11,15,13,-1,-98,-4,-50,3,-3,7,18,-3,5,3,2,-2,-77,-5,3,1,4,22,6,-4,32,1,3,-4,6,19,1,7,3,-3,-3,4,6,-5,-15,-1,-4,-8,-7,-8,9,-6,25,-14,7,-93,-4,2,0,-5,-7,-25,-3,2,3,-2,-2,-93,-8,-66,-3,2,-5,2,4,0,-1,33,-7,2,-3,4,-3,-3,1,-5,4,-11,3,6,-16,-72,2,-6,-63,0,-15,2,-23,-27,4,-3,2,126,-3,14,-61,-4,-26,3,3,0,3,-4,-4,7,-101,-77,1,-34,-8,-3,-87,-68,10,7,-3,9,-9,-108,2,4,-4,-28,-115,-18,-2,1,3,8,3,-68},
+                                              {34,29,4,5,4,0,4,-5,6,-2,2,4,3,6,-1,-29,7,7,3,3,1,-55,4,3,-1,3,3,-1,2,8,4,11,2,12,7,0,4,4,3,5,7,6,-38,7,6,8,9,7,0,15,-4,14,-9,-7,118,1,-1,-7,-6,-4,-4,3,1,4,-12,-9,1,5,9,6,4,-7,2,-3,6,-20,3,5,6,6,2,2,9,-4,3,1,-3,4,2,15,7,3,4,-63,-9,-11,4,0,2,-9,3,2,-2,3,6,0,4,-7,-5,2,-4,4,17,3,-79,1,3,2,7,7,-15,16,-31,-2,-97,-4,-69,4,5,-38,-12,7,3,4,9,-80,2,7,-1,2,1,5,-85,-2,-5,-12,1,-3,23,-6,4,4,-3,3,-2,-2,-3,3,-24,-5,5,3,-4,7,5,2,3,-7,23,3,-31,-5,-4,0,-80,4,2,-4,0,-3,-6,3,-83,7,0,7,8,-5,-36,8,5,0,-80,-7,3,1,5,5,-43,-1,-4,2,-1,2,-13,-5,3,-79,4,3,-7,7,4,3,-38,1,0,-2,0,25,3,-1,5,3,-2,-1,5,3,2,-6,9,-2,-3,-9,-70,6,3,-77,-5,8,-1,4,-1,3,-77,2,-83,-5,6,17,12,4,1,3,2,7},
+                                              {-19,-22,0,-12,2,-4,4,5,4,-16,-4,1,-3,-2,-3,-1,-82,4,6,2,-2,5,-1,0,-78,-9,3,2,-28,-8,3,-99,-4,8,-6,7,-8,-72,6,-7,4,3,6,5,-6,1,-2,6,25,11,0,-91,-6,20,3,-3,-3,6,0,-73,27,-2,2,1,27,1,-4,3,-72,-76,6,-14,14,-4,1,8,-4,-4,2,-1,-2,-1,6,-2,4,0,-2,-7,3,-59,-77,-2,-4,6,-9,-18,0,3,124,6,6,-55,-1,5,4,1,-4,-7,4,4,-51,-1,-35,-98,7,-49,1,-50,-2,2,-3,-18,-46,3,7,-16,-9,2,2,3,-14,-4,-5,6,-74,-1,3,-3,1,-6,4,11,3,2,30,1,-52,0,2,15,3,-6,6,-2,-1,-77,2,11,-3,-14,0,-7,-4,-4,-7,6,8,25,11,-5,0,2,-8,5,-4,8,-62,5,2,4,-1,9,5,18,2,-2,-2,7,2,-86,1,28,3,-9,-14,6,1,-20,-5,-2,-51,49,-1,3,32,3,2,3,2,-1,3,-1,6,-1,2,3,2,4,-3,-3,10,3,6,-8,0,1,-63,-3,-3,-55,10,5,-3,2,-50,-5,5,6,13,5,3,3,-2,6,-4,5,6,-18,0,-22,7,7,4,-51,8,-68},
+                                              {-10,-19,-40,-1,-1,3,10,5,2,-1,5,8,-2,-40,4,3,-6,0,-56,6,-1,4,-83,3,4,27,4,2,11,5,1,10,6,10,-1,-1,-26,-68,5,1,4,-70,4,7,-11,6,0,125,-4,20,6,13,0,-10,2,-5,-2,-7,-6,1,-7,-73,-6,4,-7,5,4,9,6,-77,3,-6,0,14,-1,4,5,2,6,4,5,-16,9,2,-4,4,-5,4,2,19,0,-10,-60,-45,-10,-7,-59,-5,2,2,4,4,1,-60,4,2,-2,-4,-4,3,4,2,-1,7,2,5,2,-11,3,4,24,-7,3,6,5,-9,10,0,9,3,25,-1,3,2,-2,4,6,6,5,6,6,3,5,-7,-5,-2,6,1,4,-13,2,6,-1,3,-7,4,16,-21,2,-13,4,2,1,4,5,2,12,29,15,-3,9,3,-3,-3,0,6,-4,3,-3,6,7,7,3,17,5,7,4,3,2,2,-80,5,4,-43,2,0,8,5,4,1,4,-1,-2,4,37,4,5,3,-3,3,1,8,5,0,3,-1,-44,9,-2,1,1,-70,-5,2,-2,5,3,-73,-4,6,8,5,-63,1,-7,-3,-84,3,-3,3,5,2,-4,-81,-64,-2,3,-4,4,-8,8,4,-39,-4,6,7},
+                                              {30,-19,1,-1,4,-2,5,3,3,-3,-88,-8,-78,-2,-79,7,6,-43,6,4,-2,1,2,3,4,-38,5,-79,12,-1,4,12,2,-67,-3,0,-53,-60,5,-11,7,4,-3,5,-36,1,-9,6,-7,3,-2,14,21,-21,-2,0,-50,17,1,2,4,-2,3,-4,-13,-4,5,4,8,-72,-1,25,9,-6,4,1,2,6,1,-4,1,-8,5,2,1,4,52,-17,3,22,2,-4,1,-1,18,-12,4,-79,-1,-33,3,7,2,8,-45,2,-4,24,-2,-2,2,-51,-4,5,-77,7,-12,-4,5,-38,16,-17,-22,-3,4,1,8,-88,11,5,-15,1,5,-8,-1,1,3,2,-5,-5,-39,6,-80,1,-12,-4,6,-85,2,-14,4,2,-13,2,-4,-4,4,17,-12,1,-2,4,-1,7,3,-8,13,25,3,-7,5,-35,-5,-5,-3,-12,-7,-1,1,4,11,4,1,-64,4,2,4,0,9,3,-1,-1,0,-8,2,-24,4,-7,7,-2,-33,-6,-1,2,33,-3,6,-5,3,4,6,-3,8,-4,3,0,6,4,-1,-12,-76,-4,2,-1,3,2,6,2,-1,7,-89,10,-2,5,-4,5,2,6,-7,126,5,6,-1,2,-3,2,2,-2,3,21,8,4,2,7,-36,8},
+                                              {-3,-2,-8,0,52,-3,3,0,4,-2,-3,0,2,-2,1,1,2,-1,2,2,1,2,3,0,-1,7,2,3,2,3,1,6,1,-5,10,-22,5,5,4,4,2,3,-2,-15,1,3,-1,2,-4,2,1,-7,-15,14,3,-2,2,-14,-5,1,10,3,-2,0,12,0,1,3,4,7,0,8,-1,-3,12,-5,2,-1,-52,2,5,7,-8,-2,-1,-1,8,-1,-22,15,-1,3,2,-4,10,12,2,3,2,1,63,2,-6,3,2,2,3,-2,6,4,-1,23,-4,1,9,-1,1,-2,-2,2,-5,-3,7,2,7,5,0,0,-7,2,-3,1,3,2,0,-1,2,10,13,0,0,2,7,3,5,0,1,1,-1,-8,-1,2,-10,1,8,1,5,-11,6,12,-52,-1,-4,14,4,64,6,-3,12,3,1,-1,-1,3,1,1,2,-26,-22,2,9,1,1,-5,10,-56,3,-21,-3,-1,3,2,2,-1,3,10,1,-3,1,2,-2,-6,2,1,2,2,2,1,3,1,-3,3,2,-2,-2,2,2,4,3,-4,-7,4,-2,43,-9,-2,-3,-2,-2,-1,-7,-5,2,-1,2,-1,6,8,-5,3,-1,4,-8,4,-6,-3,-1,5,-1,-6,22,0,2,-1,4,5},
+                                              {-3,-8,-1,-4,-9,-5,-5,-1,2,1,-1,-8,1,3,1,1,1,0,-3,0,2,1,1,-4,-7,1,2,2,1,3,0,8,1,-9,10,34,4,2,1,3,2,-1,-3,-7,-2,2,4,1,-3,-2,0,-3,-9,8,3,-2,3,2,-5,1,3,0,2,0,4,-2,1,6,5,5,1,3,-1,-1,-73,1,-1,-2,-82,1,4,3,2,-1,1,-3,4,-1,-13,5,-2,3,-3,0,5,7,1,1,1,-3,27,2,0,-1,-1,2,1,-1,3,-1,-2,1,-1,-8,5,2,2,-1,2,1,3,-5,4,1,2,10,-1,0,-15,1,-3,2,2,-2,0,1,1,12,12,-7,-3,-2,5,-3,-4,0,3,2,-6,-5,1,-5,-6,-1,6,1,4,-7,8,-2,15,-3,-2,9,1,-16,-3,-5,4,0,3,2,-3,1,3,-1,3,-13,-7,1,8,2,1,-7,12,11,-1,-11,-3,-1,-1,1,3,0,2,9,-1,1,0,-1,2,-1,2,2,-4,1,1,1,0,-3,-3,5,2,1,-4,0,-3,2,1,3,-7,3,-3,-13,-6,-4,-2,-2,-4,-1,-10,2,2,-1,6,-2,-1,3,-4,1,-1,-3,1,4,-7,-4,-1,5,-2,-5,7,0,-5,2,1,5},
+                                              {-9,-5,0,-1,-5,-4,3,-1,2,2,-2,-3,3,7,1,-4,-1,0,3,0,-2,-1,3,0,-10,4,3,2,3,4,-1,5,-1,-7,17,-18,-1,3,2,8,1,-4,-1,-7,-1,4,1,2,-4,3,-1,-3,-15,10,3,-5,2,-7,-5,-2,2,2,-1,-1,8,-3,3,2,5,6,2,6,-5,-2,18,-3,-2,0,-82,-1,4,6,1,1,-1,-3,6,0,29,5,-2,3,1,1,4,6,3,3,2,-3,27,2,-4,-1,2,1,2,-2,3,1,-1,2,-6,-7,3,5,1,-1,-1,1,6,-8,7,1,6,9,1,2,-21,3,-3,-1,2,0,-3,1,-1,-70,-76,-1,-3,1,3,-1,-2,1,1,2,-7,-7,-1,1,-12,-1,14,-2,-1,-3,13,4,18,-5,3,9,2,-15,2,-3,3,1,-1,3,-2,1,2,-2,2,-11,-13,1,-1,-3,2,-17,17,16,2,29,-1,0,2,1,2,-5,-1,9,2,-2,1,1,2,-5,-1,-3,-3,-1,-4,-1,1,0,-2,7,2,-1,-6,1,0,2,1,3,-10,1,-2,-20,-9,1,-4,-1,-2,-1,-14,0,2,-2,5,-3,5,6,-2,0,0,1,-9,10,-11,-4,-1,4,-3,-8,7,2,1,-1,2,7},
+                                              {-5,-3,-1,1,22,-3,0,-3,-7,3,-1,-3,2,4,-2,-5,-1,-1,0,1,2,1,2,-1,-8,1,1,1,2,2,1,8,0,-10,13,-13,2,4,3,1,5,-4,-4,-4,0,4,-3,2,-5,-1,1,-1,-10,12,2,2,2,4,-2,1,1,1,-3,1,5,-3,-1,2,4,3,4,3,-2,-4,10,2,1,1,11,-8,1,3,2,2,0,-1,8,-1,-13,7,1,4,-1,1,4,3,-1,3,1,-5,-12,3,-1,-1,-2,0,1,-1,2,-1,-3,1,-3,-4,3,1,1,0,0,2,-1,-5,7,2,-1,8,-1,0,-16,-1,-4,-1,0,-5,1,1,0,12,11,1,-1,-4,3,-3,-5,1,2,1,-4,-5,-1,1,-8,1,13,-1,1,-3,9,5,14,-2,0,6,-5,-19,-1,-2,4,1,-2,0,-2,2,2,1,2,33,-12,0,9,1,1,-2,-67,-86,-3,-6,3,-2,1,3,1,-1,1,9,-2,-1,2,-1,-1,-1,1,-2,-3,1,-2,0,2,-3,-4,-1,-1,1,-6,1,2,1,1,-5,-7,2,-3,31,-5,0,-2,-2,-3,-1,-11,2,1,-1,2,1,4,-2,-4,1,-5,-1,-8,2,-4,-1,-1,6,-4,-5,8,-4,-3,-2,-1,4},
+                                              {-11,-4,-4,2,-41,-4,3,-3,2,1,-1,-1,2,-3,-1,-1,1,1,2,2,-1,0,4,1,-12,4,1,3,-4,2,-2,6,-2,-15,19,35,1,6,-1,1,1,2,-1,-23,2,2,-12,3,-4,3,3,1,-7,8,5,-3,2,-9,-2,1,4,3,-5,-2,8,-2,-3,0,4,2,3,5,-1,-3,-68,-2,1,-10,17,0,3,3,-5,3,1,0,3,-1,36,3,-1,3,0,1,14,6,2,2,3,1,-21,2,2,2,2,1,1,-4,7,-5,-3,-2,-2,-16,5,3,0,1,0,4,-2,-11,4,3,-1,6,-4,1,-14,1,-7,1,1,2,-2,2,1,-62,18,1,-2,1,6,-1,-1,0,2,1,-8,-10,2,-1,-13,-2,16,-1,0,-11,10,2,-57,0,2,11,2,39,3,-4,4,1,-1,0,-1,3,5,-5,3,36,-25,1,7,-4,1,-11,-69,15,-1,-28,-1,-1,3,0,1,-5,0,5,0,-3,2,1,-2,3,2,3,-7,1,-1,2,0,-2,-16,2,-1,-2,-10,2,3,0,-4,-11,-7,6,-4,1,-13,1,-3,0,-2,0,-16,-2,3,-5,2,0,-1,0,-10,3,1,3,-7,-2,-8,-1,-1,0,-12,-4,2,2,-1,1,3,4},
+                                              {-2,-2,-3,0,0,-4,-1,-1,0,2,1,-2,1,5,2,-7,2,-2,-2,1,1,6,2,1,-10,1,2,0,1,2,1,7,1,-10,12,-15,7,2,1,4,1,-2,-6,-11,-1,4,-6,2,-2,-2,-1,-3,-12,5,4,-2,3,-3,-5,1,3,2,0,0,6,1,-1,3,4,4,1,3,-1,-2,13,3,2,-2,12,-1,2,3,1,0,2,1,7,0,-11,2,-2,3,-1,2,4,2,1,1,0,-3,-10,0,-6,0,-3,1,1,-3,4,-1,1,-1,2,-6,1,1,0,-2,-1,-1,-6,-6,7,1,-1,7,0,0,-14,-6,-4,1,1,0,0,0,1,14,-88,1,-2,-2,5,-2,-5,2,1,1,-4,-5,-2,-1,-9,-2,11,0,2,-1,2,2,13,-2,-2,7,1,-11,2,-4,3,2,1,1,-1,1,1,1,4,27,-15,0,4,-1,1,-6,-64,10,2,26,-4,1,0,0,1,-3,2,6,1,0,-6,-1,1,2,3,-1,-2,1,-1,1,2,-1,-4,2,1,1,-4,1,-1,2,-1,-4,-6,-1,-2,-15,-7,0,-2,-2,1,0,-10,-2,3,2,3,-3,4,-1,-6,1,-1,-4,-5,4,-6,-2,-3,6,-1,-6,8,2,0,-2,-2,4},
+                                              {-5,-3,2,2,24,-4,1,0,1,4,-1,-1,0,2,-1,-3,2,-2,1,1,-1,-1,-1,-2,-13,-1,2,1,1,2,0,6,-1,-9,-78,-13,2,2,2,2,1,-1,-2,-7,-1,4,7,2,1,1,-1,1,-14,13,4,-2,4,-5,-5,1,2,4,0,-1,6,-1,3,1,5,1,-1,4,1,-2,17,1,1,-1,16,2,4,5,-3,-1,2,-1,7,-1,28,3,-1,2,1,1,4,5,0,3,3,-4,-14,-4,1,1,0,2,0,-2,3,3,-6,1,-4,-7,7,-7,1,-6,0,3,1,-4,5,1,6,5,-4,2,-20,3,-6,0,1,1,-1,1,-1,-77,18,1,-2,-2,9,-2,-3,1,-3,2,-8,-9,1,4,-13,-2,16,2,2,0,8,2,16,-1,0,15,2,-20,3,-6,1,-2,2,2,-4,1,2,-1,3,-19,32,0,5,0,1,-14,19,-77,1,-12,-2,0,2,1,3,-4,-1,7,2,-3,3,-1,-1,2,2,2,-9,1,0,2,1,2,-4,2,2,1,-6,-1,2,3,-6,-6,-10,2,-1,32,-9,1,-9,2,-2,-5,-15,-1,6,1,-2,-1,4,7,-9,-1,1,-7,-7,4,-10,-2,0,5,-6,-4,8,-1,-2,-4,1,3},
+                                              {-4,-4,7,1,-2,-3,0,-2,-1,-4,0,-3,0,-3,1,-6,1,-1,-8,2,2,1,4,-2,-7,2,3,2,8,3,-1,7,-2,-8,-85,28,4,-1,2,-1,1,5,-4,-12,0,3,12,3,-3,-2,0,-2,-10,7,3,-2,1,-2,-5,1,2,2,1,-1,8,-4,0,2,4,1,1,5,-2,-1,-76,-1,2,-3,11,-1,4,0,-2,-2,-1,1,8,0,-12,3,-1,3,-5,0,5,4,-1,2,1,-5,-10,2,2,7,-1,2,-1,-3,2,-1,-3,-2,2,-5,6,0,1,1,1,0,7,-5,8,3,4,6,-5,-1,-17,-1,-3,-1,2,2,-1,1,0,15,12,1,-3,-5,4,-2,-3,1,1,2,-6,-8,2,0,-12,-1,11,1,-4,-7,15,3,14,-3,-4,8,1,-13,-2,-2,3,0,1,1,-1,1,2,-1,1,-16,28,1,6,1,2,-7,12,11,-2,-14,3,0,0,2,2,-4,1,5,1,-1,-1,0,2,1,2,0,0,2,-1,0,1,0,-1,2,-1,1,-4,1,-5,1,1,-1,-6,1,0,-21,-6,-2,-1,0,-1,-2,-10,-5,2,0,2,-1,-2,5,-3,0,-3,3,-7,0,-7,-1,-2,7,-2,-4,8,-1,-3,-1,-2,3},
+                                              {-10,-5,1,-2,-41,-5,1,0,2,3,1,-1,2,9,-3,-2,2,-4,-1,1,2,-1,2,1,-7,-1,1,1,-2,2,-1,10,-1,-13,-75,-17,3,2,3,-1,1,-1,-1,-9,-2,-1,6,2,-4,1,-2,-3,-2,8,4,-1,5,2,-5,2,5,2,-1,-1,5,-1,0,1,4,2,4,2,-3,-3,18,0,2,-2,15,4,3,2,-4,0,1,-2,0,1,-24,8,1,3,2,1,13,5,2,2,1,-5,-14,2,-1,-2,-4,3,3,-3,4,3,0,45,1,-9,3,1,-2,3,1,-2,-2,-5,2,1,6,5,0,1,-15,0,-4,-2,3,2,1,1,0,16,-69,2,-6,1,5,-1,-6,-1,3,1,-5,-9,2,2,-11,0,13,2,3,-5,10,7,-75,-1,-2,6,-1,30,6,-5,3,-2,0,-4,-1,1,3,1,-1,-21,31,2,3,1,1,-10,18,14,1,29,-2,-1,1,2,1,-2,2,5,1,-1,-2,0,-2,2,1,2,-7,-1,2,-1,2,-1,-3,7,2,-1,-6,2,-1,2,0,-2,-4,1,-1,6,-10,2,-2,-2,-2,-1,-12,-3,0,-1,1,-2,4,7,-6,6,-1,3,-6,5,-7,-2,-2,3,-3,-6,6,2,1,1,-4,6},
+                                              {-4,-6,0,3,-3,-1,24,0,1,1,1,-12,3,3,2,4,2,1,4,1,1,1,3,-17,-3,3,14,3,-2,-1,14,6,3,2,3,-3,2,1,1,0,-1,-2,-2,6,-3,4,4,1,-3,4,2,-3,-4,-3,1,2,-1,9,-5,3,-2,1,2,1,-2,0,0,-5,6,4,2,0,-1,-2,-1,2,1,-1,-2,-1,2,7,5,-1,-79,-1,3,2,-4,4,1,2,1,2,-5,9,-3,1,1,-1,-4,-2,-4,2,-1,2,3,-4,2,3,-1,3,1,1,3,-4,-1,-1,0,-2,1,0,1,3,6,4,-2,-1,-2,-2,6,12,2,-4,3,2,3,2,2,-15,-3,-1,5,13,-3,-1,3,1,-6,-5,-2,34,-3,2,1,2,1,3,0,-2,-2,-1,-2,4,-1,-3,-3,-5,11,2,-1,-2,-3,17,3,2,1,-3,0,0,2,-3,1,2,3,1,-12,-4,-2,1,3,-2,2,13,2,6,-3,0,-2,4,-10,-2,-12,-3,-5,0,1,4,1,-2,3,-2,1,0,-4,2,1,1,-2,2,3,3,-1,-6,3,-11,-1,0,-3,-4,2,-2,3,1,-6,-58,-8,5,-2,1,1,4,11,-9,6,-2,1,-5,-2,-3,-4,-2,4,1,2,6},
+                                              {-4,-4,-7,-1,-2,-1,41,-1,0,-8,4,-22,3,-1,3,0,1,-2,-3,-1,0,-1,2,-21,2,-13,4,3,-10,5,-52,3,3,-1,1,-2,2,4,-2,-2,4,5,-3,-2,-2,7,-2,3,-2,1,5,-8,2,-5,5,-5,2,5,-7,3,-7,1,4,4,-7,-1,-2,-1,5,14,-1,-3,1,-2,0,-1,0,1,-1,2,4,1,10,0,-63,-3,5,4,-1,-2,-2,2,-2,3,-4,13,-3,0,1,0,2,-2,-1,-6,-3,2,3,-3,6,-2,-1,-3,1,1,10,-2,3,-2,2,-3,-7,-2,-3,1,4,5,-2,0,1,-3,13,3,1,-1,3,3,-2,1,2,-20,-2,0,3,4,-3,-1,4,3,-1,-2,-2,-24,4,1,-5,3,7,-5,1,-13,2,-2,-3,-2,-2,-2,-5,-8,1,5,2,-1,2,3,5,1,4,-1,-1,3,0,4,-3,-1,2,2,-18,-2,1,2,-5,0,2,19,2,4,-2,2,-2,3,6,-7,1,-1,-12,2,2,3,-1,-2,-1,-5,-1,2,0,2,-1,2,-4,-2,4,4,-3,-2,5,-70,1,0,-5,-4,4,1,2,0,-1,5,-1,11,-5,1,-1,-1,6,5,3,-2,0,1,-2,-6,-1,-1,1,3,2,4},
+                                              {-4,-5,0,2,1,0,24,0,2,1,4,32,5,6,4,0,1,2,5,-1,-2,-2,2,-16,3,0,16,3,4,-2,15,3,4,4,2,1,-3,2,-1,-1,1,-4,2,2,-3,7,8,2,-1,3,3,0,1,-2,2,-1,1,2,-3,1,-6,1,2,2,-3,-2,2,-4,3,6,2,-3,-3,-2,2,2,-2,2,0,-2,3,6,7,2,-79,-3,3,2,-1,6,-2,1,-1,1,-5,9,-2,3,3,0,2,-2,1,-2,0,1,3,-3,0,-1,-1,-1,4,8,2,2,2,-2,-1,-2,9,-2,-1,1,8,3,0,1,4,2,7,12,2,-3,2,3,1,1,4,-16,-1,-1,3,15,-3,0,2,3,-7,-2,-3,-14,1,2,-5,1,-1,1,-4,-2,2,-3,-2,7,-1,1,-3,-4,5,3,-1,-1,-4,-64,3,-1,3,1,1,2,0,-3,1,6,2,3,-11,-2,-1,3,0,1,3,12,-1,2,0,1,-1,4,-9,-4,-14,-7,-4,-1,-5,1,-2,-2,3,-4,2,1,-5,-2,-1,0,-2,1,4,1,-2,-3,1,-12,-1,2,-3,-4,5,1,4,-1,-4,18,-7,7,2,2,3,1,9,-5,2,-2,1,-4,-3,-2,0,1,3,1,3,8},
+                                              {-3,-5,-1,3,3,-1,-9,-3,-8,-2,1,-7,4,3,1,-3,0,1,1,0,2,2,2,37,-2,-1,-65,3,2,3,11,5,3,5,2,0,0,2,-1,3,5,-4,-2,1,-2,8,4,2,-2,-2,3,-1,1,-1,2,-2,2,9,1,2,-3,1,-1,2,-1,-1,-2,-4,3,4,6,-4,0,-3,-1,3,1,1,-1,-7,-1,2,8,5,10,-2,3,3,-2,7,0,3,-2,-3,-3,5,-4,1,2,-3,1,-2,-4,1,-5,1,2,-1,1,-3,-1,-2,5,1,3,-2,3,-1,1,-1,-3,3,-1,2,3,6,-1,0,1,-1,5,8,1,-8,3,1,1,1,1,-11,-1,-3,4,7,-4,-1,3,2,-4,-3,-3,36,3,3,-2,1,1,1,-4,-3,0,0,1,4,-6,1,-5,-4,1,2,-1,-2,-2,13,1,3,2,1,2,0,5,1,-1,3,1,0,-12,-1,2,2,1,1,0,12,2,2,-4,2,0,2,-2,-1,-7,-4,-4,2,-2,2,0,-5,-1,2,-1,3,-3,1,1,2,2,-1,4,3,-2,-1,4,-5,-2,-1,-4,-3,4,5,2,1,-5,-65,-4,-1,-2,-1,-3,-1,4,-5,4,-2,1,-1,-4,-1,1,-4,-1,-1,1,5},
+                                              {-8,-4,-2,7,4,-4,-19,-3,2,-5,4,-21,4,-2,4,2,1,4,6,1,-1,-2,3,39,3,-3,-58,3,-2,-47,-65,4,2,3,2,3,-4,5,-2,-4,1,-4,3,6,-3,1,-14,5,-4,8,5,4,-2,-5,5,-4,1,7,-9,4,-4,-3,-2,0,-8,-1,-1,-5,2,4,2,-2,1,-6,-2,4,-1,-4,1,1,5,7,3,4,18,1,1,3,2,6,0,1,-4,-4,-5,10,-3,0,2,1,2,-1,2,2,1,3,2,-2,2,-3,-1,-1,6,2,2,1,1,1,0,-2,6,-7,-1,2,3,1,-3,1,5,3,11,22,3,-1,3,4,-2,0,3,-13,-1,1,4,25,-7,-2,3,3,-10,-3,1,-20,-2,1,-4,4,2,1,-3,-11,1,4,2,7,-1,5,1,-7,5,0,-2,-3,-4,15,6,1,3,3,5,2,4,-5,0,4,3,3,-21,0,2,4,-1,-2,3,16,1,4,1,1,-1,5,-9,5,-21,-1,-6,-1,1,4,-2,-3,-17,-2,0,1,-11,-1,3,-2,-2,-7,1,2,-4,-2,3,22,3,0,-6,-3,4,-3,0,-3,-8,19,-17,3,-3,4,5,4,24,-13,0,2,4,-3,-9,-3,1,1,1,5,3,5},
+                                              {0,-2,2,1,1,-1,-10,-1,-2,6,4,34,2,6,3,-3,2,-2,2,0,2,4,2,36,0,0,-62,1,-4,1,11,5,3,4,2,-1,3,1,-2,1,-1,-2,-5,-1,-2,6,7,1,1,-1,1,-4,2,-5,1,2,2,5,-5,3,-2,2,2,3,-3,2,-2,-3,3,5,-1,-4,1,-1,1,3,1,2,1,-3,1,-1,6,2,11,-1,2,3,-1,4,0,2,-2,-1,-4,3,-3,2,1,-1,1,-3,3,0,-4,0,3,-2,3,-1,-1,-1,4,2,-2,-1,1,-2,2,-3,1,-2,1,1,2,5,-2,0,3,-5,3,9,1,-2,3,3,0,2,1,-14,-2,-2,3,8,-3,2,1,2,-4,-1,-3,-6,3,-1,-6,2,2,2,2,-7,1,-1,-2,4,-3,0,-7,-5,2,4,4,-2,-3,-71,2,2,4,0,1,0,2,1,-1,3,1,2,-7,1,-3,3,-1,-1,1,10,2,1,-3,2,-6,1,-7,-2,-5,-1,-4,2,-1,3,0,-3,-2,2,1,3,-2,1,-1,2,1,-2,3,1,-3,-4,2,-6,0,1,2,-2,5,2,4,3,-4,14,-3,-1,-5,1,-1,-2,7,-4,4,-2,0,-3,-2,-3,3,-2,2,-2,0,5},
+                                              {-4,-5,1,3,4,-3,-9,0,-2,-7,3,-13,2,3,2,-2,-1,-1,2,1,-2,1,-2,-24,-2,-3,17,2,-3,-2,15,1,2,5,2,-1,-3,2,-1,-1,-1,-3,-1,0,-2,5,-2,2,3,2,1,2,2,-2,3,4,3,7,-5,3,-3,2,3,1,-3,-1,1,-6,-1,2,-1,-2,3,-2,-1,0,0,1,1,0,3,4,4,0,16,-1,4,1,1,7,-1,1,-2,1,-4,6,-4,2,3,-1,1,-6,-1,0,-2,2,1,-2,1,1,-5,0,3,1,5,-9,1,-5,2,-1,2,2,-1,2,7,2,-2,2,4,2,5,-74,-1,-2,3,3,-1,-1,3,24,-1,-3,5,15,-4,1,-4,3,-6,-3,-2,34,1,1,-2,4,1,1,-3,-11,-1,1,-3,3,-3,2,-4,-5,6,1,2,-2,-3,19,2,1,2,1,1,1,2,-1,0,3,2,1,-13,-2,0,4,1,-3,2,13,1,2,0,2,-1,2,-9,3,-12,1,-6,2,-1,3,-1,1,0,5,1,2,-5,-1,1,1,1,2,4,2,-2,-1,2,-6,-4,2,-3,-7,5,1,3,2,-8,-69,-9,6,-2,0,2,-6,12,-9,1,-2,1,-1,-7,-3,-2,-2,-1,-5,2,4},
+                                              {-2,-6,10,4,2,-2,-15,-2,-2,-3,2,-14,2,1,2,-3,2,-1,-4,1,1,0,5,-10,2,1,13,1,1,6,-85,6,1,4,2,1,-1,-2,1,3,2,3,-2,1,-2,3,3,1,-3,-3,2,-1,1,-5,3,-1,0,6,-6,3,-1,1,3,2,-1,-2,-1,-4,4,2,1,-3,-1,0,1,2,2,1,1,-3,3,-3,0,1,10,-1,5,3,-2,5,-1,3,-6,-3,-4,6,-1,2,2,-3,1,-2,-4,6,-3,3,1,-3,1,-2,-1,-2,6,3,3,-2,2,1,3,-3,6,-1,1,2,7,3,-7,-1,2,0,6,-68,3,-1,2,3,0,3,1,28,0,-3,3,13,1,-1,1,3,-3,-6,0,-16,1,1,-3,2,-2,2,1,-2,1,-2,-5,8,-1,0,-3,-3,2,1,1,-2,-4,5,2,1,1,1,2,1,0,2,1,3,2,3,-13,-1,4,3,1,-1,1,10,2,1,-3,1,-2,2,-5,0,-8,-1,-6,2,0,2,-1,-2,-2,-7,-1,3,-2,0,-3,2,0,-4,3,1,-1,-4,3,19,1,3,-4,-4,5,2,3,2,-5,8,-8,4,-1,1,-2,3,8,-8,2,1,-1,-1,-1,-2,2,-2,0,2,-1,4},
+                                              {-5,-7,1,1,-1,-3,-10,-1,-1,-2,3,30,3,6,3,1,3,-3,1,1,2,0,1,-23,5,-7,17,1,-5,0,14,5,3,3,-1,1,3,0,-1,3,1,-2,1,3,-6,3,-17,4,-4,5,1,-4,2,-4,3,2,4,8,-6,4,-4,1,1,0,-6,0,-1,-5,2,2,2,-2,1,-3,0,1,1,1,1,1,3,3,0,4,16,-1,-2,4,-1,6,2,2,0,-3,-3,5,-2,-1,1,-6,1,-2,-2,-2,-6,3,2,-1,2,1,0,2,5,4,1,-1,0,1,2,-6,2,0,-5,1,9,-2,1,-1,3,-1,7,-69,3,-2,3,4,-1,-1,1,22,-6,-3,3,15,-6,-2,2,3,-5,-3,-1,-14,0,2,-5,3,1,2,-3,1,0,3,1,6,-4,1,-4,-6,5,-1,4,-6,-5,-82,4,3,-1,1,1,3,2,1,0,-1,1,2,-12,-1,-3,3,1,1,2,15,2,3,-1,2,-3,3,-6,3,-13,-3,-6,0,1,0,0,-1,0,-2,1,1,-4,1,-1,2,1,2,3,2,-1,-3,2,-8,2,0,-5,-4,2,2,1,0,-5,21,-7,5,-3,3,3,3,10,-7,2,-1,0,-2,-3,-1,0,1,3,1,-6,6},
+                                              {7,-10,-1,-13,-3,-3,3,3,2,-3,-3,2,2,0,0,2,2,-1,3,-85,-1,1,3,1,2,4,1,0,7,5,-1,-13,-74,3,1,-5,5,3,0,1,1,2,0,6,0,3,-3,3,-5,3,2,1,-5,-6,2,-3,-2,-1,-5,1,3,2,-1,-78,-10,-12,2,2,-12,6,2,-3,-6,-4,2,1,15,-2,-2,-2,3,6,1,-1,-1,-14,3,0,-2,-13,2,3,1,-3,-8,8,0,-1,1,1,-6,-1,-5,0,0,1,16,-3,-8,5,2,-1,-3,5,-8,0,-2,-2,-1,-1,-1,-2,1,18,5,3,3,-2,-4,1,-4,2,0,-2,1,-1,2,-2,-1,1,0,2,-11,-3,10,0,4,-1,-8,5,29,-1,10,3,-1,1,2,-1,4,19,-2,-18,1,12,-1,-4,2,-8,7,-1,-1,-2,18,1,1,3,1,-5,-3,15,-10,-3,0,4,1,1,2,-3,-1,1,2,-15,-1,-6,1,8,-1,-1,-1,0,1,-4,-1,31,-6,-1,30,2,2,-1,1,0,2,-1,-5,19,-1,3,3,-5,2,0,-3,-6,3,2,-2,1,-3,-1,3,-4,-11,-2,7,1,4,6,4,2,0,5,-2,6,4,-14,1,-9,-3,9,5,-1,4,0,4,-19},
+                                              {3,-12,4,-11,-2,-5,-5,3,1,-5,1,-6,2,-3,1,4,1,-1,-1,-83,-1,0,1,-4,4,1,0,1,9,5,-1,-10,12,3,0,-1,3,2,-2,6,0,2,2,-1,-1,4,4,2,-3,1,2,0,0,-4,4,3,-1,-2,-5,1,-2,-1,3,15,-9,-12,3,6,-5,2,-1,-4,-2,-4,2,0,14,0,-1,-1,4,2,10,1,1,-13,3,1,1,-13,-2,3,-2,1,-3,7,1,-1,1,3,1,-1,-2,-4,-2,1,10,-2,-7,0,2,-1,4,4,-6,2,1,-2,2,-2,-1,-3,-1,11,2,4,5,-1,-1,3,-2,3,2,-1,1,-1,2,-1,2,-7,0,-26,-7,1,3,-2,5,2,-7,6,-11,-6,12,2,-1,1,5,4,3,14,-1,-18,-1,12,-1,0,13,-9,4,1,2,1,21,1,3,2,2,-2,-1,12,-8,0,-1,8,0,2,1,3,-2,2,-3,-12,0,-1,-2,6,-1,1,-1,0,0,5,1,-13,-6,0,26,2,-1,-1,-1,-4,3,2,-5,-76,-4,3,0,-1,5,1,-4,-1,3,-3,-2,1,-6,-1,6,2,-11,-1,9,1,-2,5,2,-1,-1,0,-4,3,0,-10,1,-4,-3,9,-2,2,1,2,1,-14},
+                                              {12,-5,-4,-13,-3,-2,3,3,1,-7,1,1,4,7,2,2,1,1,3,-55,-3,2,2,1,14,5,2,1,13,4,1,-7,13,3,2,0,0,5,1,-5,3,2,5,3,-2,4,-10,2,-2,0,2,5,-1,-3,5,-3,1,-8,-1,1,-1,2,-1,9,-3,57,4,2,-7,8,2,1,-9,-2,3,-3,-52,3,1,-3,3,8,1,1,-1,-22,3,1,3,-10,1,3,1,4,-7,11,2,3,5,3,2,0,0,-1,0,2,11,1,-18,0,4,-3,-4,13,0,4,1,-1,1,-1,0,-3,2,-57,9,-4,4,-1,2,2,-3,4,1,1,1,2,0,0,2,1,1,11,-3,2,2,2,4,2,-2,10,-16,2,12,2,2,-1,3,-3,2,9,2,78,0,14,0,1,3,-5,-1,1,-2,2,4,1,3,1,3,-1,-2,11,-38,-3,1,14,1,3,8,2,0,3,0,-11,1,-1,-1,4,3,-1,0,1,1,-6,3,-16,-1,-1,60,0,1,1,2,-5,3,-1,-3,13,-1,2,-5,-5,5,-2,-2,0,2,1,-1,4,-2,1,6,-3,-2,-2,18,1,7,8,14,1,-1,2,2,9,2,-14,2,-6,-1,13,-2,2,5,1,2,-6},
+                                              {4,-4,-3,-8,1,-2,-1,0,-9,2,0,-3,3,-1,-2,-2,1,0,1,10,-1,2,2,0,1,5,1,1,7,3,3,-11,-79,4,2,0,2,3,1,-8,5,1,-1,1,-1,9,-4,4,-4,1,1,2,-3,-3,2,-2,2,4,0,0,-1,0,-1,13,-5,-8,0,2,-4,3,3,-5,-6,-5,1,4,12,0,-1,-9,1,5,3,4,1,27,2,0,-1,-22,2,4,-2,-2,-4,6,-2,2,1,-2,-1,-1,-1,-2,-3,-1,9,-1,-6,-1,1,-2,5,5,-10,1,1,-1,0,1,-2,-1,4,12,-2,-4,5,0,0,-1,-3,2,2,-7,2,1,1,-1,-1,1,-1,1,-8,-1,5,-1,2,1,-5,4,25,0,12,3,3,-1,1,8,0,10,1,-14,3,8,-5,1,-1,-7,0,-2,-3,-4,17,2,2,2,3,0,-1,-79,-1,-1,1,4,-1,1,1,0,4,1,0,-12,-1,-3,-1,5,-1,1,-1,-1,2,4,0,-10,-5,-1,-11,0,1,-3,-1,7,0,2,-5,13,1,1,3,-11,5,-1,-2,1,3,2,-1,-1,-3,0,5,2,-9,-1,6,1,4,-1,3,0,-6,0,-4,3,3,-12,1,0,-5,10,-3,-4,-2,0,-1,-14},
+                                              {8,-8,-1,-5,1,-4,3,0,1,2,1,0,3,-3,-1,2,2,1,2,17,-3,0,3,1,6,4,-1,0,14,5,-5,-17,15,3,1,0,-3,6,-2,-8,3,4,3,9,0,2,-10,4,-8,4,4,3,-4,-5,5,-2,-1,-2,-6,0,-4,2,-7,-69,-12,-25,-3,-1,-14,4,1,-5,-6,-4,1,1,-65,-2,0,-1,5,4,-5,3,2,34,3,-1,6,-13,2,3,-1,-1,-9,7,1,-1,3,3,1,3,1,1,2,2,17,-5,-18,-3,4,-2,4,6,-12,3,-1,2,1,-1,-1,-10,-2,16,-1,-5,1,-2,-1,1,-6,2,-1,1,1,2,-1,-3,-1,2,1,-20,-14,-3,5,-2,4,1,-9,8,-31,-2,9,0,-1,1,4,3,1,19,-1,41,1,15,2,6,18,-8,2,-3,-4,-2,22,1,4,-1,1,1,2,-71,-16,-4,-1,7,1,2,3,2,2,3,1,-6,-1,-7,-2,5,2,-2,1,1,3,1,3,36,-9,-2,-19,3,1,-1,-13,3,-1,-1,-10,-74,3,1,2,-12,-2,2,-4,1,4,3,1,4,-3,0,5,-2,-9,-7,3,3,1,1,13,3,2,5,2,-2,0,-30,2,-4,-11,13,-1,2,4,3,2,-15},
+                                              {6,-7,-1,-8,-2,-3,1,2,0,1,2,1,2,3,1,-5,2,-1,1,11,-2,6,3,2,5,1,1,-1,2,2,1,-8,12,0,2,-2,7,1,-3,-10,-1,0,-5,1,-1,4,-2,3,-2,0,1,-2,-1,-6,2,-5,0,-3,-3,1,-3,1,1,11,-5,32,-1,3,-7,5,0,-6,-6,-3,2,5,13,1,1,-3,2,3,6,1,1,35,2,2,2,-15,-1,4,-2,-2,-4,3,1,1,1,3,-1,-2,-4,-1,-4,0,12,-3,-4,1,3,-2,0,6,-9,0,-1,-3,0,-4,-3,-7,5,-88,-1,1,3,-1,0,-6,-4,2,0,0,-1,2,1,-2,-1,1,-2,-2,-4,1,3,1,2,1,-7,6,-3,-1,9,2,-2,0,2,3,6,13,0,-15,-2,8,-2,-1,-1,-8,-3,-2,3,-1,15,1,1,2,3,-2,0,-67,-15,-2,1,9,1,1,4,2,-3,2,-1,-8,-1,-2,-1,4,0,1,-6,-1,-3,-1,-1,-9,-4,1,-9,-1,1,-1,-2,3,2,1,-4,11,-2,2,-1,-9,4,-2,-3,-2,2,2,-2,1,1,0,5,-2,-8,1,5,0,4,-2,1,3,-2,-2,-2,2,2,-10,1,-1,-2,9,1,2,3,-3,1,-15},
+                                              {7,-5,1,-5,2,-3,2,3,-1,7,2,2,2,-2,-1,-2,2,-1,3,14,-4,0,-1,-2,2,-2,1,-1,11,3,0,-15,-78,4,3,1,-2,3,-1,-13,2,0,1,5,0,4,-3,3,-1,3,1,4,-3,-4,5,-2,2,-5,-2,1,-1,2,2,15,-9,-14,3,1,-11,1,-1,-6,-6,-3,3,-1,-81,-2,1,0,4,4,2,-1,2,-20,4,1,5,-10,0,2,-1,-1,-8,6,-2,1,3,-1,-1,-5,3,-1,0,1,-80,-1,-13,4,-2,-4,-6,4,-9,-8,0,-5,1,0,3,-3,-2,16,5,-6,2,0,0,2,-4,2,-1,1,2,0,0,-1,1,1,0,1,-7,0,1,0,-1,2,-8,6,28,3,9,1,2,1,2,5,4,15,0,35,3,15,0,3,5,-9,-1,-3,-2,2,15,2,2,1,2,-1,2,16,-12,1,-1,9,2,2,3,3,3,3,-1,-1,0,-4,-2,6,3,-1,1,-2,-3,5,3,-15,-9,1,-11,2,1,3,-1,-7,2,0,-6,16,-1,3,-2,-6,5,-1,-2,2,3,3,-3,3,-3,-4,6,-3,-9,1,0,2,5,7,13,1,1,-4,-3,3,1,32,2,-1,-6,10,-1,0,3,-5,2,-9},
+                                              {7,-7,9,-7,1,-2,1,1,-3,1,2,-1,2,-2,-1,-2,1,-3,-7,11,-1,1,4,0,7,6,1,-1,6,3,-2,-11,10,5,1,0,1,-1,0,-30,2,6,-2,2,1,3,3,3,-4,-1,1,1,-3,-5,3,-6,-2,-3,-4,1,-4,2,1,16,-5,-13,2,1,-14,1,0,-3,-4,-2,2,-1,14,-2,1,-2,4,1,0,0,-1,-17,2,1,2,-8,0,3,-6,0,-3,6,-2,2,3,2,-2,-1,-2,4,-2,1,-80,-3,-9,0,1,-2,6,7,-6,1,1,2,1,-2,5,-3,2,11,4,-4,1,-2,-2,-1,-1,1,2,-1,-1,1,1,1,1,1,-1,-27,-8,-2,5,-2,1,1,-7,4,-12,0,10,1,0,1,-3,3,8,12,-1,-15,-2,14,1,-1,13,-7,1,-3,-1,-2,18,1,1,1,0,-2,1,13,-6,1,0,4,1,4,2,1,2,2,-2,-11,0,-3,-2,3,1,-1,-1,-2,2,2,0,-15,-6,0,-9,1,0,1,0,-4,1,2,-5,-77,-5,3,-4,-4,6,-3,-1,-2,2,-2,2,4,-2,1,6,-3,-8,0,5,2,-2,3,3,2,-3,5,-3,-1,1,27,-1,-1,-3,10,5,0,-1,1,-1,-16},
+                                              {5,-10,-1,-11,-1,-3,1,3,1,-1,1,2,2,3,2,3,3,-4,-1,15,0,1,1,1,9,1,1,-2,10,2,0,-12,18,3,0,-1,4,0,-1,-28,3,4,2,2,-4,4,-7,5,-5,3,0,-1,-3,-5,2,-3,3,-2,-4,2,-3,3,-1,-73,-9,32,-1,2,-13,2,2,-3,-5,-4,2,-1,14,-1,0,2,5,7,-1,1,1,-21,1,-1,2,-8,1,4,1,2,-6,6,1,1,-1,-4,-2,-1,-2,-4,-5,3,-73,-4,-7,3,3,1,5,8,-8,1,-2,0,1,-4,-2,-2,-2,-80,8,-2,6,-2,-3,0,-3,1,3,1,0,1,0,-2,0,2,-5,-2,-5,1,6,-1,3,2,-7,5,-10,1,12,2,3,1,1,2,2,24,-2,-15,2,12,-1,2,4,-11,0,-5,-1,-8,17,1,4,2,-1,1,2,18,-7,-2,-1,4,0,2,2,2,-2,1,1,-13,-2,-2,0,2,0,0,-3,0,-1,6,-1,32,-10,-1,-10,-1,1,0,0,2,1,-1,-7,16,-1,2,-1,0,2,-1,-2,-1,3,3,2,2,-3,0,4,-2,-10,-2,8,0,3,8,3,2,0,4,-2,4,2,33,1,-5,-5,14,-5,4,5,1,-5,-17},
+                                              {-2,4,-2,1,-3,-1,0,-2,39,2,-1,-2,2,4,-1,3,3,-3,1,2,2,-1,4,-1,-8,4,1,3,4,1,2,4,2,3,2,-4,-2,4,3,1,2,1,1,-3,-2,3,6,2,-1,6,19,-1,-4,12,2,-6,-3,5,15,0,-2,2,-1,2,8,-2,0,-1,2,3,-5,-2,-2,-2,3,4,2,-1,1,-10,-16,4,2,-75,-1,2,2,1,-3,6,4,2,1,-2,-3,-1,2,2,2,-2,-2,1,-2,3,-1,2,5,-4,2,3,-2,4,-3,-7,4,-3,1,-3,-1,2,-3,9,9,4,-7,3,-1,2,1,2,-3,1,4,-16,3,-1,2,2,3,-3,2,-2,3,-6,-2,1,-2,0,1,-4,2,2,-4,19,-1,2,3,-1,-5,8,1,-3,-4,-5,35,-4,-5,-3,-2,3,-4,-5,0,3,-1,-3,1,-5,-4,1,3,-2,2,-1,0,-1,-3,-2,-3,1,5,-1,2,2,3,4,6,2,3,18,-3,-2,3,-3,-4,1,1,2,3,2,1,2,-2,1,3,3,3,2,17,9,2,4,-1,-5,0,1,0,0,-2,2,4,-5,-3,2,1,0,4,-6,-2,2,-57,-1,-2,5,5,-2,2,-4,-2,-6,-3,-21,0,-3,-1,6},
+                                              {0,1,-1,-1,-2,-2,-6,-2,36,-3,2,-8,3,-2,-1,2,2,-3,-3,1,4,-1,1,-4,-3,1,-1,3,5,5,2,7,1,3,2,-2,1,3,1,1,3,-2,1,-2,-3,5,-1,2,-2,3,14,-2,3,4,3,-4,2,5,9,1,-1,-2,3,3,4,-1,-1,4,3,2,-74,-3,2,-3,2,4,1,2,1,-8,-10,1,5,10,2,-1,0,3,-1,4,2,3,-2,-2,-2,1,0,1,-1,-1,0,-1,-5,-1,-3,2,2,-2,2,-1,-2,1,1,-7,3,0,3,-2,1,-1,2,5,6,2,-5,3,2,2,1,2,0,2,5,-12,3,-1,1,1,1,-9,1,-4,1,1,-2,1,-3,2,-1,-1,2,-5,2,15,-4,3,5,-1,-3,6,2,-5,-4,-2,-9,-3,-9,-3,-6,2,-3,-3,-2,2,4,0,2,-2,-2,1,7,3,3,6,1,1,5,0,-1,2,-1,0,2,6,2,5,-5,3,2,13,-1,2,-1,1,-4,3,-2,2,1,-4,-1,7,-1,3,2,2,-2,3,13,8,4,1,-1,-1,1,-1,-2,-2,-4,0,5,1,-3,2,4,-3,0,-3,-2,1,-65,-4,6,5,1,-1,1,-1,-2,-5,1,-9,-4,1,-3,5},
+                                              {-4,7,-1,0,0,-1,-1,-2,36,5,2,-2,4,2,2,-2,1,-3,1,1,0,-3,3,1,-2,5,3,3,8,1,3,1,-1,3,3,-1,-5,3,2,5,3,0,3,-1,-3,6,-4,4,-1,5,-69,-3,2,6,2,-3,2,3,15,-2,-9,0,-1,3,5,-2,1,1,2,3,-8,-3,-5,-3,3,2,0,3,1,-16,-15,4,2,18,-1,-2,2,3,4,3,2,2,0,1,-3,-1,3,4,2,-1,1,0,-3,-2,-2,0,2,-1,0,-1,0,2,-2,-5,1,3,3,-2,0,1,4,5,9,1,-5,2,2,4,3,2,-1,2,4,30,1,0,1,1,3,-3,2,-3,2,-2,2,1,-3,2,1,-2,-2,1,-2,18,-3,-1,0,-11,-6,6,3,-6,-1,-2,-16,-1,-4,0,-8,3,1,-4,-1,1,1,-4,3,1,-2,-2,-2,-1,2,5,0,3,-1,-2,1,3,2,1,2,3,-1,1,10,1,2,17,-6,-2,3,-8,-3,1,-5,-1,1,5,2,8,-3,1,2,3,2,1,14,9,4,-1,-2,2,0,3,-5,2,-2,1,5,-3,-3,1,4,-1,5,-5,2,-1,-70,-2,-2,8,1,-4,2,0,-2,-2,1,-17,0,-2,-4,6},
+                                              {-5,15,-9,3,1,2,-3,-3,-22,1,-1,-2,3,-1,1,-4,1,-3,1,1,3,2,2,0,-6,-6,-2,3,3,3,5,7,1,4,4,-1,-5,6,1,5,10,0,1,-2,-3,9,-14,2,2,4,3,-12,-6,3,2,-2,-2,4,13,-3,-11,-1,-3,4,2,-1,-3,-2,-4,2,12,-7,-2,-3,2,4,3,-2,0,-23,-12,3,-7,-62,1,-1,4,4,2,3,3,5,-1,-6,-1,-2,1,2,6,-3,-2,-1,-5,-6,-5,1,3,-1,3,-5,-1,-1,2,-1,-2,-2,3,-3,-1,-2,-2,11,6,2,2,-1,6,3,-3,2,2,3,-1,-24,1,-3,3,2,1,-3,0,-3,1,-5,-10,-2,-1,2,4,1,-1,2,-1,-52,6,2,9,-8,-9,3,2,-3,1,-13,41,-2,-1,-3,-22,2,0,-5,3,2,1,2,3,-1,-1,1,6,3,3,1,-2,-1,-7,-2,5,2,4,-1,-2,3,3,-1,17,3,-2,-2,-1,-3,4,-4,-5,3,-2,3,3,-1,1,-9,-3,3,3,3,-1,-2,5,9,3,2,-1,3,4,0,-7,-3,-2,1,5,-1,-5,3,2,-2,7,-3,-3,-3,-1,-4,-4,2,5,-1,5,3,1,-2,-3,38,-2,-3,-4,3},
+                                              {-5,13,-4,3,2,-4,1,-5,-9,5,2,-2,4,2,0,-2,2,-2,1,3,1,0,5,2,-21,2,0,4,11,0,1,5,-1,3,3,1,-5,4,-2,-2,3,1,3,0,-1,5,-8,4,-5,11,23,3,-3,10,3,2,-2,4,34,-2,-5,0,-4,2,6,-2,-3,-2,1,1,-7,-8,0,-5,2,5,2,-9,2,-19,-33,2,-1,16,1,4,1,1,3,4,3,2,1,5,-5,-3,3,3,3,1,1,2,-2,1,0,-1,3,-3,3,-4,0,2,-1,-23,1,1,1,1,0,2,5,10,11,3,-13,0,1,4,6,-1,-5,2,3,-21,2,-2,0,1,1,-2,4,0,3,-8,1,1,-1,1,2,-4,4,1,-6,-60,-2,1,3,-2,-9,10,2,0,1,-9,-8,3,-2,-2,-10,-2,3,-5,-1,3,-1,-2,2,5,3,-1,3,2,0,2,0,1,-3,0,4,2,4,-1,1,0,2,3,-11,2,6,21,-9,1,7,0,-5,1,-2,2,1,-19,-12,-5,-3,2,4,3,6,2,19,4,-1,4,-2,1,1,0,-1,1,-4,3,5,-4,-4,-4,-3,2,1,-17,-5,4,25,-1,2,2,-1,-1,-1,0,-8,-4,2,38,-2,0,-2,3},
+                                              {2,7,-2,0,-1,-1,-3,-3,-3,0,2,-2,2,4,-1,-5,2,-5,-1,1,3,3,2,2,-6,4,0,1,-1,-1,3,5,1,2,2,-3,1,2,1,-1,3,-2,-3,-3,-4,5,-1,2,1,0,-64,0,2,4,-1,-5,1,4,7,-1,-4,1,-1,4,7,0,-3,0,6,3,-5,-6,-1,-1,3,46,3,2,2,-8,-8,-2,5,14,1,1,0,2,2,-1,2,3,-3,0,-2,-3,1,2,1,-2,-1,-2,-1,0,-5,0,2,-1,3,-1,0,1,-5,-6,0,-2,2,-3,0,-3,-2,6,8,1,-7,2,4,2,3,-3,-3,2,0,34,2,2,1,1,0,-4,-1,-4,2,-3,-4,3,-3,1,2,-3,-1,0,1,-81,-2,2,3,-5,-5,5,2,-4,-2,-1,-7,-3,-7,-5,-9,4,3,-5,-3,2,0,-2,4,0,-1,-1,2,4,2,6,0,1,0,0,-7,3,2,2,-1,-1,3,1,8,2,-3,10,-7,0,2,-1,-3,2,-2,3,3,7,0,5,-2,3,4,2,1,1,12,4,4,0,-1,-1,1,1,-1,1,2,2,5,-4,-2,4,1,-1,4,-9,-4,1,12,-5,-2,5,3,-2,3,-1,-1,-4,-1,32,-2,-3,-4,4},
+                                              {-2,6,-1,4,2,-1,-1,-2,-12,6,2,-2,2,3,1,-2,3,-4,2,3,0,-2,1,-1,-10,1,1,3,5,1,3,2,-1,4,4,-2,-6,2,2,-1,3,2,2,-2,-2,6,1,2,2,7,19,2,-1,11,3,-3,1,3,16,-2,3,3,1,2,7,-2,1,-1,3,-1,-5,-4,2,-3,2,3,3,-1,3,33,-15,1,-1,-75,2,2,3,1,1,4,3,1,0,1,-4,-3,0,2,3,-3,-1,-4,-4,-1,-2,1,2,-1,1,3,-3,1,-10,-7,4,-9,2,-5,2,2,1,8,10,2,-8,-4,-2,5,2,4,-3,2,5,-13,1,1,-2,1,2,-3,2,-4,5,-3,-1,1,-6,2,3,-3,1,3,-2,19,-2,3,4,-2,-7,7,2,-2,1,-5,35,0,-5,-3,-10,1,-6,-4,-1,3,1,-2,3,2,1,0,2,3,2,5,1,1,-2,-2,2,3,3,-2,3,1,1,2,5,3,5,-57,-4,3,4,2,-7,1,-2,2,2,7,-1,-10,-2,3,6,2,3,3,18,9,5,2,-1,3,0,0,-9,3,-3,-4,6,-4,-2,3,-2,1,3,-10,-3,1,18,-8,-4,3,1,-1,4,-1,-5,-3,-1,-20,-3,-5,-2,6},
+                                              {2,6,10,3,1,1,-2,-3,-13,3,1,-3,1,6,-1,-3,2,-5,-6,2,3,-1,4,-1,-4,6,1,2,8,2,0,5,-2,3,2,-3,-5,1,3,3,2,4,0,-1,-3,3,4,3,-3,3,11,-1,0,6,3,-4,-1,6,22,-1,-5,1,1,3,6,-2,-1,2,4,-2,20,-1,-2,0,2,2,3,1,2,30,-22,-1,2,8,-3,1,3,1,1,3,1,3,-5,-6,-2,-2,1,1,2,-3,-1,2,2,6,-4,2,1,-3,1,-2,0,2,4,-5,4,0,2,1,1,-1,4,6,10,3,-3,0,-2,1,2,1,-1,-1,2,-12,0,0,1,2,2,-2,0,-3,1,-4,1,1,-1,2,1,-2,2,1,1,15,-3,2,-1,-4,-3,1,2,-3,-5,-3,-12,-2,-4,-1,-9,1,2,-5,1,0,-1,-3,1,0,-1,1,3,5,2,4,2,2,-3,-2,4,2,2,-1,3,0,2,1,-5,1,1,-65,-3,4,3,-2,-2,3,0,1,1,-20,-1,-6,-2,3,3,1,-2,1,16,1,3,-1,1,-1,2,-1,-1,2,-3,2,5,1,-2,3,0,0,-1,-8,1,1,11,-1,-6,0,2,0,1,1,1,-3,4,-13,-3,0,-4,3},
+                                              {-5,3,-2,0,-1,-2,-2,-2,-11,3,1,-2,2,4,-3,1,3,-6,-2,3,4,-2,2,1,-3,-2,2,2,3,1,2,5,2,1,1,-2,-2,0,2,-4,4,-1,2,-2,-7,3,-5,2,-2,7,-73,-5,1,5,1,2,3,5,14,1,-8,2,-1,2,3,-1,-1,0,0,-1,-8,-2,-1,-3,2,3,3,2,2,30,-15,2,0,19,1,0,-5,3,-1,6,4,2,1,-3,-2,-3,2,2,0,-7,-2,0,3,-2,-7,3,3,-1,3,1,-1,4,0,-8,-1,-1,0,0,1,-4,1,7,6,2,-6,-1,2,4,1,1,-1,0,7,31,2,1,1,1,1,-3,-4,-5,2,-4,-4,-1,-2,-1,3,-5,3,0,0,17,-2,2,4,6,-9,9,0,-3,-1,-4,-14,-2,-5,-3,-8,-2,0,-7,-2,2,2,-1,-1,0,-1,2,2,3,2,1,0,2,0,-1,-1,1,3,2,2,1,3,0,7,3,0,-69,-3,0,2,-1,-4,1,-1,0,3,9,1,9,-3,1,4,3,1,3,14,9,3,1,-1,-1,1,1,1,0,-2,1,2,-4,-3,1,3,0,4,-6,-3,3,17,0,0,6,3,-2,2,1,-2,-3,-1,-16,0,0,-7,5},
+                                              {-1,6,0,3,-2,25,2,-17,2,-2,-2,1,1,5,2,2,1,0,2,1,14,8,1,2,1,0,-1,0,-10,13,-4,-15,1,-15,-1,-5,2,6,28,3,-3,-7,-2,-10,1,-5,7,-1,-6,-2,3,2,2,-5,-2,1,17,-3,-2,-2,4,-2,-22,-1,-2,-3,-9,1,-4,6,2,5,-5,-1,-1,1,-1,-77,-1,1,0,-22,2,-3,-1,2,3,-4,-4,-49,1,16,-1,7,12,-2,-2,-1,-1,3,-3,0,1,7,4,13,3,-2,3,23,1,2,-4,3,6,-3,-3,-3,-76,0,-3,12,11,1,-9,8,-8,0,1,1,6,1,1,-3,-1,-1,-66,-3,1,-2,1,4,6,-3,5,-2,-2,-1,2,6,-2,-1,8,0,0,0,1,-3,0,-1,-2,-1,2,-9,0,-7,1,-5,-1,23,-10,-2,4,1,0,31,-2,-7,-4,-2,4,-66,-3,-15,-1,-1,6,-4,0,1,2,6,-2,5,-2,8,1,-1,-1,1,4,6,0,-1,-3,18,2,-1,11,-2,-3,-3,26,-57,3,-1,3,-5,-3,9,-4,3,-15,-7,3,2,-2,0,3,-1,-10,1,-2,-18,-3,1,-14,-18,4,-1,1,4,11,-10,3,-3,1,-8,22,-5,5,-1,2,1,2,-10},
+                                              {0,1,-4,-4,-3,20,-4,-9,1,-2,0,-7,1,-3,1,4,-1,1,-5,-1,14,7,-3,-5,6,-1,-2,0,-10,-50,-3,-10,-1,-8,-2,-1,2,6,-16,2,7,15,-1,-4,-2,-2,-5,3,-4,-3,0,6,5,-2,-1,-3,7,-7,0,0,2,-2,46,-1,-4,-5,-9,-46,-1,5,3,4,-2,-4,-3,-2,-1,20,-2,1,2,-26,0,-1,1,0,3,-2,-2,-22,-2,8,-5,0,7,-2,-1,-2,1,0,-2,-1,-1,4,-2,13,-1,-2,3,-10,-1,-1,1,5,4,-1,-1,-3,12,-2,6,11,5,-1,-11,8,-4,1,3,1,9,2,1,-4,0,-1,-79,-4,-1,-10,2,2,4,2,2,-3,-1,2,1,4,-2,-8,6,-2,-1,1,-1,6,-4,-1,-2,-2,-1,-6,1,-3,-2,-7,-5,17,2,-1,0,-1,2,-14,-3,-1,-3,0,0,-77,-2,-6,-1,-1,-1,-2,2,-1,-4,3,-1,7,-2,6,-3,1,-3,0,6,9,-2,2,-6,14,-2,-1,-83,-6,0,7,27,15,3,-1,-1,-14,-6,9,-6,0,-14,-3,2,1,0,-2,-1,-2,-7,17,-2,-16,3,-2,-10,-14,4,-1,-2,-2,-4,-4,3,-4,-2,-1,28,-5,-2,4,-2,3,0,-8},
+                                              {-3,6,1,0,-3,25,1,23,-1,3,-1,-1,1,5,3,0,-1,1,1,0,-58,5,0,0,9,1,0,0,0,12,-2,-14,-1,-1,0,0,-3,5,-16,3,0,-8,-2,-4,-2,-1,14,2,-2,-2,1,3,4,-2,0,2,3,-8,3,-3,1,-3,-17,-1,-3,-3,26,1,-22,5,0,4,-7,-3,-2,-2,-3,21,-1,-2,-1,-22,4,-1,-1,-4,5,-2,3,-8,-2,12,-2,8,4,-1,-1,0,4,-1,-2,-1,-1,3,1,8,1,-1,2,-3,2,-1,-8,12,4,4,-2,-2,16,-2,-1,9,12,-1,-7,11,11,1,6,-2,7,2,3,-2,-1,0,-78,-2,2,-3,1,2,3,-2,2,-1,-3,0,4,8,-3,-1,3,-1,4,-3,-1,5,1,8,0,-4,0,-8,-1,0,-5,-4,-5,21,-6,1,-2,0,1,-19,0,0,-2,-1,-6,-65,-2,-57,-2,0,5,-2,-3,2,-1,2,-1,5,-3,5,-1,-2,-3,1,5,4,0,-7,-3,-70,-3,-1,8,-4,-4,2,23,12,3,-1,3,-8,-6,8,-9,-2,-18,-2,2,2,-2,2,2,-2,-9,-1,-1,-18,2,-1,-13,-19,12,1,0,4,8,-6,0,-3,1,-2,16,-5,1,2,2,1,-1,-3},
+                                              {-1,9,-2,4,1,23,1,-15,-10,-5,-1,-1,0,3,1,-5,-2,3,-1,1,13,6,-1,3,3,1,-2,-1,-7,-9,-1,-9,-1,-12,0,0,-2,6,26,3,-82,-9,-3,-5,-1,1,9,2,-6,-3,3,1,6,-2,1,1,7,-7,-3,-2,1,-4,-19,1,-2,-4,-10,1,3,3,5,2,0,-3,-3,1,-1,-77,-2,-10,2,-19,2,3,-2,1,3,-3,-2,-21,-1,13,-2,1,7,-2,-1,0,2,-3,-3,-1,-1,7,-2,-80,1,1,2,-13,0,-1,-1,7,7,-2,-1,-2,-84,1,-4,13,10,0,-7,6,20,1,3,-1,7,0,3,-9,-1,-2,10,-4,0,0,2,2,7,-4,1,-2,-2,-1,4,6,-2,0,6,-1,1,-3,1,0,-7,-3,-2,-2,1,-5,-4,-2,2,-4,-7,18,-3,-2,4,-1,-1,-11,0,-1,-2,-2,6,29,-2,-1,-3,-1,-1,-3,5,-1,-1,6,1,5,-2,4,-8,-1,-2,-2,5,5,-1,-1,-1,12,-2,-2,11,-5,2,1,-11,14,4,-1,4,-13,1,-1,-7,-1,-12,-1,2,3,-1,-2,0,0,-8,15,-2,39,1,-2,-8,-12,6,-1,-5,1,5,-7,4,-2,1,-2,22,-4,0,-7,-1,-1,-1,-9},
+                                              {-39,-20,-34,-18,-17,5,-18,-35,-18,-11,-10,-17,-32,-23,-32,-20,-19,-17,-22,-25,-76,-32,-29,-17,-39,-17,-18,-31,-24,-16,-32,-33,-20,-34,-19,-17,-3,-16,-36,-18,-30,-16,-22,-22,-30,-43,-18,-21,-34,-9,-19,-62,-26,-16,-23,-1,9,-20,-17,-17,-17,-25,3,-23,-37,-30,29,-23,-39,-23,-10,-28,-3,-19,-23,-47,-28,-14,-26,-18,-26,-65,-28,-31,-32,-15,-38,-26,-17,-30,-16,8,-20,-14,-3,-23,0,-23,-31,-28,-25,-33,-4,-15,-28,-84,-19,-25,-20,25,-17,-49,-17,-17,-33,-20,-29,-28,6,-15,-8,-6,-9,-26,-31,-23,-17,-19,-23,-18,-14,-14,-43,-20,-31,-15,18,-22,-14,-13,-14,18,-14,-23,-36,-5,-17,-21,-23,-19,-18,-20,-23,-31,-25,-18,-30,-17,-30,-17,-35,-39,-1,-33,-26,-26,17,-20,-18,-29,1,-19,-26,-17,-13,10,-15,-15,-18,-19,-35,-28,-21,-32,-22,-27,-19,-16,-15,-30,-21,-25,-33,-8,-27,-34,-13,-24,-18,-13,-8,-16,-26,-16,-40,-4,-29,-31,-73,1,-33,-11,-38,-76,-9,-22,-7,-47,-19,-22,-9,-13,-35,-30,-22,1,-27,-17,-22,-17,-25,28,-7,7,-1,-19,-41,-50,0,-15,-16,10,-13,-27,-8,-19,-18,-7,14,-16,-31,-21,-10,-17,-17,-19},
+                                              {-1,10,-3,-2,-2,22,1,28,-2,-1,-1,-1,-1,-2,-1,-3,1,-1,-1,-1,15,-84,-1,5,6,2,-1,-2,-12,-7,-1,-9,-2,-5,-1,-2,4,3,-10,5,-12,-3,-4,3,-2,-3,-2,4,-4,1,-3,4,7,-3,-2,2,-8,-8,-1,-2,-2,-3,-19,-1,-1,-2,-11,5,-11,5,2,4,-1,-4,1,4,1,17,0,-2,2,-24,4,-3,0,2,1,-4,2,-4,-1,8,-4,5,8,-4,-2,-1,0,1,-1,-3,-3,4,-3,-85,-1,-2,4,-10,1,-1,-1,7,1,-1,-2,-3,19,-4,2,10,9,-2,-7,4,-39,1,6,-4,5,1,-3,-4,-1,0,5,0,-1,1,0,3,4,-1,2,-2,-2,-2,2,4,-4,-2,1,-2,5,0,-1,-2,-4,-4,-1,-3,-3,-5,-2,-1,-4,-5,-1,24,0,-3,1,-2,-2,-14,-3,-1,-1,-2,1,24,-4,-10,-1,-1,4,1,-8,0,-3,5,-2,3,-2,6,-1,2,-8,-2,2,6,0,0,1,-78,-2,0,12,-1,8,3,-8,16,6,-1,2,-16,-2,3,-7,-3,-16,-3,2,3,-2,-3,2,0,-7,16,1,42,-3,-3,-9,-14,3,1,-1,-3,3,-9,1,-3,-1,-2,26,-7,2,2,2,0,-2,-8},
+                                              {-3,6,3,-1,2,23,2,-14,-1,-2,1,0,-1,6,-2,-2,-1,0,-1,2,-56,6,-3,0,4,-2,-2,-1,-11,-8,-2,-18,-2,-17,1,-1,-3,2,25,3,-2,9,-2,-5,0,-5,-2,1,-2,2,2,55,6,-3,0,-7,-8,-7,1,-1,4,0,-20,2,-5,-1,23,-1,-18,2,1,6,-1,-1,-3,-2,1,-57,1,2,1,-28,1,-3,0,2,5,-3,2,-8,0,-67,-2,8,3,-3,-4,-1,3,0,-1,-5,-5,-21,1,10,2,-1,3,-6,-5,-3,-7,5,5,-10,-2,-5,-71,-1,-1,8,13,1,-11,8,-10,2,5,2,6,-1,2,-2,-2,-1,14,-4,1,1,1,3,10,-3,1,-1,-6,0,5,6,-1,3,8,-2,6,0,-2,-2,-6,-1,-2,3,1,-10,-1,1,6,-8,-4,-68,-12,-2,2,2,0,-18,1,-1,0,0,1,24,-3,-11,0,0,4,-1,1,1,1,4,0,4,-1,4,2,0,1,-1,2,-4,0,3,-8,16,2,0,9,0,-5,-1,-16,12,8,1,3,-6,-1,8,-8,3,25,1,3,1,-5,4,1,-5,-11,-10,1,-12,-5,1,-14,-20,9,-2,2,-8,12,-11,-1,1,2,-1,12,-3,3,1,0,-3,-2,-6},
+                                              {3,4,11,3,-1,22,-1,-14,-4,-7,-1,-3,-1,-2,2,0,-1,0,-6,0,13,7,3,3,7,-2,0,-1,-6,22,-1,-8,-2,-10,0,1,3,3,-11,4,5,-35,-2,2,-1,-5,-6,-1,-7,-3,0,-1,3,-5,0,3,-45,-6,-1,-2,1,-4,44,0,-1,-4,-10,2,-12,1,4,3,-3,-3,-2,-1,0,19,-1,0,2,-13,1,-3,-3,2,1,-4,-1,1,-1,-79,-7,7,8,-3,-2,-2,2,-2,-2,0,-1,-61,-3,11,0,-2,2,-13,-1,-1,0,7,5,-1,-1,1,12,-4,-2,11,9,1,-6,10,-10,0,3,-1,9,-2,2,-1,-3,0,17,-1,0,-3,0,-2,4,-4,1,-2,-4,0,5,5,0,-2,2,-2,6,0,-1,4,1,2,-1,-2,-1,-9,1,1,-6,-3,-5,-73,-2,-4,2,-2,-1,-8,-1,1,-1,0,1,17,-2,1,0,1,4,-2,3,1,1,6,-1,5,-2,3,-3,-3,-2,-1,7,8,1,2,1,16,-1,-2,-81,-4,3,-1,-16,13,6,-1,-3,-14,-3,6,-8,-2,29,-1,3,-1,-2,1,2,-2,-6,23,-1,-14,0,-1,-9,-14,6,2,-4,4,11,-6,1,-1,-3,2,32,-5,3,0,-4,2,-5,-9},
+                                              {-4,6,-1,3,-1,25,1,25,-1,1,-2,1,-1,6,1,1,1,-5,-3,1,15,5,-1,5,9,-2,-2,-1,-16,-10,-2,-15,-1,-13,-2,1,2,1,-15,0,3,12,-1,-2,-4,-6,5,3,-6,-2,1,2,7,-4,1,-1,-75,-4,3,-1,4,-1,-20,-2,-5,-2,-12,2,-41,1,2,4,-4,-4,-1,-3,-1,20,0,2,-1,-21,-3,-1,1,1,3,-4,-1,7,0,-75,-1,8,12,-3,1,-2,1,-3,-1,0,2,-22,-4,12,2,-4,4,27,2,2,2,9,4,-1,-3,1,21,-5,4,10,6,-1,-8,7,14,1,2,1,8,-1,5,1,-2,2,14,-2,1,2,-5,4,4,-2,5,-2,-1,-1,6,6,-1,2,7,-1,1,0,1,-2,-10,1,-2,-1,2,-7,-2,2,3,-9,-3,-73,-3,-7,3,1,2,30,-3,1,0,0,1,23,-3,-18,0,2,1,1,-2,1,2,10,-2,5,-2,2,-3,-1,-4,1,6,15,-1,1,-5,-69,0,-2,10,-2,-2,10,-19,-56,6,-1,1,-6,-4,6,-3,2,26,-1,1,3,2,1,1,-2,-9,-9,-3,-20,-2,0,-14,-18,3,4,1,4,8,-9,2,-2,1,-4,22,-3,0,1,2,2,-5,-8},
+                                              {6,8,-2,2,-3,-2,0,1,5,0,-1,2,1,7,-2,-22,4,1,-2,1,2,1,4,1,1,4,1,1,-5,-1,2,5,1,3,2,-6,10,4,-2,8,-1,0,-13,7,-1,3,-6,1,-2,4,-1,-1,-3,-2,-17,-1,-3,-5,-3,1,-3,2,-2,1,-3,1,-2,1,5,5,3,0,-1,-3,2,3,1,-1,1,1,2,6,4,-2,1,2,3,1,-8,4,4,4,-1,2,-4,-4,-1,2,3,2,-6,-2,3,-1,1,0,4,-5,2,2,1,2,-2,2,-8,-3,-1,-2,1,1,-3,6,-7,1,-11,1,0,-1,-2,24,-4,3,1,-1,2,-69,4,2,1,-1,3,2,-10,-7,-6,-2,-1,-2,1,-4,-2,-2,2,3,1,2,2,-4,5,-3,-1,0,2,0,2,-7,-2,-3,9,3,-7,0,-4,2,16,-1,2,-5,-5,1,3,-2,14,1,1,1,2,-6,-6,2,4,0,16,-2,2,6,-1,3,29,4,4,-4,1,-3,-4,-1,1,18,3,-1,4,-5,-3,1,2,3,-1,1,1,3,2,3,-2,-6,2,0,1,3,17,1,3,-1,4,0,-6,2,5,-7,-4,4,3,3,1,6,-1,-1,-80,-5,1,2,-1,-1,2,-1,-1,5},
+                                              {6,3,2,-3,-4,-1,-6,-1,4,0,1,-4,2,4,2,-6,2,-1,-5,1,2,0,1,-4,5,1,-1,1,-1,-1,1,6,2,3,2,-4,8,3,-3,5,2,-1,-15,-1,-1,6,-8,1,0,0,0,-3,1,-3,-14,1,1,1,-5,1,-3,-1,3,1,-1,1,-1,6,4,3,0,-3,2,-3,1,3,1,2,1,2,4,2,7,2,4,-1,1,2,-5,0,1,4,-3,1,-3,-2,-2,1,1,3,-2,-2,-4,-4,-1,1,3,-4,3,-2,0,0,4,2,-4,-1,2,-3,4,1,-1,4,-6,-1,-6,3,3,0,2,26,-1,4,3,-1,3,8,3,1,1,-9,3,-1,-7,1,-6,-2,-1,0,-1,0,-1,-7,6,2,-3,1,7,2,-7,-3,2,-1,-3,2,2,-3,-9,-4,3,3,-5,1,-3,0,15,0,3,-3,-2,2,6,1,-68,4,2,2,2,-1,-10,2,-2,-2,12,2,1,6,2,4,-16,5,7,1,1,-1,-3,-1,0,10,1,1,2,1,-2,3,2,2,-2,0,0,10,4,2,-3,-1,2,-1,2,2,13,0,5,4,4,2,3,2,-1,-4,-4,4,3,0,4,4,-8,-1,-73,-4,2,3,3,1,-2,1,-1,5},
+                                              {4,13,-1,2,-3,1,1,1,5,-1,2,1,3,6,2,-8,2,2,-2,1,-3,-2,3,-1,7,5,3,1,4,-1,2,5,3,6,2,-4,6,5,-2,12,1,-2,27,5,-1,6,-4,1,-1,2,-1,0,0,-2,-16,2,-1,-6,-2,-1,-3,1,-1,1,-3,-2,1,2,4,5,2,-4,-4,-2,3,5,-1,3,2,0,2,5,7,2,1,-2,3,2,-3,4,1,3,-1,5,-5,-4,1,4,5,2,-2,-2,1,-1,2,-2,3,-5,0,-1,3,1,-1,7,-12,2,1,-3,1,2,1,4,-3,-2,-8,1,1,2,4,28,-3,3,2,2,1,17,2,2,3,-2,4,2,-9,-1,-5,-1,-3,0,2,-2,-2,-2,4,4,1,-1,2,3,-8,1,3,-5,0,3,3,-3,-4,-2,4,1,-11,3,-3,0,17,-1,3,1,-2,-2,4,-3,15,8,2,3,5,0,-13,3,2,-1,18,-4,-1,3,2,2,-8,4,5,-6,0,-8,-4,-2,-4,-79,1,0,5,1,-2,-1,1,3,-1,1,-3,1,3,1,-2,-2,1,3,3,5,17,1,7,1,5,1,-4,1,4,-8,-1,4,4,2,-1,7,-5,-3,-66,-4,-1,9,3,2,3,-4,-1,8},
+                                              {6,7,1,5,-1,-1,-3,-3,-3,2,0,-1,1,0,-2,45,1,-1,-3,1,2,2,2,-1,0,6,0,1,2,-5,3,5,1,3,2,-4,5,3,-2,5,3,-4,-10,2,-1,6,-9,1,0,-4,1,-1,1,-1,-12,-1,1,-2,4,0,-1,-1,-3,1,-3,-1,-3,1,7,2,4,-5,0,-2,1,47,2,3,1,-8,-4,0,6,5,2,0,3,1,-6,2,2,4,-3,2,-5,-4,-2,2,4,1,-3,-3,1,1,-2,-1,2,-2,1,-3,0,-2,3,2,-6,-2,2,-3,2,2,-1,9,-2,0,-10,4,2,1,-1,-5,-3,3,1,-7,2,-69,4,2,-1,-2,3,-1,-6,-3,-7,-9,-3,-2,4,-4,-3,-2,7,4,1,-1,3,1,-7,1,2,-1,5,2,-4,-2,-4,-4,2,2,-10,-1,-2,2,10,0,2,-2,-3,0,6,2,10,6,2,1,1,-3,10,1,2,-2,-80,-2,2,3,-2,2,35,3,4,-2,0,-5,-5,-1,-2,12,3,-2,2,-1,-3,3,2,2,1,-1,0,4,1,2,-2,-1,3,1,0,2,7,1,5,2,4,2,-2,2,4,-9,-4,3,0,0,-1,4,-1,-1,10,-1,1,6,3,-6,-2,-4,-2,4},
+                                              {8,15,-2,4,1,-6,1,-2,4,-1,2,2,2,7,1,13,4,1,-1,3,-1,2,4,3,7,4,1,1,-6,1,1,4,1,5,4,-4,6,7,-4,7,4,1,-14,7,1,1,-2,4,-3,6,-2,3,-3,-3,-27,2,-2,-2,-5,1,-4,1,-4,1,-4,1,-3,-2,4,1,3,-4,1,-6,2,0,1,-2,4,2,3,4,1,3,3,3,3,2,-4,3,5,4,-1,-4,-7,-5,0,2,5,3,-2,-1,-5,-1,2,-2,3,-6,2,-4,3,-1,0,4,-14,0,-1,1,3,2,-1,8,-10,0,-15,1,-49,2,3,-16,-6,5,0,4,1,17,3,2,1,-3,5,0,-19,-7,1,2,-1,-1,2,-5,1,-2,5,2,-1,-1,4,1,-11,-6,1,3,6,-4,4,0,-5,-4,8,-2,-8,1,-7,3,19,-1,4,3,1,-1,6,-2,-59,1,2,3,4,2,27,3,3,-3,-66,-6,1,5,1,4,-25,3,3,3,3,-1,-5,-4,-1,16,1,-2,-7,-6,-4,0,2,2,3,0,-7,5,0,5,-4,-3,1,-1,5,5,30,3,6,-3,5,-2,-9,5,3,-20,-7,5,4,4,5,3,-8,2,21,-3,-6,11,1,4,2,-1,-1,5},
+                                              {10,21,-6,-2,-2,3,-3,-3,4,-3,1,1,2,9,-1,24,3,-1,0,2,1,3,3,1,6,-4,-2,-1,-12,-2,3,4,2,8,3,-5,13,5,-4,1,1,-5,39,-7,-1,6,-13,1,1,1,-4,-9,-1,-6,-11,1,-3,-13,0,0,-3,1,-2,1,1,3,-5,2,4,3,-2,-5,-1,-1,3,8,2,0,2,0,2,1,4,3,3,2,6,4,-3,-3,4,4,-3,1,-3,-6,-2,2,3,3,-4,-3,-2,-3,-3,-1,4,-3,5,-3,3,-1,-5,3,-6,-2,1,-3,3,-2,-12,2,-1,-2,-1,-1,0,3,2,-16,-2,4,-1,-3,1,5,3,2,-1,-2,-1,3,-4,-1,-1,2,-2,-2,4,-5,-4,1,1,1,3,1,7,-3,-1,-5,1,-2,3,-11,3,-4,-2,-5,2,8,2,0,-1,1,-2,-3,5,-3,-2,-1,8,-1,6,-1,1,2,2,-1,18,4,2,-9,-55,-3,3,4,3,3,-17,4,2,-10,2,1,-4,-3,-1,-61,2,1,2,-11,-2,3,3,2,0,0,1,8,3,-3,-3,-4,3,-1,-2,4,12,2,6,-4,6,2,-5,2,5,-6,-7,4,4,-1,-4,3,-2,1,-1,-1,2,2,-2,1,-5,-4,-3,3},
+                                              {5,10,3,4,0,-2,-1,1,2,-1,1,1,0,6,-2,-27,3,-1,-1,2,-2,1,-1,-2,1,-1,2,1,-1,-3,3,2,0,6,3,-4,5,3,-3,7,-1,2,-10,2,-1,4,1,2,1,3,-3,1,-1,-1,-20,-5,0,-5,-3,-2,-1,1,1,-1,0,1,1,-1,1,0,2,-4,2,-4,3,1,2,0,4,2,2,4,5,-1,4,2,4,1,-3,3,3,2,-1,1,-4,-4,-3,2,4,1,-3,-5,1,-3,1,-1,2,-3,0,1,-4,-1,-1,3,-6,-10,-1,-6,3,1,-5,5,-7,-1,-10,-2,-2,2,4,-14,-3,3,-2,1,1,-67,2,1,2,-2,3,0,-11,-3,-4,0,-5,-1,3,-5,-2,1,3,3,5,-1,6,2,-14,-8,1,0,3,-3,1,-2,-1,-2,4,-1,-9,2,-5,1,-72,0,2,-1,-1,-1,2,2,17,1,3,2,2,-1,-9,4,1,-1,15,-2,0,6,3,3,30,2,1,3,2,2,-6,0,-1,18,1,2,1,1,-2,2,4,2,1,1,-4,4,4,3,-2,-1,2,0,-3,6,21,-4,6,1,6,3,-8,4,5,-7,-4,2,4,-4,0,4,-7,-1,16,-1,-4,4,1,1,0,-6,-2,5},
+                                              {5,8,11,1,-1,-1,-3,-3,2,3,1,0,-1,9,-1,-18,2,-2,-9,2,2,-1,4,-1,4,5,1,0,3,-4,-1,6,1,3,2,-4,7,0,-2,9,-1,2,-15,1,-1,2,-3,2,-2,-2,-1,-4,2,-4,-17,-1,-2,-2,-3,0,-4,-1,1,1,0,0,-2,1,6,1,0,-2,-4,1,2,1,3,1,3,-2,3,-2,2,1,-1,2,4,2,-4,3,2,5,-8,-4,-2,-3,-2,2,3,2,-4,-1,-1,4,-1,0,1,-5,2,-2,-1,-1,1,4,-6,-1,1,0,4,1,-4,5,-5,1,-4,1,-1,0,1,-11,-2,-1,1,2,1,10,4,2,0,-3,2,-4,-7,-3,-7,1,-2,-1,2,-2,0,-3,5,3,-1,1,-3,0,4,-3,2,0,-8,-2,2,-4,-8,-1,2,0,-2,0,-4,0,-71,-1,1,1,-2,1,1,3,-65,3,2,3,3,-2,-9,3,1,-1,10,-3,2,2,3,2,-15,3,5,-1,2,-4,-1,-1,1,10,2,2,3,-4,-4,3,2,2,-4,2,-2,5,3,-1,-1,-3,2,-3,1,5,18,2,6,1,4,3,-7,1,-2,-6,-3,5,2,4,-4,0,-2,-1,9,2,1,6,3,1,-1,-2,-2,3},
+                                              {5,9,2,1,-3,-1,-1,1,5,2,1,3,1,8,-1,-12,4,-3,-3,2,2,-2,1,1,5,-2,1,-2,-3,-3,3,6,2,3,1,-4,8,2,-2,8,1,2,24,5,-4,2,5,3,-1,5,-3,-4,0,-2,-20,-2,3,-2,-4,2,-2,1,-2,-1,-6,2,-2,1,5,-1,3,0,-1,-5,2,5,2,2,2,3,2,3,2,1,2,2,-1,2,-4,2,4,4,0,2,-2,-3,-1,2,3,-1,-4,-2,-3,-3,-4,0,3,-3,3,0,4,2,2,4,-9,1,-1,0,2,-2,-4,8,-7,0,-7,-1,4,2,3,-17,-2,2,3,3,2,18,1,1,-1,-1,-1,-1,-7,-2,-6,-3,-1,-3,3,-2,-1,-1,4,4,-3,2,5,3,-8,-1,0,1,-2,-1,1,-3,-3,-5,6,-4,-7,-10,-5,1,-59,-1,0,0,-2,1,1,1,14,0,1,3,3,1,-18,2,2,-1,14,-3,2,2,2,3,-13,3,6,1,1,-2,-5,-2,1,-77,2,1,3,3,-2,0,3,2,-2,2,-2,9,2,2,-2,-3,1,3,5,3,21,1,4,-1,5,1,-3,3,3,-6,-5,5,4,4,0,5,-8,-1,13,-5,1,10,1,3,3,-1,-5,6},
+                                              {-2,-4,-1,2,-4,-4,-2,1,-1,-8,-1,-3,1,6,-2,4,17,-1,1,1,-1,-1,1,-3,-12,-2,1,2,-13,-1,0,-15,1,4,-2,-3,0,-7,2,2,-3,2,-2,4,1,0,9,3,23,4,1,3,-3,11,3,1,-3,-2,-2,17,21,3,-2,0,7,-1,2,0,-12,-8,3,-2,14,-4,0,-2,1,-3,1,1,4,6,2,-2,-1,-2,2,-2,-2,-7,-71,-2,3,3,-6,-5,1,1,-8,0,-4,34,2,-1,1,2,2,-3,2,2,-16,3,10,-10,5,-18,-2,-21,-2,3,-2,-1,-2,2,9,-11,-1,0,-4,-2,-5,1,-9,0,21,1,2,-1,1,-3,1,6,7,-1,6,1,23,0,2,7,1,2,3,-1,-4,17,2,3,4,-2,-2,0,-2,-6,0,-5,4,10,-1,4,5,1,-3,3,1,3,2,-6,-1,2,6,-1,2,5,2,-2,2,-3,-5,-81,2,12,0,0,17,5,-1,-81,3,-1,-5,-6,1,-3,10,2,1,3,2,1,2,-2,0,-1,2,2,4,4,-5,-4,4,2,1,-9,3,-1,-67,-3,-5,-21,6,-3,3,-2,-8,-1,4,8,3,2,2,-30,-4,7,4,-1,2,-8,1,-4,7,-1,1,-14,2,-6},
+                                              {-1,-5,-2,0,-3,-2,-7,1,-2,11,2,-9,2,0,-3,3,-86,-1,-3,0,-1,-1,0,-6,-11,0,1,3,-8,4,0,-9,1,2,1,-1,2,-7,1,-1,-1,2,-3,-1,0,4,11,3,16,-1,2,3,0,7,3,-3,-1,4,-2,14,12,1,2,1,4,-2,1,5,-5,-8,-1,-2,12,-3,0,-4,1,-2,1,-2,4,1,4,1,3,-2,-1,1,1,-15,-74,0,1,-1,-2,-3,0,2,-5,-1,1,-15,4,-5,-2,2,1,-1,1,-4,-13,-1,15,-8,5,-14,2,-13,2,1,3,-2,-3,1,6,-12,2,1,-1,-4,-2,1,0,0,11,1,3,1,-1,-9,1,1,6,2,4,0,31,2,1,8,0,-8,3,-1,-1,12,4,11,3,-3,0,-3,-2,1,-1,-2,-5,7,2,3,5,2,-5,3,3,1,10,-1,1,2,7,1,1,7,3,-1,6,-1,-6,8,-2,10,2,8,12,5,-3,18,0,-1,1,-5,2,-1,6,2,-2,3,1,-2,1,4,-1,3,2,2,1,1,-9,1,5,1,0,2,3,-1,19,-2,-3,-11,6,1,3,0,-2,-3,0,8,1,1,-1,9,1,5,3,-1,-1,-5,0,-5,-1,0,-4,33,0,-3},
+                                              {-7,-2,0,-1,-1,-2,-3,1,-2,-25,2,-4,2,7,-1,1,14,0,1,0,-3,-2,0,-3,-11,-2,1,2,-2,-2,0,-13,1,3,1,1,-5,-6,1,3,-2,1,-1,5,0,5,4,3,24,2,1,4,1,6,4,-1,1,-6,-1,13,15,1,0,0,7,-2,5,1,-10,-6,1,-3,7,-4,2,-4,-2,2,1,-2,3,3,1,1,-1,-4,2,0,3,-11,-70,0,3,4,-5,-6,3,4,-4,-1,1,-24,-1,-3,2,0,1,-1,1,-3,29,-1,-17,-7,3,28,0,-25,-1,2,-3,-4,-8,0,9,-14,0,2,1,-2,-3,0,1,-2,10,1,2,-1,2,-3,1,4,4,2,-5,1,29,1,2,7,-1,0,4,-2,1,-78,1,1,3,-1,1,-3,-1,3,0,1,3,7,0,2,0,3,-4,2,1,2,18,-1,3,1,0,-4,2,8,2,1,6,0,-5,16,1,6,1,-1,-70,4,1,16,1,-1,-1,-6,-1,-6,7,-1,-3,-1,0,2,-3,1,-1,-1,1,2,3,2,-1,-2,3,-1,1,2,2,1,17,-1,-3,-16,7,-3,1,1,-5,-2,5,8,14,1,2,-36,-4,10,-1,-2,2,-5,-2,-3,3,1,0,-19,1,1},
+                                              {-4,-2,-3,3,2,-4,-4,-2,-11,-13,1,-4,2,3,-3,-4,11,-1,-1,0,-1,-2,-1,-3,-9,0,-1,2,-4,-1,2,-10,0,6,1,-1,-3,-4,1,3,0,1,-4,-1,1,4,6,2,12,-1,2,2,0,10,1,4,1,2,-2,-76,12,1,-2,2,7,-3,-1,1,-4,-5,6,-5,9,-4,-1,-2,1,2,0,-8,2,4,7,-1,2,-2,3,0,2,-5,13,0,1,0,-4,-5,0,2,-7,-3,-1,38,-1,-1,-2,1,0,-1,1,-6,-7,-2,-1,-7,4,-15,2,-12,-1,4,1,-4,-5,1,3,-3,2,1,-2,-3,-4,1,63,-6,11,0,2,0,-1,0,1,2,5,1,2,0,-11,1,4,7,1,2,6,1,2,10,2,-1,5,-3,-1,-1,-1,-2,-9,1,4,8,-2,2,0,-1,-2,4,0,4,12,1,3,0,8,3,2,4,2,-1,3,-1,0,-87,0,12,0,-1,16,3,-5,14,2,-2,0,-4,1,-1,6,1,-3,1,2,-3,-2,1,-2,2,3,2,4,0,1,-6,4,0,0,2,3,-1,-71,-3,-2,38,7,1,4,-1,-3,1,5,2,2,-1,-2,-35,-6,5,5,-1,2,-2,-2,-4,-3,-6,-4,-17,-1,-4},
+                                              {-8,-7,-4,1,0,-3,-1,-3,-3,-6,0,-2,1,-1,-3,2,-68,1,1,2,-4,-1,1,3,-13,-6,2,2,-9,1,-2,-19,-1,4,0,1,-5,-8,-2,1,-1,4,0,5,2,-1,1,3,34,5,4,76,-3,7,5,-3,-1,-1,-1,-59,23,1,-5,-2,9,0,-3,1,-14,-7,2,-2,11,-4,0,-4,0,-6,2,2,2,2,5,3,3,1,3,-1,6,-12,22,-2,1,1,-8,-5,1,0,-8,-2,0,-29,0,1,2,1,1,-3,2,-7,-28,0,-16,-15,5,26,-2,-18,-1,3,-3,-9,-12,3,1,-11,-1,1,-2,-1,-5,2,-3,2,13,1,2,-2,0,1,3,7,6,-1,-5,1,-19,0,4,14,3,-1,1,-3,-2,19,3,6,3,-5,-2,3,-1,1,1,4,5,9,1,-1,0,1,-4,5,3,1,25,3,5,1,6,1,2,3,2,-1,5,-1,-2,18,2,8,0,-3,-65,3,1,-62,3,0,-2,-2,3,1,10,-1,0,3,0,-1,-16,-1,-2,-1,3,2,6,4,-3,-8,-3,4,-2,1,5,-1,24,-2,-4,36,6,-5,2,-6,-12,1,1,3,9,3,4,-28,-3,0,1,2,3,-7,-10,-3,3,2,-3,29,2,-6},
+                                              {2,0,0,3,-1,-2,-4,1,-3,9,2,-4,1,4,-1,-5,15,-1,-1,1,-1,5,1,-1,-13,2,-1,1,-11,0,2,-12,2,4,1,-2,4,-4,-1,2,-2,2,-6,3,1,5,-6,3,16,1,-1,2,1,4,3,1,-1,-5,-1,-83,10,2,-1,1,8,-1,-1,1,-12,-6,1,-3,10,-3,2,0,1,-1,2,-2,2,3,4,1,2,0,1,1,1,-7,10,1,0,3,-3,-5,1,2,-5,-1,-2,-14,-4,-3,-1,0,2,-2,2,-4,29,-2,18,-8,1,-12,0,-15,-1,2,-5,-5,-2,1,2,-13,3,0,1,-5,-4,2,-5,0,7,1,2,0,-1,-2,-1,2,4,-1,4,2,-16,0,3,7,-1,-1,3,-1,2,-76,2,8,3,-4,-1,-1,1,-1,-1,-1,-3,7,-3,2,1,1,-3,2,0,2,13,0,2,1,6,2,2,6,1,0,4,0,-6,8,-2,9,-1,-2,12,3,-1,17,-3,-1,-3,-8,0,2,9,1,-2,2,2,0,0,-3,0,2,6,2,2,1,-3,-8,6,-1,1,-3,3,0,16,-1,-1,33,7,-5,5,1,-5,0,5,-1,-1,3,1,8,-3,6,5,-2,2,-4,1,-9,5,2,-1,-20,-2,-4},
+                                              {2,-1,0,6,1,0,-2,2,-2,11,-1,-1,-1,10,-3,-2,8,-2,3,2,-3,0,-3,-4,2,-11,2,3,-12,-1,1,-9,1,6,1,0,0,-1,0,-4,-1,4,-1,0,2,5,0,3,18,5,1,8,-2,11,4,0,1,-9,1,6,-8,4,1,3,13,-1,3,2,-6,-2,0,5,9,-1,1,-6,3,2,4,3,6,5,-9,-1,2,-1,5,-2,6,-11,8,-1,4,-2,-7,-5,-1,3,-4,-3,-1,67,0,-3,1,2,1,0,0,-2,-18,-4,24,-1,8,45,1,58,0,3,-11,-3,-2,3,8,-20,-1,3,1,0,-3,0,3,4,-51,0,1,-1,1,-1,1,-4,10,1,-1,2,-22,2,8,13,1,3,2,-1,2,7,5,-15,10,-1,1,3,-1,4,1,3,-3,13,5,3,3,4,-6,3,-1,4,-45,0,6,3,4,3,2,6,2,-1,6,0,-4,-46,3,15,3,-4,-57,12,-1,8,4,-2,-6,-8,3,1,11,3,0,2,2,0,1,-11,0,2,7,3,3,4,-4,-5,10,3,2,4,4,1,-46,2,-3,-24,5,-5,9,1,-13,2,7,7,9,3,3,28,-4,7,6,1,2,-2,-3,-4,-1,-1,-3,-22,1,1},
+                                              {-1,-3,20,2,-1,-2,-4,-3,-4,-33,1,-5,1,9,-2,-3,-75,-2,-6,1,-1,-1,1,-4,-8,2,2,1,-2,-2,0,-10,-1,6,0,0,-1,-6,0,7,-3,4,-5,3,2,-2,1,4,17,1,0,2,0,6,3,-3,-1,-2,-3,10,12,2,1,2,8,-3,0,-1,-8,-6,2,0,7,-5,1,-3,2,-3,2,-1,2,1,1,0,-1,-1,1,1,1,-5,13,-1,-4,-1,-2,-4,2,2,-5,-1,-2,-17,1,6,-1,3,-1,-3,1,-4,-12,-2,4,-8,5,-15,0,29,1,2,0,-3,-6,2,7,-10,-4,-1,-3,-2,-3,0,-3,1,-85,1,3,1,-1,-1,-1,-1,7,1,4,1,-12,2,3,7,1,-1,4,-2,3,12,-2,-10,5,1,1,0,-5,0,1,-2,-2,12,-1,2,4,1,-3,3,1,3,-74,0,3,2,4,1,2,3,2,1,2,0,-1,14,1,10,0,-2,15,-2,-3,13,2,0,2,-4,-1,-1,10,2,-1,2,2,0,-2,-2,-2,3,4,2,-2,1,1,-2,5,0,2,-2,3,-2,20,-1,-2,-14,8,-3,5,0,-2,-2,-1,4,3,3,-1,-37,-3,3,4,1,0,-1,0,-3,5,-1,-3,30,-2,-6},
+                                              {-7,-8,2,2,-2,-5,-3,1,-2,-9,2,-2,-1,2,-7,1,18,-5,-1,1,1,-3,0,-1,-10,-3,1,1,-16,-1,2,-15,0,3,-2,-1,1,-7,0,4,-3,4,-1,2,-5,-1,-10,4,26,6,-2,2,3,8,3,1,3,1,-1,16,18,3,-2,-1,6,-1,-1,0,-18,-8,3,-2,12,-6,1,-5,2,-1,1,3,2,4,-2,2,2,-2,0,-2,3,-3,18,-1,3,4,-5,-3,1,2,-7,-6,-2,-23,0,-4,-5,3,1,-4,3,-1,24,2,9,-11,3,-20,-2,25,1,-3,1,-4,-7,1,8,-10,2,1,0,-3,-3,0,-2,2,-77,3,2,-2,-2,1,-4,3,5,-1,4,-1,-21,1,6,5,3,2,3,0,0,-77,1,2,-2,-2,-2,0,-3,-2,-2,-1,6,13,-1,-1,3,-2,-4,3,2,5,-74,1,5,2,2,0,3,4,0,-1,6,1,-5,17,1,14,0,-1,17,-2,0,-80,-1,-1,-3,-1,1,-1,8,1,-1,0,3,2,-1,6,-1,-1,3,2,4,3,-6,2,3,0,2,1,3,0,30,-1,-4,-18,5,-1,3,-2,-7,0,6,7,2,4,2,-34,-6,8,3,0,1,-5,-1,-6,-4,2,1,-15,-4,-8},
+                                              {-4,-2,7,3,-4,-3,2,-2,1,3,-2,-1,1,-13,-2,1,0,-1,33,2,2,-1,18,1,0,2,1,2,6,1,2,4,2,3,-1,-4,-1,-3,-1,4,-1,-3,-3,4,0,4,-8,-20,-2,2,2,-1,-4,-3,1,1,-2,-4,-4,2,-4,16,-1,2,-5,-2,-2,1,5,-4,1,-3,-2,18,0,-2,2,1,1,1,2,3,4,-1,-1,-3,5,-1,-7,1,2,1,-5,1,-3,-2,2,-1,2,-1,-5,-1,-3,4,1,2,2,-3,1,1,-1,1,2,-1,5,0,-1,0,2,-2,1,1,-1,3,5,5,-1,-1,-2,-3,6,1,1,-2,-1,1,3,2,3,4,-2,1,4,-4,-5,1,-2,0,1,-6,-3,3,-1,2,-2,2,-16,-10,8,-10,-1,-2,1,-3,-2,-5,-3,8,7,4,1,-1,1,2,1,-4,-1,-6,-4,2,0,-1,2,-1,3,2,-2,-5,-4,-1,-70,1,1,-9,1,6,-1,1,-3,1,8,-1,2,-4,5,2,-1,4,2,1,-1,4,-3,1,3,2,12,3,2,-4,3,13,0,-7,1,2,1,-70,-1,-1,4,-1,-2,-1,4,1,-7,5,0,3,2,1,-2,-9,1,1,3,-3,-2,-5,-4,-4,-18,-1,3,5},
+                                              {-4,-4,5,-2,-4,-4,-4,-1,-2,-1,2,-6,2,-24,-1,-1,-1,1,32,1,2,-2,13,-3,4,17,3,2,4,3,-1,6,2,3,1,1,-1,-2,-3,3,1,2,-3,1,-1,6,4,-20,-1,-4,4,1,-1,-4,3,-4,0,-1,-3,2,-3,7,3,3,-4,-3,-2,6,4,-5,-3,-4,2,17,2,2,0,3,0,1,4,-2,5,3,4,-3,3,1,-3,3,-2,1,-15,-2,-1,-1,-8,0,2,1,-1,-1,-6,0,-1,4,1,-3,1,-1,-2,-1,-5,2,3,2,3,-1,4,-1,4,-1,-4,1,4,5,0,0,3,-3,7,0,2,-3,1,2,2,1,2,-3,1,1,2,3,-3,0,-1,3,1,-2,-1,-3,4,2,-5,3,-8,-2,10,-10,1,-2,1,-2,-2,-3,-5,11,1,2,3,-1,1,1,3,-3,1,-3,-2,3,3,3,1,5,3,2,6,-2,-2,2,-60,-1,2,-4,1,5,-2,1,-1,1,8,1,-2,0,8,3,-3,3,-1,-1,-4,-4,-2,3,2,2,-15,0,1,-1,3,5,-1,-1,2,-3,1,5,-2,-1,5,4,-4,1,6,-1,-7,3,0,1,2,-2,4,-7,-4,-1,2,-2,0,-5,3,-3,-15,2,2,4},
+                                              {-3,1,7,2,-3,-2,1,-2,-1,1,1,-1,3,-16,1,0,-2,1,33,1,-1,-2,18,0,5,2,2,2,9,0,1,1,3,5,2,1,-3,-5,-2,9,0,-4,-2,3,-1,8,2,-19,-1,2,2,1,-2,-3,2,3,-1,-4,-1,1,-8,14,0,1,-4,-3,1,1,2,-4,1,-5,-5,17,3,-1,-1,4,1,-2,2,3,2,3,-1,-6,3,1,-3,2,-1,1,-5,-1,-4,-3,1,1,3,-1,-2,0,0,-1,2,1,-2,-2,0,-1,0,1,-1,6,1,3,2,-1,2,-2,6,-1,0,1,7,6,2,1,5,-2,7,1,1,-3,-2,1,2,1,5,3,0,-2,1,-1,-5,1,-3,2,2,-3,-3,2,1,2,-5,-1,-16,-7,9,-1,3,-5,0,0,-1,-3,-3,7,3,3,0,2,-1,1,1,-2,1,-2,-1,2,-2,-2,3,5,4,4,1,-3,-4,3,-69,0,1,-10,-2,5,-1,0,-1,1,8,-2,1,-7,5,1,-5,1,-1,1,-2,0,-2,1,2,-2,-18,1,-1,-6,3,-78,1,-1,-1,3,-1,17,0,-1,5,4,-1,0,5,0,-5,6,5,3,2,-1,-1,-7,-3,-4,2,-1,-3,-5,3,-2,17,1,1,7},
+                                              {-4,0,6,3,0,-1,0,-4,-7,2,-1,-1,2,-12,-1,-5,-2,-1,-9,2,3,2,9,1,0,9,2,3,10,2,3,3,2,3,1,-1,-1,-1,-2,2,3,-3,-3,2,0,9,-6,-14,1,-2,3,1,-2,-1,1,2,1,1,5,1,-6,-62,-2,2,-3,-3,-3,1,4,-4,3,-5,0,11,1,2,1,4,1,-8,-3,3,7,6,3,-4,4,1,-3,4,1,1,-6,-5,-2,-4,2,0,4,-2,-2,-1,-2,1,-3,2,-1,-1,-1,-3,-1,0,-1,1,2,0,2,0,3,1,0,1,1,3,1,4,1,2,3,-1,4,1,-2,-7,-1,-1,4,0,2,5,-2,-2,3,-4,-3,-1,-3,1,4,-1,-3,4,2,3,-3,1,-8,-9,6,-7,1,-2,-3,-3,-7,-3,-4,7,1,3,-2,-2,0,3,-1,-2,0,-3,-1,1,5,3,2,5,3,1,-1,-3,-2,1,12,1,-1,-6,1,6,-5,1,-1,-3,8,-1,0,-5,6,2,-3,2,1,-4,-1,-3,-3,4,2,1,28,-2,0,2,3,10,0,0,2,2,-1,-70,-2,-1,4,3,-2,1,3,1,-4,-4,1,1,-1,-3,1,-6,-1,0,2,1,-2,-3,2,-8,-1,-2,-1,4},
+                                              {-7,-2,3,5,2,-5,2,-4,-1,1,2,-2,2,-34,1,0,-2,5,-24,3,-2,-3,19,-1,5,5,0,2,7,4,-2,4,2,5,2,4,-8,-19,-3,3,-1,-20,0,4,2,2,-1,-38,-3,9,5,5,-7,-4,4,-4,-2,-5,-4,1,-10,-58,-2,2,-9,-3,-3,2,3,-9,1,-3,0,36,2,2,1,-1,3,4,4,-1,-1,5,4,-3,6,-1,-2,1,2,1,-24,-7,-5,-6,-17,-2,5,2,-1,2,-4,-3,3,2,1,-4,3,-2,0,-1,3,2,5,4,-1,3,2,1,5,-7,-2,3,-1,3,-3,1,4,-3,11,-2,0,-1,-2,3,1,1,3,6,0,2,5,-7,-1,-1,3,0,5,-1,0,1,-2,2,-7,2,-38,1,6,-10,0,2,10,-4,1,2,1,11,1,-3,-3,0,1,-1,4,-1,2,-2,5,3,2,2,1,1,4,3,-3,-3,-1,1,25,2,1,-14,-2,3,-1,-1,0,3,9,4,5,-3,6,-1,-2,4,-2,-3,-18,-2,-3,1,2,1,6,4,-2,-12,-2,23,-3,-2,2,0,1,22,0,2,5,3,-3,-3,2,2,-14,2,-4,5,6,3,7,-14,-5,3,4,-3,-8,-2,2,-1,0,3,4,3},
+                                              {-3,0,2,-1,-2,-2,1,-3,-1,2,1,0,2,-11,1,-4,0,-2,-9,2,2,3,10,2,3,6,2,0,-1,2,2,3,3,3,1,0,1,-2,-3,4,-1,-3,-8,2,-1,7,-4,-14,2,-1,1,1,-1,-5,-1,-3,-2,-4,-3,2,-4,-65,0,2,-4,-1,-4,3,6,-4,-1,-2,0,12,3,1,2,4,2,-2,1,3,6,2,3,-2,4,1,-3,0,1,0,-6,-2,-1,-5,3,0,2,-1,-2,-2,-2,2,-1,1,1,-2,3,-1,-2,-2,-3,2,-3,0,1,-1,3,-2,0,-4,1,1,1,7,-1,1,4,-6,4,2,-1,-2,-1,2,2,3,1,5,-2,0,3,-2,-4,2,-3,1,1,-1,-3,3,3,0,-3,2,-10,-12,8,-12,1,-2,-4,-1,-2,-3,-5,8,1,5,3,-1,-1,1,0,-2,3,-3,-1,1,1,4,1,5,3,4,1,-1,-6,3,11,1,0,-9,2,3,-2,3,-5,-2,6,0,2,-3,6,3,-3,4,0,-1,-3,-12,-2,3,4,1,7,-1,2,-3,4,-68,0,-3,1,3,2,14,4,0,6,-1,-2,2,5,2,-3,-3,-2,3,1,-4,-2,-7,0,0,4,-1,-1,-5,3,-4,23,-3,1,5},
+                                              {-6,-3,12,4,0,-2,1,-1,-3,8,1,2,2,-14,-2,-2,-1,-1,-5,2,-1,-1,-76,-1,0,7,2,3,7,1,1,2,1,5,3,1,-2,-4,-3,2,-2,-2,-2,1,0,7,2,-18,4,2,2,5,-3,-4,2,-1,2,-4,-2,3,-1,13,1,2,-5,-2,0,2,3,-8,0,-5,1,16,2,-2,2,2,2,3,3,0,2,2,2,-3,5,1,-4,3,3,-1,27,2,-4,-4,8,1,4,-1,-2,-3,-2,3,1,3,1,-2,0,2,-5,-3,-9,1,4,-8,1,-4,2,-1,2,-2,0,3,4,1,-1,2,3,-2,6,-1,-2,-2,-3,2,1,1,4,6,-1,-3,8,-1,-3,1,-5,2,4,-2,-2,4,1,2,-2,3,-19,-1,8,-6,1,-1,-3,-1,-2,0,-3,13,2,-1,-4,-1,-2,2,1,-4,2,-2,2,2,2,2,1,3,4,3,-1,-1,-1,3,21,2,3,-15,0,3,1,2,-1,-1,7,4,2,-1,7,2,-3,5,-1,2,1,-6,-1,2,4,1,16,3,-1,-4,4,12,1,0,1,1,-4,-60,-1,-3,6,-1,-3,0,2,3,-9,5,-1,1,4,-8,-1,-13,-4,2,5,0,-6,-4,2,-3,-21,-6,1,5},
+                                              {-3,1,2,2,-2,2,0,-3,-1,-5,1,0,0,-1,3,-4,-2,-4,-24,1,1,-1,-61,0,3,-1,4,1,3,1,-1,4,2,-1,1,-2,-2,9,-2,3,1,6,-4,-4,1,3,-8,-24,1,3,3,-10,-7,-6,4,-8,-6,-17,-6,2,-11,3,2,3,-3,-2,-3,0,7,-6,1,-4,-6,12,1,-5,2,-1,2,-3,4,-3,-10,1,1,-2,8,3,-3,-5,1,-1,33,-10,-3,-4,-32,-2,5,-3,-2,-1,-5,3,-1,3,-1,-5,2,-3,-2,-4,-2,3,8,2,2,1,4,-3,-4,-4,3,3,3,1,-5,-1,-1,-1,14,-6,-2,1,-5,3,4,4,2,-3,-2,-3,0,-2,-15,1,-4,2,5,-1,0,2,-2,1,0,2,-14,-2,11,-15,1,-2,-2,-3,-1,-3,-3,10,-7,5,0,1,2,3,-3,-3,1,-4,0,2,1,2,-2,3,4,4,-4,-2,1,2,9,-6,1,2,2,2,-2,1,1,-6,4,-3,8,-1,4,4,-1,3,0,0,1,-8,-2,3,5,0,-30,3,2,-7,2,-11,1,-1,4,-2,-2,-6,-1,-2,7,-4,-3,1,5,2,-1,-1,-3,6,1,1,0,-3,-5,0,2,2,-2,-7,1,-5,-30,1,-2,1},
+                                              {-6,-5,11,1,-3,-2,1,-2,-3,5,1,1,1,-10,-1,-2,1,-4,-7,3,3,-3,-71,1,5,10,2,1,4,1,2,6,4,4,0,1,4,-4,-3,1,0,-1,-1,0,-4,4,-3,-17,-2,4,1,-1,-3,-5,2,-3,2,1,-2,2,-4,11,-1,2,-6,-2,-3,3,6,-7,1,-2,-1,15,2,-1,3,4,2,4,2,1,3,4,2,-4,2,2,-4,3,2,1,28,-2,-2,-4,9,-1,1,-6,-4,-1,0,1,-5,4,2,0,2,0,-1,3,3,3,2,1,-1,2,3,-5,2,-2,-3,2,6,1,3,3,2,-4,7,-2,2,-2,1,3,1,1,2,6,-5,-3,3,-3,-2,-2,-3,2,4,-4,0,2,2,4,-5,2,-15,-4,5,-3,1,-1,-6,1,-3,-2,-5,13,1,-2,1,-6,-1,1,2,-2,-3,-2,1,4,1,3,2,-1,3,4,-1,-2,-3,3,18,3,1,-15,2,2,-1,2,-3,2,11,4,1,-1,7,1,-1,2,1,0,2,0,-3,1,3,2,-17,2,2,-1,2,-67,2,-2,1,1,2,15,-1,-1,3,-2,-5,-2,5,2,-6,4,-1,1,4,1,1,-9,-4,-1,3,0,-4,-5,2,-2,20,2,-3,6},
+                                              {7,-7,-1,1,-2,-3,-1,4,1,1,-65,2,14,4,-59,2,2,-19,2,2,2,0,2,-3,2,-1,1,15,-2,-4,2,10,2,-15,1,-4,-6,-8,0,-1,-1,2,-1,12,-13,0,7,2,-4,4,1,0,11,-6,3,-5,-4,8,-6,2,9,2,-1,-1,-9,2,1,0,7,-5,-2,-2,-4,-2,4,0,-1,0,2,1,3,6,-1,-1,0,-1,-14,17,-2,3,2,0,4,6,9,-3,-1,16,0,-25,-3,-1,-3,2,29,2,1,17,3,4,-1,41,-8,2,-6,-3,-80,1,1,30,-5,-2,-5,1,8,4,1,-75,2,1,-3,-1,4,0,1,0,2,2,2,0,-20,6,-8,-2,-2,1,2,15,2,-7,-2,-2,-4,2,-3,1,3,6,-3,7,-1,1,0,-4,-2,-5,6,8,2,2,2,-5,1,1,-1,3,-1,-5,-2,1,0,-1,1,-10,3,1,2,-1,0,1,3,1,-2,-1,1,-11,-1,-1,0,1,-3,5,1,-1,9,1,2,2,3,-1,-2,-1,1,-2,2,2,0,3,3,-1,-4,1,1,-4,1,2,0,1,-1,-2,-13,-3,1,0,1,2,4,8,-1,-17,2,3,-1,7,5,0,3,-3,-1,5,-7,-4,4,-2,34,7},
+                                              {7,-7,-2,-3,-3,-3,-7,3,-1,-1,8,-7,11,-3,16,3,2,32,-3,1,2,0,-1,-7,5,-3,1,10,2,3,1,7,1,-11,1,-1,-5,-6,-3,-4,1,1,-1,4,-8,6,4,2,-1,-1,2,-1,12,-4,4,-4,-1,8,-4,2,3,1,1,1,-5,1,0,5,5,-5,-3,4,2,-2,2,1,-1,1,1,-1,4,4,4,2,2,-3,-12,17,0,2,-1,-1,-1,-1,4,-1,-2,-82,0,-9,0,-2,2,-3,-12,2,0,14,2,-1,-1,1,-3,3,-5,1,14,0,4,-13,-3,-3,-9,-1,6,8,3,-82,4,1,-1,0,4,-1,2,0,0,1,1,-8,-16,3,-7,2,-4,1,2,13,1,-1,0,-8,5,1,-5,1,4,9,-3,1,1,-2,-2,-1,-2,-2,-2,5,-2,2,3,-5,-2,-2,3,3,1,-3,-1,3,4,3,1,-6,4,2,3,2,-1,2,-2,-1,0,5,1,-16,-2,3,0,1,-4,3,2,2,6,1,0,2,1,-2,-1,-12,0,1,2,1,-3,3,1,1,-7,1,0,0,3,1,1,2,-3,-1,-9,1,0,-1,6,3,-1,6,-3,-17,0,-3,3,4,3,0,1,2,-3,5,3,-3,-3,0,31,5},
+                                              {4,-6,1,-1,-3,-2,-2,5,1,1,16,2,17,4,21,1,-1,-8,1,1,-2,-1,1,-3,7,-4,2,-79,4,-3,2,7,2,-4,1,-1,-12,-7,-2,-4,1,0,3,10,-15,3,2,4,-2,4,3,1,16,-5,3,-5,-3,6,-4,-1,3,2,-2,-2,-6,-1,2,1,5,-5,-2,5,-6,-4,3,1,-4,2,2,-2,3,9,2,2,-1,-5,-16,-68,-1,4,-2,-1,3,5,3,-5,1,18,3,27,1,-1,2,-1,-19,0,-3,22,2,0,2,4,-4,8,-10,2,17,1,2,-11,-5,-4,-9,-2,11,7,4,-74,7,1,-3,0,5,2,0,1,1,1,3,0,-18,6,-6,3,1,2,1,17,3,-4,-2,-2,2,3,-5,-2,2,10,-2,6,2,-4,1,-5,-1,-1,6,12,-2,2,1,25,-4,-1,1,0,1,-1,0,1,-5,-3,2,-23,3,3,4,3,-1,1,0,1,-1,-1,-3,-19,1,-1,1,1,-7,1,0,-3,11,-1,-3,0,1,-1,0,4,-1,-2,1,1,-2,3,1,3,-12,-1,0,2,1,3,-1,3,-2,-1,-13,1,2,-2,3,3,5,8,-1,-22,2,-1,-4,8,3,1,3,5,-3,14,3,-1,5,-2,30,6},
+                                              {4,-3,-1,-1,0,-2,-3,1,-7,1,-77,-2,10,2,-58,-2,1,-15,1,2,2,1,0,-3,1,1,1,11,4,-1,4,7,1,-13,2,-1,-9,-4,-2,3,5,-3,-2,5,-11,6,2,1,-3,2,0,2,10,-4,2,-1,-2,10,-1,2,2,1,-3,0,-4,-1,-1,0,4,-6,1,3,-1,-3,1,4,-1,2,1,-8,1,6,3,5,1,-2,-12,14,-1,4,-1,0,-1,-1,3,-4,-2,13,1,-17,-2,-2,2,-1,-15,1,-1,15,2,-2,-1,-1,-3,3,-9,-1,13,1,3,29,-6,-2,-9,1,1,3,2,12,4,-1,-2,1,0,-6,2,1,2,2,1,-1,28,1,-6,-3,-1,1,1,-76,5,-3,-2,-3,1,3,-2,-1,2,8,-4,2,0,-1,1,-2,-6,-2,2,8,-3,2,-1,-4,-1,1,-1,2,-1,-3,-1,1,3,2,1,-3,2,0,-1,1,3,1,0,3,-2,-1,1,-14,-4,1,1,-2,-3,7,1,-2,9,1,-2,2,2,-4,-1,-13,-2,1,2,2,-1,1,3,-7,-8,-1,-1,0,3,0,1,1,-2,-1,-11,4,1,-1,1,2,5,1,-2,-16,-3,-2,-2,5,6,0,3,5,-3,8,3,-7,-1,-2,-15,4},
+                                              {7,-11,-2,3,2,-2,0,1,-1,-1,13,2,16,0,30,0,1,37,2,2,-1,-2,2,-1,5,-6,1,17,1,-4,-1,7,-1,-15,3,-1,-10,-12,-4,-4,2,3,2,13,-26,1,-3,3,-2,5,4,4,12,-6,3,1,-9,13,-5,1,3,2,-4,-1,-10,1,-3,-2,6,-7,0,2,-2,-4,3,1,-2,-1,3,4,4,2,-3,4,3,0,-23,-67,2,2,1,-1,2,5,13,-5,-1,-68,3,-34,2,0,2,2,34,1,-2,29,4,-5,2,2,-2,4,-11,2,-70,3,3,-27,-6,-11,-16,1,1,5,1,19,3,-2,-5,1,2,3,-1,2,2,-1,0,1,32,7,-13,-2,-4,0,2,-68,5,-5,1,-3,-1,0,-6,0,4,11,-4,4,2,3,0,-2,0,3,6,10,1,-6,1,3,-2,1,2,-2,2,-1,3,0,3,1,0,-9,2,2,4,4,3,2,2,-1,-2,-2,-1,-19,1,-1,2,1,-9,6,3,4,11,-2,-1,2,1,-2,-13,2,-3,-2,2,1,2,4,-1,-1,-7,2,-3,1,3,1,1,4,-2,2,-17,-4,2,-5,1,6,1,2,-8,-23,4,-1,2,1,5,4,3,-3,-12,10,3,-1,3,1,-30,4},
+                                              {6,-3,-1,-3,-3,-3,-4,3,-2,2,14,1,12,5,13,-5,2,-10,-1,1,2,6,-1,-1,5,3,1,-86,-2,-4,2,9,2,-8,2,-2,-7,-8,-3,-4,-2,0,-7,5,-12,3,-1,2,-2,0,1,-5,14,-8,1,-4,-2,6,-2,2,1,2,-2,2,-3,4,-2,2,6,-4,-2,2,-2,-2,4,4,-1,1,3,-1,1,6,3,1,2,-1,-11,14,1,1,0,0,1,2,4,-5,-2,11,1,30,-2,-3,-4,1,-16,1,1,13,3,-1,1,4,-6,4,-9,-2,14,0,2,-6,-8,-7,-5,-1,1,3,3,13,7,-4,-3,1,1,2,0,4,1,2,1,0,35,3,-4,1,-4,3,1,-74,2,-3,-3,-3,6,1,-2,0,3,9,-3,0,1,0,0,-3,-2,-1,2,8,-3,1,5,23,-4,1,-1,1,3,-2,0,1,2,1,1,-7,2,2,3,4,-4,2,-1,-2,-2,-2,1,-14,0,2,-5,-1,-6,1,1,0,7,1,-1,-1,2,-2,-3,-6,1,1,5,-1,-1,3,-2,-8,-8,-1,0,-2,2,1,-1,2,1,1,-11,-1,3,0,1,1,4,-1,-5,-15,0,-5,-1,5,5,0,2,5,-1,7,1,-3,2,-3,-11,4},
+                                              {7,-11,2,5,-1,-2,-2,5,-2,2,-68,3,-82,4,-65,-1,2,-21,2,2,-2,-1,-2,-5,2,-5,1,16,3,-2,3,6,-2,-8,3,-2,-9,-7,-2,0,-1,3,1,5,30,3,-5,2,2,2,1,4,16,-6,4,4,-3,10,-6,3,-1,3,0,-1,-8,1,3,-1,5,-8,-4,6,1,-4,3,-1,-2,0,3,4,4,8,-1,-1,3,-1,-16,-72,0,3,1,-3,3,-1,4,-5,-3,18,4,-13,-2,-5,1,2,-17,2,-2,22,1,3,-4,1,-9,2,-10,-8,15,-3,3,28,-2,-3,-8,-1,5,-1,-1,20,6,1,-3,0,1,2,-2,1,1,1,1,2,-13,5,-6,-2,-3,1,-2,16,4,-5,-2,1,1,1,-3,0,1,8,-4,0,1,1,3,3,-2,1,7,13,2,1,-3,-15,-4,2,0,-1,2,-3,3,1,3,2,1,-14,3,2,3,3,0,2,1,2,-1,-1,-2,-25,2,-1,2,-1,-11,-6,2,2,8,1,-1,2,1,2,-4,-6,-1,0,5,-1,0,4,6,-1,-12,0,2,2,2,-1,-3,4,-3,-4,-15,0,4,0,-2,4,5,8,-6,-21,2,-9,-1,6,5,3,3,5,-5,10,1,-3,2,-6,-15,5},
+                                              {6,-6,13,1,-2,-2,-4,1,-3,-1,10,-1,-85,0,15,-2,2,38,-5,1,3,0,1,-5,7,1,1,12,1,-4,2,8,-1,-8,1,-2,-6,-7,-2,4,0,7,-2,5,32,1,11,3,-2,0,2,-1,13,-5,3,-5,-4,7,-4,1,2,2,-1,0,-3,-2,-1,1,6,-5,-2,5,-4,-3,3,1,1,0,3,-1,3,4,1,2,-1,-1,-9,15,-2,1,-1,0,-5,0,4,-4,-2,-72,1,-6,-3,-1,-2,9,-19,1,-1,13,2,-1,-1,2,-4,5,-8,-1,15,4,3,-12,-2,-5,-6,1,6,7,-2,11,5,-1,-3,-1,3,2,0,1,1,2,0,0,-13,-1,-6,-1,-1,1,-2,10,2,-3,-1,-4,3,1,-3,2,-2,14,-1,3,1,0,-3,2,-1,-2,-1,11,-3,-1,-2,-12,-2,-1,1,1,-1,-2,0,2,1,1,1,-6,3,3,-1,1,3,2,1,0,-2,-1,1,-19,-2,-1,-1,-1,-3,8,0,-1,8,2,-1,0,1,-2,-3,7,-2,1,2,1,-6,2,3,-3,-9,-2,3,-2,2,-1,0,5,-2,-2,-10,0,1,-1,2,3,-2,5,-2,-15,-1,0,-3,1,4,2,-1,8,-4,8,1,-4,-3,-1,-8,3},
+                                              {11,-3,-2,1,-2,-2,-2,4,0,-1,7,3,-55,1,17,3,3,-22,2,3,3,-1,-1,-4,11,-8,0,-48,1,-3,2,7,2,-3,1,-1,-2,-1,-2,-1,2,4,4,5,66,1,-11,5,-7,3,1,1,22,-4,6,1,-5,13,-3,4,10,4,-2,-2,-5,3,-1,2,10,3,0,4,-1,-2,4,0,1,3,4,4,2,8,-5,2,1,-2,-1,12,2,-2,2,0,4,1,11,-4,1,9,0,55,0,-2,3,1,58,3,0,17,5,3,2,21,-6,5,2,-1,-48,4,3,-21,-6,-4,-6,-1,8,4,5,11,9,3,-1,-2,4,3,2,4,2,2,1,0,-27,4,0,1,2,1,2,9,8,-6,2,-1,1,2,-7,0,9,-1,7,-1,1,3,-2,4,-2,2,6,13,-7,-1,1,35,-1,1,1,2,-3,0,1,4,4,3,2,-13,4,4,2,3,0,2,1,2,-1,-2,2,-21,-2,0,0,1,4,12,1,0,16,1,2,1,2,-1,-2,-3,1,-2,4,2,-2,5,-4,6,-9,-1,2,1,3,2,4,2,-2,-1,-6,-2,2,-2,0,3,7,7,-4,-25,2,2,-6,9,9,0,3,8,-3,11,-6,-2,5,1,-24,5},
+                                              {7,7,-27,-8,-13,2,-1,3,-5,-4,-3,0,-8,8,-14,-2,-6,1,-4,-8,-9,-22,-12,0,22,-15,-3,-9,-5,-2,-5,-15,-6,16,10,-12,-11,-19,-1,-4,-1,4,-2,33,-4,-4,-7,-6,3,-2,-4,-30,32,-16,-11,2,-30,7,-2,-9,-17,-9,4,-5,-40,-4,-2,-41,-20,-16,1,-23,0,-1,7,-26,-6,-17,12,0,-9,-18,-18,-6,-5,-6,-13,-7,-10,-33,-5,-8,-7,-26,-10,-29,-3,-9,-7,0,-24,-3,0,-11,-4,-10,-7,-3,-15,-5,-1,19,-2,15,-29,-2,-8,2,-5,-3,3,7,-7,-8,-17,-35,1,-7,41,-2,8,-5,-24,-2,-10,-8,-10,5,9,0,1,-1,-15,-5,7,-4,-7,-7,12,13,-4,-4,16,-6,-24,-6,-14,15,-25,-11,5,-6,0,-23,-4,-11,3,5,-10,-18,-6,-6,-5,-6,-6,0,-4,-8,-20,-5,-26,-11,-6,21,7,12,11,-21,-3,-6,-12,-4,-10,0,-6,-39,-3,-4,-2,-7,-7,-17,-16,-2,5,-9,-5,-9,-11,-1,-9,-1,-1,-7,12,-6,2,-14,5,15,10,-9,5,-39,45,-4,-6,-7,-1,2,14,-3,-4,3,1,-4,-23,-32,9,-9,-4,0,10,-17,17,-1,-9,-7,-13,9,27,-5,3,1,-4,-8},
+                                              {5,9,-19,-6,-1,2,-25,1,-3,3,-8,-24,-10,3,-19,-2,-9,-3,-2,-7,-8,-26,-5,-30,-12,-10,7,-11,-2,-17,7,-19,-6,-27,-2,-3,-6,-14,3,-4,-27,16,-3,-26,0,-2,5,-5,-2,0,-8,-34,3,9,-14,1,-27,-10,7,-11,-1,-3,1,-5,5,-3,-2,18,-27,-21,3,13,-8,-5,-5,-34,-6,-15,-8,0,-18,-26,36,-9,11,-4,-13,-9,2,-31,-7,-7,-4,10,9,-18,2,-9,-10,1,-4,-2,-3,-21,-3,-10,-4,3,-14,-1,2,-6,-3,-14,-25,-3,-9,3,-8,2,-22,6,6,-5,-17,-47,3,-8,-16,-2,-12,6,-28,-1,-14,-7,-11,-5,-7,-17,1,2,-13,-37,10,-5,-4,-9,15,9,-2,-27,1,-10,15,-10,-27,-8,-2,12,-7,-7,-3,-10,-3,-5,6,6,-7,-14,-7,-6,1,12,-9,2,-7,-1,2,-6,-16,-18,-5,-11,-5,-6,19,-2,-3,-10,-2,1,-10,-29,-8,-32,-3,-10,1,-8,4,-19,49,-1,6,-8,-4,-10,-11,-2,-12,2,1,-8,15,-3,3,-6,3,14,-3,-4,6,-2,-9,-3,-11,-1,5,2,-13,-5,-5,3,5,14,17,-25,7,-10,-5,2,-19,16,-9,-1,-7,0,-12,8,-11,-3,4,-3,-1,-7},
+                                              {-39,3,-22,34,-2,0,-1,-2,-3,-4,-3,-4,-9,-4,-9,-5,-7,-5,-5,10,-7,-31,-11,0,-30,-13,-4,-9,-19,-4,-6,19,7,-10,-3,-2,-4,-16,2,9,-6,3,-4,-33,-3,-1,7,-4,-4,-4,-8,-36,-3,4,-7,0,-5,5,-1,-8,1,-9,5,3,9,-23,-6,-35,20,-14,2,11,5,-3,-6,-8,6,-21,-8,0,-10,-20,23,-10,-5,-11,-16,-4,-8,19,-4,-7,-7,-7,8,-25,-3,-7,-14,1,-3,-2,3,-8,-6,-10,8,-7,42,-2,-4,-34,1,-24,19,-6,-5,2,-7,0,-6,9,-5,11,-19,15,-4,-6,-4,-3,6,-5,-16,-3,-10,-5,-9,-2,-6,-1,-1,3,21,-3,-30,-6,-4,-6,11,-34,-9,1,-45,-12,-12,-5,-11,-7,-5,-51,-8,-16,-4,-39,-4,-6,3,5,-7,-20,-3,-7,-31,-4,-6,7,-6,-2,0,5,53,-11,-4,-25,-5,-7,10,-6,-3,-7,-9,17,-5,4,-8,-2,-8,-7,-2,-8,-4,-1,-12,-4,7,-5,-22,-6,-10,-4,-7,5,-1,-6,13,9,4,-13,3,17,-4,-7,4,-2,-9,-6,-14,-8,-4,2,-10,-3,27,3,-17,-5,-21,-27,-10,2,-7,3,-2,-20,-4,-8,-7,8,-11,-18,12,-4,1,3,-4,6},
+                                              {4,-26,-23,-13,-3,0,1,4,-13,-2,-6,1,-10,-12,-12,1,-6,-2,-1,-9,-9,-28,-8,-1,26,-17,-5,-11,-23,1,-12,-27,-8,-20,-4,-3,-3,-10,0,1,2,7,-2,26,-2,0,-7,-11,-1,-6,6,-30,-4,-35,-4,0,-6,-23,-20,-6,2,-6,6,-9,-30,-1,-2,14,-30,-14,-16,12,-3,4,-3,30,-9,-29,-7,-21,33,-14,-32,8,-8,-5,-15,-8,1,-30,-8,-8,-4,-1,11,6,1,-10,-9,3,-4,-3,2,-20,-2,-9,-8,1,-8,-2,-1,-5,-17,16,-16,-5,-9,2,-7,-2,-10,-19,-12,-9,21,12,15,-10,-15,-5,10,-7,13,-22,-11,-2,-10,-5,-3,2,-3,0,-9,4,7,-6,-3,-7,-8,15,-2,-1,5,1,-1,-4,-17,-7,8,-12,-7,-6,-6,20,-21,-7,0,9,25,-15,2,-4,2,-8,-3,2,-4,-4,3,-7,-6,-19,-4,-21,-5,-7,-60,-2,-3,-7,-8,-6,-7,1,-5,-14,13,-8,-4,9,3,-22,14,3,6,-9,-1,-4,-10,13,-3,-5,4,-7,-7,-7,2,-10,-45,-24,1,-6,5,-3,-12,-3,-10,-4,-4,-4,-16,-9,1,-1,3,-5,-24,32,7,-10,13,1,12,-14,-7,2,-5,2,-12,-1,2,-28,6,2,2,-5},
+                                              {24,-37,10,-12,-5,-54,-4,-34,-3,1,-6,-4,-10,0,-16,-7,-7,-5,-3,-10,0,58,-9,-5,-35,6,-6,-10,13,-1,-9,17,-7,20,-8,-6,-4,-26,-47,-2,26,-25,-7,21,-4,-32,-12,2,-5,-3,-9,37,-15,11,-8,-1,29,15,-11,-9,0,-8,-72,-6,21,-4,-20,39,22,-28,-5,-53,11,-10,-8,-23,-13,32,-10,-2,-5,79,-43,-9,-8,-8,-18,-6,-8,22,-11,-6,-6,2,-32,14,1,-8,-16,-1,-5,-5,2,28,-6,8,-9,-7,-12,-3,-2,-39,3,-22,-37,-6,-10,-3,9,1,-9,-20,-31,-10,19,-41,-4,-9,-11,-4,-35,-8,6,-2,-12,-6,7,-2,-9,-1,-5,-8,-34,3,-45,-1,-4,-7,-21,-47,-2,0,-29,-9,-10,-8,-24,-1,1,10,-14,-8,17,5,-6,-10,-14,14,1,24,13,-5,-7,-7,-6,-62,-7,-7,-2,-8,-4,28,-6,21,-9,-8,11,-3,0,-9,-9,-11,-10,-13,-10,-7,-5,-6,-1,-5,-4,33,-17,-5,13,11,-5,-8,12,2,63,1,-40,6,-24,-7,-4,61,-1,-42,14,-8,-58,-1,-3,-2,-16,-5,-6,-5,12,3,-6,-69,-8,-7,15,27,-21,-3,-6,3,-55,17,-5,-2,-7,7,39,14,18,-3,0,-5,2,6},
+                                              {-30,-13,-26,-6,0,-2,1,1,-3,0,-5,-2,-7,-31,-6,-29,-10,-2,-1,-6,-9,11,-9,-3,-26,-20,-7,-8,-10,3,-11,-29,-5,-13,-7,2,-15,-11,5,-33,-8,5,-26,-26,-3,-3,3,-14,-5,-2,-2,-35,-7,6,32,-4,-7,-6,-1,-11,6,-6,3,-5,9,-6,-1,-25,-26,-11,2,10,-5,5,-9,31,-7,-20,-12,1,-10,-6,20,-6,-9,-7,-9,-4,-1,-12,-9,-7,-3,12,9,4,1,-6,-12,2,-1,1,-5,-12,-4,-10,-6,4,-11,-2,-3,-11,-3,-17,24,-2,-4,4,-8,1,26,-23,2,-7,21,14,-18,-7,-12,-14,8,-9,-27,-5,-12,8,-10,-10,-8,2,-4,10,19,5,9,19,-1,-4,-11,8,-1,3,-7,-8,-11,-9,-6,-9,6,-5,-10,-8,-1,14,-4,-4,8,14,-8,-12,-13,-8,3,-7,11,4,-8,-1,4,-4,-11,-15,6,-38,-8,-9,8,-4,-9,-9,-7,9,8,2,-8,-11,-4,-11,-16,-3,-5,-24,-31,1,5,-7,-3,11,-10,1,-9,0,3,-8,-8,-3,4,-9,7,-36,-3,-5,4,3,-15,-1,-27,-8,-42,-2,-12,-3,-10,-1,4,-9,-23,32,11,-16,-3,6,1,-15,-1,1,10,2,-12,-33,-42,-1,1,5,2,-6},
+                                              {11,4,18,-11,-5,-1,-1,2,1,5,-4,-1,-8,-33,-7,3,7,-2,-2,-8,-8,-15,-6,3,22,-1,-9,-7,18,-4,-12,20,-6,-25,-4,-4,-5,10,-1,-3,1,-3,-2,2,-3,-1,-6,0,-45,0,-5,46,-7,-17,-10,3,1,7,-11,9,-19,-5,3,-6,-40,-5,-5,-10,24,13,3,13,-5,-6,-6,-29,-11,-10,-9,-6,-6,-19,-32,-8,-10,-4,-21,-3,-7,17,6,-2,-4,-13,15,8,6,-7,51,0,-3,-54,1,0,-5,-9,-6,-5,-11,-5,-20,-36,10,16,-28,-9,-4,-44,-5,-5,-2,7,-1,-7,-17,35,-1,-7,-9,-1,8,-10,31,-3,12,-11,-10,-2,-6,-4,-2,5,-25,-6,-32,-7,-21,-4,-21,-33,-5,-5,4,-6,-11,8,-11,13,-10,7,-6,-8,-6,-1,-4,-10,2,-23,-6,-11,-8,-4,9,-10,-9,5,6,-1,-6,-8,-15,-17,-8,-7,-7,-7,8,-4,-5,2,-7,-47,-12,6,6,-21,-6,10,-4,-4,6,1,-14,-1,-33,-8,-5,-10,-10,-3,-6,-6,2,-7,-14,-7,-3,-20,13,22,-9,-7,-1,-3,-10,-2,35,-7,-2,-29,-13,-2,-14,1,15,-11,-21,-33,-9,-4,-8,-9,8,-16,-8,-5,-10,5,-7,7,14,-4,6,-25,-1,10},
+                                              {0,8,42,-13,-2,2,1,3,3,-12,-5,-3,-9,18,-9,4,-5,-5,-10,-10,-8,-19,5,-1,-25,10,-4,-8,-17,5,-7,-29,-8,-20,-6,-3,7,14,3,-2,-24,-20,1,-4,-3,-2,1,4,-4,-1,-9,-29,-3,8,-9,-3,-15,2,5,-8,7,6,3,-9,5,-1,-2,-2,-22,15,8,6,-1,-35,-8,-31,-10,-20,-12,-1,-14,-7,-19,-9,-3,-4,-21,-7,1,-19,-6,-7,-6,-2,8,2,7,-6,-10,2,0,-1,-4,-13,-5,-10,-7,1,-10,-1,2,-8,-15,-15,-22,-3,-6,-2,-9,3,-18,6,5,-10,-15,1,4,-4,-13,2,-17,-1,-19,-2,-10,-8,-11,-10,-10,-4,-2,7,-11,5,8,-5,-3,-6,-12,18,-1,-3,4,-10,4,-9,72,-7,-25,16,-12,-6,-3,2,-4,-4,6,-30,-9,-15,-5,-5,-1,-2,-5,3,-6,1,-1,-9,-5,-19,-5,-34,-10,-12,-60,1,-6,-7,6,-3,-9,-2,-5,-5,-3,-6,1,-6,-23,-21,11,-1,-41,-9,-3,-8,-10,-2,-8,1,5,-7,-9,-6,-29,-16,-1,9,-4,12,1,2,-13,8,-14,8,-1,0,-18,-3,-2,3,-3,-2,20,-19,7,-9,-5,0,-3,19,11,-2,-7,4,-11,6,-43,-2,-15,-3,2,-4},
+                                              {-27,6,-1,-6,-2,1,0,-2,-1,-7,5,-4,10,-3,13,-7,-9,-18,-2,-7,-10,-24,-8,0,-30,7,-8,11,5,1,-11,-14,-6,18,-4,-1,14,11,4,4,-17,2,-4,-43,-35,2,-6,-2,-2,-1,-7,-27,-50,5,-4,-5,-3,-19,-2,-8,-10,-6,4,-4,14,-5,-1,-20,-35,11,1,-25,1,-5,-10,-16,-7,-18,-10,-5,-9,-14,-4,-10,-9,-2,68,5,0,-18,-8,-5,-5,-11,-21,6,4,6,-14,-42,-3,-2,3,-9,-12,-10,-5,-30,-14,-5,-4,19,0,-20,19,-4,6,-2,-9,-15,1,7,11,-7,-18,-17,-3,9,-13,2,6,-8,-24,-4,-12,-5,-12,-7,-7,-2,-10,1,20,-4,11,-3,-2,8,-15,12,-3,-1,-6,-10,4,-6,-12,-12,1,-2,-11,-8,-3,-12,-2,-5,1,-19,-4,-12,-3,-5,-5,-10,-5,-3,-3,-1,-3,-8,-23,-21,-3,24,-10,-9,10,-6,0,-6,-6,-4,-4,4,-5,44,-7,-5,0,-9,3,27,-15,-4,-31,-5,-5,-7,-11,-5,-7,-5,4,-6,-9,-4,4,-11,1,16,11,-5,0,-3,-9,-2,-16,-5,-6,0,17,-4,-6,3,2,-8,-21,-30,8,24,-9,1,7,-18,-13,-4,-7,-9,-11,-18,-43,-3,-3,2,-25,-7},
+                                              {-23,-1,-16,-7,-8,-1,-5,-14,-4,-2,2,-5,2,12,4,-5,2,-8,-7,3,4,32,-3,-4,13,2,0,2,-2,-13,-2,12,3,16,5,-9,3,3,-12,4,7,-22,-8,6,-10,-18,0,-4,4,-15,-1,2,-4,-7,-4,-2,11,0,1,3,-7,0,-8,3,-25,-7,-12,15,24,7,-4,-22,4,-1,3,-19,0,11,3,-6,-8,-20,10,-5,1,-10,-20,4,-11,21,5,-4,-5,-14,-17,-14,3,3,-9,-6,-10,-9,-4,11,-9,6,4,-2,-14,-4,-8,-7,-6,10,11,-12,1,-6,4,-8,-3,-4,2,5,9,12,-16,4,-5,-7,-6,2,-8,-8,3,1,-1,2,4,-7,-6,0,12,-2,-29,0,-11,4,6,-27,-7,-6,2,-2,-6,5,-26,1,0,-8,-1,-10,0,-11,-10,-13,8,-13,-14,6,4,-10,-4,3,3,-13,6,-6,-8,2,-23,8,3,24,2,1,10,-11,-6,1,-2,-6,-2,-4,2,15,-4,4,-6,3,4,8,-14,-6,-25,3,-9,-2,7,-1,2,-3,-13,4,6,5,-4,-12,-9,-42,7,2,-10,-8,-9,-2,19,3,-6,-3,6,-11,8,-13,9,4,4,14,-11,-3,2,4,4,7,10,-9,1,8,24,-5,-2,-8,-2,-5,-7,0}};
 
-alignas(32) int8_t outputWeights[256] = {21,12,12,9,8,-9,9,13,9,-5,-9,10,-16,-5,-15,7,-18,11,11,-18,-17,-12,-12,10,-35,9,-11,-17,9,8,-13,-13,-17,-38,-16,11,-7,-15,16,-6,-13,9,9,-7,12,-6,-26,13,-11,6,-12,10,-9,10,12,-6,-17,8,-11,-17,-9,-11,11,-16,20,12,15,-14,-36,-28,-7,36,7,-14,-16,12,-19,-20,-17,9,14,9,8,-11,-13,10,10,-15,9,-28,-16,-10,9,12,12,20,6,-16,14,7,12,13,-4,-23,15,-14,-17,-15,13,9,11,14,7,-10,-36,14,-18,12,-12,10,7,8,-7,-18,-11,-7,8,-16,11,9,19,-12,10,11,-13,-12,-12,-15,-16,10,11,6,-10,-10,40,-10,11,-16,-29,13,11,9,-7,-12,-11,-16,8,-9,-7,-7,-18,14,-6,-8,9,14,5,8,7,-10,-5,8,-11,-14,-12,10,-9,11,10,-16,-12,-15,-11,-24,-15,-17,8,10,7,-11,-12,-11,-13,-7,-18,-9,6,-15,10,-12,-6,9,10,8,25,-20,11,-12,-16,5,-5,-33,14,-18,-16,-16,10,10,-5,14,-7,-11,15,10,14,-6,-15,-11,-13,11,-13,5,-7,11,-6,-12,-36,-34,9,12,-13,6,-7,-9,-6,9,-12,-6,6,9,9,10,10,12,11,-8};
+alignas(32) int16_t hiddenBiases[256] = {-71,-53,-79,-38,-42,-40,-48,-37,-40,-13,-25,-38,-57,-44,-72,-46,-38,-41,-36,-48,-47,-58,-62,-45,-75,-33,-36,-55,-38,-51,-60,-43,-40,-59,-39,-36,-10,-41,-44,-34,-52,-53,-43,-36,-69,-61,-28,-39,-49,-42,-39,-125,-53,-25,-42,-6,-46,-32,-37,-38,-42,-50,-64,-34,-67,-59,-46,-42,-62,-57,-17,-72,2,-50,-44,-103,-51,-98,-58,-32,-55,-73,-55,-58,-58,-36,-80,-41,-33,-48,-35,-52,-37,-47,-23,-42,0,-33,-64,-57,-65,-69,-5,-57,-65,-61,-42,-52,-46,-34,-35,-105,-39,-42,-72,-49,-57,-55,-45,-34,-22,-25,-37,-49,-41,-60,-40,-39,-48,-35,-44,-35,-82,-40,-62,-36,-53,-41,-41,-27,-41,17,-41,-38,-83,-6,-37,-40,-46,-51,-28,-40,-49,-62,-48,-37,-69,-22,-48,-40,-56,-74,-2,-54,-55,-70,9,-32,-37,-84,-11,-44,-49,-35,-33,-67,-25,-35,-33,-40,-70,-92,-40,-49,-43,-63,-49,-33,-35,-63,-42,-57,-60,-32,-50,-72,-27,-38,-34,-33,-25,-40,-52,-39,-64,-52,-54,-55,-54,2,7,-20,-41,-49,-26,-40,-26,-67,-33,-61,-1,-31,-39,-64,-49,-9,-52,-31,-41,-38,-36,-31,-14,-61,-1,-38,-59,-69,-12,-38,-30,4,-46,-40,-10,-35,-34,6,-20,-27,-60,-52,-28,-37,-44,-16};
+#endif
 
-float outputBias = -0.0376901775598526f;
+alignas(32) int8_t outputWeights[256] = {21,12,12,9,8,-9,9,13,-18,11,11,-18,-17,-12,-12,10,9,-5,-9,10,-16,-5,-15,7,-35,9,-11,-17,9,8,-13,-13,-17,-38,-16,11,-7,-15,16,-6,-11,6,-12,10,-9,10,12,-6,-13,9,9,-7,12,-6,-26,13,-17,8,-11,-17,-9,-11,11,-16,20,12,15,-14,-36,-28,-7,36,14,9,8,-11,-13,10,10,-15,7,-14,-16,12,-19,-20,-17,9,9,-28,-16,-10,9,12,12,20,6,-16,14,7,12,13,-4,-23,7,-10,-36,14,-18,12,-12,10,15,-14,-17,-15,13,9,11,14,7,8,-7,-18,-11,-7,8,-16,11,9,19,-12,10,11,-13,-12,40,-10,11,-16,-29,13,11,9,-12,-15,-16,10,11,6,-10,-10,-7,-12,-11,-16,8,-9,-7,-7,-18,14,-6,-8,9,14,5,8,-9,11,10,-16,-12,-15,-11,-24,7,-10,-5,8,-11,-14,-12,10,-15,-17,8,10,7,-11,-12,-11,-13,-7,-18,-9,6,-15,10,-12,-16,5,-5,-33,14,-18,-16,-16,-6,9,10,8,25,-20,11,-12,10,10,-5,14,-7,-11,15,10,14,-6,-15,-11,-13,11,-13,5,-13,6,-7,-9,-6,9,-12,-6,-7,11,-6,-12,-36,-34,9,12,6,9,9,10,10,12,11,-8};
+
+const Network defaultNetwork = {256, 0, &hiddenWeights[0][0], hiddenBiases, NULL, NULL, outputWeights,
+                                -0.0376901775598526f, NULL, NULL, NULL, 0};
@@ -3,12 +3,18 @@
 
 #include <stdint.h>
 
-extern int16_t hiddenWeights[190][256];
+#ifdef INT8_HIDDEN_WEIGHTS
+// The first layer is stored at half scale (63.5 instead of 127) so that the [-2, 2] clipped weights fit in an int8.
+typedef int8_t HiddenWeight;
+#else
+typedef int16_t HiddenWeight;
+#endif
+
+extern HiddenWeight hiddenWeights[190][256];
 
 extern int16_t hiddenBiases[256];
 
+// Within every block of 32 neurons the middle two groups of 8 are swapped, matching the output of applyClippedReLU
 extern int8_t outputWeights[256];
 
-extern float outputBias;
-
 #endif //UTTT2_PARAMETERS_H
@@ -0,0 +1,49 @@
+#include <stdio.h>
+#include <math.h>
+#include "elo_tests.h"
+#include "../../src/arena/elo.h"
+#include "../test_util.h"
+
+
+void eloAndScoreAreInverses() {
+    myAssert(fabs(scoreToElo(0.5)) < 1e-9);
+    myAssert(fabs(scoreToElo(eloToScore(123.0)) - 123.0) < 1e-6);
+    myAssert(fabs(scoreToElo(0.75) + scoreToElo(0.25)) < 1e-9);
+    // 3:1 odds are 191 Elo
+    myAssert(fabs(scoreToElo(0.75) - 190.8) < 0.1);
+}
+
+
+void confidenceIntervalShrinksWithMoreGames() {
+    GameResults few = {60, 20, 20};
+    GameResults many = {600, 200, 200};
+    EloEstimate fewEstimate = estimateElo(&few);
+    EloEstimate manyEstimate = estimateElo(&many);
+    myAssert(fabs(fewEstimate.elo - manyEstimate.elo) < 1e-9);
+    myAssert(fewEstimate.lower < manyEstimate.lower && manyEstimate.lower < manyEstimate.elo);
+    myAssert(fewEstimate.upper > manyEstimate.upper && manyEstimate.upper > manyEstimate.elo);
+}
+
+
+void sprtDecidesClearResults() {
+    SPRT sprt;
+    initializeSPRT(&sprt, 0, 10, 0.05, 0.05);
+    GameResults equal = {20, 10, 20};
+    myAssert(testSPRT(&sprt, &equal) == SPRT_CONTINUE);
+    GameResults manyEqual = {4000, 2000, 4000};
+    myAssert(testSPRT(&sprt, &manyEqual) == SPRT_ACCEPT_H0);
+    GameResults muchBetter = {240, 60, 100};
+    myAssert(testSPRT(&sprt, &muchBetter) == SPRT_ACCEPT_H1);
+    GameResults noDraws = {200, 0, 0};
+    myAssert(testSPRT(&sprt, &noDraws) == SPRT_CONTINUE);
+}
+
+
+void runEloTests() {
+    printf("\teloAndScoreAreInverses...\n");
+    eloAndScoreAreInverses();
+    printf("\tconfidenceIntervalShrinksWithMoreGames...\n");
+    confidenceIntervalShrinksWithMoreGames();
+    printf("\tsprtDecidesClearResults...\n");
+    sprtDecidesClearResults();
+}
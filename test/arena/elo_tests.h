@@ -0,0 +1,6 @@
+#ifndef UTTT2_ELO_TESTS_H
+#define UTTT2_ELO_TESTS_H
+
+void runEloTests();
+
+#endif //UTTT2_ELO_TESTS_H
@@ -0,0 +1,80 @@
+#include <stdio.h>
+#include "engine_tests.h"
+#include "../../src/arena/engine.h"
+#include "../../src/arena/mcts_engine.h"
+#include "../../src/nn/network.h"
+#include "../test_util.h"
+#include "../nn/forward_tests.h"
+
+
+// Returns the amount of plies, fills moves with the moves of the game
+int playEngineGame(Engine* player1, Engine* player2, int simulations, Square moves[TOTAL_SMALL_SQUARES]) {
+    Board* referee = createBoard();
+    Engine* players[2] = {player1, player2};
+    resetEngine(player1);
+    resetEngine(player2);
+    SearchLimits limits = {0, simulations, 0, false};
+    Square previousMove = {9, 9};
+    while (referee->state.winner == NONE) {
+        previousMove = playEngineTurn(players[referee->state.currentPlayer], limits, previousMove);
+        myAssert(isLegalMove(referee, previousMove));
+        moves[referee->state.ply] = previousMove;
+        makePermanentMove(referee, previousMove);
+    }
+    int plies = referee->state.ply;
+    freeBoard(referee);
+    return plies;
+}
+
+
+void enginesWithDifferentConfigsPlayFullGames() {
+    Network* network = createRandomNetwork(128, 0, true);
+    EngineConfig puctConfig = {.name = "puct", .interface = &mctsEngine, .usePUCT = true, .evalCacheLog2Entries = 16,
+                               .network = network};
+    EngineConfig defaultConfig = {.name = "default", .interface = &mctsEngine, .network = &defaultNetwork};
+    Engine* puct = createEngine(&puctConfig);
+    Engine* standard = createEngine(&defaultConfig);
+    Square moves[TOTAL_SMALL_SQUARES];
+    int plies = playEngineGame(puct, standard, 300, moves);
+    plies += playEngineGame(standard, puct, 300, moves);
+    myAssert(puct->statistics.moves + standard->statistics.moves == plies);
+    myAssert(puct->statistics.simulations == 300L * puct->statistics.moves);
+    freeEngine(puct);
+    freeEngine(standard);
+    freeRandomNetwork(network);
+}
+
+
+// An engine that played a game before has to play the next one exactly like a new engine would, including one whose
+// eval cache still holds the positions of the last game
+void resetEngineStartsOver() {
+    Network* fastNetwork = createRandomNetwork(32, 0, false);
+    EngineConfig configs[] = {
+        {.name = "default", .interface = &mctsEngine, .network = &defaultNetwork},
+        {.name = "cached", .interface = &mctsEngine, .evalCacheLog2Entries = 16, .network = &defaultNetwork,
+         .fastNetwork = fastNetwork}
+    };
+    for (int i = 0; i < (int) (sizeof(configs) / sizeof(EngineConfig)); i++) {
+        Engine* player1 = createEngine(&configs[i]);
+        Engine* player2 = createEngine(&configs[i]);
+        Square firstMoves[TOTAL_SMALL_SQUARES];
+        int firstPlies = playEngineGame(player1, player2, 500, firstMoves);
+        Square secondMoves[TOTAL_SMALL_SQUARES];
+        int secondPlies = playEngineGame(player1, player2, 500, secondMoves);
+        myAssert(firstPlies == secondPlies);
+        for (int j = 0; j < firstPlies; j++) {
+            myAssert(squaresAreEqual(firstMoves[j], secondMoves[j]));
+        }
+        freeEngine(player1);
+        freeEngine(player2);
+    }
+    freeRandomNetwork(fastNetwork);
+}
+
+
+void runEngineTests() {
+    printf("\tenginesWithDifferentConfigsPlayFullGames...\n");
+    enginesWithDifferentConfigsPlayFullGames();
+    printf("\tresetEngineStartsOver...\n");
+    resetEngineStartsOver();
+}
@@ -0,0 +1,6 @@
+#ifndef UTTT2_ENGINE_TESTS_H
+#define UTTT2_ENGINE_TESTS_H
+
+void runEngineTests();
+
+#endif //UTTT2_ENGINE_TESTS_H
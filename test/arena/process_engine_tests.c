@@ -0,0 +1,85 @@
+#define _GNU_SOURCE  // readlink, PATH_MAX
+#include <stdio.h>
+#include <limits.h>
+#include <unistd.h>
+#include "process_engine_tests.h"
+#include "../../src/arena/engine.h"
+#include "../../src/arena/mcts_engine.h"
+#include "../../src/arena/process_engine.h"
+#include "../../src/misc/timer.h"
+#include "../../src/nn/network.h"
+#include "../test_util.h"
+
+
+// This very binary, started with "play", is the other program
+void processEnginePlaysAgainstSearch() {
+    char executable[PATH_MAX];
+    ssize_t length = readlink("/proc/self/exe", executable, sizeof(executable) - 1);
+    myAssert(length > 0);
+    executable[length] = '\0';
+    char command[PATH_MAX + 16];
+    snprintf(command, sizeof(command), "'%s' play 0.002", executable);
+    EngineConfig processConfig = {.name = "process", .interface = &processEngine, .command = command,
+                                  .moveTimeout = 1.0};
+    EngineConfig searchConfig = {.name = "search", .interface = &mctsEngine, .network = &defaultNetwork};
+    Engine* process = createEngine(&processConfig);
+    Engine* search = createEngine(&searchConfig);
+    for (int game = 0; game < 2; game++) {
+        Engine* players[2] = {game == 0? process : search, game == 0? search : process};
+        resetEngine(process);
+        resetEngine(search);
+        Board* referee = createBoard();
+        SearchLimits limits = {0, 200, 0, false};
+        Square previousMove = {9, 9};
+        while (referee->state.winner == NONE) {
+            previousMove = playEngineTurn(players[referee->state.currentPlayer], limits, previousMove);
+            myAssert(isLegalMove(referee, previousMove));
+            makePermanentMove(referee, previousMove);
+        }
+        freeBoard(referee);
+    }
+    myAssert(process->statistics.moves > 0 && process->statistics.slowestMove < 1.0);
+    freeEngine(process);
+    freeEngine(search);
+}
+
+
+Square playFirstMove(const char* command, double moveTimeout) {
+    EngineConfig config = {.name = command, .interface = &processEngine, .command = command,
+                           .moveTimeout = moveTimeout};
+    Engine* engine = createEngine(&config);
+    resetEngine(engine);
+    SearchLimits limits = {0.01, 0, 0, false};
+    Square firstMove = {9, 9};
+    Square move = playEngineTurn(engine, limits, firstMove);
+    freeEngine(engine);
+    return move;
+}
+
+
+// The first move gets ten times the timeout
+void silentProgramTimesOut() {
+    double start = getMonotonicTime();
+    Square move = playFirstMove("sleep 5", 0.02);
+    double elapsedTime = getMonotonicTime() - start;
+    myAssert(move.board == 9 && move.position == 9);
+    myAssert(elapsedTime >= 0.2 && elapsedTime < 1);
+}
+
+
+void programWithoutMoveForfeits() {
+    Square noMove = playFirstMove("true", 1.0);
+    myAssert(noMove.board == 9 && noMove.position == 9);
+    Square garbage = playFirstMove("echo pass", 1.0);
+    myAssert(garbage.board == 9 && garbage.position == 9);
+}
+
+
+void runProcessEngineTests() {
+    printf("\tprocessEnginePlaysAgainstSearch...\n");
+    processEnginePlaysAgainstSearch();
+    printf("\tsilentProgramTimesOut...\n");
+    silentProgramTimesOut();
+    printf("\tprogramWithoutMoveForfeits...\n");
+    programWithoutMoveForfeits();
+}
@@ -0,0 +1,6 @@
+#ifndef UTTT2_PROCESS_ENGINE_TESTS_H
+#define UTTT2_PROCESS_ENGINE_TESTS_H
+
+void runProcessEngineTests();
+
+#endif //UTTT2_PROCESS_ENGINE_TESTS_H
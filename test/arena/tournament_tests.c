@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <math.h>
+#include "tournament_tests.h"
+#include "../../src/arena/tournament.h"
+#include "../test_util.h"
+
+#define TEST_CHECKPOINT_FILENAME "/tmp/uttt2_tournament_tests.txt"
+
+const char* const testNames[] = {"weak", "middle", "strong", "extra"};
+
+
+void gauntletOnlyPairsTheFirstEngine() {
+    Tournament roundRobin;
+    Tournament gauntlet;
+    initializeTournament(&roundRobin, 4, testNames, ROUND_ROBIN, 3);
+    initializeTournament(&gauntlet, 4, testNames, GAUNTLET, 3);
+    myAssert(roundRobin.amountOfPairings == 6 && getAmountOfTasks(&roundRobin) == 18);
+    myAssert(gauntlet.amountOfPairings == 3 && getAmountOfTasks(&gauntlet) == 9);
+    for (int task = 0; task < getAmountOfTasks(&gauntlet); task++) {
+        myAssert(getTaskPairing(&gauntlet, task)->first == 0);
+    }
+    // Consecutive tasks belong to different pairings
+    myAssert(getTaskPairing(&roundRobin, 0) != getTaskPairing(&roundRobin, 1));
+    freeTournament(&roundRobin);
+    freeTournament(&gauntlet);
+}
+
+
+// Records the results every pair of each pairing would have on average, for engines 100 Elo apart
+void recordExpectedResults(Tournament* tournament) {
+    for (int task = 0; task < getAmountOfTasks(tournament); task++) {
+        Pairing* pairing = getTaskPairing(tournament, task);
+        double score = eloToScore(100.0 * (pairing->first - pairing->second));
+        int wins = (int) lround(100 * score);
+        GameResults results = {wins, 0, 100 - wins};
+        recordTaskResults(tournament, task, &results);
+    }
+}
+
+
+void ratingsMatchEloDifferences() {
+    Tournament tournament;
+    initializeTournament(&tournament, 3, testNames, ROUND_ROBIN, 20);
+    recordExpectedResults(&tournament);
+    EloEstimate ratings[3];
+    computeRatings(&tournament, ratings);
+    myAssert(fabs(ratings[0].elo + ratings[1].elo + ratings[2].elo) < 1e-3);
+    myAssert(fabs(ratings[1].elo - ratings[0].elo - 100) < 2 && fabs(ratings[2].elo - ratings[1].elo - 100) < 2);
+    for (int i = 0; i < 3; i++) {
+        myAssert(ratings[i].lower < ratings[i].elo && ratings[i].elo < ratings[i].upper);
+        myAssert(ratings[i].upper - ratings[i].lower < 50);
+    }
+    freeTournament(&tournament);
+}
+
+
+void perfectScoreKeepsRatingsFinite() {
+    Tournament tournament;
+    initializeTournament(&tournament, 2, testNames, ROUND_ROBIN, 10);
+    GameResults sweep = {2, 0, 0};
+    for (int task = 0; task < 10; task++) {
+        recordTaskResults(&tournament, task, &sweep);
+    }
+    EloEstimate ratings[2];
+    computeRatings(&tournament, ratings);
+    myAssert(isfinite(ratings[0].elo) && ratings[0].elo > 200 && ratings[0].elo < 1000);
+    freeTournament(&tournament);
+}
+
+
+void checkpointResumesTournament() {
+    const char* filename = TEST_CHECKPOINT_FILENAME;
+    remove(filename);
+    Tournament tournament;
+    initializeTournament(&tournament, 3, testNames, ROUND_ROBIN, 4);
+    myAssert(openCheckpoint(&tournament, filename));
+    GameResults results = {1, 1, 0};
+    recordTaskResults(&tournament, 0, &results);
+    recordTaskResults(&tournament, 7, &results);
+    freeTournament(&tournament);
+    // An interrupted write leaves half a line behind
+    FILE* file = fopen(filename, "a");
+    fprintf(file, "11 2");
+    fclose(file);
+
+    Tournament resumed;
+    initializeTournament(&resumed, 3, testNames, ROUND_ROBIN, 4);
+    myAssert(openCheckpoint(&resumed, filename));
+    for (int task = 0; task < getAmountOfTasks(&resumed); task++) {
+        myAssert(resumed.taskIsDone[task] == (task == 0 || task == 7));
+    }
+    myAssert(getTaskPairing(&resumed, 0)->results.wins == 1 && getTaskPairing(&resumed, 7)->results.draws == 1);
+    recordTaskResults(&resumed, 11, &results);
+    freeTournament(&resumed);
+
+    Tournament again;
+    initializeTournament(&again, 3, testNames, ROUND_ROBIN, 4);
+    myAssert(openCheckpoint(&again, filename));
+    myAssert(again.taskIsDone[11] && again.taskIsDone[0] && !again.taskIsDone[1]);
+    freeTournament(&again);
+
+    Tournament other;
+    initializeTournament(&other, 3, testNames, GAUNTLET, 4);
+    myAssert(!openCheckpoint(&other, filename));
+    freeTournament(&other);
+    remove(filename);
+}
+
+
+void runTournamentTests() {
+    printf("\tgauntletOnlyPairsTheFirstEngine...\n");
+    gauntletOnlyPairsTheFirstEngine();
+    printf("\tratingsMatchEloDifferences...\n");
+    ratingsMatchEloDifferences();
+    printf("\tperfectScoreKeepsRatingsFinite...\n");
+    perfectScoreKeepsRatingsFinite();
+    printf("\tcheckpointResumesTournament...\n");
+    checkpointResumesTournament();
+}
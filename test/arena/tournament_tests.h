@@ -0,0 +1,6 @@
+#ifndef UTTT2_TOURNAMENT_TESTS_H
+#define UTTT2_TOURNAMENT_TESTS_H
+
+void runTournamentTests();
+
+#endif //UTTT2_TOURNAMENT_TESTS_H
@@ -0,0 +1,59 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "dead_boards_tests.h"
+#include "../../src/board/dead_boards.h"
+#include "../test_util.h"
+
+
+bool lineIsOpen(uint16_t opponentSmallBoard) {
+    const uint16_t lines[8] = {0007, 0070, 0700, 0111, 0222, 0444, 0421, 0124};
+    for (int i = 0; i < 8; i++) {
+        if ((lines[i] & opponentSmallBoard) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+void winnabilityMatchesLines() {
+    for (uint16_t player1SmallBoard = 0; player1SmallBoard < 512; player1SmallBoard++) {
+        for (uint16_t player2SmallBoard = 0; player2SmallBoard < 512; player2SmallBoard++) {
+            if (player1SmallBoard & player2SmallBoard) {
+                continue;
+            }
+            uint8_t winnability = getSmallBoardWinnability(player1SmallBoard, player2SmallBoard);
+            myAssert(((winnability & WINNABLE_BY_P1) != 0) == lineIsOpen(player2SmallBoard));
+            myAssert(((winnability & WINNABLE_BY_P2) != 0) == lineIsOpen(player1SmallBoard));
+        }
+    }
+}
+
+
+// Once a game is decided, every continuation has to end with that result
+void forcedWinnerHoldsForRandomGames() {
+    srand(13);
+    int decidedEarly = 0;
+    for (int game = 0; game < 2000; game++) {
+        Board* board = createBoard();
+        Winner forcedWinner = NONE;
+        while (board->state.winner == NONE) {
+            Winner winner = getForcedWinner(&board->state);
+            myAssert(forcedWinner == NONE || winner == forcedWinner);
+            forcedWinner = winner;
+            playRandomMoves(board, 1);
+        }
+        myAssert(forcedWinner == NONE || board->state.winner == forcedWinner);
+        decidedEarly += forcedWinner != NONE;
+        freeBoard(board);
+    }
+    myAssert(decidedEarly > 0);
+}
+
+
+void runDeadBoardsTests() {
+    printf("\twinnabilityMatchesLines...\n");
+    winnabilityMatchesLines();
+    printf("\tforcedWinnerHoldsForRandomGames...\n");
+    forcedWinnerHoldsForRandomGames();
+}
@@ -0,0 +1,6 @@
+#ifndef UTTT2_DEAD_BOARDS_TESTS_H
+#define UTTT2_DEAD_BOARDS_TESTS_H
+
+void runDeadBoardsTests();
+
+#endif //UTTT2_DEAD_BOARDS_TESTS_H
@@ -0,0 +1,104 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "symmetry_tests.h"
+#include "../../src/board/symmetry.h"
+#include "../test_util.h"
+
+
+bool statesAreEqual(const State* state1, const State* state2) {
+    return state1->player1.marks == state2->player1.marks && state1->player2.marks == state2->player2.marks
+           && state1->player1.bigBoard == state2->player1.bigBoard && state1->player2.bigBoard == state2->player2.bigBoard
+           && state1->currentPlayer == state2->currentPlayer && state1->currentBoard == state2->currentBoard
+           && state1->winner == state2->winner && state1->ply == state2->ply;
+}
+
+
+void transformsAreDistinctPermutations() {
+    for (int t = 0; t < SYMMETRIES; t++) {
+        uint16_t seen = 0;
+        for (uint8_t i = 0; i < 9; i++) {
+            seen |= 1 << transformIndex(i, t);
+        }
+        myAssert(seen == 511);
+        myAssert(transformIndex(4, t) == 4);
+        myAssert(transformIndex(ANY_BOARD, t) == ANY_BOARD);
+        for (int other = 0; other < t; other++) {
+            bool differs = false;
+            for (uint8_t i = 0; i < 9; i++) {
+                differs |= transformIndex(i, t) != transformIndex(i, other);
+            }
+            myAssert(differs);
+        }
+        for (uint8_t i = 0; i < 9; i++) {
+            myAssert(transformIndex(transformIndex(i, t), inverseTransform(t)) == i);
+        }
+    }
+    for (uint8_t i = 0; i < 9; i++) {
+        myAssert(transformIndex(i, IDENTITY_TRANSFORM) == i);
+    }
+}
+
+
+// Playing the transformed moves from the empty board has to give the transformed position, with the same legal moves
+void transformedGamesMatchTransformedStates() {
+    srand(11);
+    for (int game = 0; game < 50; game++) {
+        int t = game % SYMMETRIES;
+        Board* board = createBoard();
+        Board* transformedBoard = createBoard();
+        while (board->state.winner == NONE) {
+            State expected = transformState(&board->state, t);
+            myAssert(statesAreEqual(&transformedBoard->state, &expected));
+            Square moves[TOTAL_SMALL_SQUARES];
+            Square transformedMoves[TOTAL_SMALL_SQUARES];
+            int8_t amountOfMoves = generateMoves(board, moves);
+            myAssert(generateMoves(transformedBoard, transformedMoves) == amountOfMoves);
+            __uint128_t legal = 0;
+            __uint128_t transformedLegal = 0;
+            for (int i = 0; i < amountOfMoves; i++) {
+                Square transformed = transformSquare(moves[i], t);
+                legal |= (__uint128_t) 1 << (9*transformed.board + transformed.position);
+                transformedLegal |= (__uint128_t) 1 << (9*transformedMoves[i].board + transformedMoves[i].position);
+            }
+            myAssert(legal == transformedLegal);
+            Square move = moves[rand() % amountOfMoves];
+            makePermanentMove(board, move);
+            makePermanentMove(transformedBoard, transformSquare(move, t));
+        }
+        myAssert(board->state.winner == transformedBoard->state.winner);
+        freeBoard(board);
+        freeBoard(transformedBoard);
+    }
+}
+
+
+void symmetricPositionsShareCanonicalKey() {
+    srand(12);
+    for (int i = 0; i < 1000; i++) {
+        Board* board = createBoard();
+        playRandomMoves(board, rand() % 60);
+        int canonicalTransform;
+        uint64_t key = canonicalKey(&board->state, &canonicalTransform);
+        State canonical = transformState(&board->state, canonicalTransform);
+        myAssert(key == hashState(&canonical));
+        for (int t = 0; t < SYMMETRIES; t++) {
+            State transformed = transformState(&board->state, t);
+            int transform;
+            myAssert(canonicalKey(&transformed, &transform) == key);
+            State transformedCanonical = transformState(&transformed, transform);
+            myAssert(statesAreEqual(&transformedCanonical, &canonical));
+        }
+        freeBoard(board);
+    }
+}
+
+
+void runSymmetryTests() {
+    printf("\ttransformsAreDistinctPermutations...\n");
+    transformsAreDistinctPermutations();
+    printf("\ttransformedGamesMatchTransformedStates...\n");
+    transformedGamesMatchTransformedStates();
+    printf("\tsymmetricPositionsShareCanonicalKey...\n");
+    symmetricPositionsShareCanonicalKey();
+}
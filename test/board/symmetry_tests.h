@@ -0,0 +1,6 @@
+#ifndef UTTT2_SYMMETRY_TESTS_H
+#define UTTT2_SYMMETRY_TESTS_H
+
+void runSymmetryTests();
+
+#endif //UTTT2_SYMMETRY_TESTS_H
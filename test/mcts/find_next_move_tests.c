@@ -1,8 +1,11 @@
 #include <stdio.h>
+#include <string.h>
 #include <sys/time.h>
 #include "find_next_move_tests.h"
 #include "../../src/mcts/find_next_move.h"
+#include "../../src/misc/timer.h"
 #include "../test_util.h"
+#include "../nn/forward_tests.h"
 
 
 void findNextMoveDoesNotChangeBoard() {
@@ -51,9 +54,124 @@ void findNextMoveUsesAsMuchTimeAsWasGiven() {
 }
 
 
+void searchPlaysFullGames(const Network* network, const Network* fastNetwork, bool usePUCT) {
+    for (int game = 0; game < 5; game++) {
+        Board* board = createBoard();
+        board->network = network;
+        board->fastNetwork = fastNetwork;
+        board->usePUCT = usePUCT;
+        int rootIndex = createMCTSRootNode(board);
+        while (board->state.winner == NONE) {
+            findNextMove(board, rootIndex, 0.002);
+            Square nextMove = getMostPromisingMove(board, &board->nodes[rootIndex]);
+            rootIndex = updateRoot(&board->nodes[rootIndex], board, nextMove);
+            makePermanentMove(board, nextMove);
+        }
+        freeBoard(board);
+    }
+}
+
+
+void puctSearchPlaysFullGames() {
+    Network* network = createRandomNetwork(128, 0, true);
+    searchPlaysFullGames(network, NULL, true);
+    freeRandomNetwork(network);
+}
+
+
+void cascadedSearchPlaysFullGames() {
+    Network* fastNetwork = createRandomNetwork(32, 0, false);
+    searchPlaysFullGames(&defaultNetwork, fastNetwork, false);
+    freeRandomNetwork(fastNetwork);
+}
+
+
+// After the enemy's reply, the root can be a child that only has the eval of the fast network
+void singleSimulationExpandsFastNetworkRoot() {
+    Network* fastNetwork = createRandomNetwork(32, 0, false);
+    Board* board = createBoard();
+    board->fastNetwork = fastNetwork;
+    int rootIndex = createMCTSRootNode(board);
+    SearchLimits limits = {.simulations = 1};
+    while (board->state.winner == NONE) {
+        myAssert(findNextMoveWithLimits(board, rootIndex, limits) == 1);
+        MCTSNode* root = &board->nodes[rootIndex];
+        myAssert(root->numChildren > 0);
+        Square nextMove = getMostPromisingMove(board, root);
+        rootIndex = updateRoot(root, board, nextMove);
+        makePermanentMove(board, nextMove);
+    }
+    freeBoard(board);
+    freeRandomNetwork(fastNetwork);
+}
+
+
+// Two boards playing the same game with the same limits have to build the same trees and pick the same moves
+void fixedSimulationSearchIsDeterministic() {
+    Board* board1 = createBoard();
+    Board* board2 = createBoard();
+    int rootIndex1 = createMCTSRootNode(board1);
+    int rootIndex2 = createMCTSRootNode(board2);
+    SearchLimits limits = {0, 2000, 0, false};
+    while (board1->state.winner == NONE) {
+        myAssert(findNextMoveWithLimits(board1, rootIndex1, limits) == 2000);
+        myAssert(findNextMoveWithLimits(board2, rootIndex2, limits) == 2000);
+        myAssert(board1->currentNodeIndex == board2->currentNodeIndex && rootIndex1 == rootIndex2);
+        myAssert(memcmp(board1->nodes, board2->nodes, board1->currentNodeIndex * sizeof(MCTSNode)) == 0);
+        Square move1 = getMostPromisingMove(board1, &board1->nodes[rootIndex1]);
+        Square move2 = getMostPromisingMove(board2, &board2->nodes[rootIndex2]);
+        myAssert(squaresAreEqual(move1, move2));
+        rootIndex1 = updateRoot(&board1->nodes[rootIndex1], board1, move1);
+        rootIndex2 = updateRoot(&board2->nodes[rootIndex2], board2, move2);
+        makePermanentMove(board1, move1);
+        makePermanentMove(board2, move2);
+    }
+    freeBoard(board1);
+    freeBoard(board2);
+}
+
+
+void nodeLimitStopsSearch() {
+    Board* board = createBoard();
+    playRandomMoves(board, 10);
+    int rootIndex = createMCTSRootNode(board);
+    int nodesBefore = board->currentNodeIndex;
+    SearchLimits limits = {1.0, 0, 5000, false};
+    findNextMoveWithLimits(board, rootIndex, limits);
+    int allocatedNodes = board->currentNodeIndex - nodesBefore;
+    myAssert(allocatedNodes >= 5000 && allocatedNodes < 5000 + TOTAL_SMALL_SQUARES);
+    freeBoard(board);
+}
+
+
+// A search that gets preempted still runs for its whole budget
+void threadCpuTimeLimitCountsOnlyOwnTime() {
+    Board* board = createBoard();
+    int rootIndex = createMCTSRootNode(board);
+    SearchLimits limits = {0.05, 0, 0, true};
+    double start = getThreadCpuTime();
+    findNextMoveWithLimits(board, rootIndex, limits);
+    double elapsedTime = getThreadCpuTime() - start;
+    myAssert(elapsedTime >= 0.05 && elapsedTime < 0.1);
+    freeBoard(board);
+}
+
+
 void runFindNextMoveTests() {
     printf("\tfindNextMoveDoesNotChangeBoard...\n");
     findNextMoveDoesNotChangeBoard();
     printf("\tfindNextMoveUsesAsMuchTimeAsWasGiven...\n");
     findNextMoveUsesAsMuchTimeAsWasGiven();
+    printf("\tpuctSearchPlaysFullGames...\n");
+    puctSearchPlaysFullGames();
+    printf("\tcascadedSearchPlaysFullGames...\n");
+    cascadedSearchPlaysFullGames();
+    printf("\tsingleSimulationExpandsFastNetworkRoot...\n");
+    singleSimulationExpandsFastNetworkRoot();
+    printf("\tfixedSimulationSearchIsDeterministic...\n");
+    fixedSimulationSearchIsDeterministic();
+    printf("\tnodeLimitStopsSearch...\n");
+    nodeLimitStopsSearch();
+    printf("\tthreadCpuTimeLimitCountsOnlyOwnTime...\n");
+    threadCpuTimeLimitCountsOnlyOwnTime();
 }
\ No newline at end of file
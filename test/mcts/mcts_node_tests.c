@@ -1,9 +1,11 @@
 #include <stdio.h>
 #include <math.h>
+#include <stdlib.h>
 #include "mcts_node_tests.h"
 #include "../../src/mcts/mcts_node.h"
 #include "../test_util.h"
 #include "../../src/nn/forward.h"
+#include "../nn/forward_tests.h"
 
 
 void rootIsLeafNode() {
@@ -87,7 +89,7 @@ void optimizedNNEvalTest() {
     for (int i = 0; i < root->numChildren; i++) {
         MCTSNode* child = &board->nodes[root->childrenIndex + i];
         makeTemporaryMove(board, child->square);
-        float expectedEval = neuralNetworkEval(board);
+        float expectedEval = neuralNetworkEval(board->network, board);
         float actualEval = child->eval;
         myAssert(fabsf(expectedEval - actualEval) < 1e-4);
         revertToCheckpoint(board);
@@ -96,6 +98,62 @@ void optimizedNNEvalTest() {
 }
 
 
+void puctChildrenGetPriorsFromOneEval() {
+    Network* network = createRandomNetwork(256, 0, true);
+    srand(9);
+    for (int i = 0; i < 100; i++) {
+        Board* board = createBoard();
+        board->network = network;
+        board->usePUCT = true;
+        playRandomMoves(board, 21 + rand() % 30);
+        if (board->state.winner == NONE) {
+            int rootIndex = createMCTSRootNode(board);
+            discoverChildNodes(rootIndex, board);
+            MCTSNode* root = &board->nodes[rootIndex];
+            float childEval = 1 - neuralNetworkEval(network, board);
+            int priorSum = 0;
+            for (int j = 0; j < root->numChildren; j++) {
+                MCTSNode* child = &board->nodes[root->childrenIndex + j];
+                myAssert(child->prior >= 1);
+                myAssert(child->eval == childEval || child->eval == 0.5f || child->eval == 10000.0f);
+                priorSum += child->prior;
+            }
+            myAssert(abs(priorSum - UINT8_MAX) <= root->numChildren);
+        }
+        freeBoard(board);
+    }
+    freeRandomNetwork(network);
+}
+
+
+void fastNetworkScoresChildrenUntilFirstVisit() {
+    Network* fastNetwork = createRandomNetwork(32, 0, false);
+    Board* board = createBoard();
+    board->fastNetwork = fastNetwork;
+    srand(10);
+    playRandomMoves(board, 25);
+    myAssert(board->state.winner == NONE);
+    int rootIndex = createMCTSRootNode(board);
+    discoverChildNodes(rootIndex, board);
+    MCTSNode* root = &board->nodes[rootIndex];
+    for (int i = 0; i < root->numChildren; i++) {
+        int childIndex = root->childrenIndex + i;
+        MCTSNode* child = &board->nodes[childIndex];
+        makeTemporaryMove(board, child->square);
+        myAssert(child->numChildren == -2);
+        myAssert(child->eval == neuralNetworkEval(fastNetwork, board));
+        expandLeaf(childIndex, board);
+        myAssert(child->numChildren == -1);
+        myAssert(child->eval == neuralNetworkEval(board->network, board));
+        expandLeaf(childIndex, board);
+        myAssert(child->numChildren > 0 || board->state.winner != NONE);
+        revertToCheckpoint(board);
+    }
+    freeBoard(board);
+    freeRandomNetwork(fastNetwork);
+}
+
+
 void runMCTSNodeTests() {
     printf("\trootIsLeafNode...\n");
     rootIsLeafNode();
@@ -109,4 +167,8 @@ void runMCTSNodeTests() {
     alwaysPlays44WhenGoingFirst();
     printf("\toptimizedNNEvalTest...\n");
     optimizedNNEvalTest();
+    printf("\tpuctChildrenGetPriorsFromOneEval...\n");
+    puctChildrenGetPriorsFromOneEval();
+    printf("\tfastNetworkScoresChildrenUntilFirstVisit...\n");
+    fastNetworkScoresChildrenUntilFirstVisit();
 }
\ No newline at end of file
@@ -0,0 +1,71 @@
+#define _POSIX_C_SOURCE 199309L  // nanosleep
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "ponder_tests.h"
+#include "../../src/mcts/ponder.h"
+#include "../../src/handle_turn.h"
+#include "../test_util.h"
+
+
+void waitMilliseconds(int milliseconds) {
+    struct timespec time = {0, milliseconds * 1000000L};
+    nanosleep(&time, NULL);
+}
+
+
+void ponderingGrowsTheTreeWithoutChangingTheBoard() {
+    Board* board = createBoard();
+    HandleTurnResult result = handleTurn(board, createMCTSRootNode(board), 0.01, (Square) {4, 4});
+    State before = board->state;
+    float simsBefore = board->nodes[result.newRootIndex].sims;
+    Ponder ponderer;
+    startPondering(&ponderer, board, result.newRootIndex);
+    waitMilliseconds(20);
+    int amountOfSimulations = stopPondering(&ponderer);
+    myAssert(amountOfSimulations > 0);
+    myAssert(board->nodes[result.newRootIndex].sims >= simsBefore + (float) amountOfSimulations - 1);
+    myAssert(board->state.player1.marks == before.player1.marks && board->state.player2.marks == before.player2.marks);
+    myAssert(board->state.currentBoard == before.currentBoard && board->state.ply == before.ply);
+    freeBoard(board);
+}
+
+
+// The opponent plays random moves, we ponder in between and the pondered subtree becomes the next root
+void ponderedGamesPlayToTheEnd() {
+    srand(15);
+    for (int game = 0; game < 3; game++) {
+        Board* board = createBoard();
+        Board* opponentBoard = createBoard();
+        int rootIndex = createMCTSRootNode(board);
+        Square enemyMove = {9, 9};
+        while (true) {
+            HandleTurnResult result = handleTurn(board, rootIndex, 0.002, enemyMove);
+            rootIndex = result.newRootIndex;
+            makePermanentMove(opponentBoard, result.move);
+            if (board->state.winner != NONE) {
+                break;
+            }
+            Ponder ponderer;
+            startPondering(&ponderer, board, rootIndex);
+            Square moves[TOTAL_SMALL_SQUARES];
+            enemyMove = moves[rand() % generateMoves(opponentBoard, moves)];
+            makePermanentMove(opponentBoard, enemyMove);
+            waitMilliseconds(2);
+            stopPondering(&ponderer);
+            if (opponentBoard->state.winner != NONE) {
+                break;
+            }
+        }
+        freeBoard(board);
+        freeBoard(opponentBoard);
+    }
+}
+
+
+void runPonderTests() {
+    printf("\tponderingGrowsTheTreeWithoutChangingTheBoard...\n");
+    ponderingGrowsTheTreeWithoutChangingTheBoard();
+    printf("\tponderedGamesPlayToTheEnd...\n");
+    ponderedGamesPlayToTheEnd();
+}
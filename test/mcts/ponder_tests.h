@@ -0,0 +1,6 @@
+#ifndef UTTT2_PONDER_TESTS_H
+#define UTTT2_PONDER_TESTS_H
+
+void runPonderTests();
+
+#endif //UTTT2_PONDER_TESTS_H
@@ -0,0 +1,75 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "time_manager_tests.h"
+#include "../../src/mcts/find_next_move.h"
+#include "../test_util.h"
+
+
+void fixedTimeManagerUsesTheBudget() {
+    Board* board = createBoard();
+    int rootIndex = createMCTSRootNode(board);
+    TimeManager timeManager;
+    initializeTimeManager(&timeManager, 0.01, 0, false);
+    while (board->state.winner == NONE) {
+        double timeUsedBefore = timeManager.timeUsed;
+        findNextMoveWithTimeManager(board, rootIndex, &timeManager);
+        double budget = board->state.ply <= 1? 0.1 : 0.01;
+        myAssert(timeManager.timeUsed - timeUsedBefore >= budget);
+        Square move = getMostPromisingMove(board, &board->nodes[rootIndex]);
+        rootIndex = updateRoot(&board->nodes[rootIndex], board, move);
+        makePermanentMove(board, move);
+    }
+    myAssert(timeManager.earlyStops == 0 && timeManager.extensions == 0);
+    freeBoard(board);
+}
+
+
+// With only one legal move nothing can overtake the best child, so the first check stops the search
+void onlyMoveStopsEarly() {
+    srand(14);
+    int positions = 0;
+    while (positions < 5) {
+        Board* board = createBoard();
+        playRandomMoves(board, 20 + rand() % 30);
+        Square moves[TOTAL_SMALL_SQUARES];
+        if (board->state.winner == NONE && generateMoves(board, moves) == 1) {
+            int rootIndex = createMCTSRootNode(board);
+            TimeManager timeManager;
+            initializeTimeManager(&timeManager, 1.0, 0, true);
+            findNextMoveWithTimeManager(board, rootIndex, &timeManager);
+            myAssert(timeManager.earlyStops == 1);
+            myAssert(timeManager.timeUsed < 0.5);
+            positions++;
+        }
+        freeBoard(board);
+    }
+}
+
+
+void timeBankLastsTheWholeGame() {
+    for (int adaptive = 0; adaptive <= 1; adaptive++) {
+        Board* board = createBoard();
+        int rootIndex = createMCTSRootNode(board);
+        TimeManager timeManager;
+        initializeTimeManager(&timeManager, 0, 0.5, adaptive);
+        while (board->state.winner == NONE) {
+            findNextMoveWithTimeManager(board, rootIndex, &timeManager);
+            myAssert(timeManager.timeBank > -0.05);
+            Square move = getMostPromisingMove(board, &board->nodes[rootIndex]);
+            rootIndex = updateRoot(&board->nodes[rootIndex], board, move);
+            makePermanentMove(board, move);
+        }
+        myAssert(timeManager.timeUsed <= 0.55);
+        freeBoard(board);
+    }
+}
+
+
+void runTimeManagerTests() {
+    printf("\tfixedTimeManagerUsesTheBudget...\n");
+    fixedTimeManagerUsesTheBudget();
+    printf("\tonlyMoveStopsEarly...\n");
+    onlyMoveStopsEarly();
+    printf("\ttimeBankLastsTheWholeGame...\n");
+    timeBankLastsTheWholeGame();
+}
@@ -0,0 +1,6 @@
+#ifndef UTTT2_TIME_MANAGER_TESTS_H
+#define UTTT2_TIME_MANAGER_TESTS_H
+
+void runTimeManagerTests();
+
+#endif //UTTT2_TIME_MANAGER_TESTS_H
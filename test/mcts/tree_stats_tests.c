@@ -0,0 +1,57 @@
+#include <stdio.h>
+#include "tree_stats_tests.h"
+#include "../../src/mcts/tree_stats.h"
+#include "../../src/mcts/find_next_move.h"
+#include "../test_util.h"
+
+
+void treeStatsCoverEveryNodeOfAFreshSearch() {
+    Board* board = createBoard();
+    playRandomMoves(board, 10);
+    int rootIndex = createMCTSRootNode(board);
+    SearchLimits limits = {0, 2000, 0, false};
+    findNextMoveWithLimits(board, rootIndex, limits);
+    TreeStats stats;
+    computeTreeStats(board, rootIndex, &stats);
+    // Pruned moves leave their slots allocated but unreachable
+    myAssert(stats.reachableNodes > 1 && stats.reachableNodes <= board->currentNodeIndex);
+    myAssert(stats.depthHistogram[0] == 1);
+    int nodesByDepth = 0;
+    for (int depth = 0; depth <= stats.maxDepth; depth++) {
+        nodesByDepth += stats.depthHistogram[depth];
+    }
+    myAssert(nodesByDepth == stats.reachableNodes);
+    int children = 0;
+    for (int branching = 0; branching <= stats.maxBranching; branching++) {
+        children += branching * stats.branchingHistogram[branching];
+    }
+    myAssert(children == stats.reachableNodes - 1);
+    myAssert(stats.principalVariationLength > 0);
+    myAssert(squaresAreEqual(stats.principalVariation[0], getMostPromisingMove(board, &board->nodes[rootIndex])));
+    myAssert(stats.principalVariationSims[0] <= board->nodes[rootIndex].sims);
+    freeBoard(board);
+}
+
+
+void childrenSplitTheReachableNodes() {
+    Board* board = createBoard();
+    playRandomMoves(board, 20);
+    int rootIndex = createMCTSRootNode(board);
+    SearchLimits limits = {0, 2000, 0, false};
+    findNextMoveWithLimits(board, rootIndex, limits);
+    MCTSNode* root = &board->nodes[rootIndex];
+    int childNodes = 0;
+    for (int i = 0; i < root->numChildren; i++) {
+        childNodes += countReachableNodes(board, root->childrenIndex + i);
+    }
+    myAssert(childNodes == countReachableNodes(board, rootIndex) - 1);
+    freeBoard(board);
+}
+
+
+void runTreeStatsTests() {
+    printf("\ttreeStatsCoverEveryNodeOfAFreshSearch...\n");
+    treeStatsCoverEveryNodeOfAFreshSearch();
+    printf("\tchildrenSplitTheReachableNodes...\n");
+    childrenSplitTheReachableNodes();
+}
@@ -0,0 +1,6 @@
+#ifndef UTTT2_TREE_STATS_TESTS_H
+#define UTTT2_TREE_STATS_TESTS_H
+
+void runTreeStatsTests();
+
+#endif //UTTT2_TREE_STATS_TESTS_H
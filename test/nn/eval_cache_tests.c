@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../test_util.h"
+#include "../../src/nn/eval_cache.h"
+#include "../../src/mcts/find_next_move.h"
+#include "forward_tests.h"
+#include "eval_cache_tests.h"
+
+
+void repeatedEvalsHitCache() {
+    srand(4);
+    for (int i = 0; i < 100; i++) {
+        Board* board = createBoard();
+        board->evalCache = createEvalCache(16);
+        playRandomMoves(board, rand() % 50);
+        Square moves[TOTAL_SMALL_SQUARES];
+        int8_t amountOfMoves = generateMoves(board, moves);
+        for (int j = 0; j < amountOfMoves; j++) {
+            float eval = getEvalOfMove(board, moves[j]);
+            uint64_t probesBefore = board->evalCache->probes;
+            uint64_t hitsBefore = board->evalCache->hits;
+            myAssert(getEvalOfMove(board, moves[j]) == eval);
+            myAssert(board->evalCache->hits - hitsBefore == board->evalCache->probes - probesBefore);
+        }
+        EvalCache* cache = board->evalCache;
+        board->evalCache = NULL;
+        for (int j = 0; j < amountOfMoves; j++) {
+            float eval = getEvalOfMove(board, moves[j]);
+            board->evalCache = cache;
+            myAssert(getEvalOfMove(board, moves[j]) == eval);
+            board->evalCache = NULL;
+        }
+        freeEvalCache(cache);
+        freeBoard(board);
+    }
+}
+
+
+// The cache is meant for searches with a fast network, where every first visit of a child needs a full evaluation.
+// Without verification a hit returns the stored output, which still has to grow the same tree.
+void cacheDoesNotChangeTrees() {
+    Network* fastNetwork = createRandomNetwork(32, 0, false);
+    EvalCache* cache = createEvalCache(DEFAULT_EVAL_CACHE_LOG2_ENTRIES);
+    SearchLimits limits = {0, 2000, 0, false};
+    for (int game = 0; game < 3; game++) {
+        Board* boardWithCache = createBoard();
+        boardWithCache->fastNetwork = fastNetwork;
+        boardWithCache->evalCache = cache;
+        Board* boardWithoutCache = createBoard();
+        boardWithoutCache->fastNetwork = fastNetwork;
+        int rootIndex = createMCTSRootNode(boardWithCache);
+        myAssert(createMCTSRootNode(boardWithoutCache) == rootIndex);
+        while (boardWithCache->state.winner == NONE) {
+            findNextMoveWithLimits(boardWithCache, rootIndex, limits);
+            findNextMoveWithLimits(boardWithoutCache, rootIndex, limits);
+            myAssert(boardWithCache->currentNodeIndex == boardWithoutCache->currentNodeIndex);
+            myAssert(memcmp(boardWithCache->nodes, boardWithoutCache->nodes,
+                            boardWithCache->currentNodeIndex * sizeof(MCTSNode)) == 0);
+            Square move = getMostPromisingMove(boardWithCache, &boardWithCache->nodes[rootIndex]);
+            int newRootIndex = updateRoot(&boardWithCache->nodes[rootIndex], boardWithCache, move);
+            myAssert(updateRoot(&boardWithoutCache->nodes[rootIndex], boardWithoutCache, move) == newRootIndex);
+            rootIndex = newRootIndex;
+            makePermanentMove(boardWithCache, move);
+            makePermanentMove(boardWithoutCache, move);
+        }
+        freeBoard(boardWithCache);
+        freeBoard(boardWithoutCache);
+    }
+    myAssert(cache->hits > 0);
+    printf("\t\t%llu probes, hit rate %.2f%%\n", (unsigned long long) cache->probes, 100*evalCacheHitRate(cache));
+    freeEvalCache(cache);
+    freeRandomNetwork(fastNetwork);
+}
+
+
+void cacheIsClearedForOtherNetwork() {
+    Board* board = createBoard();
+    board->evalCache = createEvalCache(16);
+    Square move = {4, 4};
+    float defaultEval = getEvalOfMove(board, move);
+    Network modified = defaultNetwork;
+    modified.outputBias += 0.25f;
+    board->network = &modified;
+    myAssert(getEvalOfMove(board, move) != defaultEval);
+    myAssert(board->evalCache->hits == 0);
+    freeEvalCache(board->evalCache);
+    freeBoard(board);
+}
+
+
+void runEvalCacheTests() {
+    printf("\trepeatedEvalsHitCache...\n");
+    repeatedEvalsHitCache();
+    printf("\tcacheDoesNotChangeTrees...\n");
+    cacheDoesNotChangeTrees();
+    printf("\tcacheIsClearedForOtherNetwork...\n");
+    cacheIsClearedForOtherNetwork();
+}
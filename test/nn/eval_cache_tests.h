@@ -0,0 +1,6 @@
+#ifndef UTTT2_EVAL_CACHE_TESTS_H
+#define UTTT2_EVAL_CACHE_TESTS_H
+
+void runEvalCacheTests();
+
+#endif //UTTT2_EVAL_CACHE_TESTS_H
@@ -1,11 +1,207 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "../test_util.h"
 #include "../../src/nn/forward.h"
+#include "../../src/mcts/mcts_node.h"
 #include "forward_tests.h"
 
 
+void* alignedRandomArray(size_t amount, size_t size, int smallest, int largest) {
+    size_t bytes = (amount * size + 31) / 32 * 32;
+    uint8_t* array = aligned_alloc(32, bytes);
+    for (size_t i = 0; i < amount; i++) {
+        int value = smallest + rand() % (largest - smallest + 1);
+        if (size == 1) {
+            ((int8_t*) array)[i] = (int8_t) value;
+        } else if (size == 2) {
+            ((int16_t*) array)[i] = (int16_t) value;
+        } else {
+            ((int32_t*) array)[i] = value;
+        }
+    }
+    return array;
+}
+
+
+Network* createRandomNetwork(int hiddenNeurons, int hidden2Neurons, bool policy) {
+    Network* network = malloc(sizeof(Network));
+    int paddedHidden = PADDED_NEURONS(hiddenNeurons);
+    network->hiddenNeurons = hiddenNeurons;
+    network->hidden2Neurons = hidden2Neurons;
+    network->hiddenWeights = alignedRandomArray(INPUT_NEURONS * hiddenNeurons, sizeof(HiddenWeight), -64, 64);
+    network->hiddenBiases = alignedRandomArray(hiddenNeurons, sizeof(int16_t), -100, 0);
+    network->hidden2Weights = hidden2Neurons == 0? NULL : alignedRandomArray(hidden2Neurons * paddedHidden, 1, -64, 64);
+    network->hidden2Biases = hidden2Neurons == 0? NULL : alignedRandomArray(hidden2Neurons, sizeof(int32_t), -2000, 2000);
+    network->outputWeights = alignedRandomArray(hidden2Neurons == 0? paddedHidden : hidden2Neurons, 1, -64, 64);
+    network->outputBias = (float) (rand() % 100 - 50) / 1000;
+    network->policyWeights = policy? alignedRandomArray(POLICY_OUTPUTS * paddedHidden, 1, -64, 64) : NULL;
+    network->policyBiases = policy? alignedRandomArray(POLICY_OUTPUTS, sizeof(int32_t), -2000, 2000) : NULL;
+    network->mapping = NULL;
+    network->mappingSize = 0;
+    return network;
+}
+
+
+void freeRandomNetwork(Network* network) {
+    free((void*) network->hiddenWeights);
+    free((void*) network->hiddenBiases);
+    free((void*) network->hidden2Weights);
+    free((void*) network->hidden2Biases);
+    free((void*) network->outputWeights);
+    free((void*) network->policyWeights);
+    free((void*) network->policyBiases);
+    free(network);
+}
+
+
+int addPlayerFeatures(PlayerBitBoard* playerBitBoard, int bigBoardOffset, int smallBoardOffset, int* features) {
+    int amount = 0;
+    for (int i = 0; i < 9; i++) {
+        if (playerBitBoard->bigBoard & (1 << i)) {
+            features[amount++] = i + bigBoardOffset;
+        }
+    }
+    for (int i = 0; i < TOTAL_SMALL_SQUARES; i++) {
+        if ((playerBitBoard->marks >> i) & 1) {
+            features[amount++] = i + smallBoardOffset;
+        }
+    }
+    return amount;
+}
+
+
+// Clipped ReLU outputs of the first hidden layer, in packed order
+void referenceActivations(const Network* network, Board* board, int* activations) {
+    int features[200];
+    PlayerBitBoard* p1 = &board->state.player1;
+    int amount = addPlayerFeatures(p1 + board->state.currentPlayer, 0, 9, features);
+    amount += addPlayerFeatures(p1 + !board->state.currentPlayer, 90, 99, &features[amount]);
+    features[amount++] = board->state.currentBoard + 180;
+    memset(activations, 0, MAX_HIDDEN_NEURONS * sizeof(int));
+    for (int neuron = 0; neuron < network->hiddenNeurons; neuron++) {
+        int hidden = network->hiddenBiases[neuron];
+        for (int i = 0; i < amount; i++) {
+            hidden += network->hiddenWeights[features[i] * network->hiddenNeurons + neuron];
+        }
+#ifdef INT8_HIDDEN_WEIGHTS
+        hidden *= 2;
+#endif
+        activations[toPackedOrder(neuron)] = hidden < 0? 0 : hidden > 127? 127 : hidden;
+    }
+}
+
+
+// Compared before the conversion to an eval, which the compiler may contract into a different float expression in
+// every place it gets inlined
+int32_t referenceNeuralNetworkOutput(const Network* network, Board* board) {
+    int paddedHidden = PADDED_NEURONS(network->hiddenNeurons);
+    int activations[MAX_HIDDEN_NEURONS];
+    referenceActivations(network, board, activations);
+    int output = 0;
+    if (network->hidden2Neurons == 0) {
+        for (int i = 0; i < paddedHidden; i++) {
+            output += activations[i] * network->outputWeights[i];
+        }
+    }
+    for (int neuron = 0; neuron < network->hidden2Neurons; neuron++) {
+        int hidden2 = network->hidden2Biases[neuron];
+        for (int i = 0; i < paddedHidden; i++) {
+            hidden2 += activations[i] * network->hidden2Weights[neuron * paddedHidden + i];
+        }
+        hidden2 >>= 6;
+        output += (hidden2 < 0? 0 : hidden2 > 127? 127 : hidden2) * network->outputWeights[neuron];
+    }
+    return output;
+}
+
+
+void simdEvalMatchesReference(const Network* network) {
+    Board* board = createBoard();
+    board->network = network;
+    srand(7);
+    for (int i = 0; i < 2000; i++) {
+        Square moves[TOTAL_SMALL_SQUARES];
+        int8_t amountOfMoves = generateMoves(board, moves);
+        if (amountOfMoves == 0) {
+            freeBoard(board);
+            board = createBoard();
+            board->network = network;
+            amountOfMoves = generateMoves(board, moves);
+        }
+        makePermanentMove(board, moves[rand() % amountOfMoves]);
+        myAssert(neuralNetworkOutput(network, board) == referenceNeuralNetworkOutput(network, board));
+    }
+    freeBoard(board);
+}
+
+
+void policyMatchesReference(const Network* network) {
+    Board* board = createBoard();
+    srand(8);
+    int paddedHidden = PADDED_NEURONS(network->hiddenNeurons);
+    for (int i = 0; i < 500; i++) {
+        Square moves[TOTAL_SMALL_SQUARES];
+        int8_t amountOfMoves = generateMoves(board, moves);
+        if (amountOfMoves == 0) {
+            freeBoard(board);
+            board = createBoard();
+            amountOfMoves = generateMoves(board, moves);
+        }
+        int32_t logits[TOTAL_SMALL_SQUARES];
+        int32_t output = neuralNetworkOutputWithPolicy(network, board, moves, amountOfMoves, logits);
+        myAssert(output == neuralNetworkOutput(network, board));
+        int activations[MAX_HIDDEN_NEURONS];
+        referenceActivations(network, board, activations);
+        for (int j = 0; j < amountOfMoves; j++) {
+            int move = 9*moves[j].board + moves[j].position;
+            int32_t logit = network->policyBiases[move];
+            for (int k = 0; k < paddedHidden; k++) {
+                logit += activations[k] * network->policyWeights[move * paddedHidden + k];
+            }
+            myAssert(logits[j] == logit);
+        }
+        makePermanentMove(board, moves[rand() % amountOfMoves]);
+    }
+    freeBoard(board);
+}
+
+
+void incrementalEvalMatchesFullEval(const Network* network) {
+    Board* board = createBoard();
+    board->network = network;
+    int rootIndex = createMCTSRootNode(board);
+    discoverChildNodes(rootIndex, board);
+    MCTSNode* root = &board->nodes[rootIndex];
+    for (int i = 0; i < root->numChildren; i++) {
+        MCTSNode* child = &board->nodes[root->childrenIndex + i];
+        makeTemporaryMove(board, child->square);
+        myAssert(neuralNetworkEval(network, board) == child->eval);
+        revertToCheckpoint(board);
+    }
+    freeBoard(board);
+}
+
+
+void allNetworkSizesMatchReference() {
+    const int sizes[][2] = {{32, 0}, {64, 32}, {128, 0}, {128, 32}, {512, 0}, {1024, 16}};
+    for (int i = 0; i < (int) (sizeof(sizes) / sizeof(sizes[0])); i++) {
+        srand(i);
+        Network* network = createRandomNetwork(sizes[i][0], sizes[i][1], true);
+        simdEvalMatchesReference(network);
+        incrementalEvalMatchesFullEval(network);
+        policyMatchesReference(network);
+        freeRandomNetwork(network);
+    }
+}
+
+
 void runForwardTests() {
     Board* board = createBoard();
-    printf("Eval: %f\n", neuralNetworkEval(board));
+    printf("Eval: %f\n", neuralNetworkEval(board->network, board));
     freeBoard(board);
+    printf("\tsimdEvalMatchesReference...\n");
+    simdEvalMatchesReference(&defaultNetwork);
+    printf("\tallNetworkSizesMatchReference...\n");
+    allNetworkSizesMatchReference();
 }
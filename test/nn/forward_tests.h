@@ -1,6 +1,12 @@
 #ifndef UTTT2_FORWARD_TESTS_H
 #define UTTT2_FORWARD_TESTS_H
 
+#include "../../src/nn/network.h"
+
+Network* createRandomNetwork(int hiddenNeurons, int hidden2Neurons, bool policy);
+
+void freeRandomNetwork(Network* network);
+
 void runForwardTests();
 
 #endif //UTTT2_FORWARD_TESTS_H
@@ -0,0 +1,74 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../test_util.h"
+#include "../../src/nn/forward.h"
+#include "network_tests.h"
+#include "forward_tests.h"
+
+#define TEST_NETWORK_FILENAME "/tmp/uttt2_network_tests.bin"
+
+
+void savedNetworkEvaluatesIdentically(const Network* savedNetwork) {
+    myAssert(saveNetwork(savedNetwork, TEST_NETWORK_FILENAME));
+    Network* network = loadNetwork(TEST_NETWORK_FILENAME);
+    myAssert(network != NULL);
+    myAssert(network->hiddenNeurons == savedNetwork->hiddenNeurons);
+    myAssert(network->hidden2Neurons == savedNetwork->hidden2Neurons);
+    myAssert((network->policyWeights == NULL) == (savedNetwork->policyWeights == NULL));
+    srand(3);
+    for (int i = 0; i < 100; i++) {
+        Board* board = createBoard();
+        playRandomMoves(board, rand() % 40);
+        myAssert(neuralNetworkEval(network, board) == neuralNetworkEval(savedNetwork, board));
+        if (savedNetwork->policyWeights != NULL) {
+            Square moves[TOTAL_SMALL_SQUARES];
+            int8_t amountOfMoves = generateMoves(board, moves);
+            int32_t logits[TOTAL_SMALL_SQUARES];
+            int32_t savedLogits[TOTAL_SMALL_SQUARES];
+            neuralNetworkOutputWithPolicy(network, board, moves, amountOfMoves, logits);
+            neuralNetworkOutputWithPolicy(savedNetwork, board, moves, amountOfMoves, savedLogits);
+            myAssert(memcmp(logits, savedLogits, amountOfMoves * sizeof(int32_t)) == 0);
+        }
+        freeBoard(board);
+    }
+    freeNetwork(network);
+    remove(TEST_NETWORK_FILENAME);
+}
+
+
+void corruptNetworkIsRejected() {
+    myAssert(saveNetwork(&defaultNetwork, TEST_NETWORK_FILENAME));
+    FILE* file = fopen(TEST_NETWORK_FILENAME, "r+b");
+    fseek(file, sizeof(NetworkFileHeader) + 1000, SEEK_SET);
+    fputc(fgetc(file) ^ 1, file);
+    fclose(file);
+    myAssert(loadNetwork(TEST_NETWORK_FILENAME) == NULL);
+    remove(TEST_NETWORK_FILENAME);
+    myAssert(loadNetwork(TEST_NETWORK_FILENAME) == NULL);
+}
+
+
+void twoNetworksCoexist() {
+    Network modified = defaultNetwork;
+    modified.outputBias += 0.25f;
+    Board* board = createBoard();
+    float defaultEval = neuralNetworkEval(&defaultNetwork, board);
+    float modifiedEval = neuralNetworkEval(&modified, board);
+    myAssert(modifiedEval > defaultEval);
+    myAssert(neuralNetworkEval(&defaultNetwork, board) == defaultEval);
+    freeBoard(board);
+}
+
+
+void runNetworkTests() {
+    printf("\tsavedNetworkEvaluatesIdentically...\n");
+    savedNetworkEvaluatesIdentically(&defaultNetwork);
+    Network* network = createRandomNetwork(128, 32, true);
+    savedNetworkEvaluatesIdentically(network);
+    freeRandomNetwork(network);
+    printf("\tcorruptNetworkIsRejected...\n");
+    corruptNetworkIsRejected();
+    printf("\ttwoNetworksCoexist...\n");
+    twoNetworksCoexist();
+}
@@ -0,0 +1,6 @@
+#ifndef UTTT2_NETWORK_TESTS_H
+#define UTTT2_NETWORK_TESTS_H
+
+void runNetworkTests();
+
+#endif //UTTT2_NETWORK_TESTS_H
@@ -1,6 +1,15 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <x86intrin.h>
 #include "profile_simulations.h"
 #include "../src/handle_turn.h"
+#include "../src/nn/forward.h"
+#include "../src/board/symmetry.h"
+#include "../src/misc/timer.h"
+#include "../src/misc/perf_counters.h"
+#include "nn/forward_tests.h"
+#include "test_util.h"
 
 
 void profileSimulations() {
@@ -18,3 +27,232 @@ void profileSimulations() {
     }
     printf("Amount of simulations on second move: %d\n", totalSims / runs);
 }
+
+
+// Same random network for both schemes, so this compares the search cost, not move quality
+void profileSimulationsPUCT() {
+    Network* network = createRandomNetwork(256, 0, true);
+    for (int usePUCT = 0; usePUCT <= 1; usePUCT++) {
+        const int runs = 20;
+        int totalSims = 0;
+        int totalNodes = 0;
+        for (int i = 0; i < runs; i++) {
+            Board* board = createBoard();
+            board->network = network;
+            board->usePUCT = usePUCT;
+            int rootIndex = createMCTSRootNode(board);
+            Square square = {1, 0};
+            discoverChildNodes(rootIndex, board);
+            rootIndex = updateRoot(&board->nodes[rootIndex], board, square);
+            makePermanentMove(board, square);
+            int nodesBefore = board->currentNodeIndex;
+            totalSims += findNextMove(board, rootIndex, 0.1);
+            totalNodes += board->currentNodeIndex - nodesBefore;
+            freeBoard(board);
+        }
+        // Value mode runs the network once per child, PUCT once per expanded node
+        printf("%s: %d simulations on second move, %.1f network evaluations per simulation\n",
+               usePUCT? "PUCT" : "Value per child", totalSims / runs,
+               usePUCT? 1.0 : (double) totalNodes / totalSims);
+    }
+    freeRandomNetwork(network);
+}
+
+
+// The random fast network only shows the speed side of the trade-off, the arena measures strength
+void profileSimulationsFastNetwork() {
+    Network* fastNetwork = createRandomNetwork(32, 0, false);
+    for (int useFastNetwork = 0; useFastNetwork <= 1; useFastNetwork++) {
+        const int runs = 20;
+        int totalSims = 0;
+        for (int i = 0; i < runs; i++) {
+            Board* board = createBoard();
+            board->fastNetwork = useFastNetwork? fastNetwork : NULL;
+            int rootIndex = createMCTSRootNode(board);
+            Square square = {1, 0};
+            discoverChildNodes(rootIndex, board);
+            rootIndex = updateRoot(&board->nodes[rootIndex], board, square);
+            makePermanentMove(board, square);
+            totalSims += findNextMove(board, rootIndex, 0.1);
+            freeBoard(board);
+        }
+        printf("%s: %d simulations on second move\n", useFastNetwork? "32-wide fast network" : "Full network only",
+               totalSims / runs);
+    }
+    freeRandomNetwork(fastNetwork);
+}
+
+
+void profileNetworkEvaluations(const Network* network) {
+    const int amountOfPositions = 1000;
+    const int runs = 1000;
+    State* positions = malloc(amountOfPositions * sizeof(State));
+    Board* board = createBoard();
+    board->network = network;
+    srand(42);
+    for (int i = 0; i < amountOfPositions; i++) {
+        Square moves[TOTAL_SMALL_SQUARES];
+        int8_t amountOfMoves = generateMoves(board, moves);
+        if (amountOfMoves == 0) {
+            freeBoard(board);
+            board = createBoard();
+            board->network = network;
+            amountOfMoves = generateMoves(board, moves);
+        }
+        makePermanentMove(board, moves[rand() % amountOfMoves]);
+        positions[i] = board->state;
+    }
+    struct timeval start, end;
+    gettimeofday(&start, NULL);
+    uint64_t startCycles = __rdtsc();
+    float evalSum = 0.0f;
+    for (int run = 0; run < runs; run++) {
+        for (int i = 0; i < amountOfPositions; i++) {
+            board->state = positions[i];
+            evalSum += neuralNetworkEval(board->network, board);
+        }
+    }
+    uint64_t cycles = __rdtsc() - startCycles;
+    gettimeofday(&end, NULL);
+    double elapsedTime = (double) (end.tv_sec - start.tv_sec) + (double) (end.tv_usec - start.tv_usec) / 1000000;
+    printf("%dx%d evaluations per second: %.0f, %.1f cycles per evaluation (checksum %f)\n",
+           network->hiddenNeurons, network->hidden2Neurons, runs * amountOfPositions / elapsedTime,
+           (double) cycles / (runs * amountOfPositions), evalSum);
+    freeBoard(board);
+    free(positions);
+}
+
+
+void profileEvaluations() {
+    profileNetworkEvaluations(&defaultNetwork);
+    const int sizes[][2] = {{128, 0}, {256, 32}, {512, 0}, {1024, 0}};
+    for (int i = 0; i < (int) (sizeof(sizes) / sizeof(sizes[0])); i++) {
+        Network* network = createRandomNetwork(sizes[i][0], sizes[i][1], false);
+        profileNetworkEvaluations(network);
+        freeRandomNetwork(network);
+    }
+}
+
+
+void profileSymmetries() {
+    const int amountOfPositions = 1000;
+    const int runs = 1000;
+    State* positions = malloc(amountOfPositions * sizeof(State));
+    srand(43);
+    for (int i = 0; i < amountOfPositions; i++) {
+        Board* board = createBoard();
+        playRandomMoves(board, rand() % 60);
+        positions[i] = board->state;
+        freeBoard(board);
+    }
+    struct timeval start, end;
+    gettimeofday(&start, NULL);
+    uint64_t checksum = 0;
+    for (int run = 0; run < runs; run++) {
+        for (int i = 0; i < amountOfPositions; i++) {
+            State transformed = transformState(&positions[i], run % SYMMETRIES);
+            checksum += (uint64_t) transformed.player1.marks ^ transformed.player2.bigBoard;
+        }
+    }
+    gettimeofday(&end, NULL);
+    double transformTime = (double) (end.tv_sec - start.tv_sec) + (double) (end.tv_usec - start.tv_usec) / 1000000;
+    gettimeofday(&start, NULL);
+    for (int run = 0; run < runs; run++) {
+        for (int i = 0; i < amountOfPositions; i++) {
+            int transform;
+            checksum += canonicalKey(&positions[i], &transform) + transform;
+        }
+    }
+    gettimeofday(&end, NULL);
+    double canonicalTime = (double) (end.tv_sec - start.tv_sec) + (double) (end.tv_usec - start.tv_usec) / 1000000;
+    printf("State transforms per second: %.0f, canonical keys per second: %.0f (checksum %llu)\n",
+           runs * amountOfPositions / transformTime, runs * amountOfPositions / canonicalTime,
+           (unsigned long long) checksum);
+    free(positions);
+}
+
+
+// The deadline check findNextMove used before: wall clock time, looked at every 512 simulations
+void searchWithWallClock(Board* board, int rootIndex, double allocatedTime) {
+    struct timeval start, now;
+    gettimeofday(&start, NULL);
+    int amountOfSimulations = 0;
+    while (true) {
+        runSimulation(board, rootIndex);
+        if (++amountOfSimulations % 512 == 0) {
+            gettimeofday(&now, NULL);
+            if ((double) (now.tv_sec - start.tv_sec) + (double) (now.tv_usec - start.tv_usec) / 1000000 >= allocatedTime) {
+                return;
+            }
+        }
+    }
+}
+
+
+int compareDoubles(const void* a, const void* b) {
+    double difference = *(const double*) a - *(const double*) b;
+    return (difference > 0) - (difference < 0);
+}
+
+
+void profileDeadlines() {
+    const double budgets[] = {0.001, 0.01, 0.05};
+    const int runs[] = {200, 50, 20};
+    for (int i = 0; i < 3; i++) {
+        for (int useDeadline = 0; useDeadline <= 1; useDeadline++) {
+            double* overruns = malloc(runs[i] * sizeof(double));
+            for (int run = 0; run < runs[i]; run++) {
+                Board* board = createBoard();
+                int rootIndex = createMCTSRootNode(board);
+                Square square = {1, 0};
+                discoverChildNodes(rootIndex, board);
+                rootIndex = updateRoot(&board->nodes[rootIndex], board, square);
+                makePermanentMove(board, square);
+                double start = getMonotonicTime();
+                if (useDeadline) {
+                    findNextMove(board, rootIndex, budgets[i]);
+                } else {
+                    searchWithWallClock(board, rootIndex, budgets[i]);
+                }
+                overruns[run] = getMonotonicTime() - start - budgets[i];
+                freeBoard(board);
+            }
+            qsort(overruns, runs[i], sizeof(double), compareDoubles);
+            printf("%4.0fms budget, %-32s overrun p50 %.3fms, p99 %.3fms, max %.3fms\n", 1000 * budgets[i],
+                   useDeadline? "deadline every simulation:" : "wall clock per 512 simulations:",
+                   1000 * overruns[runs[i] / 2], 1000 * overruns[runs[i] * 99 / 100], 1000 * overruns[runs[i] - 1]);
+            free(overruns);
+        }
+    }
+}
+
+
+// Counter deltas of every search in a self-play game, per simulation
+void profilePerfCounters() {
+    PerfCounters counters;
+    if (!openPerfCounters(&counters)) {
+        printf("Hardware performance counters are not available%s\n",
+               perfEventIsAvailable(&counters, PERF_TASK_CLOCK)? ", only the task clock is counted" : "");
+        if (!perfEventIsAvailable(&counters, PERF_TASK_CLOCK)) {
+            return;
+        }
+    }
+    Board* board = createBoard();
+    int rootIndex = createMCTSRootNode(board);
+    int totalSims = 0;
+    while (board->state.winner == NONE) {
+        startPerfMeasurement(&counters);
+        int sims = findNextMove(board, rootIndex, 0.02);
+        stopPerfMeasurement(&counters);
+        totalSims += sims;
+        printf("Move %2d, %5d simulations, per simulation: ", board->state.ply, sims);
+        printPerfDeltas(stdout, &counters, counters.last, sims);
+        Square move = getMostPromisingMove(board, &board->nodes[rootIndex]);
+        rootIndex = updateRoot(&board->nodes[rootIndex], board, move);
+        makePermanentMove(board, move);
+    }
+    printf("All %d moves, per simulation: ", counters.measurements);
+    printPerfDeltas(stdout, &counters, counters.totals, totalSims);
+    freeBoard(board);
+    closePerfCounters(&counters);
+}
@@ -3,4 +3,16 @@
 
 void profileSimulations();
 
+void profileSimulationsPUCT();
+
+void profileSimulationsFastNetwork();
+
+void profileEvaluations();
+
+void profileSymmetries();
+
+void profileDeadlines();
+
+void profilePerfCounters();
+
 #endif //UTTT2_PROFILE_SIMULATIONS_H
@@ -8,4 +8,13 @@ void myAssert(bool condition) {
         fprintf(stderr, "Assertion failed\n");
         exit(1);
     }
-}
\ No newline at end of file
+}
+
+
+void playRandomMoves(Board* board, int amount) {
+    for (int i = 0; i < amount && board->state.winner == NONE; i++) {
+        Square moves[TOTAL_SMALL_SQUARES];
+        int8_t amountOfMoves = generateMoves(board, moves);
+        makePermanentMove(board, moves[rand() % amountOfMoves]);
+    }
+}
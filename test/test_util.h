@@ -2,7 +2,10 @@
 #define UTTT2_TEST_UTIL_H
 
 #include <stdbool.h>
+#include "../src/board/board.h"
 
 void myAssert(bool condition);
 
+void playRandomMoves(Board* board, int amount);
+
 #endif //UTTT2_TEST_UTIL_H
@@ -2,10 +2,21 @@
 #include "tests_main.h"
 #include "board/board_tests.h"
 #include "board/player_bitboard_tests.h"
+#include "board/symmetry_tests.h"
+#include "board/dead_boards_tests.h"
 #include "mcts/mcts_node_tests.h"
 #include "mcts/find_next_move_tests.h"
+#include "mcts/time_manager_tests.h"
+#include "mcts/ponder_tests.h"
+#include "mcts/tree_stats_tests.h"
+#include "arena/elo_tests.h"
+#include "arena/engine_tests.h"
+#include "arena/process_engine_tests.h"
+#include "arena/tournament_tests.h"
 #include "profile_simulations.h"
 #include "nn/forward_tests.h"
+#include "nn/network_tests.h"
+#include "nn/eval_cache_tests.h"
 
 
 void runTests() {
@@ -13,12 +24,46 @@ void runTests() {
     runPlayerBitBoardTests();
     printf("Forward tests...\n");
     runForwardTests();
+    printf("Network tests...\n");
+    runNetworkTests();
+    printf("EvalCache tests...\n");
+    runEvalCacheTests();
     printf("Board tests...\n");
     runBoardTests();
+    printf("Symmetry tests...\n");
+    runSymmetryTests();
+    printf("DeadBoards tests...\n");
+    runDeadBoardsTests();
     printf("MCTSNode tests...\n");
     runMCTSNodeTests();
     printf("FindNextMove tests...\n");
     runFindNextMoveTests();
+    printf("TimeManager tests...\n");
+    runTimeManagerTests();
+    printf("Ponder tests...\n");
+    runPonderTests();
+    printf("TreeStats tests...\n");
+    runTreeStatsTests();
+    printf("Elo tests...\n");
+    runEloTests();
+    printf("Engine tests...\n");
+    runEngineTests();
+    printf("ProcessEngine tests...\n");
+    runProcessEngineTests();
+    printf("Tournament tests...\n");
+    runTournamentTests();
     printf("Profile simulations...\n");
     profileSimulations();
+    printf("Profile PUCT simulations...\n");
+    profileSimulationsPUCT();
+    printf("Profile fast network simulations...\n");
+    profileSimulationsFastNetwork();
+    printf("Profile evaluations...\n");
+    profileEvaluations();
+    printf("Profile symmetries...\n");
+    profileSymmetries();
+    printf("Profile deadlines...\n");
+    profileDeadlines();
+    printf("Profile performance counters...\n");
+    profilePerfCounters();
 }
\ No newline at end of file